@@ -69,6 +69,13 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpEdge)
    SCIP_Real efficacyweight;
    SCIP_Real objparalweight;
    SCIP_Real intsuppweight;
+   SCIP_Real forward01;                      /* LP values of the edge variables of a triangle */
+   SCIP_Real forward02;
+   SCIP_Real forward10;
+   SCIP_Real forward20;
+   SCIP_Real incluster01;
+   SCIP_Real incluster02;
+   SCIP_Real incluster12;
    int* succs1;                              /* successors of first state */
    int* succs2;                              /* successors of second state */
    int nstates;                              /* number of states */
@@ -142,94 +149,98 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpEdge)
             {
                states[2] = succs2[k];
 
+               /* all inequalities below need pairwise different states with states[1] > states[2]; check this before
+                * looking up the edges
+                */
+               if( states[0] == states[1] || states[0] == states[2] || states[1] <= states[2] )
+                  continue;
+
                if( !edgesExist(edgevars, states, 3) )
                   continue;
 
-               if( (states[0] != states[1] && states[0] != states[2] && states[1] > states[2]) )
+               /* get the LP values of the edges of the triangle only once instead of for each position of the minus sign */
+               forward01 = SCIPvarGetLPSol(getEdgevar(edgevars, states[0], states[1], 1));
+               forward02 = SCIPvarGetLPSol(getEdgevar(edgevars, states[0], states[2], 1));
+               forward10 = SCIPvarGetLPSol(getEdgevar(edgevars, states[1], states[0], 1));
+               forward20 = SCIPvarGetLPSol(getEdgevar(edgevars, states[2], states[0], 1));
+               incluster12 = SCIPvarGetLPSol(getEdgevar(edgevars, states[1], states[2], 0));
+
+               /* permute the minus sign */
+               for( l = 0; l < 3 ; ++l )
                {
-                  /* permute the minus sign */
-                  for( l = 0; l < 3 ; ++l )
+                  violation[ncutscreated] = sign[l][0] * forward01;
+                  violation[ncutscreated] += sign[l][1] * forward02;
+                  violation[ncutscreated] += sign[l][2] * incluster12 - 1;
+
+                  if( violation[ncutscreated] > 0 )
                   {
-                     violation[ncutscreated] = sign[l][0]
-                        * SCIPvarGetLPSol(getEdgevar(edgevars, states[0], states[1], 1));
-                     violation[ncutscreated] += sign[l][1]
-                        * SCIPvarGetLPSol(getEdgevar(edgevars, states[0], states[2], 1));
-                     violation[ncutscreated] += sign[l][2]
-                        * SCIPvarGetLPSol(getEdgevar(edgevars, states[1], states[2], 0)) - 1;
+                     (void)SCIPsnprintf(cutname, SCIP_MAXSTRLEN, "trianglefw_%d_%d_%d_%d", states[0], states[1], states[2], l );
+                     SCIP_CALL( SCIPcreateEmptyRowSepa(scip, &(cuts[ncutscreated]), sepa, cutname,
+                        -SCIPinfinity(scip), 1.0, FALSE, FALSE, TRUE) );
 
-                     if( violation[ncutscreated] > 0 )
-                     {
-                        (void)SCIPsnprintf(cutname, SCIP_MAXSTRLEN, "trianglefw_%d_%d_%d_%d", states[0], states[1], states[2], l );
-                        SCIP_CALL( SCIPcreateEmptyRowSepa(scip, &(cuts[ncutscreated]), sepa, cutname,
-                           -SCIPinfinity(scip), 1.0, FALSE, FALSE, TRUE) );
+                     SCIP_CALL( SCIPcacheRowExtensions(scip, cuts[ncutscreated]) );
 
-                        SCIP_CALL( SCIPcacheRowExtensions(scip, cuts[ncutscreated]) );
+                     SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
+                        getEdgevar(edgevars, states[1], states[2], 0), sign[l][2]) );
+                     SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
+                        getEdgevar(edgevars, states[0], states[1], 1), sign[l][0]) );
+                     SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
+                        getEdgevar(edgevars, states[0], states[2], 1), sign[l][1]) );
 
-                        SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
-                           getEdgevar(edgevars, states[1], states[2], 0), sign[l][2]) );
-                        SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
-                           getEdgevar(edgevars, states[0], states[1], 1), sign[l][0]) );
-                        SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
-                           getEdgevar(edgevars, states[0], states[2], 1), sign[l][1]) );
-
-                        SCIP_CALL( SCIPflushRowExtensions(scip, cuts[ncutscreated]) );
-
-                        if( ncutscreated >= size - 1 )
-                        {
-                           SCIP_CALL( SCIPreallocBufferArray(scip, &violation, (int) (size + MAXCUTS)) );
-                           SCIP_CALL( SCIPreallocBufferArray(scip, &cuts, (int) (size + MAXCUTS)) );
-                           size += MAXCUTS;
-                        }
+                     SCIP_CALL( SCIPflushRowExtensions(scip, cuts[ncutscreated]) );
 
-                        ncutscreated++;
+                     if( ncutscreated >= size - 1 )
+                     {
+                        SCIP_CALL( SCIPreallocBufferArray(scip, &violation, (int) (size + MAXCUTS)) );
+                        SCIP_CALL( SCIPreallocBufferArray(scip, &cuts, (int) (size + MAXCUTS)) );
+                        size += MAXCUTS;
                      }
 
-                     violation[ncutscreated] = sign[l][0]
-                        * SCIPvarGetLPSol(getEdgevar(edgevars, states[1], states[0], 1));
-                     violation[ncutscreated] += sign[l][1]
-                        * SCIPvarGetLPSol(getEdgevar(edgevars, states[2], states[0], 1));
-                     violation[ncutscreated] += sign[l][2]
-                        * SCIPvarGetLPSol(getEdgevar(edgevars, states[1], states[2], 0)) - 1;
+                     ncutscreated++;
+                  }
 
-                     if( violation[ncutscreated] > 0)
-                     {
-                        (void)SCIPsnprintf(cutname, SCIP_MAXSTRLEN, "trianglebw_%d_%d_%d_%d", states[0], states[1], states[2], l );
-                        SCIP_CALL( SCIPcreateEmptyRowSepa(scip, &(cuts[ncutscreated]), sepa, cutname,
-                           -SCIPinfinity(scip), 1.0, FALSE, FALSE, TRUE) );
+                  violation[ncutscreated] = sign[l][0] * forward10;
+                  violation[ncutscreated] += sign[l][1] * forward20;
+                  violation[ncutscreated] += sign[l][2] * incluster12 - 1;
 
-                        SCIP_CALL( SCIPcacheRowExtensions(scip, cuts[ncutscreated]) );
+                  if( violation[ncutscreated] > 0)
+                  {
+                     (void)SCIPsnprintf(cutname, SCIP_MAXSTRLEN, "trianglebw_%d_%d_%d_%d", states[0], states[1], states[2], l );
+                     SCIP_CALL( SCIPcreateEmptyRowSepa(scip, &(cuts[ncutscreated]), sepa, cutname,
+                        -SCIPinfinity(scip), 1.0, FALSE, FALSE, TRUE) );
 
-                        SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
-                           getEdgevar(edgevars, states[1], states[2], 0), sign[l][2]) );
-                        SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
-                           getEdgevar(edgevars, states[1], states[0], 1), sign[l][0]) );
-                        SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
-                           getEdgevar(edgevars, states[2], states[0], 1), sign[l][1]) );
+                     SCIP_CALL( SCIPcacheRowExtensions(scip, cuts[ncutscreated]) );
 
-                        SCIP_CALL( SCIPflushRowExtensions(scip, cuts[ncutscreated]) );
+                     SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
+                        getEdgevar(edgevars, states[1], states[2], 0), sign[l][2]) );
+                     SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
+                        getEdgevar(edgevars, states[1], states[0], 1), sign[l][0]) );
+                     SCIP_CALL( SCIPaddVarToRow(scip, cuts[ncutscreated],
+                        getEdgevar(edgevars, states[2], states[0], 1), sign[l][1]) );
 
-                        if( ncutscreated >= size - 1 )
-                        {
-                           SCIP_CALL( SCIPreallocBufferArray(scip, &violation, (int) (size + MAXCUTS)) );
-                           SCIP_CALL( SCIPreallocBufferArray(scip, &cuts, (int) (size + MAXCUTS)) );
-                           size += MAXCUTS;
-                        }
+                     SCIP_CALL( SCIPflushRowExtensions(scip, cuts[ncutscreated]) );
 
-                        ncutscreated++;
+                     if( ncutscreated >= size - 1 )
+                     {
+                        SCIP_CALL( SCIPreallocBufferArray(scip, &violation, (int) (size + MAXCUTS)) );
+                        SCIP_CALL( SCIPreallocBufferArray(scip, &cuts, (int) (size + MAXCUTS)) );
+                        size += MAXCUTS;
                      }
+
+                     ncutscreated++;
                   }
                }
 
-               if( states[0] > states[1] && states[1] > states[2] )
+               if( states[0] > states[1] )
                {
+                  incluster01 = SCIPvarGetLPSol(getEdgevar(edgevars, states[0], states[1], 0));
+                  incluster02 = SCIPvarGetLPSol(getEdgevar(edgevars, states[0], states[2], 0));
+
                   for( l = 0; l < 3; ++l )
                   {
-                     violation[ncutscreated] = sign[l][0]
-                        * SCIPvarGetLPSol(getEdgevar(edgevars, states[0], states[1], 0));
-                     violation[ncutscreated] += sign[l][1]
-                        * SCIPvarGetLPSol(getEdgevar(edgevars, states[0], states[2], 0));
-                     violation[ncutscreated] += sign[l][2]
-                        * SCIPvarGetLPSol(getEdgevar(edgevars, states[1], states[2], 0)) - 1;
+                     violation[ncutscreated] = sign[l][0] * incluster01;
+                     violation[ncutscreated] += sign[l][1] * incluster02;
+                     violation[ncutscreated] += sign[l][2] * incluster12 - 1;
 
                      if( violation[ncutscreated] > 0 )
                      {
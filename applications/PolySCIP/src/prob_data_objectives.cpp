@@ -108,8 +108,9 @@ size_t ProbDataObjectives::getNumberNonzeroCoeffs(size_t obj) const {
  */
 ValueType ProbDataObjectives::getWeightedObjVal(SCIP_VAR* var, const WeightType& weight) {
     assert (weight.size() == non_ignored_objs_.size());
-    if (var_to_coeffs_.count(var)) {
-        auto& coeffs = var_to_coeffs_[var];
+    auto var_coeffs = var_to_coeffs_.find(var);
+    if (var_coeffs != var_to_coeffs_.end()) {
+        auto& coeffs = var_coeffs->second;
         return std::inner_product(begin(weight),
                                   end(weight),
                                   begin(non_ignored_objs_),
@@ -208,14 +208,28 @@ namespace polyscip {
      * @todo Const qualification
      */
     bool WeightSpacePolyhedron::areAdjacent(const WeightSpaceVertex* v, const WeightSpaceVertex* w) {
-        auto inc_facets = FacetContainer {};
-        std::set_intersection(v->incident_facets_.cbegin(),
-                              v->incident_facets_.cend(),
-                              w->incident_facets_.cbegin(),
-                              w->incident_facets_.cend(),
-                              std::back_inserter(inc_facets),
-                              WeightSpaceFacet::Compare());
-        return inc_facets.size() >= wsp_dimension_-1;
+        // count common incident facets of the sorted facet containers like std::set_intersection,
+        // but without storing them and only until enough common facets are found
+        auto compare = WeightSpaceFacet::Compare();
+        auto v_it = v->incident_facets_.cbegin();
+        auto w_it = w->incident_facets_.cbegin();
+        auto no_common_facets = std::size_t{0};
+        while (no_common_facets < wsp_dimension_-1 &&
+               v_it != v->incident_facets_.cend() &&
+               w_it != w->incident_facets_.cend()) {
+            if (compare(*v_it, *w_it)) {
+                ++v_it;
+            }
+            else if (compare(*w_it, *v_it)) {
+                ++w_it;
+            }
+            else {
+                ++no_common_facets;
+                ++v_it;
+                ++w_it;
+            }
+        }
+        return no_common_facets >= wsp_dimension_-1;
     }
 
     /**
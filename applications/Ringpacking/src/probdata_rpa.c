@@ -2068,7 +2068,9 @@ SCIP_RETCODE SCIPverifyCircularPatternNLP(
       SCIP_CALL( SCIPreleaseCons(subscip, &cons) );
    }
 
-   /* sort circles in x direction if they have the same type */
+   /* sort circles in x direction if they have the same type; it suffices to order each circle before the next circle
+    * of the same type, the order between all other pairs of the type follows by transitivity
+    */
    for( k = 0; k < nelems - 1; ++k )
    {
       int elemtype1;
@@ -2081,7 +2083,7 @@ SCIP_RETCODE SCIPverifyCircularPatternNLP(
       {
          int elemtype2;
 
-         elemtype2 = SCIPpatternGetElementType(pattern, k+1);
+         elemtype2 = SCIPpatternGetElementType(pattern, l);
          assert(elemtype2 >= 0 && elemtype2 < SCIPprobdataGetNTypes(probdata));
 
          if( elemtype1 != elemtype2 )
@@ -2094,6 +2096,8 @@ SCIP_RETCODE SCIPverifyCircularPatternNLP(
 
          SCIP_CALL( SCIPaddCons(subscip, cons) );
          SCIP_CALL( SCIPreleaseCons(subscip, &cons) );
+
+         break;
       }
    }
 
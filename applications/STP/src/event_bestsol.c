@@ -74,7 +74,12 @@ SCIP_DECL_EVENTEXIT(eventExitBestsol)
    return SCIP_OKAY;
 }
 
-/** execution method of event handler */
+/** execution method of event handler
+ *
+ *  Each new incumbent is appended to the intermediate solution log, which stays open during the whole solve, together
+ *  with a time-stamped line in the log file (if any); earlier solutions are never rewritten, so the last entry of the log is
+ *  always the best solution found so far.
+ */
 static
 SCIP_DECL_EVENTEXEC(eventExecBestsol)
 {  /*lint --e{715}*/
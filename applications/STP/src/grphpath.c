@@ -57,20 +57,17 @@ inline static int nearest(
    k              = heap[1];
    j              = 1;
    c              = 2;
-   heap[1]        = heap[(*count)--];
-   state[heap[1]] = 1;
+   t              = heap[(*count)--];
 
    if ((*count) > 2)
       if (LT(path[heap[3]].dist, path[heap[2]].dist))
          c++;
 
-   while((c <= (*count)) && GT(path[heap[j]].dist, path[heap[c]].dist))
+   /* move the smaller children up into the hole and store the former last element only once at its final position */
+   while((c <= (*count)) && GT(path[t].dist, path[heap[c]].dist))
    {
-      t              = heap[c];
-      heap[c]        = heap[j];
-      heap[j]        = t;
+      heap[j]        = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j              = c;
       c             += c;
 
@@ -78,6 +75,9 @@ inline static int nearest(
          if (LT(path[heap[c + 1]].dist, path[heap[c]].dist))
             c++;
    }
+   heap[j]        = t;
+   state[t]       = j;
+
    return(k);
 }
 
@@ -107,8 +107,7 @@ inline static int nearestX(
    k              = heap[1];
    j              = 1;
    c              = 2;
-   heap[1]        = heap[(*count)--];
-   state[heap[1]] = 1;
+   t              = heap[(*count)--];
 
    dcount = *count;
 
@@ -116,13 +115,11 @@ inline static int nearestX(
       if (LT(pathdist[heap[3]], pathdist[heap[2]]))
          c++;
 
-   while((c <= dcount) && GT(pathdist[heap[j]], pathdist[heap[c]]))
+   /* move the smaller children up into the hole and store the former last element only once at its final position */
+   while((c <= dcount) && GT(pathdist[t], pathdist[heap[c]]))
    {
-      t              = heap[c];
-      heap[c]        = heap[j];
-      heap[j]        = t;
+      heap[j]        = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j              = c;
       c             += c;
 
@@ -130,6 +127,9 @@ inline static int nearestX(
          if (LT(pathdist[heap[c + 1]], pathdist[heap[c]]))
             c++;
    }
+   heap[j]        = t;
+   state[t]       = j;
+
    return(k);
 }
 
@@ -156,7 +156,6 @@ inline static void correct(
    SCIP_Real cost,
    int    mode)
 {
-   int    t;
    int    c;
    int    j;
 
@@ -173,16 +172,15 @@ inline static void correct(
    /* Heap shift up */
    j = state[l];
    c = j / 2;
-   while( (j > 1) && SCIPisGT(scip, path[heap[c]].dist, path[heap[j]].dist) )
+   while( (j > 1) && SCIPisGT(scip, path[heap[c]].dist, path[l].dist) )
    {
-      t              = heap[c];
-      heap[c]        = heap[j];
-      heap[j]        = t;
+      heap[j]        = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j              = c;
       c              = j / 2;
    }
+   heap[j]        = l;
+   state[l]      = j;
 }
 
 
@@ -209,7 +207,6 @@ inline static void correctX(
    SCIP_Real cost
    )
 {
-   int    t;
    int    c;
    int    j;
 
@@ -229,16 +226,15 @@ inline static void correctX(
    j = state[l];
    c = j / 2;
 
-   while( (j > 1) && SCIPisGT(scip, pathdist[heap[c]], pathdist[heap[j]]) )
+   while( (j > 1) && SCIPisGT(scip, pathdist[heap[c]], pathdist[l]) )
    {
-      t              = heap[c];
-      heap[c]        = heap[j];
-      heap[j]        = t;
+      heap[j]        = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j              = c;
       c              = j / 2;
    }
+   heap[j]        = l;
+   state[l]      = j;
 }
 
 void heap_add(
@@ -249,7 +245,6 @@ void heap_add(
    PATH*  path
    )
 {
-   int    t;
    int    c;
    int    j;
 
@@ -260,16 +255,15 @@ void heap_add(
    j = state[node];
    c = j / 2;
 
-   while((j > 1) && GT(path[heap[c]].dist, path[heap[j]].dist))
+   while((j > 1) && GT(path[heap[c]].dist, path[node].dist))
    {
-      t              = heap[c];
-      heap[c]        = heap[j];
-      heap[j]        = t;
+      heap[j]        = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j              = c;
       c              = j / 2;
    }
+   heap[j]        = node;
+   state[node]   = j;
 
 }
 inline static void resetX(
@@ -281,7 +275,6 @@ inline static void resetX(
    int    node
    )
 {
-   int    t;
    int    c;
    int    j;
 
@@ -294,16 +287,15 @@ inline static void resetX(
    j = state[node];
    c = j / 2;
 
-   while( (j > 1) && SCIPisGT(scip, pathdist[heap[c]], pathdist[heap[j]]) )
+   while( (j > 1) && SCIPisGT(scip, pathdist[heap[c]], pathdist[node]) )
    {
-      t              = heap[c];
-      heap[c]        = heap[j];
-      heap[j]        = t;
+      heap[j]        = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j              = c;
       c              = j / 2;
    }
+   heap[j]        = node;
+   state[node]   = j;
 }
 
 inline static void reset(
@@ -315,7 +307,6 @@ inline static void reset(
    int    node
    )
 {
-   int    t;
    int    c;
    int    j;
 
@@ -328,16 +319,15 @@ inline static void reset(
    j = state[node];
    c = j / 2;
 
-   while( (j > 1) && SCIPisGT(scip, path[heap[c]].dist, path[heap[j]].dist) )
+   while( (j > 1) && SCIPisGT(scip, path[heap[c]].dist, path[node].dist) )
    {
-      t              = heap[c];
-      heap[c]        = heap[j];
-      heap[j]        = t;
+      heap[j]        = heap[c];
       state[heap[j]] = j;
-      state[heap[c]] = c;
       j              = c;
       c              = j / 2;
    }
+   heap[j]        = node;
+   state[node]   = j;
 }
 
 inline static void utdist(
@@ -0,0 +1,152 @@
+#!/usr/bin/awk -f
+#* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+#*                                                                           *
+#*                  This file is part of the program and library             *
+#*         SCIP --- Solving Constraint Integer Programs                      *
+#*                                                                           *
+#*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            *
+#*                            fuer Informationstechnik Berlin                *
+#*                                                                           *
+#*  SCIP is distributed under the terms of the ZIB Academic License.         *
+#*                                                                           *
+#*  You should have received a copy of the ZIB Academic License              *
+#*  along with SCIP; see the file COPYING. If not email to scip@zib.de.      *
+#*                                                                           *
+#* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+#
+#@file    perspective.awk
+#@brief   evaluates a run of perspective.sh: root gap closed, nodes, separation time, and perspective cut counts
+#
+# The first input file is the solu file, the second one the log written by perspective.sh. The root gap closed is
+# (final root dual bound - first LP value) / (optimal or best known value - first LP value).
+#
+function abs(x)
+{
+   return x < 0 ? -x : x;
+}
+function max(x,y)
+{
+   return (x) > (y) ? (x) : (y);
+}
+function printrun()
+{
+   if( gapclosed == "-" && firstlp != "-" && rootdb != "-" && (prob in sol) )
+   {
+      if( abs(sol[prob] - firstlp) < 1e-6 * max(abs(sol[prob]), 1.0) )
+         gapclosed = 100.0;
+      else
+         gapclosed = 100.0 * (rootdb - firstlp) / (sol[prob] - firstlp);
+   }
+
+   if( gapclosed == "-" )
+      printf("%-24s %10s %10d %10.2f %10.2f %10d %10d %10.2f\n", prob, "-", nodes, sepatime, probtime, cutsgen,
+         cutsappl, time);
+   else
+   {
+      printf("%-24s %10.2f %10d %10.2f %10.2f %10d %10d %10.2f\n", prob, gapclosed, nodes, sepatime, probtime, cutsgen,
+         cutsappl, time);
+      sumgapclosed += gapclosed;
+      ngapclosed++;
+   }
+
+   nprobs++;
+   sumnodes += log(max(nodes, 0) + nodeshift);
+   sumtime += log(max(time, 0.0) + timeshift);
+   sumsepatime += sepatime;
+   sumcutsgen += cutsgen;
+   sumcutsappl += cutsappl;
+}
+BEGIN {
+   nodeshift = 100.0;
+   timeshift = 1.0;
+   nprobs = 0;
+   ngapclosed = 0;
+   inrun = 0;
+
+   printf("perspective variant: %s\n\n", VARIANT);
+   printf("%-24s %10s %10s %10s %10s %10s %10s %10s\n", "Name", "GapCl[%]", "Nodes", "SepaTime", "ProbTime",
+      "CutsGen", "CutsAppl", "Time");
+   printf("------------------------------------------------------------------------------------------------------\n");
+}
+/^=opt=/ || /^=best=/ {
+   sol[$2] = $3;
+   next;
+}
+/^@01/ {
+   # strip the path and the extensions from the instance name
+   n = split($2, a, "/");
+   prob = a[n];
+   sub(/\.gz$/, "", prob);
+   sub(/\.[^.]*$/, "", prob);
+
+   inrun = 1;
+   intimings = 0;
+   inperspective = 0;
+   nodes = 0;
+   time = 0.0;
+   firstlp = "-";
+   rootdb = "-";
+   gapclosed = "-";
+   sepatime = 0.0;
+   probtime = 0.0;
+   cutsgen = 0;
+   cutsappl = 0;
+   next;
+}
+/^@04/ {
+   if( inrun )
+      printrun();
+   inrun = 0;
+   next;
+}
+/^Constraint Timings/ {
+   intimings = 1;
+   next;
+}
+/^Perspective Nlhdlr/ {
+   inperspective = 1;
+   next;
+}
+/^[^ ]/ {
+   intimings = 0;
+   inperspective = 0;
+}
+/^  expr  *:/ {
+   if( intimings )
+      sepatime = $5;
+}
+/^  Counts  *:/ {
+   if( inperspective )
+   {
+      cutsgen = $7;
+      cutsappl = $8;
+   }
+}
+/^                   :/ {
+   # value row of the perspective timing statistics, the second column is the probing time
+   if( inperspective )
+      probtime = $3;
+}
+/^Solving Time \(sec\)/ {
+   time = $5;
+}
+/^Solving Nodes/ {
+   nodes = $4;
+}
+/^  First LP value/ {
+   firstlp = $5;
+}
+/^  Final Dual Bound/ {
+   rootdb = $5;
+}
+END {
+   printf("------------------------------------------------------------------------------------------------------\n");
+   if( nprobs > 0 )
+   {
+      printf("%-24s %10s %10d %10.2f %10s %10d %10d %10.2f\n", "shifted geom. / total",
+         ngapclosed > 0 ? sprintf("%.2f", sumgapclosed / ngapclosed) : "-", exp(sumnodes / nprobs) - nodeshift,
+         sumsepatime, "", sumcutsgen, sumcutsappl, exp(sumtime / nprobs) - timeshift);
+   }
+   printf("\n%d instances, root gap closed averaged over %d instances with known optimal or best value\n", nprobs,
+      ngapclosed);
+}
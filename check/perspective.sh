@@ -0,0 +1,109 @@
+#!/usr/bin/env bash
+#* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+#*                                                                           *
+#*                  This file is part of the program and library             *
+#*         SCIP --- Solving Constraint Integer Programs                      *
+#*                                                                           *
+#*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            *
+#*                            fuer Informationstechnik Berlin                *
+#*                                                                           *
+#*  SCIP is distributed under the terms of the ZIB Academic License.         *
+#*                                                                           *
+#*  You should have received a copy of the ZIB Academic License              *
+#*  along with SCIP; see the file COPYING. If not email to scip@zib.de.      *
+#*                                                                           *
+#* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+# Runs a test set (default: perspective) once for each variant of the perspective nonlinear handler, i.e., disabled,
+# enabled without probing, and enabled with the probing variants, and evaluates the runs with perspective.awk.
+#
+# usage: ./perspective.sh [BINARY] [TIME] [TEST] [VARIANTS]
+#
+# BINARY   - SCIP binary, relative to the check directory (default: ../bin/scip)
+# TIME     - time limit in seconds per instance (default: 3600)
+# TEST     - name of the test set in testset/ (default: perspective)
+# VARIANTS - list of variants to run (default: "off noprobing probing batchprobing adaptiveprobing")
+#
+# For each variant, the log is written to results/perspective.TEST.VARIANT.out and the evaluation, i.e., root gap
+# closed, number of nodes, separation time of the expression constraint handler, and the counts of the perspective
+# statistics table, to results/perspective.TEST.VARIANT.res.
+
+BINARY=${1:-../bin/scip}
+TIME=${2:-3600}
+TSTNAME=${3:-perspective}
+VARIANTS=${4:-"off noprobing probing batchprobing adaptiveprobing"}
+
+PARAMPREFIX="constraints/expr/nlhdlr/perspective"
+
+if test ! -e testset/${TSTNAME}.test
+then
+    echo "Skipping test since the test file testset/${TSTNAME}.test does not exist."
+    exit 1
+fi
+
+SOLUFILE=testset/${TSTNAME}.solu
+if test ! -e ${SOLUFILE}
+then
+    SOLUFILE=testset/all.solu
+fi
+
+if test ! -e ${BINARY}
+then
+    echo "Skipping test since the binary ${BINARY} does not exist."
+    exit 1
+fi
+
+mkdir -p results
+
+for VARIANT in ${VARIANTS}
+do
+    SETFILE=results/perspective.${TSTNAME}.${VARIANT}.set
+    OUTFILE=results/perspective.${TSTNAME}.${VARIANT}.out
+    RESFILE=results/perspective.${TSTNAME}.${VARIANT}.res
+
+    # write the settings of the variant
+    case ${VARIANT} in
+        off)
+            echo "${PARAMPREFIX}/enabled = FALSE" > ${SETFILE}
+            ;;
+        noprobing)
+            echo "${PARAMPREFIX}/probingfreq = -1" > ${SETFILE}
+            ;;
+        probing)
+            echo "${PARAMPREFIX}/probingfreq = 1" > ${SETFILE}
+            ;;
+        batchprobing)
+            echo "${PARAMPREFIX}/batchprobing = TRUE" > ${SETFILE}
+            ;;
+        adaptiveprobing)
+            echo "${PARAMPREFIX}/adaptiveprobing = TRUE" > ${SETFILE}
+            ;;
+        *)
+            echo "Unknown variant ${VARIANT}, skipping it."
+            continue
+            ;;
+    esac
+
+    rm -f ${OUTFILE}
+    for INSTANCE in `awk '{print $1}' testset/${TSTNAME}.test`
+    do
+        if test "${INSTANCE}" = "DONE"
+        then
+            break
+        fi
+
+        if test ! -f ${INSTANCE}
+        then
+            echo "input file ${INSTANCE} not found!"
+            continue
+        fi
+
+        echo "@01 ${INSTANCE}" >> ${OUTFILE}
+        echo "@02 ${VARIANT}" >> ${OUTFILE}
+        ${BINARY} -c "set load ${SETFILE} set limits time ${TIME} read ${INSTANCE} optimize display statistics quit" \
+            < /dev/null >> ${OUTFILE} 2>&1
+        echo "@04" >> ${OUTFILE}
+    done
+
+    awk -f perspective.awk -v "VARIANT=${VARIANT}" ${SOLUFILE} ${OUTFILE} | tee ${RESFILE}
+done
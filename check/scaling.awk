@@ -0,0 +1,140 @@
+#!/usr/bin/awk -f
+#* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+#*                                                                           *
+#*                  This file is part of the program and library             *
+#*         SCIP --- Solving Constraint Integer Programs                      *
+#*                                                                           *
+#*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            *
+#*                            fuer Informationstechnik Berlin                *
+#*                                                                           *
+#*  SCIP is distributed under the terms of the ZIB Academic License.         *
+#*                                                                           *
+#*  You should have received a copy of the ZIB Academic License              *
+#*  along with SCIP; see the file COPYING. If not email to scip@zib.de.      *
+#*                                                                           *
+#* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+#
+#@file    scaling.awk
+#@brief   evaluates a run of scaling.sh: wall clock time, speedup, parallel efficiency, and peak memory per thread count
+#
+# The speedup of a run is the wall clock time of the single thread run on the same instance divided by its wall clock
+# time, the parallel efficiency is the speedup divided by the number of threads. Runs that did not solve the instance
+# are marked as "fail" and are excluded from the shifted geometric means.
+#
+function max(x,y)
+{
+   return (x) > (y) ? (x) : (y);
+}
+function storerun()
+{
+   if( !(prob in isprob) )
+   {
+      isprob[prob] = 1;
+      probs[nprobs++] = prob;
+   }
+   runtime[prob, nthreads] = walltime;
+   runmem[prob, nthreads] = mem;
+   runok[prob, nthreads] = solved;
+}
+BEGIN {
+   timeshift = 1.0;
+   nprobs = 0;
+   inrun = 0;
+   nthreadcounts = split(THREADS, threadcounts, " ");
+   basethreads = threadcounts[1];
+}
+/^@01/ {
+   # strip the path and the extensions from the instance name
+   n = split($2, a, "/");
+   prob = a[n];
+   sub(/\.gz$/, "", prob);
+   sub(/\.[^.]*$/, "", prob);
+
+   inrun = 1;
+   nthreads = 1;
+   walltime = 0.0;
+   mem = "-";
+   solved = 0;
+   next;
+}
+/^@02/ {
+   nthreads = $2;
+   next;
+}
+/^@03/ {
+   walltime = $3 - $2;
+   next;
+}
+/^@04/ {
+   if( inrun )
+      storerun();
+   inrun = 0;
+   next;
+}
+/^@05_/ {
+   # maximum resident set size in KB as reported by GNU time
+   mem = substr($1, 5) / 1024.0;
+   next;
+}
+/^SCIP Status *: problem is solved/ {
+   solved = 1;
+}
+END {
+   printf("%-24s %8s %10s %10s %10s %10s %6s\n", "Name", "Threads", "Time", "Speedup", "Eff[%]", "Mem[MB]", "Status");
+   printf("--------------------------------------------------------------------------------------\n");
+   for( i = 0; i < nprobs; ++i )
+   {
+      p = probs[i];
+      for( t = 1; t <= nthreadcounts; ++t )
+      {
+         k = threadcounts[t];
+         if( !((p, k) in runtime) )
+            continue;
+
+         speedup = "-";
+         eff = "-";
+         if( runok[p, k] && runok[p, basethreads] && runtime[p, k] > 0.0 )
+         {
+            speedup = sprintf("%.2f", runtime[p, basethreads] / runtime[p, k]);
+            eff = sprintf("%.1f", 100.0 * speedup * basethreads / k);
+         }
+         printf("%-24s %8d %10.2f %10s %10s %10s %6s\n", p, k, runtime[p, k], speedup, eff,
+            runmem[p, k] == "-" ? "-" : sprintf("%.1f", runmem[p, k]), runok[p, k] ? "ok" : "fail");
+      }
+   }
+   printf("--------------------------------------------------------------------------------------\n");
+
+   # shifted geometric means over the instances that were solved with all thread counts
+   nsolved = 0;
+   for( t = 1; t <= nthreadcounts; ++t )
+      sumtime[t] = 0.0;
+   for( i = 0; i < nprobs; ++i )
+   {
+      p = probs[i];
+      for( t = 1; t <= nthreadcounts; ++t )
+      {
+         if( !runok[p, threadcounts[t]] )
+            break;
+      }
+      if( t <= nthreadcounts )
+         continue;
+
+      for( t = 1; t <= nthreadcounts; ++t )
+         sumtime[t] += log(max(runtime[p, threadcounts[t]], 0.0) + timeshift);
+      nsolved++;
+   }
+
+   if( nsolved > 0 )
+   {
+      basetime = exp(sumtime[1] / nsolved) - timeshift;
+      for( t = 1; t <= nthreadcounts; ++t )
+      {
+         k = threadcounts[t];
+         meantime = exp(sumtime[t] / nsolved) - timeshift;
+         printf("%-24s %8d %10.2f %10s %10s\n", "shifted geom.", k, meantime,
+            meantime > 0.0 ? sprintf("%.2f", basetime / meantime) : "-",
+            meantime > 0.0 ? sprintf("%.1f", 100.0 * basetime * basethreads / (meantime * k)) : "-");
+      }
+   }
+   printf("\n%d instances, shifted geometric means over %d instances solved with all thread counts\n", nprobs, nsolved);
+}
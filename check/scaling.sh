@@ -0,0 +1,111 @@
+#!/usr/bin/env bash
+#* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+#*                                                                           *
+#*                  This file is part of the program and library             *
+#*         SCIP --- Solving Constraint Integer Programs                      *
+#*                                                                           *
+#*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            *
+#*                            fuer Informationstechnik Berlin                *
+#*                                                                           *
+#*  SCIP is distributed under the terms of the ZIB Academic License.         *
+#*                                                                           *
+#*  You should have received a copy of the ZIB Academic License              *
+#*  along with SCIP; see the file COPYING. If not email to scip@zib.de.      *
+#*                                                                           *
+#* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+
+# Runs a test set once for each number of threads and evaluates the wall clock times, speedups, parallel efficiencies,
+# and peak memory with scaling.awk. With one thread, the instances are solved by "optimize"; with more threads, by
+# "concurrentopt", which requires a binary that was built with a task processing interface (TPI=tny or TPI=omp).
+#
+# usage: ./scaling.sh [BINARY] [TIME] [TEST] [THREADS] [SETTINGS]
+#
+# BINARY   - SCIP binary, relative to the check directory (default: ../bin/scip); the binaries of the examples and
+#            applications work as well, as long as their interactive shell provides the used commands
+# TIME     - time limit in seconds per instance and run (default: 3600)
+# TEST     - name of the test set in testset/ (default: short)
+# THREADS  - list of thread counts to run (default: "1 2 4 8 16 32")
+# SETTINGS - name of a settings file in settings/ that is loaded before each run (default: default)
+#
+# The log of all runs is written to results/scaling.TEST.SETTINGS.out and the evaluation to
+# results/scaling.TEST.SETTINGS.res. The peak memory is only recorded if GNU time is available as /usr/bin/time.
+
+BINARY=${1:-../bin/scip}
+TIME=${2:-3600}
+TSTNAME=${3:-short}
+THREADS=${4:-"1 2 4 8 16 32"}
+SETNAME=${5:-default}
+
+if test ! -e testset/${TSTNAME}.test
+then
+    echo "Skipping test since the test file testset/${TSTNAME}.test does not exist."
+    exit 1
+fi
+
+if test ! -e ${BINARY}
+then
+    echo "Skipping test since the binary ${BINARY} does not exist."
+    exit 1
+fi
+
+SETFILE=settings/${SETNAME}.set
+if test "${SETNAME}" != "default" && test ! -e ${SETFILE}
+then
+    echo "Skipping test since the settings file ${SETFILE} does not exist."
+    exit 1
+fi
+
+if test -x /usr/bin/time
+then
+    TIMECMD="/usr/bin/time -f @05_%M"
+else
+    TIMECMD=""
+fi
+
+mkdir -p results
+
+OUTFILE=results/scaling.${TSTNAME}.${SETNAME}.out
+RESFILE=results/scaling.${TSTNAME}.${SETNAME}.res
+
+rm -f ${OUTFILE}
+for NTHREADS in ${THREADS}
+do
+    if test ${NTHREADS} -eq 1
+    then
+        SOLVECMD="optimize"
+    else
+        SOLVECMD="concurrentopt"
+    fi
+
+    if test "${SETNAME}" = "default"
+    then
+        LOADCMD=""
+    else
+        LOADCMD="set load ${SETFILE}"
+    fi
+
+    for INSTANCE in `awk '{print $1}' testset/${TSTNAME}.test`
+    do
+        if test "${INSTANCE}" = "DONE"
+        then
+            break
+        fi
+
+        if test ! -f ${INSTANCE}
+        then
+            echo "input file ${INSTANCE} not found!"
+            continue
+        fi
+
+        echo "@01 ${INSTANCE}" >> ${OUTFILE}
+        echo "@02 ${NTHREADS}" >> ${OUTFILE}
+        STARTTIME=`date +%s.%N`
+        ${TIMECMD} ${BINARY} -c "${LOADCMD} set limits time ${TIME} set parallel minnthreads ${NTHREADS} \
+            set parallel maxnthreads ${NTHREADS} read ${INSTANCE} ${SOLVECMD} quit" < /dev/null >> ${OUTFILE} 2>&1
+        ENDTIME=`date +%s.%N`
+        echo "@03 ${STARTTIME} ${ENDTIME}" >> ${OUTFILE}
+        echo "@04" >> ${OUTFILE}
+    done
+done
+
+awk -f scaling.awk -v "THREADS=${THREADS}" ${OUTFILE} | tee ${RESFILE}
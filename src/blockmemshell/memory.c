@@ -1023,6 +1023,12 @@ void unlinkEagerChunk(
 
 /** creates a new memory chunk in the given chunk block and adds memory elements to the lazy free list;
  *  returns TRUE if successful, FALSE otherwise
+ *
+ *  @note Chunks are obtained by a plain malloc() of at most CHUNKLENGTH_MAX bytes and are neither page-aligned nor
+ *        page-sized, so advising huge pages or binding NUMA nodes per chunk is not meaningful here. Large pages can be
+ *        enabled without code changes through transparent huge pages or the allocator's tunables (e.g., glibc's
+ *        glibc.malloc.hugetlb). NUMA locality follows from first-touch placement: in concurrent solves, each solver
+ *        owns its block memory and creates and initializes its chunks on its own thread.
  */
 static
 int createChunk(
@@ -1647,6 +1653,12 @@ long long BMSgetChunkMemoryUsed_call(
 
 /* for a definition of the struct, see above */
 
+/* A block memory is owned by a single thread and its methods do not lock.  Each SCIP instance creates its own block
+ * memories, so concurrent solvers on different threads never share one.  Code that runs on a helper thread must not
+ * allocate from the block memory of the calling SCIP instance, since the updates of its chunks and free lists are not
+ * synchronized; it should use BMSallocMemory() and friends instead.
+ */
+
 
 /*
  * debugging methods
@@ -2708,29 +2720,30 @@ void* BMSallocBufferMemory_work(
    {
       size_t newsize;
 
-      /* enlarge buffer */
+      /* enlarge buffer: the content of an unused buffer is irrelevant (or all zero for clean buffers), so we free
+       * and allocate the buffer instead of reallocating it, which would copy the old content
+       */
       newsize = calcMemoryGrowSize((size_t)buffer->arraygrowinit, buffer->arraygrowfac, size);
-      BMSreallocMemorySize(&buffer->data[bufnum], newsize);
-
-      /* clear new memory */
+      BMSfreeMemoryNull(&buffer->data[bufnum]);
       if( buffer->clean )
       {
-         char* tmpptr = (char*)(buffer->data[bufnum]);
-         size_t inc = buffer->size[bufnum] / sizeof(*tmpptr);
-         tmpptr += inc;
-
-         BMSclearMemorySize(tmpptr, newsize - buffer->size[bufnum]);
+         BMSallocClearMemorySize(&buffer->data[bufnum], newsize);
+      }
+      else
+      {
+         BMSallocMemorySize(&buffer->data[bufnum], newsize);
       }
-      assert( newsize > buffer->size[bufnum] );
-      buffer->totalmem += newsize - buffer->size[bufnum];
-      buffer->size[bufnum] = newsize;
-
       if ( buffer->data[bufnum] == NULL )
       {
+         buffer->totalmem -= buffer->size[bufnum];
+         buffer->size[bufnum] = 0;
          printErrorHeader(filename, line);
          printError("Insufficient memory for reallocating buffer storage.\n");
          return NULL;
       }
+      assert( newsize > buffer->size[bufnum] );
+      buffer->totalmem += newsize - buffer->size[bufnum];
+      buffer->size[bufnum] = newsize;
    }
    assert( buffer->size[bufnum] >= size );
 
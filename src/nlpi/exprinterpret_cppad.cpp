@@ -77,6 +77,15 @@ using CppAD::SCIPInterval;
 #endif
 #endif
 
+/* the atomic operators below exist only once, but receive the data for their next forward or reverse sweep via
+ * set_old(); this data is stored thread local, such that tapes can be evaluated by several threads at the same time
+ */
+#ifndef NPARASCIP
+#define SCIP_CPPAD_THREADLOCAL thread_local
+#else
+#define SCIP_CPPAD_THREADLOCAL
+#endif
+
 /* disable -Wshadow warnings for upcoming includes of CppAD if using some old GCC
  * -Wshadow was too strict with some versions of GCC 4 (https://stackoverflow.com/questions/2958457/gcc-wshadow-is-too-strict)
  */
@@ -432,28 +441,24 @@ bool univariate_rev_sparse_hes(
  *
  *  This class implements forward and reverse operations for the function x -> x^p for use within CppAD.
  *  While CppAD would implement integer powers as a recursion of multiplications, we still use pow functions as they allow us to avoid overestimation in interval arithmetics.
- *
- *  @todo treat the exponent as a (variable) argument to the function, with the assumption that we never differentiate w.r.t. it (this should make the approach threadsafe again)
  */
 template<class Type>
 class atomic_posintpower : public CppAD::atomic_base<Type>
 {
 public:
    atomic_posintpower()
-   : CppAD::atomic_base<Type>("posintpower"),
-     exponent(0)
+   : CppAD::atomic_base<Type>("posintpower")
    {
       /* indicate that we want to use bool-based sparsity pattern */
       this->option(CppAD::atomic_base<Type>::bool_sparsity_enum);
    }
 
 private:
-   /** exponent value for next call to forward or reverse */
-   int exponent;
+   /** exponent value for next call to forward or reverse (thread local, since there is only one instance of this class) */
+   static SCIP_CPPAD_THREADLOCAL int exponent;
 
    /** stores exponent value corresponding to next call to forward or reverse
     *
-    * how is this supposed to be threadsafe? (we use only one global instantiation of this class)
     * TODO according to the CppAD 2018 docu, using this function is deprecated; what is the modern way to do this?
     */
    virtual void set_old(size_t id)
@@ -654,6 +659,9 @@ private:
    }
 };
 
+template<class Type>
+SCIP_CPPAD_THREADLOCAL int atomic_posintpower<Type>::exponent = 0;
+
 /** power function with natural exponents */
 template<class Type>
 static
@@ -690,28 +698,24 @@ void posintpower(
  *  This class implements forward and reverse operations for the function x -> sign(x)abs(x)^p for use within CppAD.
  *  While we otherwise would have to use discontinuous sign and abs functions, our own implementation allows to provide
  *  a continuously differentiable function.
- *
- *  @todo treat the exponent as a (variable) argument to the function, with the assumption that we never differentiate w.r.t. it (this should make the approach threadsafe again)
  */
 template<class Type>
 class atomic_signpower : public CppAD::atomic_base<Type>
 {
 public:
    atomic_signpower()
-   : CppAD::atomic_base<Type>("signpower"),
-     exponent(0.0)
+   : CppAD::atomic_base<Type>("signpower")
    {
       /* indicate that we want to use bool-based sparsity pattern */
       this->option(CppAD::atomic_base<Type>::bool_sparsity_enum);
    }
 
 private:
-   /** exponent for use in next call to forward or reverse */
-   SCIP_Real exponent;
+   /** exponent for use in next call to forward or reverse (thread local, since there is only one instance of this class) */
+   static SCIP_CPPAD_THREADLOCAL SCIP_Real exponent;
 
    /** stores exponent corresponding to next call to forward or reverse
     *
-    * How is this supposed to be threadsafe? (we use only one global instantiation of this class)
     * TODO according to the CppAD 2018 docu, using this function is deprecated; what is the modern way to do this?
     */
    virtual void set_old(size_t id)
@@ -925,26 +929,27 @@ private:
 
 };
 
+template<class Type>
+SCIP_CPPAD_THREADLOCAL SCIP_Real atomic_signpower<Type>::exponent = 0.0;
+
 /** Specialization of atomic_signpower template for intervals */
 template<>
 class atomic_signpower<SCIPInterval> : public CppAD::atomic_base<SCIPInterval>
 {
 public:
    atomic_signpower<SCIPInterval>()
-   : CppAD::atomic_base<SCIPInterval>("signpowerint"),
-     exponent(0.0)
+   : CppAD::atomic_base<SCIPInterval>("signpowerint")
    {
       /* indicate that we want to use bool-based sparsity pattern */
       this->option(CppAD::atomic_base<SCIPInterval>::bool_sparsity_enum);
    }
 
 private:
-   /** exponent for use in next call to forward or reverse */
-   SCIP_Real exponent;
+   /** exponent for use in next call to forward or reverse (thread local, since there is only one instance of this class) */
+   static SCIP_CPPAD_THREADLOCAL SCIP_Real exponent;
 
    /** stores exponent corresponding to next call to forward or reverse
     *
-    * How is this supposed to be threadsafe? (we use only one global instantiation of this class)
     * TODO according to the CppAD 2018 docu, using this function is deprecated; what is the modern way to do this?
     */
    virtual void set_old(size_t id)
@@ -1123,6 +1128,8 @@ private:
    }
 };
 
+SCIP_CPPAD_THREADLOCAL SCIP_Real atomic_signpower<SCIPInterval>::exponent = 0.0;
+
 /** template for evaluation for signpower operator */
 template<class Type>
 static
@@ -1220,20 +1227,18 @@ class atomic_userexpr : public CppAD::atomic_base<Type>
 {
 public:
    atomic_userexpr()
-   : CppAD::atomic_base<Type>("userexpr"),
-     expr(NULL)
+   : CppAD::atomic_base<Type>("userexpr")
    {
       /* indicate that we want to use bool-based sparsity pattern */
       this->option(CppAD::atomic_base<Type>::bool_sparsity_enum);
    }
 
 private:
-   /** user expression */
-   SCIP_EXPR* expr;
+   /** user expression for use in next call to forward or reverse (thread local, since there is only one instance of this class) */
+   static SCIP_CPPAD_THREADLOCAL SCIP_EXPR* expr;
 
    /** stores user expression corresponding to next call to forward or reverse
     *
-    * how is this supposed to be threadsafe? (we use only one global instantiation of this class)
     * TODO according to the CppAD 2018 docu, using this function is deprecated; what is the modern way to do this?
     */
    virtual void set_old(size_t id)
@@ -1576,6 +1581,9 @@ private:
 
 };
 
+template<class Type>
+SCIP_CPPAD_THREADLOCAL SCIP_EXPR* atomic_userexpr<Type>::expr = NULL;
+
 template<class Type>
 static
 void evalUser(
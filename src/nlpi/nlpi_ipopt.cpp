@@ -904,7 +904,21 @@ SCIP_DECL_NLPIDELVARSET(nlpiDelVarSetIpopt)
    SCIP_CALL( SCIPnlpiOracleDelVarSet(problem->oracle, dstats) );
 
    problem->firstrun = TRUE;
-   BMSfreeMemoryArrayNull(&problem->initguess); // @TODO keep initguess for remaining variables 
+
+   /* keep the initial guess for the remaining variables; since variables only move to smaller positions, this can be
+    * done in place (the array may then be longer than necessary)
+    */
+   if( problem->initguess != NULL )
+   {
+      int i;
+
+      for( i = 0; i < dstatssize; ++i )
+      {
+         assert(dstats[i] <= i);
+         if( dstats[i] >= 0 )
+            problem->initguess[dstats[i]] = problem->initguess[i];
+      }
+   }
 
    invalidateSolution(problem);
 
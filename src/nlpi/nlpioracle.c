@@ -2650,6 +2650,11 @@ SCIP_RETCODE SCIPnlpiOracleGetJacobianSparsity(
  *  The user need to call SCIPnlpiOracleGetJacobianSparsity at least ones before using this function. 
  *
  * @return SCIP_INVALIDDATA, if the Jacobian could not be evaluated (domain error, etc.)
+ *
+ * @note Each constraint has its own expression tree, and hence its own tape in the expression interpreter, whose
+ *       gradient is obtained in a single reverse sweep. The cost is thus proportional to the cost of evaluating the
+ *       constraints already; a graph coloring of the Jacobian would only reduce the number of sweeps if all constraints
+ *       were recorded on one common tape.
  */
 SCIP_RETCODE SCIPnlpiOracleEvalJacobian(
    SCIP_NLPIORACLE*      oracle,             /**< pointer to NLPIORACLE data structure */
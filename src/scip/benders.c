@@ -3134,11 +3134,18 @@ SCIP_RETCODE solveBendersSubproblems(
    }
    else
    {
-      /* solving each of the subproblems for Benders' decomposition */
+      /* solving each of the subproblems for Benders' decomposition. This loop is used for all solve loops, so the
+       * convex (LP) and the CIP subproblems are both solved in parallel if benders/<name>/numthreads > 1. Each
+       * subproblem is a separate SCIP instance with its own memory, so no memory is shared between the threads. The
+       * solving times of the subproblems can differ significantly, so a dynamic schedule is used to balance the load
+       * between the threads. The cuts are generated afterwards in generateBendersCuts(), which adds them to the master
+       * problem. This is performed serially in the order of the subproblem indices, so the cut order is deterministic
+       * and independent of the number of threads.
+       */
       /* TODO: ensure that the each of the subproblems solve and update the parameters with the correct return values
        */
 #ifndef __INTEL_COMPILER
-      #pragma omp parallel for num_threads(numthreads) private(i) reduction(&&:locoptimal) reduction(||:locinfeasible) reduction(+:locnverified) reduction(||:locstopped) reduction(min:retcode)
+      #pragma omp parallel for num_threads(numthreads) private(i) schedule(dynamic, 1) reduction(&&:locoptimal) reduction(||:locinfeasible) reduction(+:locnverified) reduction(||:locstopped) reduction(min:retcode)
 #endif
       for( j = 0; j < nsolveidx; j++ )
       {
@@ -4139,7 +4146,17 @@ SCIP_RETCODE executeUserDefinedSolvesub(
       return SCIP_OKAY;
 }
 
-/** executes the subproblem solving process */
+/** executes the subproblem solving process
+ *
+ *  @note The subproblems are not cached across master solutions. Convex subproblems are kept in probing mode of the
+ *  same SCIP instance and only the bounds of the linking variables are changed in SCIPbendersSetupSubproblem(), so the
+ *  LP solver already warm starts from the basis of the previous solve. CIP subproblems are freed after each solve
+ *  round, because their search trees are not reusable after the linking variables are fixed to different values.
+ *  Reusing optimality cuts for a repeated linking point is not needed either: as long as a cut is part of the master
+ *  problem it separates that point, so the same point can only reappear with an auxiliary variable value that
+ *  satisfies the cut. The cuts stored by SCIPbendersStoreCut() are only used to transfer the cuts generated in LNS
+ *  heuristics to the main SCIP instance, see benders/<name>/transfercuts.
+ */
 SCIP_RETCODE SCIPbendersExecSubproblemSolve(
    SCIP_BENDERS*         benders,            /**< Benders' decomposition */
    SCIP_SET*             set,                /**< global SCIP settings */
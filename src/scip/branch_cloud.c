@@ -265,7 +265,11 @@ SCIP_DECL_BRANCHEXECLP(branchExeclpCloud)
    SCIP_CALL( SCIPstartClock(scip, branchruledata->cloudclock) );
    branchruledata->ntried++;
 
-   /* start diving to calculate the solution cloud */
+   /* start diving to calculate the solution cloud; all cloud points are computed within this single dive, which
+    * restricts the LP to the optimal face once and afterwards only changes objective coefficients, so each point is a
+    * warm-started resolve; the points are optimal for the current node's LP only and are therefore not kept for the
+    * children, whose LPs differ by the branching bound change
+    */
    SCIP_CALL( SCIPstartDive(scip) );
 
    /* fix variables with nonzero reduced costs to reduce LP to the optimal face */
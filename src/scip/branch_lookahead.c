@@ -4814,6 +4814,10 @@ SCIP_RETCODE selectVarRecursive(
     *   of the candidate array, but rather store at which index we stopped last time (e.g., because a domain reduction was
     *   found and applied) and start from that index next time. Even though the set of branching candidates is probably different
     *   it is often reasonably close and we avoid evaluating the same variables again and again.
+    *
+    * the candidates are evaluated one after another within the single probing LP of this SCIP instance; besides the
+    * shared probing state, the loop depends on its own history (domain reductions and binary constraints found for
+    * earlier candidates, early termination via isBranchFurtherLoopDecrement()), so it is not split over threads
     */
    for( i = 0, c = start;
         isBranchFurtherLoopDecrement(status, &c) && i < nlpcands && !SCIPisStopped(scip); i++, c++)
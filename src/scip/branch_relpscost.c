@@ -1035,6 +1035,9 @@ SCIP_RETCODE execRelpscost(
             pscostscore = SCIPgetVarPseudocostScore(scip, branchcands[c], branchcandssol[c]);
 
             /* replace the pseudo cost score with the already calculated one;
+             * strong branching results are only reused at the node where they were computed: across nodes, they enter
+             * the pseudocosts instead, and the reliability threshold decides when these are trusted enough to skip
+             * further strong branching on the variable
              * @todo: use old data for strong branching with propagation?
              */
             if( SCIPgetVarStrongbranchNode(scip, branchcands[c]) == nodenum )
@@ -56,6 +56,7 @@
                                             *   changes, stat updates etc.) ? */
 #define DEFAULT_COLLECTSCORES      FALSE   /**< should strong branching scores be collected ? */
 #define DEFAULT_DONOTBRANCH        FALSE   /**< should branching be done ? */
+#define DEFAULT_SCOREFILENAME      "-"     /**< file name to write the candidate scores of every call to ("-": none) */
 
 
 /** branching rule data */
@@ -69,6 +70,8 @@ struct SCIP_BranchruleData
                                                  *   changes, stat updates etc.) ? */
    SCIP_Bool             collectscores;         /**< should strong branching scores be collected ? */
    SCIP_Bool             donotbranch;           /**< should branching be done ? */
+   char*                 scorefilename;         /**< file name to write the candidate scores of every call to */
+   FILE*                 scorefile;             /**< file to write the candidate scores of every call to, or NULL */
    SCIP_VAR**            cands;                 /**< candidate variables */
    SCIP_Real*            candscores;            /**< candidate scores */
    int                   ncands;                /**< number of candidates */
@@ -268,6 +271,35 @@ SCIP_RETCODE runVanillaStrongBranching(
    return SCIP_OKAY;
 }
 
+/** appends the candidates and scores of the current call as one line per candidate to the score file */
+static
+void writeScores(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_BRANCHRULEDATA*  branchruledata      /**< branching rule data */
+   )
+{
+   SCIP_Longint nodenumber;
+   int depth;
+   int c;
+
+   assert(branchruledata != NULL);
+   assert(branchruledata->scorefile != NULL);
+   assert(branchruledata->candscores != NULL);
+
+   nodenumber = SCIPnodeGetNumber(SCIPgetCurrentNode(scip));
+   depth = SCIPgetDepth(scip);
+
+   for( c = 0; c < branchruledata->ncands; ++c )
+   {
+      SCIP_VAR* var;
+
+      var = branchruledata->cands[c];
+
+      fprintf(branchruledata->scorefile, "%" SCIP_LONGINT_FORMAT " %d %s %.15g %.15g %d\n", nodenumber, depth,
+         SCIPvarGetName(var), SCIPvarGetLPSol(var), branchruledata->candscores[c], c == branchruledata->bestcand ? 1 : 0);
+   }
+}
+
 /*
  * Callback methods
  */
@@ -346,6 +378,52 @@ SCIP_DECL_BRANCHEXIT(branchExitVanillafullstrong)
    return SCIP_OKAY;
 }
 
+/** solving process initialization method of branching rule (called when branch and bound process is about to begin) */
+static
+SCIP_DECL_BRANCHINITSOL(branchInitsolVanillafullstrong)
+{  /*lint --e{715}*/
+   SCIP_BRANCHRULEDATA* branchruledata;
+
+   branchruledata = SCIPbranchruleGetData(branchrule);
+   assert(branchruledata != NULL);
+   assert(branchruledata->scorefile == NULL);
+
+   /* open score file for writing */
+   if( branchruledata->collectscores
+      && strcmp(branchruledata->scorefilename, DEFAULT_SCOREFILENAME) != 0 )
+   {
+      branchruledata->scorefile = fopen(branchruledata->scorefilename, "w");
+
+      if( branchruledata->scorefile == NULL )
+      {
+         SCIPerrorMessage("Error: Could not open score file <%s>\n", branchruledata->scorefilename);
+         return SCIP_FILECREATEERROR;
+      }
+
+      SCIPdebugMsg(scip, "Writing strong branching scores to <%s>\n", branchruledata->scorefilename);
+   }
+
+   return SCIP_OKAY;
+}
+
+/** solving process deinitialization method of branching rule (called before branch and bound process data is freed) */
+static
+SCIP_DECL_BRANCHEXITSOL(branchExitsolVanillafullstrong)
+{  /*lint --e{715}*/
+   SCIP_BRANCHRULEDATA* branchruledata;
+
+   branchruledata = SCIPbranchruleGetData(branchrule);
+   assert(branchruledata != NULL);
+
+   if( branchruledata->scorefile != NULL )
+   {
+      fclose(branchruledata->scorefile);
+      branchruledata->scorefile = NULL;
+   }
+
+   return SCIP_OKAY;
+}
+
 /** branching execution method */
 static
 SCIP_DECL_BRANCHEXECLP(branchExeclpVanillafullstrong)
@@ -431,6 +509,9 @@ SCIP_DECL_BRANCHEXECLP(branchExeclpVanillafullstrong)
          &branchruledata->bestcand, &bestdown, &bestup, &bestscore, &bestdownvalid,
          &bestupvalid, &provedbound) );
 
+   if( branchruledata->scorefile != NULL && branchruledata->candscores != NULL )
+      writeScores(scip, branchruledata);
+
    if( !branchruledata->donotbranch )
    {
       SCIP_VAR* var;
@@ -508,6 +589,8 @@ SCIP_RETCODE SCIPincludeBranchruleVanillafullstrong(
    branchruledata->ncands = -1;
    branchruledata->npriocands = -1;
    branchruledata->bestcand = -1;
+   branchruledata->scorefilename = NULL;
+   branchruledata->scorefile = NULL;
 
    /* include branching rule */
    SCIP_CALL( SCIPincludeBranchruleBasic(scip, &branchrule, BRANCHRULE_NAME, BRANCHRULE_DESC, BRANCHRULE_PRIORITY,
@@ -520,6 +603,8 @@ SCIP_RETCODE SCIPincludeBranchruleVanillafullstrong(
    SCIP_CALL( SCIPsetBranchruleFree(scip, branchrule, branchFreeVanillafullstrong) );
    SCIP_CALL( SCIPsetBranchruleInit(scip, branchrule, branchInitVanillafullstrong) );
    SCIP_CALL( SCIPsetBranchruleExit(scip, branchrule, branchExitVanillafullstrong) );
+   SCIP_CALL( SCIPsetBranchruleInitsol(scip, branchrule, branchInitsolVanillafullstrong) );
+   SCIP_CALL( SCIPsetBranchruleExitsol(scip, branchrule, branchExitsolVanillafullstrong) );
    SCIP_CALL( SCIPsetBranchruleExecLp(scip, branchrule, branchExeclpVanillafullstrong) );
 
    /* fullstrong branching rule parameters */
@@ -543,6 +628,10 @@ SCIP_RETCODE SCIPincludeBranchruleVanillafullstrong(
          "branching/vanillafullstrong/donotbranch",
          "should candidates only be scored, but no branching be performed?",
          &branchruledata->donotbranch, TRUE, DEFAULT_DONOTBRANCH, NULL, NULL) );
+   SCIP_CALL( SCIPaddStringParam(scip,
+         "branching/vanillafullstrong/scorefilename",
+         "file name to write node number, depth, variable name, LP value, score and selection flag of every candidate to, if scores are collected (\"-\": none)",
+         &branchruledata->scorefilename, TRUE, DEFAULT_SCOREFILENAME, NULL, NULL) );
 
    return SCIP_OKAY;
 }
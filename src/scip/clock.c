@@ -31,6 +31,13 @@
 #endif
 #include <time.h>
 
+/* the time stamp counter is read with the rdtsc instruction on x86 processors and GCC compatible compilers */
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(_WIN32) && !defined(_WIN64)
+#include <x86intrin.h>
+#include <cpuid.h>
+#define SCIP_HAVE_TSC
+#endif
+
 #include "scip/def.h"
 #include "scip/pub_message.h"
 #include "blockmemshell/memory.h"
@@ -112,16 +119,109 @@ void sec2walltime(
 }
 
 
+/** length of the interval in seconds over which the time stamp counter is calibrated against the wall clock */
+#define TSC_CALIBRATIONTIME 0.01
+
+/** reads the time stamp counter */
+static
+SCIP_Longint tscRead(
+   void
+   )
+{
+#ifdef SCIP_HAVE_TSC
+   return (SCIP_Longint) __rdtsc();
+#else
+   return 0LL;
+#endif
+}
+
+/** determines the frequency of the time stamp counter in ticks per second, if the processor has an invariant counter,
+ *  that is, one that runs at a constant rate in all power states and is synchronized over all cores; returns -1.0 if no
+ *  invariant counter is available
+ *
+ *  The counter is compared to the wall clock over TSC_CALIBRATIONTIME seconds, during which this method busy waits.
+ */
+SCIP_Real SCIPclockCalibrateTsc(
+   void
+   )
+{
+   SCIP_Real tscfrequency;
+
+#ifdef SCIP_HAVE_TSC
+   struct timeval starttime; /*lint !e86*/
+   struct timeval now; /*lint !e86*/
+   unsigned int eax;
+   unsigned int ebx;
+   unsigned int ecx;
+   unsigned int edx;
+   SCIP_Longint startticks;
+   SCIP_Longint ticks;
+   SCIP_Real elapsed;
+
+   /* bit 8 of EDX of the extended CPUID leaf 0x80000007 reports an invariant time stamp counter */
+   if( __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0 || (edx & (1U << 8)) == 0 )
+      return -1.0;
+
+   gettimeofday(&starttime, NULL);
+   startticks = tscRead();
+   do
+   {
+      gettimeofday(&now, NULL);
+      ticks = tscRead();
+      elapsed = walltime2sec(now.tv_sec - starttime.tv_sec, now.tv_usec - starttime.tv_usec); /*lint !e115 !e40*/
+   }
+   while( elapsed < TSC_CALIBRATIONTIME );
+
+   tscfrequency = (ticks > startticks) ? (SCIP_Real)(ticks - startticks) / elapsed : -1.0;
+#else
+   tscfrequency = -1.0;
+#endif
+
+   SCIPdebugMessage("time stamp counter frequency: %g ticks per second\n", tscfrequency);
+
+   return tscfrequency;
+}
+
+/** converts time stamp counter ticks into seconds */
+static
+SCIP_Real tsctime2sec(
+   SCIP_Longint          ticks,              /**< time stamp counter ticks */
+   SCIP_Real             tscfrequency        /**< ticks of the time stamp counter per second */
+   )
+{
+   assert(tscfrequency > 0.0);
+
+   return (SCIP_Real)ticks / tscfrequency;
+}
+
+/** returns the given clock type, or the wall clock type if it is the time stamp counter clock and the frequency of the
+ *  time stamp counter is not known
+ */
+static
+SCIP_CLOCKTYPE clockGetAvailableType(
+   SCIP_CLOCKTYPE        clocktype,          /**< clock type */
+   SCIP_Real             tscfrequency        /**< ticks of the time stamp counter per second, or a nonpositive value */
+   )
+{
+   if( clocktype != SCIP_CLOCKTYPE_TSC )
+      return clocktype;
+
+   return tscfrequency > 0.0 ? SCIP_CLOCKTYPE_TSC : SCIP_CLOCKTYPE_WALL;
+}
+
 /** sets the clock's type and converts the clock timer accordingly */
 static
 void clockSetType(
    SCIP_CLOCK*           clck,               /**< clock timer */
-   SCIP_CLOCKTYPE        newtype             /**< new clock type */
+   SCIP_CLOCKTYPE        newtype,            /**< new clock type */
+   SCIP_Real             tscfrequency        /**< ticks of the time stamp counter per second, or a nonpositive value */
    )
 {
    assert(clck != NULL);
    assert(newtype != SCIP_CLOCKTYPE_DEFAULT);
 
+   newtype = clockGetAvailableType(newtype, tscfrequency);
+
    if( clck->clocktype != newtype )
    {
       if( clck->clocktype == SCIP_CLOCKTYPE_DEFAULT )
@@ -129,6 +229,8 @@ void clockSetType(
          assert(clck->nruns == 0);
          clck->clocktype = newtype;
          SCIPclockReset(clck);
+         if( newtype == SCIP_CLOCKTYPE_TSC )
+            clck->data.tscclock.frequency = tscfrequency;
          SCIPdebugMessage("switched clock type to %d\n", newtype);
       }
       else
@@ -137,6 +239,8 @@ void clockSetType(
 
          sec = SCIPclockGetTime(clck);
          clck->clocktype = newtype;
+         if( newtype == SCIP_CLOCKTYPE_TSC )
+            clck->data.tscclock.frequency = tscfrequency;
          SCIPclockSetTime(clck, sec);
          SCIPdebugMessage("switched clock type to %d (%g seconds -> %g seconds)\n", newtype, sec, SCIPclockGetTime(clck));
       }
@@ -147,14 +251,15 @@ void clockSetType(
 static
 void clockUpdateDefaultType(
    SCIP_CLOCK*           clck,               /**< clock timer */
-   SCIP_CLOCKTYPE        defaultclocktype    /**< default type of clock to use */
+   SCIP_CLOCKTYPE        defaultclocktype,   /**< default type of clock to use */
+   SCIP_Real             tscfrequency        /**< ticks of the time stamp counter per second, or a nonpositive value */
    )
 {
    assert(clck != NULL);
    assert(defaultclocktype != SCIP_CLOCKTYPE_DEFAULT);
 
-   if( clck->usedefault && clck->clocktype != defaultclocktype )
-      clockSetType(clck, defaultclocktype);
+   if( clck->usedefault && clck->clocktype != clockGetAvailableType(defaultclocktype, tscfrequency) )
+      clockSetType(clck, defaultclocktype, tscfrequency);
 }
 
 /** creates a clock and initializes it */
@@ -215,6 +320,9 @@ void SCIPclockReset(
       clck->data.wallclock.sec = 0;
       clck->data.wallclock.usec = 0;
       break;
+   case SCIP_CLOCKTYPE_TSC:
+      clck->data.tscclock.ticks = 0;
+      break;
    default:
       SCIPerrorMessage("invalid clock type\n");
       SCIPABORT();
@@ -272,7 +380,8 @@ void SCIPclockSetType(
    SCIPdebugMessage("setting type of clock %p (type %d, usedefault=%u) to %d\n", 
       (void*)clck, clck->clocktype, clck->usedefault, clocktype);
 
-   clck->clocktype = clocktype;
+   /* without the settings, the frequency of the time stamp counter is not known */
+   clck->clocktype = clockGetAvailableType(clocktype, -1.0);
    clck->usedefault = (clocktype == SCIP_CLOCKTYPE_DEFAULT);
    SCIPclockReset(clck);
 }
@@ -288,7 +397,7 @@ void SCIPclockStart(
 
    if( set->time_enabled && clck->enabled )
    {
-      clockUpdateDefaultType(clck, set->time_clocktype);
+      clockUpdateDefaultType(clck, set->time_clocktype, set->time_tscfrequency);
 
       if( clck->nruns == 0 )
       {
@@ -336,6 +445,11 @@ void SCIPclockStart(
             clck->lasttime = walltime2sec(clck->data.wallclock.sec, clck->data.wallclock.usec);
             break;
 
+         case SCIP_CLOCKTYPE_TSC:
+            /* the conversion into seconds is deferred until the time is queried */
+            clck->data.tscclock.ticks -= tscRead();
+            break;
+
          case SCIP_CLOCKTYPE_DEFAULT:
          default:
             SCIPerrorMessage("invalid clock type\n");
@@ -405,6 +519,10 @@ void SCIPclockStop(
 #endif
             break;
 
+         case SCIP_CLOCKTYPE_TSC:
+            clck->data.tscclock.ticks += tscRead();
+            break;
+
          case SCIP_CLOCKTYPE_DEFAULT:
          default:
             SCIPerrorMessage("invalid clock type\n");
@@ -450,6 +568,9 @@ SCIP_Real SCIPclockGetTime(
       case SCIP_CLOCKTYPE_WALL:
          result = walltime2sec(clck->data.wallclock.sec, clck->data.wallclock.usec);
          break;
+      case SCIP_CLOCKTYPE_TSC:
+         result = tsctime2sec(clck->data.tscclock.ticks, clck->data.tscclock.frequency);
+         break;
       default:
          SCIPerrorMessage("invalid clock type\n");
          SCIPABORT();
@@ -493,6 +614,9 @@ SCIP_Real SCIPclockGetTime(
                clck->data.wallclock.usec + tp.tv_usec); /*lint !e115 !e40*/
 #endif
          break;
+      case SCIP_CLOCKTYPE_TSC:
+         result = tsctime2sec(clck->data.tscclock.ticks + tscRead(), clck->data.tscclock.frequency);
+         break;
       case SCIP_CLOCKTYPE_DEFAULT:
       default:
          SCIPerrorMessage("invalid clock type\n");
@@ -528,7 +652,7 @@ void SCIPclockSetTime(
 
    /* if the clock type is not yet set, set it to an arbitrary value to be able to store the number */
    if( clck->clocktype == SCIP_CLOCKTYPE_DEFAULT )
-      clockSetType(clck, SCIP_CLOCKTYPE_WALL);
+      clockSetType(clck, SCIP_CLOCKTYPE_WALL, -1.0);
 
    switch( clck->clocktype )
    {
@@ -540,6 +664,10 @@ void SCIPclockSetTime(
       sec2walltime(sec, &clck->data.wallclock.sec, &clck->data.wallclock.usec);
       break;
 
+   case SCIP_CLOCKTYPE_TSC:
+      clck->data.tscclock.ticks = (SCIP_Longint)(sec * clck->data.tscclock.frequency);
+      break;
+
    case SCIP_CLOCKTYPE_DEFAULT:
    default:
       SCIPerrorMessage("invalid clock type\n");
@@ -589,6 +717,10 @@ void SCIPclockSetTime(
 #endif
          break;
 
+      case SCIP_CLOCKTYPE_TSC:
+         clck->data.tscclock.ticks -= tscRead();
+         break;
+
       case SCIP_CLOCKTYPE_DEFAULT:
       default:
          SCIPerrorMessage("invalid clock type\n");
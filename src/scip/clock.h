@@ -72,7 +72,19 @@ void SCIPclockEnableOrDisable(
    SCIP_Bool             enable              /**< should the clock be enabled? */
    );
 
-/** sets the type of the clock, overriding the default clock type, and resets the clock */
+/** determines the frequency of the time stamp counter in ticks per second, if the processor has an invariant counter,
+ *  that is, one that runs at a constant rate in all power states and is synchronized over all cores; returns -1.0 if no
+ *  invariant counter is available
+ *
+ *  The counter is compared to the wall clock over a short interval, during which this method busy waits.
+ */
+SCIP_Real SCIPclockCalibrateTsc(
+   void
+   );
+
+/** sets the type of the clock, overriding the default clock type, and resets the clock; the time stamp counter clock
+ *  is replaced by the wall clock, since its frequency is only known to the settings
+ */
 void SCIPclockSetType(
    SCIP_CLOCK*           clck,               /**< clock timer */
    SCIP_CLOCKTYPE        clocktype           /**< type of clock */
@@ -35,6 +35,7 @@
 #include "scip/scip_param.h"
 #include "scip/scip_prob.h"
 #include "scip/scip_reopt.h"
+#include "scip/scip_timing.h"
 #include <string.h>
 
 #define COMPR_NAME             "largestrepr"
@@ -45,6 +46,7 @@
 #define DEFAUL_MEM_REPR        10
 #define DEFAULT_ITERS           5
 #define DEFAULT_MINCOMMONVARS   3
+#define DEFAULT_MAXTIME         SCIP_REAL_MAX
 
 /*
  * Data structures
@@ -67,6 +69,7 @@ struct SCIP_ComprData
    /* parameters */
    int                   mincomvars;         /**< minimal number of common variables */
    int                   niters;             /**< number of runs in the constrained part */
+   SCIP_Real             maxtime;            /**< maximal time in seconds spent in one call of the compression */
 };
 
 
@@ -130,6 +133,7 @@ SCIP_RETCODE constructCompression(
    SCIP_Bool* covered;
    const char** varnames;
    SCIP_Real score;
+   SCIP_Real starttime;
    int nreps;
    SCIP_Longint* signature0;
    SCIP_Longint* signature1;
@@ -207,8 +211,17 @@ SCIP_RETCODE constructCompression(
       calcSignature(vars[k], vals[k], nvars[k], &signature0[k], &signature1[k]);
    }
 
+   starttime = SCIPgetSolvingTime(scip);
+
    for( start_id = 0; start_id < nleaveids; start_id++ )
    {
+      /* stop the search if the time budget is exhausted; the best representation found so far is kept */
+      if( SCIPisStopped(scip) || SCIPgetSolvingTime(scip) - starttime >= comprdata->maxtime )
+      {
+         SCIPdebugMsg(scip, "-> stop search for representations after %d of %d rounds\n", start_id, nleaveids);
+         break;
+      }
+
       nreps = -1;
       score = 0.0;
 
@@ -777,6 +790,9 @@ SCIP_RETCODE SCIPincludeComprLargestrepr(
          &comprdata->niters, FALSE, DEFAULT_ITERS, 1, INT_MAX, NULL, NULL) );
    SCIP_CALL( SCIPaddIntParam(scip, "compression/" COMPR_NAME "/mincommonvars", "minimal number of common variables.",
          &comprdata->mincomvars, FALSE, DEFAULT_MINCOMMONVARS, 1, INT_MAX, NULL, NULL) );
+   SCIP_CALL( SCIPaddRealParam(scip, "compression/" COMPR_NAME "/maxtime",
+         "maximal time in seconds spent in one call of the compression.",
+         &comprdata->maxtime, FALSE, DEFAULT_MAXTIME, 0.0, SCIP_REAL_MAX, NULL, NULL) );
 
    return SCIP_OKAY;
 }
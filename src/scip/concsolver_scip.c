@@ -252,7 +252,10 @@ SCIP_RETCODE initConcsolver(
    data->nvars = SCIPgetNVars(scip);
    vars = SCIPgetVars(scip);
 
-   /* create the concurrent solver's SCIP instance and set up the problem */
+   /* create the concurrent solver's SCIP instance and set up the problem; the copy is created right after presolving,
+    * before any LP has been solved in the main instance, so there is no root basis that could be passed on to the
+    * concurrent solvers; each of them solves its root LP with its own settings, which is part of the diversification
+    */
    SCIP_CALL( SCIPcreate(&data->solverscip) );
    SCIP_CALL( SCIPhashmapCreate(&varmapfw, SCIPblkmem(data->solverscip), data->nvars) );
    SCIP_CALL( SCIPcopy(scip, data->solverscip, varmapfw, NULL, SCIPconcsolverGetName(concsolver), TRUE, FALSE, FALSE,
@@ -577,7 +580,12 @@ SCIP_DECL_CONCSOLVERSTOP(concsolverScipStop)
    return SCIP_OKAY;
 }
 
-/** writes new solutions and global boundchanges to the iven synchronization data */
+/** writes new solutions and global boundchanges to the iven synchronization data
+ *
+ *  Branching histories (pseudocosts) are deliberately not exchanged: they are updated on every LP of each solver's own
+ *  tree (see SCIPhistoryUpdatePseudocost()), and sharing them would require synchronizing a hot path between threads
+ *  that otherwise only meet at the coarse synchronization points of the sync store.
+ */
 static
 SCIP_DECL_CONCSOLVERSYNCWRITE(concsolverScipSyncWrite)
 {
@@ -41,6 +41,7 @@
 #include "scip/event_globalbnd.h"
 #include "scip/scip.h"
 #include "scip/syncstore.h"
+#include "scip/trace.h"
 #include "scip/set.h"
 #include "tpi/tpi.h"
 
@@ -237,10 +238,16 @@ SCIP_RETCODE SCIPsynchronize(
    SCIP*                 scip                /**< SCIP datastructure */
    )
 {
+   SCIP_RETCODE retcode;
+
    assert(scip != NULL);
    assert(scip->concurrent != NULL);
 
-   SCIP_CALL( SCIPconcsolverSync(scip->concurrent->concsolver, scip->concurrent->mainscip->set) );
+   /* the trace event is closed also if synchronization fails */
+   SCIPtraceStart(scip->stat->trace, SCIP_TRACECAT_SYNC, "sync");
+   retcode = SCIPconcsolverSync(scip->concurrent->concsolver, scip->concurrent->mainscip->set);
+   SCIPtraceStop(scip->stat->trace, SCIP_TRACECAT_SYNC, "sync");
+   SCIP_CALL( retcode );
 
    scip->concurrent->mainscip->concurrent->solidx = scip->concurrent->mainscip->stat->solindex;
 
@@ -425,6 +432,19 @@ int SCIPgetConcurrentVaridx(
    return scip->concurrent->varperm[SCIPvarGetIndex(var)];
 }
 
+/** gets the index of the concurrent solver that solves the given SCIP instance, or -1 if it is not a concurrent solver */
+int SCIPgetConcurrentSolverIdx(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   assert(scip != NULL);
+
+   if( scip->concurrent == NULL )
+      return -1;
+
+   return SCIPconcsolverGetIdx(scip->concurrent->concsolver);
+}
+
 /** is the solution new since the last synchronization point */
 SCIP_Bool SCIPIsConcurrentSolNew(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -470,7 +490,14 @@ SCIP_RETCODE execConcsolver(
    return SCIP_OKAY;
 }
 
-/** start solving in parallel using the given set of concurrent solvers */
+/** start solving in parallel using the given set of concurrent solvers
+ *
+ *  @note each concurrent solver owns a complete copy of the problem and searches its own tree.  Solvers share only
+ *        solutions and global bound changes, through the synchronization store.  All data of a SCIP instance (tree,
+ *        LP, memory pools, plugin data) is owned by one thread, so nodes of one tree cannot be processed by several
+ *        threads.  Parallel tree search over a shared node pool is provided by the UG framework (FiberSCIP), which
+ *        runs one SCIP instance per worker.
+ */
 SCIP_RETCODE SCIPconcurrentSolve(
    SCIP*                 scip                /**< pointer to scip datastructure */
    )
@@ -716,6 +743,9 @@ SCIP_RETCODE SCIPcopyConcurrentSolvingStats(
    target->stat->nreprops = source->stat->nreprops;
    target->stat->nrepropboundchgs = source->stat->nrepropboundchgs;
    target->stat->nrepropcutoffs = source->stat->nrepropcutoffs;
+   target->stat->ndomprops = source->stat->ndomprops;
+   target->stat->nproprounds = source->stat->nproprounds;
+   target->stat->npropcutoffs = source->stat->npropcutoffs;
    target->stat->nlpsolsfound = source->stat->nlpsolsfound;
    target->stat->npssolsfound = source->stat->npssolsfound;
    target->stat->nsbsolsfound = source->stat->nsbsolsfound;
@@ -108,6 +108,11 @@ int SCIPgetConcurrentVaridx(
    SCIP_VAR*             var                 /**< variable */
    );
 
+/** gets the index of the concurrent solver that solves the given SCIP instance, or -1 if it is not a concurrent solver */
+int SCIPgetConcurrentSolverIdx(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
 /** has the solution been created after the last synchronization point */
 SCIP_Bool SCIPIsConcurrentSolNew(
    SCIP*                 scip,               /**< SCIP data structure */
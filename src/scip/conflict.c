@@ -1223,7 +1223,7 @@ SCIP_RETCODE conflictEnsureTmpbdchginfosMem(
    return SCIP_OKAY;
 }
 
-/** creates a temporary bound change information object that is destroyed after the conflict sets are flushed */
+/** creates a temporary bound change information object that is released after the conflict sets are flushed */
 static
 SCIP_RETCODE conflictCreateTmpBdchginfo(
    SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
@@ -1238,28 +1238,36 @@ SCIP_RETCODE conflictCreateTmpBdchginfo(
 {
    assert(conflict != NULL);
 
-   SCIP_CALL( conflictEnsureTmpbdchginfosMem(conflict, set, conflict->ntmpbdchginfos+1) );
-   SCIP_CALL( SCIPbdchginfoCreate(&conflict->tmpbdchginfos[conflict->ntmpbdchginfos], blkmem,
-         var, boundtype, oldbound, newbound) );
+   assert(conflict->ntmpbdchginfos <= conflict->nalloctmpbdchginfos);
+
+   /* reuse an object that was allocated in a previous conflict analysis, if possible */
+   if( conflict->ntmpbdchginfos < conflict->nalloctmpbdchginfos )
+   {
+      SCIPbdchginfoInit(conflict->tmpbdchginfos[conflict->ntmpbdchginfos], var, boundtype, oldbound, newbound);
+   }
+   else
+   {
+      SCIP_CALL( conflictEnsureTmpbdchginfosMem(conflict, set, conflict->ntmpbdchginfos+1) );
+      SCIP_CALL( SCIPbdchginfoCreate(&conflict->tmpbdchginfos[conflict->ntmpbdchginfos], blkmem,
+            var, boundtype, oldbound, newbound) );
+      conflict->nalloctmpbdchginfos++;
+   }
    *bdchginfo = conflict->tmpbdchginfos[conflict->ntmpbdchginfos];
    conflict->ntmpbdchginfos++;
 
    return SCIP_OKAY;
 }
 
-/** frees all temporarily created bound change information data */
+/** releases all temporarily created bound change information data; the objects stay allocated for reuse in later
+ *  conflict analyses and are only freed together with the conflict analysis data
+ */
 static
-void conflictFreeTmpBdchginfos(
-   SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
-   BMS_BLKMEM*           blkmem              /**< block memory */
+void conflictClearTmpBdchginfos(
+   SCIP_CONFLICT*        conflict            /**< conflict analysis data */
    )
 {
-   int i;
-
    assert(conflict != NULL);
 
-   for( i = 0; i < conflict->ntmpbdchginfos; ++i )
-      SCIPbdchginfoFree(&conflict->tmpbdchginfos[i], blkmem);
    conflict->ntmpbdchginfos = 0;
 }
 
@@ -2980,6 +2988,7 @@ SCIP_RETCODE createAndAddProofcons(
    SCIP_CONS* cons;
    SCIP_CONS* upgdcons;
    SCIP_VAR** vars;
+   SCIP_VAR** consvars;
    SCIP_Real* coefs;
    int* inds;
    SCIP_Real rhs;
@@ -3101,15 +3110,19 @@ SCIP_RETCODE createAndAddProofcons(
    else
       return SCIP_INVALIDCALL;
 
-   SCIP_CALL( SCIPcreateConsLinear(set->scip, &cons, name, 0, NULL, NULL, -SCIPsetInfinity(set), rhs,
+   /* collect the variables of the proof such that the constraint is created with all coefficients at once; adding
+    * them one by one would resize the constraint data after every coefficient
+    */
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &consvars, nnz) );
+
+   for( i = 0; i < nnz; i++ )
+      consvars[i] = vars[inds[i]];
+
+   SCIP_CALL( SCIPcreateConsLinear(set->scip, &cons, name, nnz, consvars, coefs, -SCIPsetInfinity(set), rhs,
          FALSE, FALSE, FALSE, FALSE, TRUE, !applyglobal,
          FALSE, TRUE, TRUE, FALSE) );
 
-   for( i = 0; i < nnz; i++ )
-   {
-      int v = inds[i];
-      SCIP_CALL( SCIPaddCoefLinear(set->scip, cons, vars[v], coefs[i]) );
-   }
+   SCIPsetFreeBufferArray(set, &consvars);
 
    /* do not upgrade linear constraints of size 1 */
    if( nnz > 1 )
@@ -3711,8 +3724,8 @@ SCIP_RETCODE SCIPconflictFlushConss(
       conflict->nconflictsets = 0;
    }
 
-   /* free all temporarily created bound change information data */
-   conflictFreeTmpBdchginfos(conflict, blkmem);
+   /* release all temporarily created bound change information data */
+   conflictClearTmpBdchginfos(conflict);
 
    return SCIP_OKAY;
 }
@@ -3907,6 +3920,7 @@ SCIP_RETCODE SCIPconflictCreate(
    (*conflict)->nproofsets = 0;
    (*conflict)->tmpbdchginfossize = 0;
    (*conflict)->ntmpbdchginfos = 0;
+   (*conflict)->nalloctmpbdchginfos = 0;
    (*conflict)->count = 0;
    (*conflict)->nglbchgbds = 0;
    (*conflict)->nappliedglbconss = 0;
@@ -3967,6 +3981,8 @@ SCIP_RETCODE SCIPconflictFree(
    BMS_BLKMEM*           blkmem              /**< block memory of transformed problem */
    )
 {
+   int i;
+
    assert(conflict != NULL);
    assert(*conflict != NULL);
    assert((*conflict)->nconflictsets == 0);
@@ -3987,6 +4003,10 @@ SCIP_RETCODE SCIPconflictFree(
    conflictsetFree(&(*conflict)->conflictset, blkmem);
    proofsetFree(&(*conflict)->proofset, blkmem);
 
+   /* free the temporary bound change information objects kept for reuse */
+   for( i = 0; i < (*conflict)->nalloctmpbdchginfos; ++i )
+      SCIPbdchginfoFree(&(*conflict)->tmpbdchginfos[i], blkmem);
+
    BMSfreeMemoryArrayNull(&(*conflict)->conflictsets);
    BMSfreeMemoryArrayNull(&(*conflict)->conflictsetscores);
    BMSfreeMemoryArrayNull(&(*conflict)->proofsets);
@@ -8639,6 +8659,14 @@ SCIP_RETCODE conflictAnalyzeBoundexceedingLP(
  *  a conflict constraint out of the resulting conflict set;
  *  updates statistics for infeasible or bound exceeding LP conflict analysis;
  *  may only be called if SCIPprobAllColsInLP()
+ *
+ *  @note The analysis runs synchronously at the node that produced the infeasible LP.  It needs more than a dual ray
+ *        and a bound snapshot: the bound heuristic (runBoundHeuristic()) resolves the LP in diving mode with relaxed
+ *        bounds, and conflict set resolution walks the bound change history of the current tree path.  Both the LP
+ *        solver and the tree are changed as soon as the next node is processed, so the analysis cannot be deferred
+ *        or moved to a worker thread without copying the LP and the tree path.  Its overhead
+ *        is controlled by the conflict/useinflp, conflict/useboundlp, conflict/maxlploops and conflict/lpiterations
+ *        parameters instead.
  */
 SCIP_RETCODE SCIPconflictAnalyzeLP(
    SCIP_CONFLICT*        conflict,           /**< conflict analysis data */
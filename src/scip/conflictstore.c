@@ -44,6 +44,7 @@
 #define CONFLICTSTORE_MAXSIZE    60000 /* maximal size of a dynamic conflict store (multiplied by 3) */
 #define CONFLICTSTORE_SIZE       10000 /* default size of conflict store */
 #define CONFLICTSTORE_SORTFREQ      20 /* frequency to resort the conflict array */
+#define CONFLICTSTORE_BATCHFRAC   0.01 /* fraction of the oldest conflicts removed at once after resorting a full store */
 
 /* event handler properties */
 #define EVENTHDLR_NAME         "ConflictStore"
@@ -648,8 +649,21 @@ SCIP_RETCODE conflictstoreCleanUpStorage(
 
    if( conflictstore->ncleanups % CONFLICTSTORE_SORTFREQ == 0 )
    {
-      /* remove conflict at first position (array is sorted) */
-      SCIP_CALL( delPosConflict(conflictstore, set, stat, transprob, blkmem, reopt, 0, TRUE) );
+      int nbatch;
+      int i;
+
+      /* remove a batch of the oldest conflicts at the beginning of the sorted array; we traverse backwards such that
+       * the conflicts swapped to the front are the youngest ones and the remaining old conflicts stay sorted, which
+       * keeps the partial scan below meaningful in the following clean-ups
+       */
+      nbatch = MAX(1, (int)(CONFLICTSTORE_BATCHFRAC * conflictstore->nconflicts));
+      assert(nbatch <= conflictstore->nconflicts);
+
+      for( i = nbatch-1; i >= 0; --i )
+      {
+         SCIP_CALL( delPosConflict(conflictstore, set, stat, transprob, blkmem, reopt, i, TRUE) );
+      }
+      ndelconfs += nbatch;
    }
    else
    {
@@ -676,8 +690,8 @@ SCIP_RETCODE conflictstoreCleanUpStorage(
 
       /* remove conflict at position oldest_i */
       SCIP_CALL( delPosConflict(conflictstore, set, stat, transprob, blkmem, reopt, oldest_i, TRUE) );
+      ++ndelconfs;
    }
-   ++ndelconfs;
 
    /* adjust size of the storage if we use a dynamic store */
    if( set->conf_maxstoresize == -1 )
@@ -945,6 +959,50 @@ SCIP_RETCODE SCIPconflictstoreClean(
    return SCIP_OKAY;
 }
 
+/** removes all conflicts that are marked as deleted and the older half of the remaining conflicts from the conflict
+ *  store; dual proofs are kept
+ */
+SCIP_RETCODE SCIPconflictstoreShrink(
+   SCIP_CONFLICTSTORE*   conflictstore,      /**< conflict store */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic SCIP statistics */
+   SCIP_PROB*            transprob,          /**< transformed problem */
+   SCIP_REOPT*           reopt,              /**< reoptimization data */
+   int*                  ndelconfs           /**< pointer to store the number of removed conflicts */
+   )
+{
+   int nold;
+   int i;
+
+   assert(conflictstore != NULL);
+   assert(ndelconfs != NULL);
+
+   *ndelconfs = 0;
+
+   SCIP_CALL( cleanDeletedAndCheckedConflicts(conflictstore, set, stat, blkmem, reopt, ndelconfs) );
+
+   if( conflictstore->nconflicts == 0 )
+      return SCIP_OKAY;
+
+   /* sort the conflicts by decreasing age and remove the older half; as in conflictstoreCleanUpStorage(), we traverse
+    * backwards such that the conflicts swapped to the front are younger ones
+    */
+   SCIPsortPtrReal((void**)conflictstore->conflicts, conflictstore->confprimalbnds, compareConss, conflictstore->nconflicts);
+
+   nold = conflictstore->nconflicts / 2;
+   for( i = nold-1; i >= 0; --i )
+   {
+      SCIP_CALL( delPosConflict(conflictstore, set, stat, transprob, blkmem, reopt, i, TRUE) );
+   }
+   *ndelconfs += nold;
+
+   SCIPsetDebugMsg(set, "shrunk conflict store: removed %d conflicts, %d remaining\n", *ndelconfs,
+      conflictstore->nconflicts);
+
+   return SCIP_OKAY;
+}
+
 /** adds a constraint to the pool of proof constraints based on dual rays
  *
  *  @note this methods captures the constraint
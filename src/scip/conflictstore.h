@@ -76,6 +76,19 @@ SCIP_RETCODE SCIPconflictstoreClean(
    SCIP_REOPT*           reopt               /**< reoptimization data */
    );
 
+/** removes all conflicts that are marked as deleted and the older half of the remaining conflicts from the conflict
+ *  store; dual proofs are kept
+ */
+SCIP_RETCODE SCIPconflictstoreShrink(
+   SCIP_CONFLICTSTORE*   conflictstore,      /**< conflict store */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< dynamic SCIP statistics */
+   SCIP_PROB*            transprob,          /**< transformed problem */
+   SCIP_REOPT*           reopt,              /**< reoptimization data */
+   int*                  ndelconfs           /**< pointer to store the number of removed conflicts */
+   );
+
 /** adds a constraint to the pool of proof constraints based on dual rays
  *
  *  @note this methods captures the constraint
@@ -2351,7 +2351,11 @@ SCIP_DECL_CONSPRESOL(consPresolComponents)
 
       SCIP_CALL( SCIPallocBufferArray(scip, &subvars, nsortedvars) );
 
-      /* loop over all components */
+      /* loop over all components; they are solved one after the other in the same sub-SCIP, which saves creating and
+       * including the plugins of a new sub-SCIP for every component; the results are applied to the main SCIP right
+       * away, the time limit of each solve accounts for the time spent on the previous components, and the loop stops
+       * as soon as a component is infeasible or only one component is left
+       */
       for( comp = 0; comp < ncompsmaxsize && !SCIPisStopped(scip); comp++ )
       {
 #ifdef WITH_DEBUG_SOLUTION
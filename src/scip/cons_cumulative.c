@@ -7313,6 +7313,11 @@ SCIP_RETCODE consCheckRedundancy(
 
 /** creates the worst case resource profile, that is, all jobs are inserted with the earliest start and latest
  *  completion time
+ *
+ *  The profile is rebuilt in each propagation call instead of being kept in the constraint data. It depends on the
+ *  local bounds, so a persistent profile would have to undo core changes on every node switch, including jumps
+ *  across the tree, and would have to catch bound change events for all jobs. Only jobs with a nonempty core are
+ *  inserted; in the upper part of the tree, where the time windows are wide, these are typically few.
  */
 static
 SCIP_RETCODE createCoreProfile(
@@ -7376,7 +7381,7 @@ SCIP_RETCODE createCoreProfile(
       SCIPdebugMsg(scip, "variable <%s>[%d,%d] (duration %d, demand %d): add core [%d,%d)\n",
          SCIPvarGetName(var), est, lst, duration, demand, begin, end);
 
-      /* insert the core into core resource profile (complexity O(log n)) */
+      /* insert the core into core resource profile (complexity O(n), since the sorted profile arrays are shifted) */
       SCIP_CALL( SCIPprofileInsertCore(profile, begin, end, demand, &pos, &infeasible) );
 
       /* in case the insertion of the core leads to an infeasibility; start the conflict analysis */
@@ -7404,7 +7409,14 @@ SCIP_RETCODE createCoreProfile(
    return SCIP_OKAY;
 }
 
-/** propagate the cumulative condition */
+/** propagate the cumulative condition
+ *
+ *  The cumulative constraints are propagated one after another, also if they model different resources. The
+ *  propagation algorithms tighten the bounds via SCIPinferVarLbCons() and SCIPinferVarUbCons(), which must not be
+ *  called concurrently, and each tightening is immediately visible to the next constraint sharing the job. This
+ *  ordering is also needed for the bound widening in conflict analysis. Within one call, the core profile is only
+ *  built once and shared by the time-table and the time-table edge-finding propagator.
+ */
 static
 SCIP_RETCODE propagateCumulativeCondition(
    SCIP*                 scip,               /**< SCIP data structure */
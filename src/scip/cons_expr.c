@@ -99,6 +99,10 @@
 
 #define BRANCH_RANDNUMINITSEED      20191229 /**< seed for random number generator, which is used to select from several similar good branching candidates */
 
+/* marks of variable expressions for their constraints that are pending from bound change events */
+#define PENDINGMARK_PROPAGATE          0x1u /**< constraints need to be propagated again */
+#define PENDINGMARK_SIMPLIFY           0x2u /**< constraints need to be simplified again */
+
 /* properties of the expression constraint handler statistics table */
 #define TABLE_NAME_EXPR                          "expression"
 #define TABLE_DESC_EXPR                          "expression constraint handler statistics"
@@ -152,6 +156,56 @@ struct SCIP_ExprConsUpgrade
 };
 typedef struct SCIP_ExprConsUpgrade SCIP_EXPRCONSUPGRADE;
 
+/** operations on an evaluation tape */
+enum ExprTapeOp
+{
+   EXPRTAPEOP_VAR     = 0,                   /**< variable */
+   EXPRTAPEOP_VALUE   = 1,                   /**< constant */
+   EXPRTAPEOP_SUM     = 2,                   /**< sum */
+   EXPRTAPEOP_PRODUCT = 3,                   /**< product */
+   EXPRTAPEOP_OTHER   = 4                    /**< any other expression, handled by the callbacks of its expression handler */
+};
+typedef enum ExprTapeOp EXPRTAPEOP;
+
+/** evaluation tape of the expression of a constraint
+ *
+ * The tape stores all subexpressions of an expression, each only once, such that children come before their
+ * parents. The positions of the children of the subexpression at position k are
+ * childidxs[childbegins[k]], ..., childidxs[childbegins[k+1]-1].
+ * Evaluation and differentiation loop over the tape without an expression iterator and handle variables, constants,
+ * sums, and products inline. The tape is only valid as long as the expression is not modified.
+ *
+ * The values and evaluation tags of the last evaluation are kept on the tape. This allows to re-evaluate only those
+ * subexpressions that depend on variables whose value changed, see evalExprTape().
+ */
+struct ExprTape
+{
+   SCIP_CONSEXPR_EXPR*   root;               /**< expression that the tape was built for */
+   SCIP_CONSEXPR_EXPR**  exprs;              /**< subexpressions of root in topological order, root is last */
+   EXPRTAPEOP*           ops;                /**< operation of each subexpression */
+   int*                  childbegins;        /**< start of the children of each subexpression in childidxs */
+   int*                  childidxs;          /**< positions of the children on the tape */
+   SCIP_Real*            vals;               /**< values of the subexpressions from the last evaluation */
+   SCIP_Real*            adjoints;           /**< working array for the partial derivatives w.r.t. the subexpressions */
+   unsigned int*         evaltags;           /**< evaluation tags that the subexpressions got in the last evaluation */
+   SCIP_Bool*            changed;            /**< whether the value of a subexpression changed in the last evaluation */
+   int                   nexprs;             /**< number of subexpressions on the tape */
+   int                   nchildidxs;         /**< length of the childidxs array */
+   SCIP_Bool             valsvalid;          /**< whether vals and evaltags are complete from the last evaluation */
+};
+typedef struct ExprTape EXPRTAPE;
+
+/** entry of the cache for eigenvalue decompositions of symmetric matrices */
+struct EigenCacheEntry
+{
+   int                   n;                  /**< dimension of matrix */
+   SCIP_Real*            matrix;             /**< matrix (n*n entries, as passed to LapackDsyev) */
+   SCIP_Real*            eigenvalues;        /**< eigenvalues of matrix */
+   SCIP_Real*            eigenvectors;       /**< eigenvectors of matrix (as returned by LapackDsyev), or NULL if not computed */
+   SCIP_Bool             success;            /**< whether the eigenvalue computation was successful */
+};
+typedef struct EigenCacheEntry EIGENCACHEENTRY;
+
 /** constraint data for expr constraints */
 struct SCIP_ConsData
 {
@@ -161,6 +215,9 @@ struct SCIP_ConsData
 
    SCIP_CONSEXPR_EXPR**  varexprs;           /**< array containing all variable expressions */
    int                   nvarexprs;          /**< total number of variable expressions */
+   int*                  hessrowbegins;      /**< start of rows of Hessian sparsity pattern w.r.t. varexprs, or NULL if not computed */
+   int*                  hesscolidxs;        /**< column indices of Hessian sparsity pattern (lower triangle) */
+   int                   nhessnz;            /**< number of nonzeros in Hessian sparsity pattern */
    SCIP_Bool             catchedevents;      /**< do we catch events on variables? */
 
    SCIP_Real             lhsviol;            /**< violation of left-hand side by current solution (used temporarily inside constraint handler) */
@@ -185,6 +242,8 @@ struct SCIP_ConsData
    SCIP_Real             linvarincrcoef;     /**< linear coefficient of linvarincr */
 
    int                   consindex;          /**< an index of the constraint that is unique among all expr-constraints in this SCIP instance and is constant */
+
+   EXPRTAPE*             tape;               /**< evaluation tape of expr, or NULL if not built */
 };
 
 /** constraint handler data */
@@ -203,6 +262,7 @@ struct SCIP_ConshdlrData
    SCIP_CONSEXPR_EXPRHDLR*  exprsignpowhdlr; /**< signed power expression handler */
    SCIP_CONSEXPR_EXPRHDLR*  exprexphdlr;     /**< exponential expression handler */
    SCIP_CONSEXPR_EXPRHDLR*  exprloghdlr;     /**< logarithm expression handler */
+   SCIP_CONSEXPR_EXPRHDLR*  exprentropyhdlr; /**< entropy expression handler */
 
    /* nonlinear handler */
    SCIP_CONSEXPR_NLHDLR**   nlhdlrs;         /**< nonlinear handlers */
@@ -233,6 +293,7 @@ struct SCIP_ConshdlrData
    unsigned int             curboundstag;    /**< tag indicating current variable bounds */
    unsigned int             lastboundrelax;  /**< tag when bounds where most recently relaxed */
    unsigned int             lastvaractivitymethodchange; /**< tag when method used to evaluate activity of variables changed last */
+   unsigned int             lastforcedreeval; /**< tag when a reevaluation of all activities was requested last, e.g., because nlhdlrs have new information */
    unsigned int             lastdifftag;     /**< last tag used for computing gradients */
    unsigned int             enforound;       /**< total number of enforcement calls, including current one */
 
@@ -241,7 +302,11 @@ struct SCIP_ConshdlrData
    /* activity intervals and domain propagation */
    SCIP_DECL_CONSEXPR_INTEVALVAR((*intevalvar)); /**< method currently used for activity calculation of variable expressions */
    SCIP_Bool                globalbounds;    /**< whether global variable bounds should be used for activity calculation */
-   SCIP_QUEUE*              reversepropqueue;  /**< expression queue to be used in reverse propagation, filled by SCIPtightenConsExprExprInterval */
+   SCIP_PQUEUE*             reversepropqueue;  /**< expression queue to be used in reverse propagation, filled by SCIPtightenConsExprExprInterval */
+   SCIP_Longint             nrevpropinserts; /**< number of insertions into the reverse propagation queue, used for FIFO order */
+   SCIP_CONSEXPR_EXPR**     pendingvarexprs; /**< variable expressions with bound change events whose constraints have not been marked yet */
+   int                      npendingvarexprs; /**< number of variable expressions in pendingvarexprs */
+   int                      pendingvarexprssize; /**< size of pendingvarexprs array */
    SCIP_Bool                forceboundtightening; /**< whether bound change passed to SCIPtightenConsExprExprInterval should be forced */
    unsigned int             curpropboundstag; /**< tag indicating current propagation rounds, to match with expr->propboundstag */
 
@@ -260,6 +325,13 @@ struct SCIP_ConshdlrData
    SCIP_Bool                forbidmultaggrnlvar; /**< whether to forbid multiaggregation of variables that appear in a nonlinear term of a constraint */
    SCIP_Bool                tightenlpfeastol;/**< whether to tighten LP feasibility tolerance during enforcement, if it seems useful */
    SCIP_Bool                propinenforce;   /**< whether to (re)run propagation in enforcement */
+   SCIP_Bool                memoactivity;    /**< whether to reuse the activity of an expression if activities of its descendants did not change */
+   SCIP_Bool                propcomponents;  /**< whether to propagate variable-disjoint components of the constraints separately */
+   SCIP_Bool                revpropprio;     /**< whether to order the reverse propagation queue by expected relative domain reduction instead of FIFO */
+   int                      maxrevpropexprs; /**< maximal number of expressions to reverse propagate per propagation round (-1: no limit) */
+   SCIP_Real                maxrevproptime;  /**< maximal time in seconds for reverse propagation per propagation round (-1: no limit) */
+   SCIP_Bool                evaltape;        /**< whether to evaluate constraints and their gradients by evaluation tapes in the solving stage */
+   SCIP_Bool                evalincremental; /**< whether evaluation tapes should only re-evaluate subexpressions that depend on changed variables */
    SCIP_Real                weakcutthreshold;/**< threshold for when to regard a cut from an estimator as weak */
    SCIP_Real                strongcutmaxcoef;/**< "strong" cuts will be scaled to have their maximal coef in [1/strongcutmaxcoef,strongcutmaxcoef] */
    SCIP_Bool                strongcutefficacy;/**< consider efficacy requirement when deciding whether a cut is "strong" */
@@ -301,10 +373,17 @@ struct SCIP_ConshdlrData
    int                      nbilinterms;     /**< total number of bilinear terms */
    int                      bilintermssize;  /**< size of bilinterms array */
 
+   /* cache of eigenvalue decompositions */
+   SCIP_HASHTABLE*          eigencache;      /**< hash table of eigenvalue decompositions of symmetric matrices, or NULL */
+   int                      eigencachemaxdim;/**< maximal dimension of matrices whose eigenvalue decomposition is cached */
+
    /* branching */
    SCIP_RANDNUMGEN*         branchrandnumgen;/**< random number generated used in branching variable selection */
    char                     branchpscostupdatestrategy; /**< value of parameter branching/lpgainnormalize */
 
+   /* reuse of estimators */
+   SCIP_ROWPREPPOOL*        rowpreppool;     /**< pool of rowpreps for estimators during solve, or NULL if not solving */
+
    /* misc */
    SCIP_Bool                checkedvarlocks; /**< whether variables contained in a single constraint have been already considered */
 };
@@ -782,6 +861,7 @@ SCIP_RETCODE copyConshdlrExprExprHdlr(
    conshdlrdata->exprsignpowhdlr = SCIPfindConsExprExprHdlr(conshdlr, "signpower");
    conshdlrdata->exprexphdlr = SCIPfindConsExprExprHdlr(conshdlr, "exp");
    conshdlrdata->exprloghdlr = SCIPfindConsExprExprHdlr(conshdlr, "log");
+   conshdlrdata->exprentropyhdlr = SCIPfindConsExprExprHdlr(conshdlr, "entropy");
 
    /* copy nonlinear handlers */
    for( i = 0; i < sourceconshdlrdata->nnlhdlrs; ++i )
@@ -1319,6 +1399,9 @@ SCIP_RETCODE forwardPropExpr(
    SCIP_CONSEXPR_ITERATOR* it;
    SCIP_CONSEXPR_EXPR* expr;
    SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_INTERVAL oldactivity;
+   unsigned int maxchildchgtag;
+   int c;
 
    assert(scip != NULL);
    assert(rootexpr != NULL);
@@ -1430,10 +1513,36 @@ SCIP_RETCODE forwardPropExpr(
                break;
             }
 
+            /* the activity of all children is uptodate now; remember when the last change happened below expr */
+            maxchildchgtag = 0;
+            for( c = 0; c < expr->nchildren; ++c )
+               maxchildchgtag = MAX(maxchildchgtag, expr->children[c]->activitychgtag);
+
+            /* if the activities of all descendants did not change since the activity of expr was computed, then
+             * a reevaluation would give the same activity (up to changes in the bounds of auxiliary variables that
+             * nlhdlrs may look at), so we only update the tag
+             * this requires the activity to be still valid, that is, no bounds were relaxed and the method to evaluate
+             * the activity of variables did not change, and no reevaluation was forced by SCIPincrementConsExprCurBoundsTag()
+             */
+            if( conshdlrdata->memoactivity && expr->nchildren > 0 && !conshdlrdata->indetect && !conshdlrdata->globalbounds &&
+                  expr->activitytag >= conshdlrdata->lastboundrelax && expr->activitytag >= conshdlrdata->lastvaractivitymethodchange &&
+                  expr->activitytag >= conshdlrdata->lastforcedreeval &&
+                  maxchildchgtag <= expr->activitytag && !SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, expr->activity) )
+            {
+#ifdef DEBUG_PROP
+               SCIPdebugMsg(scip, "skip interval evaluation of expr %p, no descendant changed since tag %u\n", (void*)expr, expr->activitytag);
+#endif
+               expr->activitytag = conshdlrdata->curboundstag;
+
+               break;
+            }
+
+            oldactivity = expr->activity;
             if( expr->activitytag < conshdlrdata->lastboundrelax )
             {
                /* reset activity to entire if invalid, so we can use it as starting point below */
                SCIPintervalSetEntire(SCIP_INTERVAL_INFINITY, &expr->activity);
+               SCIPintervalSetEmpty(&oldactivity);
             }
             else if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, expr->activity) )
             {
@@ -1551,6 +1660,11 @@ SCIP_RETCODE forwardPropExpr(
             /* remember that activity is uptodate now */
             expr->activitytag = conshdlrdata->curboundstag;
 
+            /* remember when the activity of expr or a descendant changed */
+            expr->activitychgtag = MAX(expr->activitychgtag, maxchildchgtag);
+            if( oldactivity.inf != expr->activity.inf || oldactivity.sup != expr->activity.sup )  /*lint !e777*/
+               expr->activitychgtag = conshdlrdata->curboundstag;
+
             if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, expr->activity) )
             {
                if( infeasible != NULL )
@@ -1586,9 +1700,101 @@ SCIP_RETCODE forwardPropExpr(
    return SCIP_OKAY;
 }
 
+/** compares two expressions in the reverse propagation queue by their priority */
+static
+SCIP_DECL_SORTPTRCOMP(revpropQueueComp)
+{
+   SCIP_Real prio1;
+   SCIP_Real prio2;
+
+   prio1 = ((SCIP_CONSEXPR_EXPR*)elem1)->propprio;
+   prio2 = ((SCIP_CONSEXPR_EXPR*)elem2)->propprio;
+
+   if( prio1 > prio2 )
+      return -1;
+   if( prio1 < prio2 )
+      return 1;
+   return 0;
+}
+
+/** computes the expected relative domain reduction when reverse propagating new bounds of an expression
+ *
+ *  This is the fraction by which the width of the activity shrinks, where an infinite bound that becomes finite counts
+ *  as a reduction of 1.
+ */
+static
+SCIP_Real getRevpropReduction(
+   SCIP_INTERVAL         newbounds,          /**< new bounds of expression */
+   SCIP_INTERVAL         activity            /**< current activity of expression */
+   )
+{
+   SCIP_Real actwidth;
+
+   if( (activity.inf <= -SCIP_INTERVAL_INFINITY && newbounds.inf > -SCIP_INTERVAL_INFINITY) ||
+      ( activity.sup >=  SCIP_INTERVAL_INFINITY && newbounds.sup <  SCIP_INTERVAL_INFINITY) )
+      return 1.0;
+
+   if( activity.inf <= -SCIP_INTERVAL_INFINITY || activity.sup >= SCIP_INTERVAL_INFINITY )
+      return 0.0;
+
+   actwidth = activity.sup - activity.inf;
+   if( actwidth <= 0.0 )
+      return 0.0;
+
+   return MAX(0.0, 1.0 - (newbounds.sup - newbounds.inf) / actwidth);
+}
+
+/** inserts an expression into the reverse propagation queue */
+static
+SCIP_RETCODE insertRevpropQueue(
+   SCIP_CONSHDLRDATA*    conshdlrdata,       /**< constraint handler data */
+   SCIP_CONSEXPR_EXPR*   expr,               /**< expression that got tighter propbounds */
+   SCIP_INTERVAL         newbounds           /**< new bounds of expression */
+   )
+{
+   assert(conshdlrdata != NULL);
+   assert(expr != NULL);
+   assert(!expr->inpropqueue);
+
+   /* without priorities, earlier insertions get a higher priority, which gives FIFO order */
+   if( conshdlrdata->revpropprio )
+      expr->propprio = getRevpropReduction(newbounds, expr->activity);
+   else
+      expr->propprio = -(SCIP_Real)conshdlrdata->nrevpropinserts;
+   ++conshdlrdata->nrevpropinserts;
+
+   SCIP_CALL( SCIPpqueueInsert(conshdlrdata->reversepropqueue, expr) );
+   expr->inpropqueue = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** removes all expressions from the reverse propagation queue */
+static
+void clearRevpropQueue(
+   SCIP_CONSHDLRDATA*    conshdlrdata        /**< constraint handler data */
+   )
+{
+   SCIP_CONSEXPR_EXPR* expr;
+
+   assert(conshdlrdata != NULL);
+
+   while( SCIPpqueueNElems(conshdlrdata->reversepropqueue) > 0 )
+   {
+      expr = (SCIP_CONSEXPR_EXPR*) SCIPpqueueRemove(conshdlrdata->reversepropqueue);
+
+      /* mark that the expression is not in the queue anymore */
+      expr->inpropqueue = FALSE;
+   }
+}
+
 /** propagates bounds for each sub-expression in the reversepropqueue by starting from the root expressions
  *
- *  the expression will be traversed in breadth first search by using this queue
+ *  the expressions are processed in FIFO order, which gives a breadth first search, or by decreasing expected relative
+ *  domain reduction if revpropprio is enabled
+ *
+ *  if limitwork is TRUE, then at most maxrevpropexprs expressions are processed and the time limit maxrevproptime
+ *  applies; expressions that have not been processed stay in the queue
  *
  *  @note calling this function requires feasible intervals for each sub-expression; this is guaranteed by calling
  *  forwardPropExpr() before calling this function
@@ -1599,11 +1805,14 @@ static
 SCIP_RETCODE reversePropQueue(
    SCIP*                   scip,             /**< SCIP data structure */
    SCIP_CONSHDLR*          conshdlr,         /**< constraint handler */
+   SCIP_Bool               limitwork,        /**< whether to stop when the work limits for reverse propagation are reached */
    SCIP_Bool*              infeasible,       /**< buffer to update whether an expression's bounds were propagated to an empty interval */
    int*                    ntightenings      /**< buffer to store the number of (variable) tightenings */
    )
 {
    SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_Real starttime = 0.0;
+   int nprocessed;
 
    assert(infeasible != NULL);
    assert(ntightenings != NULL);
@@ -1612,17 +1821,34 @@ SCIP_RETCODE reversePropQueue(
    assert(conshdlrdata != NULL);
 
    *ntightenings = 0;
+   nprocessed = 0;
+
+   if( limitwork && conshdlrdata->maxrevproptime >= 0.0 )
+      starttime = SCIPgetSolvingTime(scip);
 
    /* main loop that calls reverse propagation for expressions on the queue
     * when reverseprop finds a tightening for an expression, then that expression is added to the queue (within the reverseprop call)
     */
-   while( !SCIPqueueIsEmpty(conshdlrdata->reversepropqueue) && !(*infeasible) )
+   while( SCIPpqueueNElems(conshdlrdata->reversepropqueue) > 0 && !(*infeasible) )
    {
       SCIP_CONSEXPR_EXPR* expr;
       SCIP_INTERVAL propbounds;
       int e;
 
-      expr = (SCIP_CONSEXPR_EXPR*) SCIPqueueRemove(conshdlrdata->reversepropqueue);
+      /* stop if the work limits are reached; the remaining expressions stay in the queue */
+      if( limitwork )
+      {
+         if( conshdlrdata->maxrevpropexprs >= 0 && nprocessed >= conshdlrdata->maxrevpropexprs )
+            break;
+
+         /* check time only every 16 expressions, since getting the time is not free */
+         if( conshdlrdata->maxrevproptime >= 0.0 && (nprocessed & 15) == 15 &&
+            SCIPgetSolvingTime(scip) - starttime >= conshdlrdata->maxrevproptime )
+            break;
+      }
+      ++nprocessed;
+
+      expr = (SCIP_CONSEXPR_EXPR*) SCIPpqueueRemove(conshdlrdata->reversepropqueue);
       assert(expr != NULL);
       assert(expr->inpropqueue);
       /* mark that the expression is not in the queue anymore */
@@ -1703,20 +1929,114 @@ SCIP_RETCODE reversePropQueue(
    }
 
    /* reset inpropqueue for all remaining expr's in queue (can happen in case of early stop due to infeasibility) */
-   while( !SCIPqueueIsEmpty(conshdlrdata->reversepropqueue) )
+   if( *infeasible )
+      clearRevpropQueue(conshdlrdata);
+
+   return SCIP_OKAY;
+}
+
+/** remembers that the constraints of a variable expression need to be marked for propagation and/or simplification */
+static
+SCIP_RETCODE addPendingVarMarks(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_CONSEXPR_EXPR*   expr,               /**< variable expression */
+   unsigned int          marks               /**< marks to add (PENDINGMARK_PROPAGATE and/or PENDINGMARK_SIMPLIFY) */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert(expr != NULL);
+   assert(SCIPisConsExprExprVar(expr));
+   assert(marks != 0);
+
+   /* variable expression is already pending */
+   if( expr->pendingmarks != 0 )
+   {
+      expr->pendingmarks |= marks;
+      return SCIP_OKAY;
+   }
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   ENSUREBLOCKMEMORYARRAYSIZE(scip, conshdlrdata->pendingvarexprs, conshdlrdata->pendingvarexprssize,
+      conshdlrdata->npendingvarexprs + 1);
+
+   /* capture expression, so it stays alive until the marks have been applied */
+   SCIPcaptureConsExprExpr(expr);
+   conshdlrdata->pendingvarexprs[conshdlrdata->npendingvarexprs++] = expr;
+   expr->pendingmarks = marks;
+
+   return SCIP_OKAY;
+}
+
+/** marks the constraints of all variable expressions with pending bound change events for propagation and/or
+ *  simplification
+ *
+ *  Needs to be called before ispropagated or issimplified flags of constraints are looked at.
+ */
+static
+SCIP_RETCODE applyPendingVarMarks(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr            /**< expression constraint handler */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   int i;
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   for( i = 0; i < conshdlrdata->npendingvarexprs; ++i )
    {
       SCIP_CONSEXPR_EXPR* expr;
+      SCIP_CONSDATA* consdata;
+      SCIP_CONS** conss;
+      int nconss;
+      int c;
+
+      expr = conshdlrdata->pendingvarexprs[i];
+      assert(expr != NULL);
+      assert(expr->pendingmarks != 0);
 
-      expr = (SCIP_CONSEXPR_EXPR*) SCIPqueueRemove(conshdlrdata->reversepropqueue);
+      nconss = SCIPgetConsExprExprVarNConss(expr);
+      conss = SCIPgetConsExprExprVarConss(expr);
+      assert(conss != NULL || nconss == 0);
 
-      /* mark that the expression is not in the queue anymore */
-      expr->inpropqueue = FALSE;
+      for( c = 0; c < nconss; ++c )
+      {
+         assert(conss[c] != NULL);  /*lint !e613*/
+         consdata = SCIPconsGetData(conss[c]);  /*lint !e613*/
+
+         /* if boundtightening, then mark constraints to be propagated again
+          * TODO we could try be more selective here and only trigger a propagation if a relevant bound has changed,
+          *   that is, we don't need to repropagate x + ... <= rhs if only the upper bound of x has been tightened
+          *   the locks could help if they were available on a per-constraint base, but they aren't (and it may not be worth it)
+          */
+         if( expr->pendingmarks & PENDINGMARK_PROPAGATE )
+         {
+            consdata->ispropagated = FALSE;
+            SCIPdebugMsg(scip, "  marked <%s> for propagate\n", SCIPconsGetName(conss[c]));  /*lint !e613*/
+         }
+
+         /* if the event happened in presolve (but not probing), then mark constraints to be unsimplified */
+         if( expr->pendingmarks & PENDINGMARK_SIMPLIFY )
+         {
+            consdata->issimplified = FALSE;
+            SCIPdebugMsg(scip, "  marked <%s> for simplify\n", SCIPconsGetName(conss[c]));  /*lint !e613*/
+         }
+      }
+
+      expr->pendingmarks = 0;
+      SCIP_CALL( SCIPreleaseConsExprExpr(scip, &conshdlrdata->pendingvarexprs[i]) );
    }
+   conshdlrdata->npendingvarexprs = 0;
 
    return SCIP_OKAY;
 }
 
-/** calls domain propagation for a given set of constraints
+/** applies rounds of domain propagation to a given set of constraints
  *
  *  The algorithm alternates calls of forward and reverse propagation.
  *  Forward propagation ensures that activity of expressions is uptodate.
@@ -1744,7 +2064,7 @@ SCIP_RETCODE reversePropQueue(
  *    e.g., try less to propagate on convex constraints?
  */
 static
-SCIP_RETCODE propConss(
+SCIP_RETCODE propConssRounds(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
    SCIP_CONS**           conss,              /**< constraints to propagate */
@@ -1803,7 +2123,11 @@ SCIP_RETCODE propConss(
    {
       SCIPdebugMsg(scip, "start propagation round %d\n", roundnr);
 
-      assert(SCIPqueueIsEmpty(conshdlrdata->reversepropqueue));
+      /* the queue may still hold expressions if the work limits of reverse propagation stopped the previous round */
+      assert(SCIPpqueueNElems(conshdlrdata->reversepropqueue) == 0 || roundnr > 0);
+
+      /* mark constraints whose variables had bounds tightened since the last round */
+      SCIP_CALL( applyPendingVarMarks(scip, conshdlr) );
 
       /* apply forward propagation (update expression activities)
        * and add promising root expressions into queue for reversepropagation
@@ -1896,9 +2220,9 @@ SCIP_RETCODE propConss(
       }
 
       /* apply backward propagation (if cutoff is TRUE, then this call empties the queue) */
-      SCIP_CALL( reversePropQueue(scip, conshdlr, &cutoff, &ntightenings) );
+      SCIP_CALL( reversePropQueue(scip, conshdlr, TRUE, &cutoff, &ntightenings) );
       assert(ntightenings >= 0);
-      assert(SCIPqueueIsEmpty(conshdlrdata->reversepropqueue));
+      assert(!cutoff || SCIPpqueueNElems(conshdlrdata->reversepropqueue) == 0);
 
       if( cutoff )
       {
@@ -1913,7 +2237,10 @@ SCIP_RETCODE propConss(
          *result = SCIP_REDUCEDDOM;
       }
    }
-   while( ntightenings > 0 && ++roundnr < conshdlrdata->maxproprounds );
+   while( (ntightenings > 0 || SCIPpqueueNElems(conshdlrdata->reversepropqueue) > 0) && ++roundnr < conshdlrdata->maxproprounds );
+
+   /* drop expressions that are left over since the round limit was reached, as their propbounds become invalid now */
+   clearRevpropQueue(conshdlrdata);
 
    if( conshdlrdata->propauxvars )
    {
@@ -1928,6 +2255,159 @@ SCIP_RETCODE propConss(
    return SCIP_OKAY;
 }
 
+/** sorts constraints by the variable-disjoint components that they belong to
+ *
+ *  Two constraints belong to the same component if they share a variable, or if there is a sequence of constraints
+ *  that connects them via shared variables. The components are computed by a union-find data structure with respect
+ *  to the variable expressions stored in the constraint data.
+ *  If the variable expressions are not available for all constraints, then only one component is returned.
+ */
+static
+SCIP_RETCODE sortConssByComponent(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           conss,              /**< constraints */
+   int                   nconss,             /**< number of constraints */
+   SCIP_CONS**           sortedconss,        /**< buffer to store constraints sorted by component */
+   int*                  compstarts,         /**< buffer of length nconss+1 to store the start of each component in sortedconss */
+   int*                  ncomponents         /**< buffer to store the number of components */
+   )
+{
+   SCIP_CONSDATA* consdata;
+   SCIP_DISJOINTSET* djset;
+   SCIP_HASHMAP* var2cons;
+   SCIP_VAR* var;
+   int* compids;
+   int i;
+   int v;
+
+   assert(conss != NULL);
+   assert(nconss > 0);
+   assert(sortedconss != NULL);
+   assert(compstarts != NULL);
+   assert(ncomponents != NULL);
+
+   BMScopyMemoryArray(sortedconss, conss, nconss);
+   compstarts[0] = 0;
+   compstarts[1] = nconss;
+   *ncomponents = 1;
+
+   for( i = 0; i < nconss; ++i )
+      if( SCIPconsGetData(conss[i])->varexprs == NULL )
+         return SCIP_OKAY;
+
+   SCIP_CALL( SCIPcreateDisjointset(scip, &djset, nconss) );
+   SCIP_CALL( SCIPhashmapCreate(&var2cons, SCIPblkmem(scip), MAX(SCIPgetNVars(scip), 1)) );
+
+   /* unite each constraint with the first constraint that contained one of its variables */
+   for( i = 0; i < nconss; ++i )
+   {
+      consdata = SCIPconsGetData(conss[i]);
+      assert(consdata != NULL);
+
+      for( v = 0; v < consdata->nvarexprs; ++v )
+      {
+         var = SCIPgetConsExprExprVarVar(consdata->varexprs[v]);
+
+         if( SCIPhashmapExists(var2cons, (void*)var) )
+         {
+            SCIPdisjointsetUnion(djset, i, SCIPhashmapGetImageInt(var2cons, (void*)var), FALSE);
+         }
+         else
+         {
+            SCIP_CALL( SCIPhashmapInsertInt(var2cons, (void*)var, i) );
+         }
+      }
+   }
+
+   if( SCIPdisjointsetGetComponentCount(djset) > 1 )
+   {
+      SCIP_CALL( SCIPallocBufferArray(scip, &compids, nconss) );
+
+      for( i = 0; i < nconss; ++i )
+         compids[i] = SCIPdisjointsetFind(djset, i);
+
+      SCIPsortIntPtr(compids, (void**)sortedconss, nconss);
+
+      *ncomponents = 0;
+      for( i = 0; i < nconss; ++i )
+         if( i == 0 || compids[i] != compids[i-1] )
+            compstarts[(*ncomponents)++] = i;
+      compstarts[*ncomponents] = nconss;
+
+      assert(*ncomponents == SCIPdisjointsetGetComponentCount(djset));
+
+      SCIPfreeBufferArray(scip, &compids);
+   }
+
+   SCIPhashmapFree(&var2cons);
+   SCIPfreeDisjointset(scip, &djset);
+
+   return SCIP_OKAY;
+}
+
+/** calls domain propagation for a given set of constraints
+ *
+ *  If propagation by components is enabled, then the constraints are partitioned into variable-disjoint components and
+ *  the propagation rounds of propConssRounds() are applied to each component separately. Thus, the propagation
+ *  round limit applies to each component, and components where no tightening has been found do not have to wait for
+ *  other components to reach their fixpoint.
+ */
+static
+SCIP_RETCODE propConss(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< constraint handler */
+   SCIP_CONS**           conss,              /**< constraints to propagate */
+   int                   nconss,             /**< total number of constraints */
+   SCIP_Bool             force,              /**< force tightening even if below bound strengthening tolerance */
+   SCIP_RESULT*          result,             /**< pointer to store the result */
+   int*                  nchgbds             /**< buffer to add the number of changed bounds */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONS** sortedconss;
+   SCIP_RESULT compresult;
+   int* compstarts;
+   int ncomponents;
+   int c;
+
+   assert(result != NULL);
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   if( !conshdlrdata->propcomponents || nconss <= 1 )
+   {
+      SCIP_CALL( propConssRounds(scip, conshdlr, conss, nconss, force, result, nchgbds) );
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &sortedconss, nconss) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &compstarts, nconss + 1) );
+
+   SCIP_CALL( sortConssByComponent(scip, conss, nconss, sortedconss, compstarts, &ncomponents) );
+
+   *result = SCIP_DIDNOTRUN;
+   for( c = 0; c < ncomponents; ++c )
+   {
+      SCIP_CALL( propConssRounds(scip, conshdlr, &sortedconss[compstarts[c]], compstarts[c+1] - compstarts[c], force,
+            &compresult, nchgbds) );
+
+      if( compresult == SCIP_CUTOFF )
+      {
+         *result = SCIP_CUTOFF;
+         break;
+      }
+
+      if( compresult == SCIP_REDUCEDDOM || (compresult == SCIP_DIDNOTFIND && *result == SCIP_DIDNOTRUN) )
+         *result = compresult;
+   }
+
+   SCIPfreeBufferArray(scip, &compstarts);
+   SCIPfreeBufferArray(scip, &sortedconss);
+
+   return SCIP_OKAY;
+}
+
 /* calls the reverseprop callbacks of all nlhdlrs in all expressions in all constraints using activity as bounds
  *
  * This is meant to propagate any domain restricitions on functions onto variable bounds, if possible.
@@ -1963,7 +2443,7 @@ SCIP_RETCODE propExprDomains(
 
    assert(SCIPconshdlrGetData(conshdlr)->intevalvar == intEvalVarBoundTightening);
    assert(!SCIPconshdlrGetData(conshdlr)->globalbounds);
-   assert(SCIPqueueIsEmpty(SCIPconshdlrGetData(conshdlr)->reversepropqueue));
+   assert(SCIPpqueueNElems(SCIPconshdlrGetData(conshdlr)->reversepropqueue) == 0);
 
    *result = SCIP_DIDNOTFIND;
 
@@ -2019,8 +2499,9 @@ SCIP_RETCODE propExprDomains(
    }
 
    /* apply backward propagation (if cutoff is TRUE, then this call empties the queue) */
-   SCIP_CALL( reversePropQueue(scip, conshdlr, &cutoff, &ntightenings) );
+   SCIP_CALL( reversePropQueue(scip, conshdlr, FALSE, &cutoff, &ntightenings) );
    assert(ntightenings >= 0);
+   assert(SCIPpqueueNElems(SCIPconshdlrGetData(conshdlr)->reversepropqueue) == 0);
 
    if( cutoff )
    {
@@ -2424,7 +2905,15 @@ SCIP_RETCODE detectNlhdlr(
    return SCIP_OKAY;
 }
 
-/** detect nlhdlrs that can handle the expressions */
+/** detect nlhdlrs that can handle the expressions
+ *
+ * Detection runs constraint by constraint and expression by expression. The detect callbacks are not read-only:
+ * they register usage of auxiliary variables and activities of subexpressions (which creates and adds variables to
+ * SCIP and may trigger forwardPropExpr()), allocate from the block memory of the SCIP instance, and rely on the
+ * indetect flag and the enforcement data of common subexpressions that other constraints may share. Therefore, a
+ * constraint may only be detected after the constraints before it; the time spent per nlhdlr is shown in the nlhdlr
+ * statistics.
+ */
 static
 SCIP_RETCODE detectNlhdlrs(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -2850,24 +3339,227 @@ SCIP_RETCODE storeVarExprs(
    return SCIP_OKAY;
 }
 
-/** frees all variable expression stored in storeVarExprs() */
+/** frees the Hessian sparsity pattern of a constraint */
 static
-SCIP_RETCODE freeVarExprs(
+void freeHessianSparsity(
    SCIP*                   scip,             /**< SCIP data structure */
    SCIP_CONSDATA*          consdata          /**< constraint data */
    )
 {
-   int i;
-
    assert(consdata != NULL);
 
-   /* skip if we have stored the variable expressions already*/
+   if( consdata->hessrowbegins == NULL )
+      return;
+
+   SCIPfreeBlockMemoryArrayNull(scip, &consdata->hesscolidxs, consdata->nhessnz);
+   SCIPfreeBlockMemoryArray(scip, &consdata->hessrowbegins, consdata->nvarexprs + 1);
+   consdata->nhessnz = 0;
+}
+
+/** adds the entries of the Hessian sparsity pattern of a nonlinear subexpression to a hash set
+ *
+ * An entry for the pair of variables (i,j), i >= j, is stored as i * nvars + j + 1 (0 is not allowed in a hash set).
+ * If the expression is a product of distinct variables, then it has no diagonal entries, otherwise all pairs of
+ * variables of the expression are assumed to be nonzero.
+ */
+static
+SCIP_RETCODE addHessianSparsityExpr(
+   SCIP*                   scip,             /**< SCIP data structure */
+   SCIP_CONSHDLR*          conshdlr,         /**< expression constraint handler */
+   SCIP_CONSDATA*          consdata,         /**< constraint data */
+   SCIP_CONSEXPR_EXPR*     expr,             /**< nonlinear subexpression */
+   SCIP_HASHMAP*           var2idx,          /**< map from variables to their position in consdata->varexprs */
+   SCIP_CONSEXPR_EXPR**    varexprs,         /**< buffer to store variable expressions of expr */
+   int*                    idxs,             /**< buffer to store variable positions */
+   SCIP_HASHSET*           entries           /**< hash set to add entries to */
+   )
+{
+   SCIP_Bool nodiagonal;
+   int nvarexprs;
+   int nfactors;
+   int i;
+   int j;
+
+   SCIP_CALL( SCIPgetConsExprExprVarExprs(scip, conshdlr, expr, varexprs, &nvarexprs) );
+
+   for( i = 0; i < nvarexprs; ++i )
+   {
+      idxs[i] = SCIPhashmapGetImageInt(var2idx, (void*)SCIPgetConsExprExprVarVar(varexprs[i]));
+      SCIP_CALL( SCIPreleaseConsExprExpr(scip, &varexprs[i]) );
+   }
+
+   /* a product of distinct variables (and constants), e.g., a bilinear term, has a zero diagonal */
+   nodiagonal = SCIPgetConsExprExprHdlr(expr) == SCIPgetConsExprExprHdlrProduct(conshdlr);
+   nfactors = 0;
+   for( i = 0; i < expr->nchildren && nodiagonal; ++i )
+   {
+      if( SCIPisConsExprExprVar(expr->children[i]) )
+         ++nfactors;
+      else
+         nodiagonal = SCIPisConsExprExprValue(expr->children[i]);
+   }
+   nodiagonal = nodiagonal && nfactors == nvarexprs;
+
+   for( i = 0; i < nvarexprs; ++i )
+   {
+      for( j = 0; j < nvarexprs; ++j )
+      {
+         if( idxs[j] > idxs[i] || (nodiagonal && idxs[j] == idxs[i]) )
+            continue;
+
+         SCIP_CALL( SCIPhashsetInsert(entries, SCIPblkmem(scip),
+               (void*)(size_t)((SCIP_Longint)idxs[i] * consdata->nvarexprs + idxs[j] + 1)) ); /*lint !e571*/
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** computes the sparsity pattern of the Hessian of the function of a constraint
+ *
+ * The pattern is obtained from the structure of the expression: sums and products with at most one nonconstant
+ * factor are linear in their children, so their pattern is the union of the patterns of the children; for any other
+ * expression, all pairs of variables that appear in it are considered, except for the diagonal of products of distinct
+ * variables.
+ */
+static
+SCIP_RETCODE computeHessianSparsity(
+   SCIP*                   scip,             /**< SCIP data structure */
+   SCIP_CONSHDLR*          conshdlr,         /**< expression constraint handler */
+   SCIP_CONSDATA*          consdata          /**< constraint data */
+   )
+{
+   SCIP_CONSEXPR_ITERATOR* it;
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_CONSEXPR_EXPR** varexprs;
+   SCIP_HASHMAP* var2idx;
+   SCIP_HASHSET* entries;
+   SCIP_Longint* keys;
+   void** slots;
+   int* idxs;
+   int nslots;
+   int nkeys;
+   int row;
+   int i;
+
+   assert(consdata != NULL);
+   assert(consdata->varexprs != NULL);
+   assert(consdata->hessrowbegins == NULL);
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->hessrowbegins, consdata->nvarexprs + 1) );
+   consdata->nhessnz = 0;
+
+   if( consdata->nvarexprs == 0 )
+   {
+      consdata->hessrowbegins[0] = 0;
+      return SCIP_OKAY;
+   }
+
+   SCIP_CALL( SCIPhashmapCreate(&var2idx, SCIPblkmem(scip), consdata->nvarexprs) );
+   for( i = 0; i < consdata->nvarexprs; ++i )
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(var2idx, (void*)SCIPgetConsExprExprVarVar(consdata->varexprs[i]), i) );
+   }
+
+   SCIP_CALL( SCIPhashsetCreate(&entries, SCIPblkmem(scip), consdata->nvarexprs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varexprs, SCIPgetNTotalVars(scip)) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &idxs, SCIPgetNTotalVars(scip)) );
+
+   /* walk down through sums and collect the pattern of the topmost nonlinear subexpressions */
+   SCIP_CALL( SCIPexpriteratorCreate(&it, conshdlr, SCIPblkmem(scip)) );
+   SCIP_CALL( SCIPexpriteratorInit(it, consdata->expr, SCIP_CONSEXPRITERATOR_DFS, FALSE) );
+   SCIPexpriteratorSetStagesDFS(it, SCIP_CONSEXPRITERATOR_ENTEREXPR);
+
+   for( expr = SCIPexpriteratorGetCurrent(it); !SCIPexpriteratorIsEnd(it); )  /*lint !e441*/
+   {
+      SCIP_Bool linear;
+
+      linear = expr->nchildren == 0 || SCIPgetConsExprExprHdlr(expr) == SCIPgetConsExprExprHdlrSum(conshdlr);
+      if( !linear && SCIPgetConsExprExprHdlr(expr) == SCIPgetConsExprExprHdlrProduct(conshdlr) )
+      {
+         int nnonconst = 0;
+
+         for( i = 0; i < expr->nchildren; ++i )
+            if( !SCIPisConsExprExprValue(expr->children[i]) )
+               ++nnonconst;
+         linear = nnonconst <= 1;
+      }
+
+      if( linear )
+      {
+         expr = SCIPexpriteratorGetNext(it);
+         continue;
+      }
+
+      SCIP_CALL( addHessianSparsityExpr(scip, conshdlr, consdata, expr, var2idx, varexprs, idxs, entries) );
+      expr = SCIPexpriteratorSkipDFS(it);
+   }
+
+   SCIPexpriteratorFree(&it);
+
+   /* sort entries, which orders them by row and then by column */
+   nkeys = SCIPhashsetGetNElements(entries);
+   SCIP_CALL( SCIPallocBufferArray(scip, &keys, MAX(nkeys, 1)) );
+   nkeys = 0;
+   slots = SCIPhashsetGetSlots(entries);
+   nslots = (int)SCIPhashsetGetNSlots(entries);
+   for( i = 0; i < nslots; ++i )
+   {
+      if( slots[i] != NULL )
+         keys[nkeys++] = (SCIP_Longint)(size_t)slots[i] - 1;
+   }
+   assert(nkeys == SCIPhashsetGetNElements(entries));
+   SCIPsortLong(keys, nkeys);
+
+   consdata->nhessnz = nkeys;
+   if( nkeys > 0 )
+   {
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &consdata->hesscolidxs, nkeys) );
+   }
+
+   row = 0;
+   consdata->hessrowbegins[0] = 0;
+   for( i = 0; i < nkeys; ++i )
+   {
+      /* close all rows before the row of entry i */
+      while( row < keys[i] / consdata->nvarexprs )
+         consdata->hessrowbegins[++row] = i;
+
+      consdata->hesscolidxs[i] = (int)(keys[i] % consdata->nvarexprs);
+   }
+   while( row < consdata->nvarexprs )
+      consdata->hessrowbegins[++row] = nkeys;
+
+   SCIPfreeBufferArray(scip, &keys);
+   SCIPfreeBufferArray(scip, &idxs);
+   SCIPfreeBufferArray(scip, &varexprs);
+   SCIPhashsetFree(&entries, SCIPblkmem(scip));
+   SCIPhashmapFree(&var2idx);
+
+   return SCIP_OKAY;
+}
+
+/** frees all variable expression stored in storeVarExprs() */
+static
+SCIP_RETCODE freeVarExprs(
+   SCIP*                   scip,             /**< SCIP data structure */
+   SCIP_CONSDATA*          consdata          /**< constraint data */
+   )
+{
+   int i;
+
+   assert(consdata != NULL);
+
+   /* skip if we have stored the variable expressions already*/
    if( consdata->varexprs == NULL )
       return SCIP_OKAY;
 
    assert(consdata->varexprs != NULL);
    assert(consdata->nvarexprs >= 0);
 
+   /* the Hessian sparsity pattern refers to the variable expressions */
+   freeHessianSparsity(scip, consdata);
+
    /* release variable expressions */
    for( i = 0; i < consdata->nvarexprs; ++i )
    {
@@ -2950,6 +3642,530 @@ SCIP_RETCODE forbidNonlinearVariablesMultiaggration(
 }
 
 
+/** creates the evaluation tape of an expression */
+static
+SCIP_RETCODE createExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_CONSEXPR_EXPR*   root,               /**< expression */
+   EXPRTAPE**            tape                /**< buffer to store the tape */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONSEXPR_ITERATOR* it;
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_CONSEXPRITERATOR_USERDATA userdata;
+   int nexprs;
+   int nchildidxs;
+   int c;
+
+   assert(scip != NULL);
+   assert(root != NULL);
+   assert(tape != NULL);
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   SCIP_CALL( SCIPexpriteratorCreate(&it, conshdlr, SCIPblkmem(scip)) );
+
+   /* count subexpressions and children */
+   nexprs = 0;
+   nchildidxs = 0;
+   SCIP_CALL( SCIPexpriteratorInit(it, root, SCIP_CONSEXPRITERATOR_DFS, FALSE) );
+   SCIPexpriteratorSetStagesDFS(it, SCIP_CONSEXPRITERATOR_LEAVEEXPR);
+   for( expr = SCIPexpriteratorGetCurrent(it); !SCIPexpriteratorIsEnd(it); expr = SCIPexpriteratorGetNext(it) ) /*lint !e441*/
+   {
+      ++nexprs;
+      nchildidxs += expr->nchildren;
+   }
+
+   SCIP_CALL( SCIPallocBlockMemory(scip, tape) );
+   (*tape)->root = root;
+   (*tape)->nexprs = nexprs;
+   (*tape)->nchildidxs = nchildidxs;
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*tape)->exprs, nexprs) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*tape)->ops, nexprs) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*tape)->childbegins, nexprs + 1) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*tape)->childidxs, MAX(nchildidxs, 1)) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*tape)->vals, nexprs) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*tape)->adjoints, nexprs) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*tape)->evaltags, nexprs) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*tape)->changed, nexprs) );
+   (*tape)->valsvalid = FALSE;
+
+   /* store subexpressions in the order in which they are left: then all children of an expression have been stored
+    * before it; the position of an expression on the tape is stored as iterator userdata
+    */
+   nexprs = 0;
+   nchildidxs = 0;
+   SCIP_CALL( SCIPexpriteratorInit(it, root, SCIP_CONSEXPRITERATOR_DFS, FALSE) );
+   SCIPexpriteratorSetStagesDFS(it, SCIP_CONSEXPRITERATOR_LEAVEEXPR);
+   for( expr = SCIPexpriteratorGetCurrent(it); !SCIPexpriteratorIsEnd(it); expr = SCIPexpriteratorGetNext(it) ) /*lint !e441*/
+   {
+      (*tape)->exprs[nexprs] = expr;
+      (*tape)->childbegins[nexprs] = nchildidxs;
+
+      if( expr->exprhdlr == conshdlrdata->exprvarhdlr )
+         (*tape)->ops[nexprs] = EXPRTAPEOP_VAR;
+      else if( expr->exprhdlr == conshdlrdata->exprvalhdlr )
+         (*tape)->ops[nexprs] = EXPRTAPEOP_VALUE;
+      else if( expr->exprhdlr == conshdlrdata->exprsumhdlr )
+         (*tape)->ops[nexprs] = EXPRTAPEOP_SUM;
+      else if( expr->exprhdlr == conshdlrdata->exprprodhdlr )
+         (*tape)->ops[nexprs] = EXPRTAPEOP_PRODUCT;
+      else
+         (*tape)->ops[nexprs] = EXPRTAPEOP_OTHER;
+
+      for( c = 0; c < expr->nchildren; ++c )
+      {
+         (*tape)->childidxs[nchildidxs++] = SCIPexpriteratorGetExprUserData(it, expr->children[c]).intval;
+         assert((*tape)->childidxs[nchildidxs-1] < nexprs);
+      }
+
+      userdata.intval = nexprs;
+      SCIPexpriteratorSetCurrentUserData(it, userdata);
+      ++nexprs;
+   }
+   (*tape)->childbegins[nexprs] = nchildidxs;
+
+   assert(nexprs == (*tape)->nexprs);
+   assert(nchildidxs == (*tape)->nchildidxs);
+   assert((*tape)->exprs[nexprs-1] == root);
+
+   SCIPexpriteratorFree(&it);
+
+   return SCIP_OKAY;
+}
+
+/** frees the evaluation tape of an expression */
+static
+void freeExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   EXPRTAPE**            tape                /**< tape to be freed */
+   )
+{
+   assert(tape != NULL);
+   assert(*tape != NULL);
+
+   SCIPfreeBlockMemoryArray(scip, &(*tape)->changed, (*tape)->nexprs);
+   SCIPfreeBlockMemoryArray(scip, &(*tape)->evaltags, (*tape)->nexprs);
+   SCIPfreeBlockMemoryArray(scip, &(*tape)->adjoints, (*tape)->nexprs);
+   SCIPfreeBlockMemoryArray(scip, &(*tape)->vals, (*tape)->nexprs);
+   SCIPfreeBlockMemoryArray(scip, &(*tape)->childidxs, MAX((*tape)->nchildidxs, 1));
+   SCIPfreeBlockMemoryArray(scip, &(*tape)->childbegins, (*tape)->nexprs + 1);
+   SCIPfreeBlockMemoryArray(scip, &(*tape)->ops, (*tape)->nexprs);
+   SCIPfreeBlockMemoryArray(scip, &(*tape)->exprs, (*tape)->nexprs);
+   SCIPfreeBlockMemory(scip, tape);
+}
+
+/** makes sure that the evaluation tape of a constraint is available if tapes are enabled
+ *
+ * The tape is only built in the solving stage, when the expression is not modified anymore.
+ */
+static
+SCIP_RETCODE ensureExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_CONSDATA*        consdata            /**< constraint data */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   if( consdata->tape != NULL && consdata->tape->root != consdata->expr )
+      freeExprTape(scip, &consdata->tape);
+
+   if( consdata->tape == NULL && conshdlrdata->evaltape && SCIPgetStage(scip) == SCIP_STAGE_SOLVING )
+   {
+      SCIP_CALL( createExprTape(scip, conshdlr, consdata->expr, &consdata->tape) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** evaluates an expression by its evaluation tape
+ *
+ * Gives the same values as SCIPevalConsExprExpr(), i.e., the values of all subexpressions are stored in the
+ * expressions and subexpressions that have been evaluated for soltag already are not evaluated again.
+ *
+ * If incremental is TRUE and the previous evaluation by this tape was successful, then only those subexpressions are
+ * evaluated again whose value may have changed since then, i.e., those that depend on a variable with a changed
+ * solution value or that have been evaluated by someone else in the meantime. All other subexpressions only get the
+ * new tag. This requires soltag to be nonzero, so that it identifies the evaluation point uniquely.
+ */
+static
+SCIP_RETCODE evalExprTape(
+   SCIP*                 scip,               /**< SCIP data structure */
+   EXPRTAPE*             tape,               /**< evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   unsigned int          soltag,             /**< tag that uniquely identifies the solution (with its values), or 0 */
+   SCIP_Bool             incremental         /**< whether to re-evaluate only subexpressions whose value may have changed */
+   )
+{
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_Real* vals;
+   SCIP_Bool* changed;
+   int* childidxs;
+   SCIP_Real val;
+   int k;
+   int j;
+
+   assert(tape != NULL);
+
+   /* if value is up-to-date, then nothing to do */
+   if( soltag != 0 && tape->root->evaltag == soltag )
+      return SCIP_OKAY;
+
+   /* assume we'll get a domain error, see SCIPevalConsExprExpr() */
+   tape->root->evalvalue = SCIP_INVALID;
+   tape->root->evaltag = soltag;
+
+   vals = tape->vals;
+   changed = tape->changed;
+   childidxs = tape->childidxs;
+
+   incremental = incremental && tape->valsvalid && soltag != 0;
+   tape->valsvalid = FALSE;
+
+   for( k = 0; k < tape->nexprs; ++k )
+   {
+      expr = tape->exprs[k];
+
+      /* reuse values of subexpressions that have been evaluated for this solution already */
+      if( soltag != 0 && expr->evaltag == soltag && k < tape->nexprs - 1 )
+      {
+         if( expr->evalvalue == SCIP_INVALID ) /*lint !e777*/
+            return SCIP_OKAY;
+
+         changed[k] = !incremental || expr->evalvalue != vals[k]; /*lint !e777*/
+         vals[k] = expr->evalvalue;
+         tape->evaltags[k] = soltag;
+         continue;
+      }
+
+      /* skip subexpressions whose children did not change and which still have the value from the last evaluation */
+      if( incremental && expr->evaltag == tape->evaltags[k] && tape->ops[k] != EXPRTAPEOP_VAR )
+      {
+         for( j = tape->childbegins[k]; j < tape->childbegins[k+1]; ++j )
+            if( changed[childidxs[j]] )
+               break;
+
+         if( j == tape->childbegins[k+1] )
+         {
+            assert(expr->evalvalue == vals[k]); /*lint !e777*/
+            changed[k] = FALSE;
+            expr->evaltag = soltag;
+            tape->evaltags[k] = soltag;
+            continue;
+         }
+      }
+
+      switch( tape->ops[k] )
+      {
+         case EXPRTAPEOP_VAR :
+            val = SCIPgetSolVal(scip, sol, SCIPgetConsExprExprVarVar(expr));
+            break;
+
+         case EXPRTAPEOP_VALUE :
+            val = SCIPgetConsExprExprValueValue(expr);
+            break;
+
+         case EXPRTAPEOP_SUM :
+         {
+            SCIP_Real* coefs;
+
+            coefs = SCIPgetConsExprExprSumCoefs(expr) - tape->childbegins[k];
+            val = SCIPgetConsExprExprSumConstant(expr);
+            for( j = tape->childbegins[k]; j < tape->childbegins[k+1]; ++j )
+               val += coefs[j] * vals[childidxs[j]];
+            break;
+         }
+
+         case EXPRTAPEOP_PRODUCT :
+            val = SCIPgetConsExprExprProductCoef(expr);
+            for( j = tape->childbegins[k]; j < tape->childbegins[k+1] && val != 0.0; ++j )
+               val *= vals[childidxs[j]];
+            break;
+
+         case EXPRTAPEOP_OTHER :
+         default :
+            SCIP_CALL( SCIPevalConsExprExprHdlr(scip, expr, &val, NULL, sol) );
+            break;
+      }
+
+      expr->evalvalue = val;
+      expr->evaltag = soltag;
+
+      if( val == SCIP_INVALID ) /*lint !e777*/
+      {
+         tape->root->evalvalue = SCIP_INVALID;
+         return SCIP_OKAY;
+      }
+
+      changed[k] = !incremental || val != vals[k]; /*lint !e777*/
+      vals[k] = val;
+      tape->evaltags[k] = soltag;
+   }
+
+   tape->valsvalid = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** evaluates an expression by its evaluation tape for several solutions at once
+ *
+ * The values are stored in vals such that vals[k*nsols+s] is the value of the k-th subexpression on the tape in the
+ * s-th solution, or SCIP_INVALID if it could not be evaluated. Thus, the value of the root expression in solution s
+ * is given by vals[(tape->nexprs-1)*nsols+s]. Values and tags stored in the expressions are not changed.
+ */
+static
+SCIP_RETCODE evalExprTapeBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   EXPRTAPE*             tape,               /**< evaluation tape */
+   SCIP_SOL**            sols,               /**< solutions to be evaluated (entries can be NULL for the LP solution) */
+   int                   nsols,              /**< number of solutions */
+   SCIP_Real*            vals                /**< array of length tape->nexprs * nsols to store values */
+   )
+{
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_Real* childvals;
+   SCIP_Real* exprvals;
+   SCIP_Real* childexprvals;
+   int* childidxs;
+   int maxnchildren;
+   int nchildren;
+   int k;
+   int j;
+   int s;
+
+   assert(tape != NULL);
+   assert(sols != NULL);
+   assert(nsols > 0);
+   assert(vals != NULL);
+
+   childidxs = tape->childidxs;
+
+   maxnchildren = 1;
+   for( k = 0; k < tape->nexprs; ++k )
+      maxnchildren = MAX(maxnchildren, tape->childbegins[k+1] - tape->childbegins[k]);
+   SCIP_CALL( SCIPallocBufferArray(scip, &childvals, maxnchildren) );
+
+   for( k = 0; k < tape->nexprs; ++k )
+   {
+      expr = tape->exprs[k];
+      exprvals = vals + (size_t)k * nsols;
+      nchildren = tape->childbegins[k+1] - tape->childbegins[k];
+
+      switch( tape->ops[k] )
+      {
+         case EXPRTAPEOP_VAR :
+         {
+            SCIP_VAR* var;
+
+            var = SCIPgetConsExprExprVarVar(expr);
+            for( s = 0; s < nsols; ++s )
+               exprvals[s] = SCIPgetSolVal(scip, sols[s], var);
+            break;
+         }
+
+         case EXPRTAPEOP_VALUE :
+         {
+            SCIP_Real val;
+
+            val = SCIPgetConsExprExprValueValue(expr);
+            for( s = 0; s < nsols; ++s )
+               exprvals[s] = val;
+            break;
+         }
+
+         case EXPRTAPEOP_SUM :
+         {
+            SCIP_Real* coefs;
+            SCIP_Real constant;
+
+            coefs = SCIPgetConsExprExprSumCoefs(expr) - tape->childbegins[k];
+            constant = SCIPgetConsExprExprSumConstant(expr);
+            for( s = 0; s < nsols; ++s )
+               exprvals[s] = constant;
+
+            for( j = tape->childbegins[k]; j < tape->childbegins[k+1]; ++j )
+            {
+               childexprvals = vals + (size_t)childidxs[j] * nsols;
+               for( s = 0; s < nsols; ++s )
+                  exprvals[s] += coefs[j] * childexprvals[s];
+            }
+            break;
+         }
+
+         case EXPRTAPEOP_PRODUCT :
+         {
+            SCIP_Real coef;
+
+            coef = SCIPgetConsExprExprProductCoef(expr);
+            for( s = 0; s < nsols; ++s )
+               exprvals[s] = coef;
+
+            for( j = tape->childbegins[k]; j < tape->childbegins[k+1]; ++j )
+            {
+               childexprvals = vals + (size_t)childidxs[j] * nsols;
+               for( s = 0; s < nsols; ++s )
+                  exprvals[s] *= childexprvals[s];
+            }
+            break;
+         }
+
+         case EXPRTAPEOP_OTHER :
+         default :
+         {
+            for( s = 0; s < nsols; ++s )
+            {
+               /* gather values of children for this solution */
+               for( j = 0; j < nchildren; ++j )
+               {
+                  childvals[j] = vals[(size_t)childidxs[tape->childbegins[k] + j] * nsols + s];
+                  if( childvals[j] == SCIP_INVALID ) /*lint !e777*/
+                     break;
+               }
+
+               if( j < nchildren )
+                  exprvals[s] = SCIP_INVALID;
+               else
+               {
+                  SCIP_CALL( SCIPevalConsExprExprHdlr(scip, expr, &exprvals[s], childvals, sols[s]) );
+               }
+            }
+
+            /* SCIPevalConsExprExprHdlr() already took care of domain errors and children */
+            continue;
+         }
+      }
+
+      /* an expression is undefined if one of its children is undefined or the value is not finite */
+      for( j = tape->childbegins[k]; j < tape->childbegins[k+1]; ++j )
+      {
+         childexprvals = vals + (size_t)childidxs[j] * nsols;
+         for( s = 0; s < nsols; ++s )
+            if( childexprvals[s] == SCIP_INVALID ) /*lint !e777*/
+               exprvals[s] = SCIP_INVALID;
+      }
+      for( s = 0; s < nsols; ++s )
+         if( !SCIPisFinite(exprvals[s]) )
+            exprvals[s] = SCIP_INVALID;
+   }
+
+   SCIPfreeBufferArray(scip, &childvals);
+
+   return SCIP_OKAY;
+}
+
+/** computes the gradient of an expression by a reverse sweep over its evaluation tape
+ *
+ * As SCIPcomputeConsExprExprGradient(), this stores the partial derivatives w.r.t. the variables in the variable
+ * expressions and sets the difftag of all subexpressions.
+ */
+static
+SCIP_RETCODE computeExprTapeGradient(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   EXPRTAPE*             tape,               /**< evaluation tape */
+   SCIP_SOL*             sol,                /**< solution to be evaluated */
+   unsigned int          soltag              /**< tag that uniquely identifies the solution (with its values), or 0 */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_Real* adjoints;
+   int* childidxs;
+   SCIP_Real derivative;
+   unsigned int difftag;
+   int k;
+   int j;
+
+   assert(tape != NULL);
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   SCIP_CALL( evalExprTape(scip, tape, sol, soltag, conshdlrdata->evalincremental) );
+
+   if( tape->root->evalvalue == SCIP_INVALID ) /*lint !e777*/
+   {
+      tape->root->derivative = SCIP_INVALID;
+      return SCIP_OKAY;
+   }
+
+   if( tape->root->exprhdlr == conshdlrdata->exprvalhdlr )
+   {
+      tape->root->derivative = 0.0;
+      return SCIP_OKAY;
+   }
+
+   difftag = ++(conshdlrdata->lastdifftag);
+
+   adjoints = tape->adjoints;
+   childidxs = tape->childidxs;
+   BMSclearMemoryArray(adjoints, tape->nexprs);
+   adjoints[tape->nexprs - 1] = 1.0;
+
+   /* all parents of an expression come after it on the tape, so its adjoint is complete when it is reached */
+   for( k = tape->nexprs - 1; k >= 0; --k )
+   {
+      expr = tape->exprs[k];
+      expr->derivative = adjoints[k];
+      expr->difftag = difftag;
+
+      switch( tape->ops[k] )
+      {
+         case EXPRTAPEOP_VAR :
+         case EXPRTAPEOP_VALUE :
+            break;
+
+         case EXPRTAPEOP_SUM :
+         {
+            SCIP_Real* coefs;
+
+            coefs = SCIPgetConsExprExprSumCoefs(expr) - tape->childbegins[k];
+            for( j = tape->childbegins[k]; j < tape->childbegins[k+1]; ++j )
+               adjoints[childidxs[j]] += coefs[j] * adjoints[k];
+            break;
+         }
+
+         case EXPRTAPEOP_PRODUCT :
+         case EXPRTAPEOP_OTHER :
+         default :
+         {
+            if( expr->exprhdlr->bwdiff == NULL )
+            {
+               tape->root->derivative = SCIP_INVALID;
+               return SCIP_OKAY;
+            }
+
+            for( j = tape->childbegins[k]; j < tape->childbegins[k+1]; ++j )
+            {
+               if( tape->ops[childidxs[j]] == EXPRTAPEOP_VALUE )
+                  continue;
+
+               derivative = SCIP_INVALID;
+               SCIP_CALL( SCIPbwdiffConsExprExprHdlr(scip, expr, j - tape->childbegins[k], &derivative, NULL, 0.0) );
+
+               if( derivative == SCIP_INVALID ) /*lint !e777*/
+               {
+                  tape->root->derivative = SCIP_INVALID;
+                  return SCIP_OKAY;
+               }
+
+               adjoints[childidxs[j]] += derivative * adjoints[k];
+            }
+            break;
+         }
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** computes violation of a constraint */
 static
 SCIP_RETCODE computeViolation(
@@ -2968,7 +4184,16 @@ SCIP_RETCODE computeViolation(
    consdata = SCIPconsGetData(cons);
    assert(consdata != NULL);
 
-   SCIP_CALL( SCIPevalConsExprExpr(scip, SCIPconsGetHdlr(cons), consdata->expr, sol, soltag) );
+   SCIP_CALL( ensureExprTape(scip, SCIPconsGetHdlr(cons), consdata) );
+   if( consdata->tape != NULL )
+   {
+      SCIP_CALL( evalExprTape(scip, consdata->tape, sol, soltag,
+            SCIPconshdlrGetData(SCIPconsGetHdlr(cons))->evalincremental) );
+   }
+   else
+   {
+      SCIP_CALL( SCIPevalConsExprExpr(scip, SCIPconsGetHdlr(cons), consdata->expr, sol, soltag) );
+   }
    activity = SCIPgetConsExprExprValue(consdata->expr);
 
    /* consider constraint as violated if it is undefined in the current point */
@@ -3074,7 +4299,15 @@ SCIP_RETCODE getConsRelViolation(
       consdata->gradnorm = 0.0;
 
       /* compute gradient */
-      SCIP_CALL( SCIPcomputeConsExprExprGradient(scip, conshdlr, consdata->expr, sol, soltag) );
+      SCIP_CALL( ensureExprTape(scip, conshdlr, consdata) );
+      if( consdata->tape != NULL )
+      {
+         SCIP_CALL( computeExprTapeGradient(scip, conshdlr, consdata->tape, sol, soltag) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPcomputeConsExprExprGradient(scip, conshdlr, consdata->expr, sol, soltag) );
+      }
 
       /* gradient evaluation error -> no scaling */
       if( SCIPgetConsExprExprDerivative(consdata->expr) != SCIP_INVALID ) /*lint !e777*/
@@ -3290,6 +4523,7 @@ SCIP_RETCODE catchVarEvents(
       {
          SCIP_CALL( SCIPintevalConsExprExprHdlr(scip, expr, &expr->activity, intEvalVarBoundTightening, conshdlrdata) );
          expr->activitytag = conshdlrdata->curboundstag;
+         expr->activitychgtag = conshdlrdata->curboundstag;
 #ifdef DEBUG_PROP
          SCIPdebugMsg(scip, "var-exprhdlr::inteval for var <%s> = [%.20g, %.20g]\n", SCIPvarGetName(SCIPgetConsExprExprVarVar(expr)), expr->activity.inf, expr->activity.sup);
 #endif
@@ -3364,44 +4598,26 @@ SCIP_DECL_EVENTEXEC(processVarEvent)
    conshdlr = SCIPconsGetHdlr(SCIPgetConsExprExprVarConss(expr)[0]);  /*lint !e613*/
    assert(conshdlr != NULL);
 
-   /* notify constraints that use this variable expression (expr) to repropagate and possibly resimplify
+   /* remember that constraints that use this variable expression (expr) need to repropagate and possibly resimplify
     * - propagation can only find something new if a bound was tightened
     * - simplify can only find something new if a var is fixed (or maybe a bound is tightened)
     *   and we look at global changes (that is, we are not looking at boundchanges in probing)
+    * the constraints are not marked here but in applyPendingVarMarks(), so that a variable whose bounds change several
+    * times before the next propagation or presolving round visits its constraints only once
     */
    if( eventtype & (SCIP_EVENTTYPE_BOUNDTIGHTENED | SCIP_EVENTTYPE_VARFIXED) )
    {
-      SCIP_CONSDATA* consdata;
-      SCIP_CONS** conss;
-      int nconss;
-      int c;
+      unsigned int marks;
 
-      nconss = SCIPgetConsExprExprVarNConss(expr);
-      conss = SCIPgetConsExprExprVarConss(expr);
-      assert(conss != NULL || nconss == 0);
+      marks = 0;
+      if( eventtype & SCIP_EVENTTYPE_BOUNDTIGHTENED )
+         marks |= PENDINGMARK_PROPAGATE;
+      if( SCIPgetStage(scip) == SCIP_STAGE_PRESOLVING && !SCIPinProbing(scip) )
+         marks |= PENDINGMARK_SIMPLIFY;
 
-      for( c = 0; c < nconss; ++c )
+      if( marks != 0 )
       {
-         assert(conss[c] != NULL);  /*lint !e613*/
-         consdata = SCIPconsGetData(conss[c]);  /*lint !e613*/
-
-         /* if boundtightening, then mark constraints to be propagated again
-          * TODO we could try be more selective here and only trigger a propagation if a relevant bound has changed,
-          *   that is, we don't need to repropagate x + ... <= rhs if only the upper bound of x has been tightened
-          *   the locks could help if they were available on a per-constraint base, but they aren't (and it may not be worth it)
-          */
-         if( eventtype & SCIP_EVENTTYPE_BOUNDTIGHTENED )
-         {
-            consdata->ispropagated = FALSE;
-            SCIPdebugMsg(scip, "  marked <%s> for propagate\n", SCIPconsGetName(conss[c]));  /*lint !e613*/
-         }
-
-         /* if still in presolve (but not probing), then mark constraints to be unsimplified */
-         if( SCIPgetStage(scip) == SCIP_STAGE_PRESOLVING && !SCIPinProbing(scip) )
-         {
-            consdata->issimplified = FALSE;
-            SCIPdebugMsg(scip, "  marked <%s> for simplify\n", SCIPconsGetName(conss[c]));  /*lint !e613*/
-         }
+         SCIP_CALL( addPendingVarMarks(scip, conshdlr, expr, marks) );
       }
    }
 
@@ -3429,6 +4645,7 @@ SCIP_DECL_EVENTEXEC(processVarEvent)
       SCIPdebugMsg(scip, "  var-exprhdlr::inteval = [%.20g, %.20g]\n", expr->exprhdlr->name, expr->activity.inf, expr->activity.sup);
 #endif
       expr->activitytag = conshdlrdata->curboundstag;
+      expr->activitychgtag = conshdlrdata->curboundstag;
    }
 
    return SCIP_OKAY;
@@ -3780,12 +4997,15 @@ SCIP_DECL_HASHKEYVAL(hashCommonSubexprKeyval)
  *  1. traverse through all expressions trees of given constraints and compute for each of them a (not necessarily
  *     unique) hash
  *
- *  2. initialize an empty hash table and traverse through all expression; check for each of them if we can find a
- *     structural equivalent expression in the hash table; if yes we replace the expression by the expression inside the
- *     hash table, otherwise we add it to the hash table
+ *  2. initialize an empty hash table and traverse through all expression bottom-up; when leaving an expression, first
+ *     replace its children by the representatives that were found for them, then check if we can find a structural
+ *     equivalent expression in the hash table; if yes, this expression becomes the representative of the current
+ *     expression, otherwise we add it to the hash table and it represents itself
  *
  *  @note the hash keys of the expressions are used for the hashing inside the hash table; to compute if two expressions
- *  (with the same hash) are structurally the same we use the function SCIPcompareConsExprExprs()
+ *  (with the same hash) are structurally the same we use the function SCIPcompareConsExprExprs(); since children are
+ *  replaced by their representatives before an expression is looked up, equal children are identical, so that the
+ *  comparison does not need to descend into them
  */
 static
 SCIP_RETCODE replaceCommonSubexpressions(
@@ -3839,18 +5059,65 @@ SCIP_RETCODE replaceCommonSubexpressions(
 
    for( i = 0; i < nconss; ++i )
    {
+      SCIP_CONSEXPRITERATOR_USERDATA iterdata;
       SCIP_CONSEXPR_EXPR* newroot;
-      SCIP_CONSEXPR_EXPR* newchild;
+      SCIP_CONSEXPR_EXPR* newexpr;
+      SCIP_CONSEXPR_EXPR* expr;
       SCIP_CONSEXPR_EXPR* child;
+      int c;
+
+      consdata = SCIPconsGetData(conss[i]);
+      assert(consdata != NULL);
+
+      if( consdata->expr == NULL )
+         continue;
+
+      /* the representative of each visited expression is stored in the iterators expression data; expressions
+       * that are shared with previously processed constraints are not visited again
+       */
+      if( !SCIPexpriteratorIsInit(repliterator) )
+      {
+         SCIP_CALL( SCIPexpriteratorInit(repliterator, consdata->expr, SCIP_CONSEXPRITERATOR_DFS, FALSE) );
+         SCIPexpriteratorSetStagesDFS(repliterator, SCIP_CONSEXPRITERATOR_LEAVEEXPR);
+      }
+
+      newroot = NULL;
+      for( expr = SCIPexpriteratorRestartDFS(repliterator, consdata->expr); !SCIPexpriteratorIsEnd(repliterator); expr = SCIPexpriteratorGetNext(repliterator) ) /*lint !e441*/
+      {
+         /* replace children by their representatives */
+         for( c = 0; c < expr->nchildren; ++c )
+         {
+            child = (SCIP_CONSEXPR_EXPR*)SCIPexpriteratorGetExprUserData(repliterator, expr->children[c]).ptrval;
+            assert(child != NULL);
+
+            if( child != expr->children[c] )
+            {
+               assert(SCIPcompareConsExprExprs(child, expr->children[c]) == 0);
+
+               SCIPdebugMsg(scip, "replacing common child expression %p -> %p\n", (void*)expr->children[c], (void*)child);
+
+               SCIP_CALL( SCIPreplaceConsExprExprChild(scip, expr, c, child) );
+            }
+         }
 
-      consdata = SCIPconsGetData(conss[i]);
-      assert(consdata != NULL);
+         /* try to find an equivalent expression */
+         SCIP_CALL( findEqualExpr(scip, expr, key2expr, &newexpr) );
+         assert(newexpr == NULL || SCIPcompareConsExprExprs(expr, newexpr) == 0);
 
-      if( consdata->expr == NULL )
-         continue;
+         iterdata.ptrval = (newexpr != NULL) ? (void*)newexpr : (void*)expr;
+         SCIPexpriteratorSetCurrentUserData(repliterator, iterdata);
+
+         if( expr == consdata->expr )
+            newroot = newexpr;
+      }
 
-      /* check the root for equivalence separately first */
-      SCIP_CALL( findEqualExpr(scip, consdata->expr, key2expr, &newroot) );
+      /* replace the root if it has a representative; the root may also have been visited before for another constraint */
+      if( newroot == NULL )
+      {
+         newroot = (SCIP_CONSEXPR_EXPR*)SCIPexpriteratorGetExprUserData(repliterator, consdata->expr).ptrval;
+         if( newroot == consdata->expr )
+            newroot = NULL;
+      }
 
       if( newroot != NULL )
       {
@@ -3859,42 +5126,10 @@ SCIP_RETCODE replaceCommonSubexpressions(
 
          SCIPdebugMsg(scip, "replacing common root expression of constraint <%s>: %p -> %p\n", SCIPconsGetName(conss[i]), (void*)consdata->expr, (void*)newroot);
 
+         SCIPcaptureConsExprExpr(newroot);
          SCIP_CALL( SCIPreleaseConsExprExpr(scip, &consdata->expr) );
 
          consdata->expr = newroot;
-         SCIPcaptureConsExprExpr(newroot);
-
-         continue;
-      }
-
-      /* replace equivalent sub-expressions in the tree */
-      SCIP_CALL( SCIPexpriteratorInit(repliterator, consdata->expr, SCIP_CONSEXPRITERATOR_DFS, FALSE) );
-      SCIPexpriteratorSetStagesDFS(repliterator, SCIP_CONSEXPRITERATOR_VISITINGCHILD);
-
-      while( !SCIPexpriteratorIsEnd(repliterator) )
-      {
-         child = SCIPexpriteratorGetChildExprDFS(repliterator);
-         assert(child != NULL);
-
-         /* try to find an equivalent expression */
-         SCIP_CALL( findEqualExpr(scip, child, key2expr, &newchild) );
-
-         /* replace child with newchild */
-         if( newchild != NULL )
-         {
-            assert(child != newchild);
-            assert(SCIPcompareConsExprExprs(child, newchild) == 0);
-
-            SCIPdebugMsg(scip, "replacing common child expression %p -> %p\n", (void*)child, (void*)newchild);
-
-            SCIP_CALL( SCIPreplaceConsExprExprChild(scip, SCIPexpriteratorGetCurrent(repliterator), SCIPexpriteratorGetChildIdxDFS(repliterator), newchild) );
-
-            (void) SCIPexpriteratorSkipDFS(repliterator);
-         }
-         else
-         {
-            (void) SCIPexpriteratorGetNext(repliterator);
-         }
       }
    }
 
@@ -5102,6 +6337,9 @@ SCIP_RETCODE canonicalizeConstraints(
          havechange = TRUE;
    }
 
+   /* mark constraints whose variables have been fixed or tightened since the last call */
+   SCIP_CALL( applyPendingVarMarks(scip, conshdlr) );
+
    for( i = 0; i < nconss; ++i )
    {
       consdata = SCIPconsGetData(conss[i]);
@@ -7626,7 +8864,7 @@ SCIP_RETCODE enforceExprNlhdlr(
          SCIP_CALL( SCIPprocessConsExprRowprep(scip, conshdlr, nlhdlr, cons, expr, rowprep, overestimate, auxvar,
                auxvalue, allowweakcuts, branchscoresuccess, inenforcement, sol, result) );
 
-         SCIPfreeRowprep(scip, &rowprep);
+         SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
       }
 
       SCIP_CALL( SCIPfreePtrarray(scip, &rowpreps) );
@@ -7992,6 +9230,9 @@ SCIP_RETCODE enforceConstraints(
 
    *result = SCIP_DIDNOTFIND;
 
+   /* enforceConstraint() looks at ispropagated */
+   SCIP_CALL( applyPendingVarMarks(scip, conshdlr) );
+
    SCIP_CALL( SCIPexpriteratorCreate(&it, conshdlr, SCIPblkmem(scip)) );
    SCIP_CALL( SCIPexpriteratorInit(it, NULL, SCIP_CONSEXPRITERATOR_DFS, TRUE) );
 
@@ -8861,6 +10102,113 @@ void printConshdlrStatistics(
    SCIPinfoMessage(scip, file, "\n");
 }
 
+/** print statistics for expression handlers as JSON object */
+static
+void printExprHdlrStatisticsJson(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   FILE*                 file                /**< file handle, or NULL for standard out */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   int i;
+
+   assert(scip != NULL);
+   assert(conshdlr != NULL);
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   SCIPinfoMessage(scip, file, "{");
+   for( i = 0; i < conshdlrdata->nexprhdlrs; ++i )
+   {
+      SCIP_CONSEXPR_EXPRHDLR* exprhdlr = conshdlrdata->exprhdlrs[i];
+      assert(exprhdlr != NULL);
+
+      if( i > 0 )
+         SCIPinfoMessage(scip, file, ",");
+      SCIPprintJsonString(scip, file, exprhdlr->name);
+      SCIPinfoMessage(scip, file, ":{\"simplcalls\":%lld,\"simplified\":%lld,\"estimcalls\":%lld,\"intevalcalls\":%lld,"
+         "\"propcalls\":%lld,\"cuts\":%lld,\"cutoffs\":%lld,\"domreds\":%lld,\"branchscores\":%lld,",
+         exprhdlr->nsimplifycalls, exprhdlr->nsimplified, exprhdlr->nestimatecalls, exprhdlr->nintevalcalls,
+         exprhdlr->npropcalls, exprhdlr->ncutsfound, exprhdlr->ncutoffs, exprhdlr->ndomreds, exprhdlr->nbranchscores);
+      SCIPinfoMessage(scip, file, "\"estimtime\":%.15g,\"proptime\":%.15g,\"intevaltime\":%.15g,\"simplifytime\":%.15g}",
+         SCIPgetClockTime(scip, exprhdlr->estimatetime), SCIPgetClockTime(scip, exprhdlr->proptime),
+         SCIPgetClockTime(scip, exprhdlr->intevaltime), SCIPgetClockTime(scip, exprhdlr->simplifytime));
+   }
+   SCIPinfoMessage(scip, file, "}");
+}
+
+/** print statistics for nonlinear handlers as JSON object */
+static
+void printNlhdlrStatisticsJson(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   FILE*                 file                /**< file handle, or NULL for standard out */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   SCIP_Bool first;
+   int i;
+
+   assert(scip != NULL);
+   assert(conshdlr != NULL);
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   SCIPinfoMessage(scip, file, "{");
+   first = TRUE;
+   for( i = 0; i < conshdlrdata->nnlhdlrs; ++i )
+   {
+      SCIP_CONSEXPR_NLHDLR* nlhdlr = conshdlrdata->nlhdlrs[i];
+      assert(nlhdlr != NULL);
+
+      /* skip disabled nlhdlr */
+      if( !nlhdlr->enabled )
+         continue;
+
+      if( !first )
+         SCIPinfoMessage(scip, file, ",");
+      first = FALSE;
+      SCIPprintJsonString(scip, file, nlhdlr->name);
+      SCIPinfoMessage(scip, file, ":{\"detects\":%lld,\"enfocalls\":%lld,\"intevalcalls\":%lld,\"propcalls\":%lld,"
+         "\"detectall\":%lld,\"separated\":%lld,\"cutoffs\":%lld,\"domreds\":%lld,\"branchscores\":%lld,"
+         "\"reforms\":%lld,",
+         nlhdlr->ndetectionslast, nlhdlr->nenfocalls, nlhdlr->nintevalcalls, nlhdlr->npropcalls, nlhdlr->ndetections,
+         nlhdlr->nseparated, nlhdlr->ncutoffs, nlhdlr->ndomreds, nlhdlr->nbranchscores, nlhdlr->nreformulates);
+      SCIPinfoMessage(scip, file, "\"detecttime\":%.15g,\"enfotime\":%.15g,\"proptime\":%.15g,\"intevaltime\":%.15g,"
+         "\"reformtime\":%.15g}",
+         SCIPgetClockTime(scip, nlhdlr->detecttime), SCIPgetClockTime(scip, nlhdlr->enfotime),
+         SCIPgetClockTime(scip, nlhdlr->proptime), SCIPgetClockTime(scip, nlhdlr->intevaltime),
+         SCIPgetClockTime(scip, nlhdlr->reformulatetime));
+   }
+   SCIPinfoMessage(scip, file, "}");
+}
+
+/** print statistics for constraint handlers as JSON object */
+static
+void printConshdlrStatisticsJson(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   FILE*                 file                /**< file handle, or NULL for standard out */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert(scip != NULL);
+   assert(conshdlr != NULL);
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   SCIPinfoMessage(scip, file, "{\"weaksepa\":%lld,\"tightenlp\":%lld,\"desperatetightenlp\":%lld,"
+      "\"desperatebranch\":%lld,\"desperatecutoff\":%lld,\"forcelp\":%lld,\"canonicalizetime\":%.15g}",
+      conshdlrdata->nweaksepa, conshdlrdata->ntightenlp, conshdlrdata->ndesperatetightenlp,
+      conshdlrdata->ndesperatebranch, conshdlrdata->ndesperatecutoff, conshdlrdata->nforcelp,
+      SCIPgetClockTime(scip, conshdlrdata->canonicalizetime));
+}
+
 
 /*
  * vertex polyhedral separation
@@ -9078,6 +10426,7 @@ SCIP_RETCODE computeVertexPolyhedralFacetLP(
    SCIP_Real*            funvals,            /**< values of function in all corner points (w.r.t. nonfixed variables) */
    int                   nvars,              /**< number of nonfixed variables */
    SCIP_Real             targetvalue,        /**< target value: no need to compute facet if value in xstar would be worse than this value */
+   SCIP_VERTEXPOLYWARMSTART* warmstart,      /**< warm start data of the function, or NULL */
    SCIP_Bool*            success,            /**< buffer to store whether a facet could be computed successfully */
    SCIP_Real*            facetcoefs,         /**< buffer to store coefficients of facet defining inequality; must be an zero'ed array of length at least nallvars */
    SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
@@ -9216,6 +10565,15 @@ SCIP_RETCODE computeVertexPolyhedralFacetLP(
 #endif
    /* SCIP_CALL( SCIPlpiWriteLP(lp, "lp.lp") ); */
 
+   /* the LP is shared between all functions with the same number of nonfixed variables,
+    * so start from the basis of the last solve for this function
+    */
+   if( warmstart != NULL && warmstart->hasbasis )
+   {
+      assert(warmstart->nvars == nvars);
+      SCIP_CALL( SCIPlpiSetBase(lp, warmstart->cstat, warmstart->rstat) );
+   }
+
    /*
     * solve the LP and store the resulting facet for the transformed space
     */
@@ -9241,6 +10599,14 @@ SCIP_RETCODE computeVertexPolyhedralFacetLP(
       goto CLEANUP;
    }
 
+   /* remember final basis for the next solve for this function */
+   if( warmstart != NULL )
+   {
+      assert(warmstart->nvars == nvars);
+      SCIP_CALL( SCIPlpiGetBase(lp, warmstart->cstat, warmstart->rstat) );
+      warmstart->hasbasis = TRUE;
+   }
+
    /* get dual solution (facet of convex envelope); again, we have to be careful since the LP can have more rows and
     * columns than needed, in particular, \bar \beta is the last dual multiplier
     */
@@ -9494,6 +10860,75 @@ SCIP_RETCODE computeVertexPolyhedralFacetBivariate(
    return SCIP_OKAY;
 }
 
+/** returns TRUE iff the matrices of two eigenvalue decomposition cache entries are equal */
+static
+SCIP_DECL_HASHKEYEQ(eigenCacheIsHashkeyEq)
+{  /*lint --e{715}*/
+   EIGENCACHEENTRY* entry1;
+   EIGENCACHEENTRY* entry2;
+   int i;
+
+   entry1 = (EIGENCACHEENTRY*)key1;
+   entry2 = (EIGENCACHEENTRY*)key2;
+
+   if( entry1->n != entry2->n )
+      return FALSE;
+
+   for( i = 0; i < entry1->n * entry1->n; ++i )
+      if( entry1->matrix[i] != entry2->matrix[i] )  /*lint !e777*/
+         return FALSE;
+
+   return TRUE;
+}
+
+/** returns the hash value of the matrix of an eigenvalue decomposition cache entry */
+static
+SCIP_DECL_HASHKEYVAL(eigenCacheGetHashkeyVal)
+{  /*lint --e{715}*/
+   EIGENCACHEENTRY* entry;
+   uint32_t hash;
+   int i;
+
+   entry = (EIGENCACHEENTRY*)key;
+
+   hash = (uint32_t)entry->n;
+   for( i = 0; i < entry->n * entry->n; ++i )
+      if( entry->matrix[i] != 0.0 )
+         hash = SCIPhashTwo(hash + (uint32_t)i, SCIPrealHashCode(entry->matrix[i]));
+
+   return hash;
+}
+
+/** frees the cache of eigenvalue decompositions */
+static
+void freeEigenCache(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLRDATA*    conshdlrdata        /**< constraint handler data */
+   )
+{
+   EIGENCACHEENTRY* entry;
+   int i;
+
+   assert(conshdlrdata != NULL);
+
+   if( conshdlrdata->eigencache == NULL )
+      return;
+
+   for( i = 0; i < SCIPhashtableGetNEntries(conshdlrdata->eigencache); ++i )
+   {
+      entry = (EIGENCACHEENTRY*)SCIPhashtableGetEntry(conshdlrdata->eigencache, i);
+      if( entry == NULL )
+         continue;
+
+      SCIPfreeBlockMemoryArrayNull(scip, &entry->eigenvectors, entry->n * entry->n);
+      SCIPfreeBlockMemoryArray(scip, &entry->eigenvalues, entry->n);
+      SCIPfreeBlockMemoryArray(scip, &entry->matrix, entry->n * entry->n);
+      SCIPfreeBlockMemory(scip, &entry);
+   }
+
+   SCIPhashtableFree(&conshdlrdata->eigencache);
+}
+
 /** hash key retrieval function for bilinear term entries */
 static
 SCIP_DECL_HASHGETKEY(bilinearTermsGetHashkey)
@@ -10351,7 +11786,10 @@ SCIP_DECL_CONSFREE(consFreeExpr)
 
    SCIP_CALL( SCIPfreeClock(scip, &conshdlrdata->canonicalizetime) );
 
-   SCIPqueueFree(&conshdlrdata->reversepropqueue);
+   SCIPpqueueFree(&conshdlrdata->reversepropqueue);
+   assert(conshdlrdata->npendingvarexprs == 0);
+   freeEigenCache(scip, conshdlrdata);
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->pendingvarexprs, conshdlrdata->pendingvarexprssize);
 
    assert(conshdlrdata->vp_randnumgen == NULL);
 #ifndef NDEBUG
@@ -10477,6 +11915,11 @@ SCIP_DECL_CONSEXIT(consExitExpr)
    conshdlrdata = SCIPconshdlrGetData(conshdlr);
    assert(conshdlrdata != NULL);
 
+   /* release variable expressions with pending bound change events */
+   SCIP_CALL( applyPendingVarMarks(scip, conshdlr) );
+   SCIPfreeBlockMemoryArrayNull(scip, &conshdlrdata->pendingvarexprs, conshdlrdata->pendingvarexprssize);
+   conshdlrdata->pendingvarexprssize = 0;
+
    if( nconss > 0 )
    {
       /* for better performance of dropVarEvents, we sort by index, descending */
@@ -10597,6 +12040,12 @@ SCIP_DECL_CONSINITSOL(consInitsolExpr)
       SCIP_CALL( initSolve(scip, conshdlr, conss, nconss) );
    }
 
+   /* create pool for reusing rowpreps of estimators */
+   if( conshdlrdata->rowpreppool == NULL )
+   {
+      SCIP_CALL( SCIPcreateRowprepPool(scip, &conshdlrdata->rowpreppool) );
+   }
+
    if( conshdlrdata->branchpscostweight > 0.0 )
    {
       SCIP_CALL( SCIPgetCharParam(scip, "branching/lpgainnormalize", &(conshdlrdata->branchpscostupdatestrategy)) );
@@ -10616,15 +12065,32 @@ static
 SCIP_DECL_CONSEXITSOL(consExitsolExpr)
 {  /*lint --e{715}*/
    SCIP_CONSHDLRDATA* conshdlrdata;
+   int c;
 
    SCIP_CALL( deinitSolve(scip, conshdlr, conss, nconss) );
 
+   /* free evaluation tapes, since expressions may be modified after the solving stage */
+   for( c = 0; c < nconss; ++c )
+   {
+      SCIP_CONSDATA* consdata;
+
+      consdata = SCIPconsGetData(conss[c]);
+      assert(consdata != NULL);
+
+      if( consdata->tape != NULL )
+         freeExprTape(scip, &consdata->tape);
+   }
+
    conshdlrdata = SCIPconshdlrGetData(conshdlr);
    assert(conshdlrdata != NULL);
 
    /* free hash table for bilinear terms */
    SCIP_CALL( bilinearTermsFree(scip, conshdlrdata) );
 
+   /* free rowpreps kept for reuse */
+   if( conshdlrdata->rowpreppool != NULL )
+      SCIPfreeRowprepPool(scip, &conshdlrdata->rowpreppool);
+
    /* reset flag to allow another call of presolSingleLockedVars() after a restart */
    conshdlrdata->checkedvarlocks = FALSE;
 
@@ -10647,6 +12113,9 @@ SCIP_DECL_CONSDELETE(consDeleteExpr)
    /* free variable expressions */
    SCIP_CALL( freeVarExprs(scip, *consdata) );
 
+   if( (*consdata)->tape != NULL )
+      freeExprTape(scip, &(*consdata)->tape);
+
    SCIP_CALL( SCIPreleaseConsExprExpr(scip, &(*consdata)->expr) );
 
    /* free nonlinear row representation */
@@ -11559,6 +13028,26 @@ SCIP_DECL_TABLEOUTPUT(tableOutputExpr)
    return SCIP_OKAY;
 }
 
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonExpr)
+{ /*lint --e{715}*/
+   SCIP_CONSHDLR* conshdlr;
+
+   conshdlr = SCIPfindConshdlr(scip, CONSHDLR_NAME);
+   assert(conshdlr != NULL);
+
+   SCIPinfoMessage(scip, file, "{\"exprhdlrs\":");
+   printExprHdlrStatisticsJson(scip, conshdlr, file);
+   SCIPinfoMessage(scip, file, ",\"nlhdlrs\":");
+   printNlhdlrStatisticsJson(scip, conshdlr, file);
+   SCIPinfoMessage(scip, file, ",\"conshdlr\":");
+   printConshdlrStatisticsJson(scip, conshdlr, file);
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
 /** creates the handler for an expression handler and includes it into the expression constraint handler */
 SCIP_RETCODE SCIPincludeConsExprExprHdlrBasic(
    SCIP*                       scip,         /**< SCIP data structure */
@@ -11948,6 +13437,16 @@ SCIP_CONSEXPR_EXPRHDLR* SCIPgetConsExprExprHdlrLog(
    return SCIPconshdlrGetData(conshdlr)->exprloghdlr;
 }
 
+/** returns expression handler for entropy expressions */
+SCIP_CONSEXPR_EXPRHDLR* SCIPgetConsExprExprHdlrEntropy(
+   SCIP_CONSHDLR*             conshdlr       /**< expression constraint handler */
+   )
+{
+   assert(conshdlr != NULL);
+
+   return SCIPconshdlrGetData(conshdlr)->exprentropyhdlr;
+}
+
 /** gives the name of an expression handler */
 const char* SCIPgetConsExprExprHdlrName(
    SCIP_CONSEXPR_EXPRHDLR*    exprhdlr       /**< expression handler */
@@ -14457,8 +15956,7 @@ SCIP_RETCODE SCIPtightenConsExprExprInterval(
 #ifdef DEBUG_PROP
          SCIPdebugMsg(scip, " insert expr <%p> (%s) into reversepropqueue\n", (void*)expr, SCIPgetConsExprExprHdlrName(SCIPgetConsExprExprHdlr(expr)));
 #endif
-         SCIP_CALL( SCIPqueueInsert(conshdlrdata->reversepropqueue, expr) );
-         expr->inpropqueue = TRUE;
+         SCIP_CALL( insertRevpropQueue(conshdlrdata, expr, newbounds) );
    }
 
    /* update bounds on variable or auxiliary variable */
@@ -14539,6 +16037,9 @@ void SCIPincrementConsExprCurBoundsTag(
    ++conshdlrdata->curboundstag;
    assert(conshdlrdata->curboundstag > 0);
 
+   /* activities of expressions must not be reused even if no descendant changed, see forwardPropExpr() */
+   conshdlrdata->lastforcedreeval = conshdlrdata->curboundstag;
+
    if( boundrelax )
       conshdlrdata->lastboundrelax = conshdlrdata->curboundstag;
 }
@@ -14884,6 +16385,10 @@ int SCIPcompareConsExprExprs(
    SCIP_CONSEXPR_EXPRHDLR* exprhdlr2;
    int retval;
 
+   /* shared (e.g., hash-consed) subexpressions are equal without looking at them in detail */
+   if( expr1 == expr2 )
+      return 0;
+
    exprhdlr1 = SCIPgetConsExprExprHdlr(expr1);
    exprhdlr2 = SCIPgetConsExprExprHdlr(expr2);
 
@@ -15807,6 +17312,27 @@ int SCIPgetConsExprNBilinTerms(
    return conshdlrdata->nbilinterms;
 }
 
+/** returns the pool of rowpreps that nonlinear handlers can use to create estimators
+ *
+ * Rowpreps that are returned by the estimate callback of a nonlinear handler are given back to this pool after the
+ * estimator has been processed.
+ *
+ * @note The pool exists only during the solving process; otherwise, NULL is returned.
+ */
+SCIP_ROWPREPPOOL* SCIPgetConsExprRowprepPool(
+   SCIP_CONSHDLR*             consexprhdlr    /**< expression constraint handler */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+
+   assert(consexprhdlr != NULL);
+
+   conshdlrdata = SCIPconshdlrGetData(consexprhdlr);
+   assert(conshdlrdata != NULL);
+
+   return conshdlrdata->rowpreppool;
+}
+
 /** returns all bilinear terms that are contained in all expression constraints
  *
  * @note This method should only be used after auxiliary variables have been created, i.e., after CONSINITLP.
@@ -15947,7 +17473,7 @@ SCIP_RETCODE includeConshdlrExprBasic(
    conshdlrdata->lastboundrelax = 1;
    conshdlrdata->curpropboundstag = 1;
    SCIP_CALL( SCIPcreateClock(scip, &conshdlrdata->canonicalizetime) );
-   SCIP_CALL( SCIPqueueCreate(&conshdlrdata->reversepropqueue, 100, 2.0) );
+   SCIP_CALL( SCIPpqueueCreate(&conshdlrdata->reversepropqueue, 100, 2.0, revpropQueueComp, NULL) );
 
    /* include constraint handler */
    SCIP_CALL( SCIPincludeConshdlr(scip, CONSHDLR_NAME, CONSHDLR_DESC,
@@ -16023,6 +17549,38 @@ SCIP_RETCODE includeConshdlrExprBasic(
          "whether to (re)run propagation in enforcement",
          &conshdlrdata->propinenforce, TRUE, FALSE, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/" CONSHDLR_NAME "/eigencachemaxdim",
+         "maximal dimension of symmetric matrices whose eigenvalue decomposition is cached for reuse (0: no caching)",
+         &conshdlrdata->eigencachemaxdim, TRUE, 50, 0, 7000, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/memoactivity",
+         "whether to skip the interval evaluation of an expression if the activities of its descendants did not change",
+         &conshdlrdata->memoactivity, TRUE, TRUE, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/revpropprio",
+         "whether to reverse propagate expressions in the order of their expected relative domain reduction instead of FIFO",
+         &conshdlrdata->revpropprio, TRUE, FALSE, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/" CONSHDLR_NAME "/maxrevpropexprs",
+         "maximal number of expressions to reverse propagate in one propagation round before continuing in the next round (-1: no limit)",
+         &conshdlrdata->maxrevpropexprs, TRUE, -1, -1, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddRealParam(scip, "constraints/" CONSHDLR_NAME "/maxrevproptime",
+         "maximal time in seconds for reverse propagation in one propagation round before continuing in the next round (-1: no limit)",
+         &conshdlrdata->maxrevproptime, TRUE, -1.0, -1.0, SCIP_REAL_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/propcomponents",
+         "whether to propagate variable-disjoint components of the constraints separately, each with its own round limit",
+         &conshdlrdata->propcomponents, TRUE, FALSE, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/evaltape",
+         "whether to evaluate constraints and their gradients by flat evaluation tapes in the solving stage",
+         &conshdlrdata->evaltape, TRUE, FALSE, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/" CONSHDLR_NAME "/evalincremental",
+         "whether evaluation tapes should only re-evaluate subexpressions that depend on variables with changed values",
+         &conshdlrdata->evalincremental, TRUE, TRUE, NULL, NULL) );
+
    SCIP_CALL( SCIPaddRealParam(scip, "constraints/" CONSHDLR_NAME "/weakcutthreshold",
          "threshold for when to regard a cut from an estimator as weak (lower values allow more weak cuts)",
          &conshdlrdata->weakcutthreshold, TRUE, 0.2, 0.0, 1.0, NULL, NULL) );
@@ -16113,6 +17671,7 @@ SCIP_RETCODE includeConshdlrExprBasic(
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_EXPR, TABLE_DESC_EXPR, TRUE,
          NULL, NULL, NULL, NULL, NULL, NULL, tableOutputExpr,
          NULL, TABLE_POSITION_EXPR, TABLE_EARLIEST_STAGE_EXPR) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_EXPR), tableOutputJsonExpr) );
 
    return SCIP_OKAY;
 }
@@ -16177,9 +17736,10 @@ SCIP_RETCODE SCIPincludeConshdlrExpr(
    assert(conshdlrdata->nexprhdlrs > 0 && strcmp(conshdlrdata->exprhdlrs[conshdlrdata->nexprhdlrs-1]->name, "signpower") == 0);
    conshdlrdata->exprsignpowhdlr = conshdlrdata->exprhdlrs[conshdlrdata->nexprhdlrs-1];
 
-   /* include handler for entropy expression */
+   /* include and remember handler for entropy expression */
    SCIP_CALL( SCIPincludeConsExprExprHdlrEntropy(scip, conshdlr) );
    assert(conshdlrdata->nexprhdlrs > 0 && strcmp(conshdlrdata->exprhdlrs[conshdlrdata->nexprhdlrs-1]->name, "entropy") == 0);
+   conshdlrdata->exprentropyhdlr = conshdlrdata->exprhdlrs[conshdlrdata->nexprhdlrs-1];
 
    /* include handler for sine expression */
    SCIP_CALL( SCIPincludeConsExprExprHdlrSin(scip, conshdlr) );
@@ -16689,28 +18249,119 @@ SCIP_RETCODE SCIPgetAbsViolationConsExpr(
    SCIP_CALL( computeViolation(scip, cons, sol, 0) );
    *viol = getConsAbsViolation(cons);
 
-   return SCIP_OKAY;
-}
+   return SCIP_OKAY;
+}
+
+/** gets scaled violation of expression constraint
+ *
+ * This function evaluates the constraints in the given solution.
+ *
+ * The scaling that is applied to the absolute violation of the constraint
+ * depends on the setting of parameter constraints/expr/violscale.
+ */
+SCIP_RETCODE SCIPgetRelViolationConsExpr(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS*            cons,               /**< constraint */
+   SCIP_SOL*             sol,                /**< solution to check */
+   SCIP_Real*            viol                /**< buffer to store computed violation */
+   )
+{
+   assert(cons != NULL);
+   assert(viol != NULL);
+
+   SCIP_CALL( computeViolation(scip, cons, sol, 0) );
+   SCIP_CALL( getConsRelViolation(scip, cons, viol, sol, 0) );
+
+   return SCIP_OKAY;
+}
+
+/** gets the maximal absolute violation of expression constraints for each solution of a batch of solutions
+ *
+ * Each constraint is evaluated for all solutions at once: every subexpression is visited only once and its values
+ * in all solutions are stored next to each other. maxviols[s] is set to the maximal absolute violation of the
+ * constraints in sols[s], or SCIPinfinity(scip) if some constraint cannot be evaluated in this solution.
+ * The values stored in the expressions for SCIPgetConsExprExprValue() are not changed.
+ */
+SCIP_RETCODE SCIPgetAbsViolationsConsExpr(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           conss,              /**< expression constraints */
+   int                   nconss,             /**< number of constraints */
+   SCIP_SOL**            sols,               /**< solutions to check (entries can be NULL for the LP solution) */
+   int                   nsols,              /**< number of solutions */
+   SCIP_Real*            maxviols            /**< array of length nsols to store maximal violation for each solution */
+   )
+{
+   SCIP_CONSDATA* consdata;
+   EXPRTAPE* tape;
+   SCIP_Real* vals;
+   SCIP_Real* rootvals;
+   SCIP_Real viol;
+   int valssize;
+   int c;
+   int s;
+
+   assert(scip != NULL);
+   assert(conss != NULL || nconss == 0);
+   assert(sols != NULL || nsols == 0);
+   assert(maxviols != NULL || nsols == 0);
+
+   for( s = 0; s < nsols; ++s )
+      maxviols[s] = 0.0;  /*lint !e613*/
+
+   if( nsols == 0 )
+      return SCIP_OKAY;
+
+   vals = NULL;
+   valssize = 0;
+
+   for( c = 0; c < nconss; ++c )
+   {
+      assert(conss[c] != NULL);  /*lint !e613*/
+      assert(strcmp(SCIPconshdlrGetName(SCIPconsGetHdlr(conss[c])), CONSHDLR_NAME) == 0);  /*lint !e613*/
+
+      consdata = SCIPconsGetData(conss[c]);  /*lint !e613*/
+      assert(consdata != NULL);
+
+      /* use the tape of the constraint if it is up to date, otherwise build a temporary one */
+      if( consdata->tape != NULL && consdata->tape->root == consdata->expr )
+         tape = consdata->tape;
+      else
+      {
+         SCIP_CALL( createExprTape(scip, SCIPconsGetHdlr(conss[c]), consdata->expr, &tape) );  /*lint !e613*/
+      }
+
+      if( tape->nexprs * nsols > valssize )
+      {
+         SCIPfreeBufferArrayNull(scip, &vals);
+         valssize = tape->nexprs * nsols;
+         SCIP_CALL( SCIPallocBufferArray(scip, &vals, valssize) );
+      }
+
+      SCIP_CALL( evalExprTapeBatch(scip, tape, sols, nsols, vals) );  /*lint !e644*/
+
+      rootvals = vals + (size_t)(tape->nexprs - 1) * nsols;
+      for( s = 0; s < nsols; ++s )
+      {
+         /* consider constraint as violated if it is undefined in the solution, as computeViolation() does */
+         if( rootvals[s] == SCIP_INVALID ) /*lint !e777*/
+            viol = SCIPinfinity(scip);
+         else
+         {
+            viol = 0.0;
+            if( !SCIPisInfinity(scip, -consdata->lhs) )
+               viol = MAX(viol, consdata->lhs - rootvals[s]);
+            if( !SCIPisInfinity(scip, consdata->rhs) )
+               viol = MAX(viol, rootvals[s] - consdata->rhs);
+         }
 
-/** gets scaled violation of expression constraint
- *
- * This function evaluates the constraints in the given solution.
- *
- * The scaling that is applied to the absolute violation of the constraint
- * depends on the setting of parameter constraints/expr/violscale.
- */
-SCIP_RETCODE SCIPgetRelViolationConsExpr(
-   SCIP*                 scip,               /**< SCIP data structure */
-   SCIP_CONS*            cons,               /**< constraint */
-   SCIP_SOL*             sol,                /**< solution to check */
-   SCIP_Real*            viol                /**< buffer to store computed violation */
-   )
-{
-   assert(cons != NULL);
-   assert(viol != NULL);
+         maxviols[s] = MAX(maxviols[s], viol);  /*lint !e613*/
+      }
 
-   SCIP_CALL( computeViolation(scip, cons, sol, 0) );
-   SCIP_CALL( getConsRelViolation(scip, cons, viol, sol, 0) );
+      if( tape != consdata->tape )
+         freeExprTape(scip, &tape);
+   }
+
+   SCIPfreeBufferArrayNull(scip, &vals);
 
    return SCIP_OKAY;
 }
@@ -16879,6 +18530,60 @@ SCIP_RETCODE SCIPgetLinvarMayIncreaseExpr(
    return SCIP_OKAY;
 }
 
+/** gives the sparsity pattern of the Hessian of the function of an expression constraint
+ *
+ * The pattern is given as lower triangle in compressed row format: the nonzeros of row i are in the columns
+ * colidxs[rowbegins[i]], ..., colidxs[rowbegins[i+1]-1], which are sorted and at most i. Rows and columns refer to
+ * the variables of the constraint in the order that is given by SCIPgetConsExprExprVarExprs() for the expression of
+ * the constraint. The pattern is derived from the structure of the expression and may contain entries that are always
+ * zero. It is computed on first request and kept until the variable expressions of the constraint are freed.
+ *
+ * @note The variable expressions of the constraint must be stored, which is the case when the constraint is active
+ * in stages after the transformed stage.
+ */
+SCIP_RETCODE SCIPgetConsExprHessianSparsity(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_CONS*            cons,               /**< expression constraint */
+   int*                  nvars,              /**< buffer to store the number of variables, or NULL */
+   int**                 rowbegins,          /**< buffer to store pointer to start of rows (length nvars+1) */
+   int**                 colidxs,            /**< buffer to store pointer to column indices (length nnz) */
+   int*                  nnz                 /**< buffer to store the number of nonzeros in the lower triangle */
+   )
+{
+   SCIP_CONSDATA* consdata;
+
+   assert(scip != NULL);
+   assert(conshdlr != NULL);
+   assert(strcmp(SCIPconshdlrGetName(conshdlr), CONSHDLR_NAME) == 0);
+   assert(cons != NULL);
+   assert(rowbegins != NULL);
+   assert(colidxs != NULL);
+   assert(nnz != NULL);
+
+   consdata = SCIPconsGetData(cons);
+   assert(consdata != NULL);
+
+   if( consdata->varexprs == NULL )
+   {
+      SCIPerrorMessage("variable expressions of constraint <%s> are not available\n", SCIPconsGetName(cons));
+      return SCIP_INVALIDCALL;
+   }
+
+   if( consdata->hessrowbegins == NULL )
+   {
+      SCIP_CALL( computeHessianSparsity(scip, conshdlr, consdata) );
+   }
+
+   if( nvars != NULL )
+      *nvars = consdata->nvarexprs;
+   *rowbegins = consdata->hessrowbegins;
+   *colidxs = consdata->hesscolidxs;
+   *nnz = consdata->nhessnz;
+
+   return SCIP_OKAY;
+}
+
 /** detects nonlinear handlers that can handle the expressions and creates needed auxiliary variables
  *
  *  @note this method is only used for testing purposes
@@ -17607,6 +19312,22 @@ void SCIPsetConsExprNlhdlrSepa(
    nlhdlr->exitsepa = exitsepa;
 }
 
+/** set the batch estimation callback of a nonlinear handler
+ *
+ * The nonlinear handler must also implement the estimator callback.
+ */
+void SCIPsetConsExprNlhdlrEstimateBatch(
+   SCIP*                      scip,          /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLR*      nlhdlr,        /**< nonlinear handler */
+   SCIP_DECL_CONSEXPR_NLHDLRESTIMATEBATCH((*estimatebatch)) /**< batch estimation callback */
+   )
+{
+   assert(nlhdlr != NULL);
+   assert(nlhdlr->estimate != NULL);
+
+   nlhdlr->estimatebatch = estimatebatch;
+}
+
 /** gives name of nonlinear handler */
 const char* SCIPgetConsExprNlhdlrName(
    SCIP_CONSEXPR_NLHDLR*      nlhdlr         /**< nonlinear handler */
@@ -17755,6 +19476,14 @@ SCIP_Bool SCIPhasConsExprNlhdlrEstimate(
    return nlhdlr->estimate != NULL;
 }
 
+/** returns whether nonlinear handler implements the batch estimator callback */
+SCIP_Bool SCIPhasConsExprNlhdlrEstimateBatch(
+   SCIP_CONSEXPR_NLHDLR* nlhdlr              /**< nonlinear handler */
+   )
+{
+   return nlhdlr->estimatebatch != NULL;
+}
+
 /** call the detect callback of a nonlinear handler */
 SCIP_DECL_CONSEXPR_NLHDLRDETECT(SCIPdetectConsExprNlhdlr)
 {
@@ -17907,6 +19636,8 @@ SCIP_DECL_CONSEXPR_NLHDLREXITSEPA(SCIPexitsepaConsExprNlhdlr)
 /** calls the enforcement callback of a nonlinear handler */
 SCIP_DECL_CONSEXPR_NLHDLRENFO(SCIPenfoConsExprNlhdlr)
 {
+   SCIP_RETCODE retcode;
+
    assert(scip != NULL);
    assert(nlhdlr != NULL);
    assert(nlhdlr->enfotime != NULL);
@@ -17928,7 +19659,10 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(SCIPenfoConsExprNlhdlr)
 #endif
 
    SCIP_CALL( SCIPstartClock(scip, nlhdlr->enfotime) );
-   SCIP_CALL( nlhdlr->enfo(scip, conshdlr, cons, nlhdlr, expr, nlhdlrexprdata, sol, auxvalue, overestimate, allowweakcuts, separated, addbranchscores, result) );
+   SCIPstartTraceEvent(scip, SCIP_TRACECAT_NLHDLR, nlhdlr->name);
+   retcode = nlhdlr->enfo(scip, conshdlr, cons, nlhdlr, expr, nlhdlrexprdata, sol, auxvalue, overestimate, allowweakcuts, separated, addbranchscores, result);
+   SCIPstopTraceEvent(scip, SCIP_TRACECAT_NLHDLR, nlhdlr->name);
+   SCIP_CALL( retcode );
    SCIP_CALL( SCIPstopClock(scip, nlhdlr->enfotime) );
 
    /* update statistics */
@@ -17989,6 +19723,87 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(SCIPestimateConsExprNlhdlr)
    return SCIP_OKAY;
 }
 
+/** calls the batch estimator callback of a nonlinear handler
+ *
+ * If the nonlinear handler does not implement the batch estimator callback, then the estimator callback is
+ * called for each point and the first estimator that it returns is kept.
+ */
+SCIP_DECL_CONSEXPR_NLHDLRESTIMATEBATCH(SCIPestimateBatchConsExprNlhdlr)
+{
+   SCIP_PTRARRAY* ptrrowpreps;
+   int k;
+
+   assert(scip != NULL);
+   assert(nlhdlr != NULL);
+   assert(nlhdlr->enfotime != NULL);
+   assert(sols != NULL || nsols == 0);
+   assert(rowpreps != NULL || nsols == 0);
+
+   BMSclearMemoryArray(rowpreps, nsols);
+
+   if( nlhdlr->estimate == NULL || nsols == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPstartClock(scip, nlhdlr->enfotime) );
+
+   if( nlhdlr->estimatebatch != NULL )
+   {
+      SCIP_CALL( nlhdlr->estimatebatch(scip, conshdlr, nlhdlr, expr, nlhdlrexprdata, sols, nsols, overestimate,
+            targetvalues, rowpreps) );
+      SCIP_CALL( SCIPstopClock(scip, nlhdlr->enfotime) );
+
+      /* update statistics */
+      nlhdlr->nenfocalls += nsols;
+
+      return SCIP_OKAY;
+   }
+
+   /* fall back to calling the estimator callback for every point */
+   SCIP_CALL( SCIPcreatePtrarray(scip, &ptrrowpreps) );
+
+   for( k = 0; k < nsols; ++k )
+   {
+      SCIP_Real auxvalue;
+      SCIP_Bool success;
+      SCIP_Bool addedbranchscores;
+      int r;
+
+      SCIP_CALL( nlhdlr->evalaux(scip, nlhdlr, expr, nlhdlrexprdata, &auxvalue, sols[k]) );
+
+      success = FALSE;
+      SCIP_CALL( nlhdlr->estimate(scip, conshdlr, nlhdlr, expr, nlhdlrexprdata, sols[k], auxvalue, overestimate,
+            targetvalues != NULL ? targetvalues[k] : (overestimate ? -SCIPinfinity(scip) : SCIPinfinity(scip)),
+            ptrrowpreps, &success, FALSE, &addedbranchscores) );
+
+      /* keep the first estimator and free the others */
+      for( r = SCIPgetPtrarrayMinIdx(scip, ptrrowpreps); r <= SCIPgetPtrarrayMaxIdx(scip, ptrrowpreps); ++r )
+      {
+         SCIP_ROWPREP* rowprep;
+
+         rowprep = (SCIP_ROWPREP*) SCIPgetPtrarrayVal(scip, ptrrowpreps, r);
+         if( rowprep == NULL )
+            continue;
+
+         if( success && rowpreps[k] == NULL )
+            rowpreps[k] = rowprep;
+         else
+         {
+            SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
+         }
+      }
+      SCIP_CALL( SCIPclearPtrarray(scip, ptrrowpreps) );
+   }
+
+   SCIP_CALL( SCIPfreePtrarray(scip, &ptrrowpreps) );
+
+   SCIP_CALL( SCIPstopClock(scip, nlhdlr->enfotime) );
+
+   /* update statistics */
+   nlhdlr->nenfocalls += nsols;
+
+   return SCIP_OKAY;
+}
+
 /* Quadratic expression functions */
 
 /** gives the coefficients and expressions that define a quadratic expression
@@ -18247,6 +20062,99 @@ SCIP_RETCODE SCIPprintConsExprQuadratic(
 }
 
 
+/** computes the eigenvalues and, optionally, the eigenvectors of a symmetric matrix
+ *
+ * Gives the same result as LapackDsyev(), but remembers the decomposition of matrices of dimension up to
+ * constraints/expr/eigencachemaxdim, so that matrices with the same entries (e.g., from quadratic functions with the
+ * same coefficient structure in different constraints or after a restart) are decomposed only once.
+ * As for LapackDsyev(), only the upper triangle of the matrix is used. If eigenvectors are computed, they are stored
+ * in matrix, otherwise the content of matrix is undefined on return.
+ */
+SCIP_RETCODE SCIPcomputeConsExprEigenDecomposition(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_Bool             computeeigenvectors,/**< whether also eigenvectors should be computed */
+   int                   n,                  /**< dimension of matrix */
+   SCIP_Real*            matrix,             /**< matrix (n*n entries), overwritten by eigenvectors if computeeigenvectors */
+   SCIP_Real*            eigenvalues,        /**< array to store the n eigenvalues in ascending order */
+   SCIP_Bool*            success             /**< buffer to store whether the computation was successful */
+   )
+{
+   SCIP_CONSHDLRDATA* conshdlrdata;
+   EIGENCACHEENTRY key;
+   EIGENCACHEENTRY* entry;
+   int nn;
+
+   assert(scip != NULL);
+   assert(conshdlr != NULL);
+   assert(n > 0);
+   assert(matrix != NULL);
+   assert(eigenvalues != NULL);
+   assert(success != NULL);
+
+   conshdlrdata = SCIPconshdlrGetData(conshdlr);
+   assert(conshdlrdata != NULL);
+
+   nn = n * n;
+
+   /* do not cache large matrices */
+   if( n > conshdlrdata->eigencachemaxdim )
+   {
+      *success = LapackDsyev(computeeigenvectors, n, matrix, eigenvalues) == SCIP_OKAY;
+      return SCIP_OKAY;
+   }
+
+   if( conshdlrdata->eigencache == NULL )
+   {
+      SCIP_CALL( SCIPhashtableCreate(&conshdlrdata->eigencache, SCIPblkmem(scip), 100, SCIPhashGetKeyStandard,
+            eigenCacheIsHashkeyEq, eigenCacheGetHashkeyVal, NULL) );
+   }
+
+   key.n = n;
+   key.matrix = matrix;
+   entry = (EIGENCACHEENTRY*)SCIPhashtableRetrieve(conshdlrdata->eigencache, (void*)&key);
+
+   if( entry == NULL )
+   {
+      SCIP_CALL( SCIPallocBlockMemory(scip, &entry) );
+      entry->n = n;
+      SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &entry->matrix, matrix, nn) );
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &entry->eigenvalues, n) );
+      entry->eigenvectors = NULL;
+      entry->success = FALSE;
+
+      SCIP_CALL( SCIPhashtableInsert(conshdlrdata->eigencache, (void*)entry) );
+   }
+   else if( !entry->success || !computeeigenvectors || entry->eigenvectors != NULL )
+   {
+      /* take decomposition (or failure) from cache */
+      *success = entry->success;
+      if( entry->success )
+      {
+         BMScopyMemoryArray(eigenvalues, entry->eigenvalues, n);
+         if( computeeigenvectors )
+            BMScopyMemoryArray(matrix, entry->eigenvectors, nn);
+      }
+
+      return SCIP_OKAY;
+   }
+
+   /* entry is new or eigenvectors are missing: decompose matrix and store the result */
+   *success = LapackDsyev(computeeigenvectors, n, matrix, eigenvalues) == SCIP_OKAY;
+
+   entry->success = *success;
+   if( *success )
+   {
+      BMScopyMemoryArray(entry->eigenvalues, eigenvalues, n);
+      if( computeeigenvectors )
+      {
+         SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &entry->eigenvectors, matrix, nn) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** Checks the curvature of the quadratic function, x^T Q x + b^T x stored in quaddata
  *
  * For this, it builds the matrix Q and computes its eigenvalues using LAPACK; if Q is
@@ -18264,6 +20172,7 @@ SCIP_RETCODE SCIPgetConsExprQuadraticCurvature(
    SCIP_HASHMAP* expr2matrix;
    double* matrix;
    double* alleigval;
+   SCIP_Bool success;
    int nvars;
    int nn;
    int n;
@@ -18366,7 +20275,9 @@ SCIP_RETCODE SCIPgetConsExprQuadraticCurvature(
    }
 
    /* compute eigenvalues */
-   if( LapackDsyev(FALSE, n, matrix, alleigval) != SCIP_OKAY )
+   SCIP_CALL( SCIPcomputeConsExprEigenDecomposition(scip, SCIPfindConshdlr(scip, CONSHDLR_NAME), FALSE, n, matrix,
+         alleigval, &success) );
+   if( !success )
    {
       SCIPwarningMessage(scip, "Failed to compute eigenvalues of quadratic coefficient matrix --> don't know curvature\n");
       goto CLEANUP;
@@ -18396,11 +20307,11 @@ CLEANUP:
 
 
 
-/* computes a facet of the convex or concave envelope of a vertex polyhedral function
- * see (doxygen-)comment of this function in cons_expr.h
- * (this is by intention not a doxygen comment)
+/** computes a facet of the convex or concave envelope of a vertex polyhedral function, possibly using and updating
+ * the given warm start data
  */
-SCIP_RETCODE SCIPcomputeFacetVertexPolyhedral(
+static
+SCIP_RETCODE computeFacetVertexPolyhedral(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
    SCIP_Bool             overestimate,       /**< whether to compute facet of concave (TRUE) or convex (FALSE) envelope */
@@ -18410,11 +20321,13 @@ SCIP_RETCODE SCIPcomputeFacetVertexPolyhedral(
    SCIP_Real*            box,                /**< box where to compute facet: should be lb_1, ub_1, lb_2, ub_2... */
    int                   nallvars,           /**< half of the length of box */
    SCIP_Real             targetvalue,        /**< target value: no need to compute facet if value in xstar would be worse than this value */
+   SCIP_VERTEXPOLYWARMSTART** warmstart,     /**< pointer to warm start data of the function, or NULL if no warm start */
    SCIP_Bool*            success,            /**< buffer to store whether a facet could be computed successfully */
    SCIP_Real*            facetcoefs,         /**< buffer to store coefficients of facet defining inequality; must be an array of length at least nallvars */
    SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
 )
 {
+   SCIP_VERTEXPOLYWARMSTART* ws;
    SCIP_Real* corner;
    SCIP_Real* funvals;
    int* nonfixedpos;
@@ -18456,6 +20369,32 @@ SCIP_RETCODE SCIPcomputeFacetVertexPolyhedral(
       return SCIP_OKAY;
    }
 
+   ws = NULL;
+   if( warmstart != NULL )
+   {
+      /* create warm start data on first call */
+      if( *warmstart == NULL )
+      {
+         SCIP_CALL( SCIPallocBlockMemory(scip, warmstart) );
+         BMSclearMemory(*warmstart);
+         (*warmstart)->nallvars = nallvars;
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*warmstart)->box, 2 * nallvars) );
+      }
+      ws = *warmstart;
+      assert(ws->nallvars == nallvars);
+
+      /* function values and basis are only meaningful for the same set of nonfixed variables */
+      if( ws->nvars != nvars )
+      {
+         SCIPfreeBlockMemoryArrayNull(scip, &ws->funvals, POWEROFTWO(ws->nvars));
+         SCIPfreeBlockMemoryArrayNull(scip, &ws->cstat, POWEROFTWO(ws->nvars));
+         SCIPfreeBlockMemoryArrayNull(scip, &ws->rstat, ws->nvars + 1);
+         ws->hasfunvals = FALSE;
+         ws->hasbasis = FALSE;
+         ws->nvars = nvars;
+      }
+   }
+
    /* compute f(v^i) for each corner v^i of [l,u] */
    ncorners = POWEROFTWO(nvars);
    SCIP_CALL( SCIPallocBufferArray(scip, &funvals, ncorners) );
@@ -18465,31 +20404,52 @@ SCIP_RETCODE SCIPcomputeFacetVertexPolyhedral(
       if( SCIPisRelEQ(scip, box[2 * j], box[2 * j + 1]) )
          corner[j] = (box[2 * j] + box[2 * j + 1]) / 2.0;
    }
-   for( i = 0; i < ncorners; ++i )
+
+   if( ws != NULL && ws->hasfunvals && memcmp(ws->box, box, 2 * nallvars * sizeof(SCIP_Real)) == 0 )
    {
-      SCIPdebugMsg(scip, "corner %d: ", i);
-      for( j = 0; j < nvars; ++j )
+      /* box did not change since the last call, so the function values in the corners are still valid */
+      BMScopyMemoryArray(funvals, ws->funvals, ncorners);
+   }
+   else
+   {
+      for( i = 0; i < ncorners; ++i )
       {
-         int varpos = nonfixedpos[j];
-         /* if j'th bit of row index i is set, then take upper bound on var j, otherwise lower bound var j
-          * we check this by shifting i for j positions to the right and checking whether the last bit is set
-          */
-         if( (i >> j) & 0x1 )
-            corner[varpos] = box[2 * varpos + 1]; /* ub of var */
-         else
-            corner[varpos] = box[2 * varpos ]; /* lb of var */
-         SCIPdebugMsgPrint(scip, "%g, ", corner[varpos]);
-         assert(!SCIPisInfinity(scip, REALABS(corner[varpos])));
-      }
+         SCIPdebugMsg(scip, "corner %d: ", i);
+         for( j = 0; j < nvars; ++j )
+         {
+            int varpos = nonfixedpos[j];
+            /* if j'th bit of row index i is set, then take upper bound on var j, otherwise lower bound var j
+             * we check this by shifting i for j positions to the right and checking whether the last bit is set
+             */
+            if( (i >> j) & 0x1 )
+               corner[varpos] = box[2 * varpos + 1]; /* ub of var */
+            else
+               corner[varpos] = box[2 * varpos ]; /* lb of var */
+            SCIPdebugMsgPrint(scip, "%g, ", corner[varpos]);
+            assert(!SCIPisInfinity(scip, REALABS(corner[varpos])));
+         }
 
-      funvals[i] = function(corner, nallvars, fundata);
+         funvals[i] = function(corner, nallvars, fundata);
 
-      SCIPdebugMsgPrint(scip, "obj = %e\n", funvals[i]);
+         SCIPdebugMsgPrint(scip, "obj = %e\n", funvals[i]);
 
-      if( funvals[i] == SCIP_INVALID || SCIPisInfinity(scip, REALABS(funvals[i])) )  /*lint !e777*/
+         if( funvals[i] == SCIP_INVALID || SCIPisInfinity(scip, REALABS(funvals[i])) )  /*lint !e777*/
+         {
+            SCIPdebugMsg(scip, "cannot compute underestimator; function value at corner is too large %g\n", funvals[i]);
+            goto CLEANUP;
+         }
+      }
+
+      /* remember function values for the next call */
+      if( ws != NULL )
       {
-         SCIPdebugMsg(scip, "cannot compute underestimator; function value at corner is too large %g\n", funvals[i]);
-         goto CLEANUP;
+         if( ws->funvals == NULL )
+         {
+            SCIP_CALL( SCIPallocBlockMemoryArray(scip, &ws->funvals, ncorners) );
+         }
+         BMScopyMemoryArray(ws->funvals, funvals, ncorners);
+         BMScopyMemoryArray(ws->box, box, 2 * nallvars);
+         ws->hasfunvals = TRUE;
       }
    }
 
@@ -18525,7 +20485,13 @@ SCIP_RETCODE SCIPcomputeFacetVertexPolyhedral(
    }
    else
    {
-      SCIP_CALL( computeVertexPolyhedralFacetLP(scip, conshdlr, overestimate, xstar, box, nallvars, nonfixedpos, funvals, nvars, targetvalue, success, facetcoefs, facetconstant) );
+      if( ws != NULL && ws->cstat == NULL )
+      {
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &ws->cstat, ncorners) );
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &ws->rstat, nvars + 1) );
+      }
+
+      SCIP_CALL( computeVertexPolyhedralFacetLP(scip, conshdlr, overestimate, xstar, box, nallvars, nonfixedpos, funvals, nvars, targetvalue, ws, success, facetcoefs, facetconstant) );
    }
    if( !*success )
    {
@@ -18586,6 +20552,79 @@ CLEANUP:
    return SCIP_OKAY;
 }
 
+/* computes a facet of the convex or concave envelope of a vertex polyhedral function
+ * see (doxygen-)comment of this function in cons_expr.h
+ * (this is by intention not a doxygen comment)
+ */
+SCIP_RETCODE SCIPcomputeFacetVertexPolyhedral(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_Bool             overestimate,       /**< whether to compute facet of concave (TRUE) or convex (FALSE) envelope */
+   SCIP_DECL_VERTEXPOLYFUN((*function)),     /**< pointer to vertex polyhedral function */
+   void*                 fundata,            /**< data for function evaluation (can be NULL) */
+   SCIP_Real*            xstar,              /**< point to be separated */
+   SCIP_Real*            box,                /**< box where to compute facet: should be lb_1, ub_1, lb_2, ub_2... */
+   int                   nallvars,           /**< half of the length of box */
+   SCIP_Real             targetvalue,        /**< target value: no need to compute facet if value in xstar would be worse than this value */
+   SCIP_Bool*            success,            /**< buffer to store whether a facet could be computed successfully */
+   SCIP_Real*            facetcoefs,         /**< buffer to store coefficients of facet defining inequality; must be an array of length at least nallvars */
+   SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
+)
+{
+   SCIP_CALL( computeFacetVertexPolyhedral(scip, conshdlr, overestimate, function, fundata, xstar, box, nallvars,
+         targetvalue, NULL, success, facetcoefs, facetconstant) );
+
+   return SCIP_OKAY;
+}
+
+/* computes a facet of the convex or concave envelope of a vertex polyhedral function, reusing data from the previous
+ * call for the same function
+ * see (doxygen-)comment of this function in cons_expr.h
+ * (this is by intention not a doxygen comment)
+ */
+SCIP_RETCODE SCIPcomputeFacetVertexPolyhedralWarmstart(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_Bool             overestimate,       /**< whether to compute facet of concave (TRUE) or convex (FALSE) envelope */
+   SCIP_DECL_VERTEXPOLYFUN((*function)),     /**< pointer to vertex polyhedral function */
+   void*                 fundata,            /**< data for function evaluation (can be NULL) */
+   SCIP_Real*            xstar,              /**< point to be separated */
+   SCIP_Real*            box,                /**< box where to compute facet: should be lb_1, ub_1, lb_2, ub_2... */
+   int                   nallvars,           /**< half of the length of box */
+   SCIP_Real             targetvalue,        /**< target value: no need to compute facet if value in xstar would be worse than this value */
+   SCIP_VERTEXPOLYWARMSTART** warmstart,     /**< pointer to warm start data of the function */
+   SCIP_Bool*            success,            /**< buffer to store whether a facet could be computed successfully */
+   SCIP_Real*            facetcoefs,         /**< buffer to store coefficients of facet defining inequality; must be an array of length at least nallvars */
+   SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
+)
+{
+   assert(warmstart != NULL);
+
+   SCIP_CALL( computeFacetVertexPolyhedral(scip, conshdlr, overestimate, function, fundata, xstar, box, nallvars,
+         targetvalue, warmstart, success, facetcoefs, facetconstant) );
+
+   return SCIP_OKAY;
+}
+
+/** frees warm start data for the facet computation of a vertex polyhedral function */
+void SCIPfreeFacetVertexPolyhedralWarmstart(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VERTEXPOLYWARMSTART** warmstart      /**< pointer to warm start data, can point to NULL */
+   )
+{
+   assert(scip != NULL);
+   assert(warmstart != NULL);
+
+   if( *warmstart == NULL )
+      return;
+
+   SCIPfreeBlockMemoryArrayNull(scip, &(*warmstart)->funvals, POWEROFTWO((*warmstart)->nvars));
+   SCIPfreeBlockMemoryArrayNull(scip, &(*warmstart)->cstat, POWEROFTWO((*warmstart)->nvars));
+   SCIPfreeBlockMemoryArrayNull(scip, &(*warmstart)->rstat, (*warmstart)->nvars + 1);
+   SCIPfreeBlockMemoryArray(scip, &(*warmstart)->box, 2 * (*warmstart)->nallvars);
+   SCIPfreeBlockMemory(scip, warmstart);
+}
+
 /** given three points, constructs coefficient of equation for hyperplane generated by these three points
  * Three points a, b, and c are given.
  * Computes coefficients alpha, beta, gamma, and delta, such that a, b, and c, satisfy
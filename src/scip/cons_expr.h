@@ -247,6 +247,12 @@ SCIP_CONSEXPR_EXPRHDLR* SCIPgetConsExprExprHdlrLog(
         SCIP_CONSHDLR*             conshdlr       /**< expression constraint handler */
 );
 
+/** returns expression handler for entropy expressions */
+SCIP_EXPORT
+SCIP_CONSEXPR_EXPRHDLR* SCIPgetConsExprExprHdlrEntropy(
+   SCIP_CONSHDLR*             conshdlr       /**< expression constraint handler */
+   );
+
 /** gives the name of an expression handler */
 SCIP_EXPORT
 const char* SCIPgetConsExprExprHdlrName(
@@ -1330,6 +1336,18 @@ int SCIPgetConsExprNBilinTerms(
    SCIP_CONSHDLR*             consexprhdlr    /**< expression constraint handler */
    );
 
+/** returns the pool of rowpreps that nonlinear handlers can use to create estimators
+ *
+ * Rowpreps that are returned by the estimate callback of a nonlinear handler are given back to this pool after the
+ * estimator has been processed.
+ *
+ * @note The pool exists only during the solving process; otherwise, NULL is returned.
+ */
+SCIP_EXPORT
+SCIP_ROWPREPPOOL* SCIPgetConsExprRowprepPool(
+   SCIP_CONSHDLR*             consexprhdlr    /**< expression constraint handler */
+   );
+
 /** returns all bilinear terms that are contained in all expression constraints
  *
  * @note This method should only be used after auxiliary variables have been created, i.e., after CONSINITLP.
@@ -1602,6 +1620,23 @@ SCIP_RETCODE SCIPgetRelViolationConsExpr(
    SCIP_Real*            viol                /**< buffer to store computed violation */
    );
 
+/** gets the maximal absolute violation of expression constraints for each solution of a batch of solutions
+ *
+ * Each constraint is evaluated for all solutions at once: every subexpression is visited only once and its values
+ * in all solutions are stored next to each other. maxviols[s] is set to the maximal absolute violation of the
+ * constraints in sols[s], or SCIPinfinity(scip) if some constraint cannot be evaluated in this solution.
+ * The values stored in the expressions for SCIPgetConsExprExprValue() are not changed.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgetAbsViolationsConsExpr(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONS**           conss,              /**< expression constraints */
+   int                   nconss,             /**< number of constraints */
+   SCIP_SOL**            sols,               /**< solutions to check (entries can be NULL for the LP solution) */
+   int                   nsols,              /**< number of solutions */
+   SCIP_Real*            maxviols            /**< array of length nsols to store maximal violation for each solution */
+   );
+
 /** gives the unique index of an expression constraint
  *
  * Each expression constraint gets an index assigned when it is created.
@@ -1652,6 +1687,28 @@ SCIP_RETCODE SCIPgetLinvarMayIncreaseExpr(
    SCIP_Real*            coef                /**< pointer to store the coefficient */
    );
 
+/** gives the sparsity pattern of the Hessian of the function of an expression constraint
+ *
+ * The pattern is given as lower triangle in compressed row format: the nonzeros of row i are in the columns
+ * colidxs[rowbegins[i]], ..., colidxs[rowbegins[i+1]-1], which are sorted and at most i. Rows and columns refer to
+ * the variables of the constraint in the order that is given by SCIPgetConsExprExprVarExprs() for the expression of
+ * the constraint. The pattern is derived from the structure of the expression and may contain entries that are always
+ * zero. It is computed on first request and kept until the variable expressions of the constraint are freed.
+ *
+ * @note The variable expressions of the constraint must be stored, which is the case when the constraint is active
+ * in stages after the transformed stage.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPgetConsExprHessianSparsity(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_CONS*            cons,               /**< expression constraint */
+   int*                  nvars,              /**< buffer to store the number of variables, or NULL */
+   int**                 rowbegins,          /**< buffer to store pointer to start of rows (length nvars+1) */
+   int**                 colidxs,            /**< buffer to store pointer to column indices (length nnz) */
+   int*                  nnz                 /**< buffer to store the number of nonzeros in the lower triangle */
+   );
+
 /** detects nonlinear handlers that can handle the expressions and creates needed auxiliary variables
  *
  *  @note this method is only used for testing purposes
@@ -1777,6 +1834,17 @@ void SCIPsetConsExprNlhdlrSepa(
    SCIP_DECL_CONSEXPR_NLHDLREXITSEPA((*exitsepa))  /**< separation deinitialization callback (can be NULL) */
 );
 
+/** set the batch estimation callback of a nonlinear handler
+ *
+ * The nonlinear handler must also implement the estimator callback.
+ */
+SCIP_EXPORT
+void SCIPsetConsExprNlhdlrEstimateBatch(
+   SCIP*                      scip,          /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLR*      nlhdlr,        /**< nonlinear handler */
+   SCIP_DECL_CONSEXPR_NLHDLRESTIMATEBATCH((*estimatebatch)) /**< batch estimation callback */
+);
+
 /** gives name of nonlinear handler */
 SCIP_EXPORT
 const char* SCIPgetConsExprNlhdlrName(
@@ -1866,6 +1934,12 @@ SCIP_Bool SCIPhasConsExprNlhdlrEstimate(
    SCIP_CONSEXPR_NLHDLR* nlhdlr              /**< nonlinear handler */
 );
 
+/** returns whether nonlinear handler implements the batch estimator callback */
+SCIP_EXPORT
+SCIP_Bool SCIPhasConsExprNlhdlrEstimateBatch(
+   SCIP_CONSEXPR_NLHDLR* nlhdlr              /**< nonlinear handler */
+);
+
 /** call the detect callback of a nonlinear handler */
 SCIP_EXPORT
 SCIP_DECL_CONSEXPR_NLHDLRDETECT(SCIPdetectConsExprNlhdlr);
@@ -1902,6 +1976,14 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(SCIPenfoConsExprNlhdlr);
 SCIP_EXPORT
 SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(SCIPestimateConsExprNlhdlr);
 
+/** calls the batch estimator callback of a nonlinear handler
+ *
+ * If the nonlinear handler does not implement the batch estimator callback, then the estimator callback is
+ * called for each point and the first estimator that it returns is kept.
+ */
+SCIP_EXPORT
+SCIP_DECL_CONSEXPR_NLHDLRESTIMATEBATCH(SCIPestimateBatchConsExprNlhdlr);
+
 /** @} */
 
 /**@name Quadratic expression functions */
@@ -1994,6 +2076,25 @@ SCIP_RETCODE SCIPprintConsExprQuadratic(
    SCIP_CONSEXPR_QUADEXPR* quaddata          /**< quadratic form */
    );
 
+/** computes the eigenvalues and, optionally, the eigenvectors of a symmetric matrix
+ *
+ * Gives the same result as LapackDsyev(), but remembers the decomposition of matrices of dimension up to
+ * constraints/expr/eigencachemaxdim, so that matrices with the same entries (e.g., from quadratic functions with the
+ * same coefficient structure in different constraints or after a restart) are decomposed only once.
+ * As for LapackDsyev(), only the upper triangle of the matrix is used. If eigenvectors are computed, they are stored
+ * in matrix, otherwise the content of matrix is undefined on return.
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcomputeConsExprEigenDecomposition(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_Bool             computeeigenvectors,/**< whether also eigenvectors should be computed */
+   int                   n,                  /**< dimension of matrix */
+   SCIP_Real*            matrix,             /**< matrix (n*n entries), overwritten by eigenvectors if computeeigenvectors */
+   SCIP_Real*            eigenvalues,        /**< array to store the n eigenvalues in ascending order */
+   SCIP_Bool*            success             /**< buffer to store whether the computation was successful */
+   );
+
 /** Checks the curvature of the quadratic function, x^T Q x + b^T x stored in quaddata
  *
  * For this, it builds the matrix Q and computes its eigenvalues using LAPACK; if Q is
@@ -2103,6 +2204,38 @@ SCIP_RETCODE SCIPcomputeFacetVertexPolyhedral(
    SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
 );
 
+/** computes a facet of the convex or concave envelope of a vertex polyhedral function, reusing data from the previous
+ * call for the same function
+ *
+ * Same as SCIPcomputeFacetVertexPolyhedral(), but the function values in the corners are reused if the box did not
+ * change, and the separation LP is warm started from the basis of the previous call with the same number of nonfixed
+ * variables. The warm start data is created if *warmstart is NULL and needs to be freed with
+ * SCIPfreeFacetVertexPolyhedralWarmstart().
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcomputeFacetVertexPolyhedralWarmstart(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_Bool             overestimate,       /**< whether to compute facet of concave (TRUE) or convex (FALSE) envelope */
+   SCIP_DECL_VERTEXPOLYFUN((*function)),     /**< pointer to vertex polyhedral function */
+   void*                 fundata,            /**< data for function evaluation (can be NULL) */
+   SCIP_Real*            xstar,              /**< point to be separated */
+   SCIP_Real*            box,                /**< box where to compute facet: should be lb_1, ub_1, lb_2, ub_2... */
+   int                   nallvars,           /**< half of the length of box */
+   SCIP_Real             targetvalue,        /**< target value: no need to compute facet if value in xstar would be worse than this value */
+   SCIP_VERTEXPOLYWARMSTART** warmstart,     /**< pointer to warm start data of the function */
+   SCIP_Bool*            success,            /**< buffer to store whether a facet could be computed successfully */
+   SCIP_Real*            facetcoefs,         /**< buffer to store coefficients of facet defining inequality; must be an array of length at least nallvars */
+   SCIP_Real*            facetconstant       /**< buffer to store constant part of facet defining inequality */
+);
+
+/** frees warm start data for the facet computation of a vertex polyhedral function */
+SCIP_EXPORT
+void SCIPfreeFacetVertexPolyhedralWarmstart(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_VERTEXPOLYWARMSTART** warmstart      /**< pointer to warm start data, can point to NULL */
+);
+
 /** given three points, constructs coefficient of equation for hyperplane generated by these three points
  * Three points a, b, and c are given.
  * Computes coefficients alpha, beta, gamma, and delta, such that a, b, and c, satisfy
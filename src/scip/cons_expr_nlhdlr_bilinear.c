@@ -1232,7 +1232,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateBilinear)
 
    if( *success )
    {
-      SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
+      SCIP_CALL( SCIPcreateRowprepFromPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
       SCIPaddRowprepConstant(rowprep, linconstant);
       SCIP_CALL( SCIPensureRowprepSize(scip, rowprep, 2) );
       SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, x, lincoefx) );
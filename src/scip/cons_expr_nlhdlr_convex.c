@@ -67,6 +67,8 @@ struct SCIP_ConsExpr_NlhdlrExprData
 
    int                   nleafs;             /**< number of distinct leafs of nlexpr, i.e., number of distinct (auxiliary) variables handled */
    SCIP_CONSEXPR_EXPR**  leafexprs;          /**< distinct leaf expressions (excluding value-expressions), thus variables */
+
+   SCIP_VERTEXPOLYWARMSTART* vpwarmstart;    /**< warm start data for vertex-polyhedral facet computation, or NULL if not used yet */
 };
 
 /** nonlinear handler data */
@@ -1393,8 +1395,8 @@ SCIP_RETCODE estimateVertexPolyhedral(
 
    SCIP_CALL( SCIPensureRowprepSize(scip, rowprep, nlhdlrexprdata->nleafs + 1) );
 
-   SCIP_CALL( SCIPcomputeFacetVertexPolyhedral(scip, conshdlr, overestimate, nlhdlrExprEvalConcave, (void*)&evaldata,
-      xstar, box, nlhdlrexprdata->nleafs, targetvalue, success, rowprep->coefs, &facetconstant) );
+   SCIP_CALL( SCIPcomputeFacetVertexPolyhedralWarmstart(scip, conshdlr, overestimate, nlhdlrExprEvalConcave, (void*)&evaldata,
+      xstar, box, nlhdlrexprdata->nleafs, targetvalue, &nlhdlrexprdata->vpwarmstart, success, rowprep->coefs, &facetconstant) );
 
    if( !*success )
    {
@@ -1649,6 +1651,7 @@ SCIP_DECL_CONSEXPR_NLHDLRFREEEXPRDATA(nlhdlrfreeExprDataConvexConcave)
    assert(nlhdlrexprdata != NULL);
    assert(*nlhdlrexprdata != NULL);
 
+   SCIPfreeFacetVertexPolyhedralWarmstart(scip, &(*nlhdlrexprdata)->vpwarmstart);
    SCIPfreeBlockMemoryArrayNull(scip, &(*nlhdlrexprdata)->leafexprs, (*nlhdlrexprdata)->nleafs);
    SCIP_CALL( SCIPreleaseConsExprExpr(scip, &(*nlhdlrexprdata)->nlexpr) );
    SCIPhashmapFree(&(*nlhdlrexprdata)->nlexpr2origexpr);
@@ -1920,7 +1923,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateConvex)
    /* SCIP_CALL( nlhdlrExprEval(scip, nlexpr, sol) ); */
    assert(auxvalue == SCIPgetConsExprExprValue(nlhdlrexprdata->nlexpr)); /* given value (originally from nlhdlrEvalAuxConvexConcave) should coincide with the one stored in nlexpr */  /*lint !e777*/
 
-   SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
+   SCIP_CALL( SCIPcreateRowprepFromPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
 
    if( nlhdlrexprdata->nleafs == 1 && SCIPisConsExprExprIntegral(nlhdlrexprdata->leafexprs[0]) )
    {
@@ -1951,7 +1954,72 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateConvex)
    }
    else
    {
-      SCIPfreeRowprep(scip, &rowprep);
+      SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
+   }
+
+   return SCIP_OKAY;
+}
+
+/** batch estimator callback
+ *
+ * Checks once whether the secant method applies and then computes for every point a secant or gradient estimator.
+ * The gradient computation also evaluates nlexpr in the point, so no separate evaluation is needed.
+ */
+static
+SCIP_DECL_CONSEXPR_NLHDLRESTIMATEBATCH(nlhdlrEstimateBatchConvex)
+{ /*lint --e{715}*/
+   SCIP_Bool usesecant;
+   int k;
+
+   assert(scip != NULL);
+   assert(expr != NULL);
+   assert(nlhdlrexprdata != NULL);
+   assert(nlhdlrexprdata->nlexpr != NULL);
+   assert(rowpreps != NULL);
+   assert(!overestimate || SCIPgetConsExprExprCurvature(nlhdlrexprdata->nlexpr) == SCIP_EXPRCURV_CONCAVE);
+   assert( overestimate || SCIPgetConsExprExprCurvature(nlhdlrexprdata->nlexpr) == SCIP_EXPRCURV_CONVEX);
+
+   usesecant = nlhdlrexprdata->nleafs == 1 && SCIPisConsExprExprIntegral(nlhdlrexprdata->leafexprs[0]);
+
+   for( k = 0; k < nsols; ++k )
+   {
+      SCIP_ROWPREP* rowprep;
+      SCIP_Bool success = FALSE;
+      SCIP_Bool bysecant;
+
+      rowpreps[k] = NULL;
+
+      SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
+      SCIP_CALL( SCIPensureRowprepSize(scip, rowprep, nlhdlrexprdata->nleafs) );
+
+      if( usesecant )
+      {
+         SCIP_CALL( estimateConvexSecant(scip, conshdlr, nlhdlr, nlhdlrexprdata, sols[k], rowprep, &success) );
+      }
+      bysecant = success;
+
+      /* if secant method was not used or failed, then try with gradient
+       * auxvalue is only checked for evaluation errors, which the gradient computation detects, too
+       */
+      if( !success )
+      {
+         SCIP_CALL( estimateGradient(scip, conshdlr, nlhdlrexprdata, sols[k], 0.0, rowprep, &success) );
+      }
+
+      if( !success )
+      {
+         SCIPfreeRowprep(scip, &rowprep);
+         continue;
+      }
+
+      (void) SCIPsnprintf(rowprep->name, SCIP_MAXSTRLEN, "%sestimate_convex%s%p_%s%d",
+         overestimate ? "over" : "under",
+         bysecant ? "secant" : "gradient",
+         (void*)expr,
+         sols[k] != NULL ? "sol" : "lp",
+         sols[k] != NULL ? SCIPsolGetIndex(sols[k]) : SCIPgetNLPs(scip));
+
+      rowpreps[k] = rowprep;
    }
 
    return SCIP_OKAY;
@@ -2019,6 +2087,7 @@ SCIP_RETCODE SCIPincludeConsExprNlhdlrConvex(
    SCIPsetConsExprNlhdlrCopyHdlr(scip, nlhdlr, nlhdlrCopyhdlrConvex);
    SCIPsetConsExprNlhdlrFreeExprData(scip, nlhdlr, nlhdlrfreeExprDataConvexConcave);
    SCIPsetConsExprNlhdlrSepa(scip, nlhdlr, nlhdlrInitSepaConvex, NULL, nlhdlrEstimateConvex, NULL);
+   SCIPsetConsExprNlhdlrEstimateBatch(scip, nlhdlr, nlhdlrEstimateBatchConvex);
    SCIPsetConsExprNlhdlrInitExit(scip, nlhdlr, NULL, nlhdlrExitConvex);
 
    return SCIP_OKAY;
@@ -2236,7 +2305,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateConcave)
    *success = FALSE;
    *addedbranchscores = FALSE;
 
-   SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
+   SCIP_CALL( SCIPcreateRowprepFromPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
 
    SCIP_CALL( estimateVertexPolyhedral(scip, conshdlr, nlhdlr, nlhdlrexprdata, sol, FALSE, overestimate, targetvalue, rowprep, success) );
 
@@ -2252,7 +2321,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateConcave)
    }
    else
    {
-      SCIPfreeRowprep(scip, &rowprep);
+      SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
    }
 
    if( addbranchscores )
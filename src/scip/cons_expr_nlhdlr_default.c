@@ -203,7 +203,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateDefault)
 
    *addedbranchscores = FALSE;
 
-   SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
+   SCIP_CALL( SCIPcreateRowprepFromPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
 
    nchildren = SCIPgetConsExprExprNChildren(expr);
 
@@ -244,7 +244,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateDefault)
    }
    else
    {
-      SCIPfreeRowprep(scip, &rowprep);
+      SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
    }
 
    if( addbranchscores )
@@ -296,6 +296,81 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateDefault)
    return SCIP_OKAY;
 }
 
+/** batch estimation callback
+ *
+ * Collects the auxiliary variables of the children once and then calls the estimation callback of the expression
+ * handler for every point.
+ */
+static
+SCIP_DECL_CONSEXPR_NLHDLRESTIMATEBATCH(nlhdlrEstimateBatchDefault)
+{ /*lint --e{715}*/
+   SCIP_VAR** childvars;
+   SCIP_Bool* branchcand;
+   int nchildren;
+   int c;
+   int k;
+
+   assert(scip != NULL);
+   assert(expr != NULL);
+   assert(rowpreps != NULL);
+
+   nchildren = SCIPgetConsExprExprNChildren(expr);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &childvars, nchildren) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &branchcand, nchildren) );
+
+   for( c = 0; c < nchildren; ++c )
+   {
+      childvars[c] = SCIPgetConsExprExprAuxVar(SCIPgetConsExprExprChildren(expr)[c]);
+      assert(childvars[c] != NULL);
+   }
+
+   for( k = 0; k < nsols; ++k )
+   {
+      SCIP_ROWPREP* rowprep;
+      SCIP_Real constant;
+      SCIP_Bool success;
+
+      rowpreps[k] = NULL;
+
+      SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
+      SCIP_CALL( SCIPensureRowprepSize(scip, rowprep, nchildren) );
+
+      /* the expression handler may reset the branchcand flags */
+      for( c = 0; c < nchildren; ++c )
+         branchcand[c] = TRUE;
+
+      SCIP_CALL( SCIPestimateConsExprExprHdlr(scip, conshdlr, expr, sols[k], overestimate,
+            targetvalues != NULL ? targetvalues[k] : (overestimate ? -SCIPinfinity(scip) : SCIPinfinity(scip)),
+            rowprep->coefs, &constant, &rowprep->local, &success, branchcand) );
+
+      if( !success )
+      {
+         SCIPfreeRowprep(scip, &rowprep);
+         continue;
+      }
+
+      /* add variables to rowprep */
+      BMScopyMemoryArray(rowprep->vars, childvars, nchildren);
+      rowprep->nvars = nchildren;
+      rowprep->side = -constant;
+
+      (void) SCIPsnprintf(rowprep->name, SCIP_MAXSTRLEN, "%sestimate_%s%p_%s%d",
+         overestimate ? "over" : "under",
+         SCIPgetConsExprExprHdlrName(SCIPgetConsExprExprHdlr(expr)),
+         (void*)expr,
+         sols[k] != NULL ? "sol" : "lp",
+         sols[k] != NULL ? SCIPsolGetIndex(sols[k]) : SCIPgetNLPs(scip));
+
+      rowpreps[k] = rowprep;
+   }
+
+   SCIPfreeBufferArray(scip, &branchcand);
+   SCIPfreeBufferArray(scip, &childvars);
+
+   return SCIP_OKAY;
+}
+
 static
 SCIP_DECL_CONSEXPR_NLHDLREXITSEPA(nlhdlrExitSepaDefault)
 { /*lint --e{715}*/
@@ -362,6 +437,7 @@ SCIP_RETCODE SCIPincludeConsExprNlhdlrDefault(
 
    SCIPsetConsExprNlhdlrCopyHdlr(scip, nlhdlr, nlhdlrCopyhdlrDefault);
    SCIPsetConsExprNlhdlrSepa(scip, nlhdlr, nlhdlrInitSepaDefault, NULL, nlhdlrEstimateDefault, nlhdlrExitSepaDefault);
+   SCIPsetConsExprNlhdlrEstimateBatch(scip, nlhdlr, nlhdlrEstimateBatchDefault);
    SCIPsetConsExprNlhdlrProp(scip, nlhdlr, nlhdlrIntevalDefault, nlhdlrReversepropDefault);
 
    return SCIP_OKAY;
@@ -24,6 +24,8 @@
 #include "scip/cons_expr_nlhdlr_perspective.h"
 #include "scip/cons_expr.h"
 #include "scip/cons_expr_var.h"
+#include "scip/cons_expr_pow.h"
+#include "scip/pub_bandit_epsgreedy.h"
 #include "scip/scip_sol.h"
 #include "scip/cons_expr_iterator.h"
 #include "scip/cons_expr_rowprep.h"
@@ -35,6 +37,15 @@
 #define NLHDLR_DETECTPRIORITY     -20 /**< detect last so that to make use of what other handlers detected */
 #define NLHDLR_ENFOPRIORITY       125 /**< enforce first because perspective cuts are always stronger */
 
+#define EVENTHDLR_NAME            "perspective_scvars"
+#define EVENTHDLR_DESC            "signals changes of variable bounds relevant for semicontinuity"
+#define EVENTHDLR_EVENTTYPE       (SCIP_EVENTTYPE_GBDCHANGED | SCIP_EVENTTYPE_IMPLADDED) /**< events that can change semicontinuity */
+
+#define TABLE_NAME_PERSPECTIVE           "perspective_nlhdlr"
+#define TABLE_DESC_PERSPECTIVE           "perspective nlhdlr statistics table"
+#define TABLE_POSITION_PERSPECTIVE       12600                  /**< the position of the statistics table */
+#define TABLE_EARLIEST_STAGE_PERSPECTIVE SCIP_STAGE_TRANSFORMED /**< output of the statistics table is only printed from this stage onwards */
+
 #define DEFAULT_MAXPROPROUNDS     1     /**< maximal number of propagation rounds in probing */
 #define DEFAULT_MINDOMREDUCTION   0.1   /**< minimal relative reduction in a variable's domain for applying probing */
 #define DEFAULT_MINVIOLPROBING    1e-05 /**< minimal violation w.r.t. auxiliary variables for applying probing */
@@ -44,6 +55,15 @@
 #define DEFAULT_TIGHTENBOUNDS     TRUE  /**< whether variable semicontinuity is used to tighten variable bounds */
 #define DEFAULT_ADJREFPOINT       FALSE /**< whether to adjust the reference point if indicator is not 1 */
 #define DEFAULT_BIGMCUTS          FALSE /**< whether to strengthen cuts for constraints with big-M structure */
+#define DEFAULT_BATCHPROBING      FALSE /**< whether to probe each indicator only once per separation round for all expressions depending on it */
+#define DEFAULT_PROBINGCACHE      TRUE  /**< whether to reuse the result of probing propagation if the local domains did not change */
+#define DEFAULT_CUTPOOL           FALSE /**< whether to store globally valid perspective cuts and reuse them before computing new ones */
+#define DEFAULT_MAXPOOLCUTS       10    /**< maximal number of stored cuts per expression */
+#define BANDIT_EPS                0.2   /**< exploration parameter of the epsilon greedy bandit for adaptive probing */
+#define BANDIT_SEED               417   /**< initial seed of the bandits for adaptive probing */
+#define DEFAULT_ADAPTIVEPROBING   FALSE /**< whether a bandit algorithm decides for each expression whether probing is worth its cost */
+#define DEFAULT_PROBINGCOSTWEIGHT 0.5   /**< weight of the fraction of time spent in probing that is subtracted from the reward of probing */
+#define DEFAULT_CLOSEDFORM        TRUE  /**< whether to compute perspective tangents of exp, pow and entropy expressions in closed form */
 
 /** translates x to 2^x for non-negative integer x */
 #define POWEROFTWO(x) (0x1u << (x))
@@ -52,21 +72,41 @@
  * Data structures
  */
 
-/** data structure to store information of a semicontinuous variable
+/** data structure to store information of all semicontinuous variables
+ *
+ * The data is stored in compressed sparse row format: for a variable x with index i = SCIPvarGetIndex(x), the entries
+ * j = starts[i], ..., starts[i] + nbnds[i] - 1 of the packed arrays store the data of nbnds[i] implications
+ *   bvars[j] = 0 -> x = vals0[j]
+ *   bvars[j] = 1 -> lbs1[j] <= x <= ubs1[j]
+ * where bvars[j] are binary variables, sorted by SCIPvarComp within each row.
+ * If x is not (known to be) semicontinuous, then nbnds[i] = 0.
+ *
+ * The row of x has space for rowsizes[i] entries. If it needs to grow, it is moved to the end of the packed arrays.
  *
- * For a variable x (not stored in the struct), this stores the data of nbnds implications
- *   bvars[i] = 0 -> x = vals[i]
- *   bvars[i] = 1 -> lbs[i] <= x <= ubs[i]
- * where bvars[i] are binary variables.
+ * The result of checking a variable for semicontinuity is kept (also across restarts) and only recomputed if the
+ * global bounds or the variable bounds of the variable changed. These changes are signaled by events.
  */
 struct SCVarData
 {
-   SCIP_Real*            vals0;              /**< values of the variable when the corresponding bvars[i] = 0 */
-   SCIP_Real*            lbs1;               /**< global lower bounds of the variable when the corresponding bvars[i] = 1 */
-   SCIP_Real*            ubs1;               /**< global upper bounds of the variable when the corresponding bvars[i] = 1 */
+   int*                  starts;             /**< position of the first entry of each variable in the packed arrays */
+   int*                  nbnds;              /**< number of suitable on/off bounds of each variable */
+   int*                  rowsizes;           /**< number of entries reserved for each variable */
+   int                   indicessize;        /**< size of the arrays indexed by variable indices */
+   SCIP_Real*            vals0;              /**< values of the variable when the corresponding bvars[j] = 0 */
+   SCIP_Real*            lbs1;               /**< global lower bounds of the variable when the corresponding bvars[j] = 1 */
+   SCIP_Real*            ubs1;               /**< global upper bounds of the variable when the corresponding bvars[j] = 1 */
    SCIP_VAR**            bvars;              /**< the binary variables on which the variable domain depends */
-   int                   nbnds;              /**< number of suitable on/off bounds the var has */
-   int                   bndssize;           /**< size of the arrays */
+   int                   nentries;           /**< number of used entries in the packed arrays */
+   int                   entriessize;        /**< size of the packed arrays */
+   int                   nscvars;            /**< number of semicontinuous variables */
+   SCIP_Bool*            examined;           /**< whether each variable has been checked for semicontinuity and its changes are tracked */
+   SCIP_Bool*            dirty;              /**< whether the bounds of each examined variable changed since it was checked */
+   SCIP_EVENTHDLR*       eventhdlr;          /**< event handler for tracking changes of variables, or NULL */
+   SCIP_VAR**            eventvars;          /**< variables for which events are caught */
+   int*                  filterposs;         /**< filter positions of the caught events */
+   int                   neventvars;         /**< number of variables for which events are caught */
+   int                   eventvarssize;      /**< size of the eventvars and filterposs arrays */
+   int                   nruns;              /**< number of the run in which the data was last updated */
 };
 typedef struct SCVarData SCVARDATA;
 
@@ -87,12 +127,66 @@ struct SCIP_ConsExpr_NlhdlrExprData
    SCIP_VAR**            indicators;         /**< all indicator variables for the expression */
    int                   nindicators;        /**< number of indicator variables */
    SCIP_Bool             onlybigm;
+
+   /* data of batched probing */
+   SCIP_ROWPREP**        pendingcuts;        /**< perspective cuts computed while probing on behalf of another expression */
+   SCIP_Bool*            pendingbrscores;    /**< whether branching scores were added when computing the pending cuts */
+   int*                  pendingindpos;      /**< positions (in indicators) of the indicators the pending cuts belong to */
+   int                   npendingcuts;       /**< number of pending cuts */
+   int                   pendingcutssize;    /**< size of the pending cuts arrays */
+   SCIP_Bool*            batchedinds;        /**< whether the indicator at a position has been probed in the current batch round */
+   int                   batchedindssize;    /**< size of the batchedinds array */
+   SCIP_Longint          batchnode;          /**< number of the node of the batch round the pending data belongs to */
+   SCIP_Longint          batchnlps;          /**< number of LPs solved at the time of the batch round */
+   SCIP_Bool             batchoverestimate;  /**< whether the pending cuts are overestimators */
+
+   /* data of the cut pool */
+   SCIP_ROW**            poolrows;           /**< globally valid perspective cuts that were added before */
+   SCIP_VAR**            poolinds;           /**< indicators for which the pool cuts were computed */
+   SCIP_Real**           poolrefpoints;      /**< values of vars at which the pool cuts were computed */
+   int*                  poolnrefvals;       /**< lengths of the reference points */
+   int                   npoolrows;          /**< number of pool cuts */
+   int                   poolrowssize;       /**< size of the pool arrays */
+
+   /* data of adaptive probing */
+   SCIP_BANDIT*          probingbandit;      /**< bandit that decides whether to probe (action 1) or not (action 0), or NULL */
+};
+
+/** expressions that depend on an indicator variable (used for batched probing) */
+struct IndExprs
+{
+   SCIP_CONSEXPR_EXPR**  exprs;              /**< expressions that have the indicator among their indicators */
+   int                   nexprs;             /**< number of expressions */
+   int                   exprssize;          /**< size of the exprs array */
 };
+typedef struct IndExprs INDEXPRS;
+
+/** result of the last probing propagation for an indicator
+ *
+ * The bounds obtained by propagating indicator = 1 are stored together with the local domains of the variables
+ * they were computed for. If probing is started again for the same indicator and these local domains did not
+ * change, the stored bounds are applied instead of calling the propagation again.
+ */
+struct ProbingCache
+{
+   unsigned int          signature;          /**< hash of the variables and their local domains */
+   SCIP_Longint          nruns;              /**< number of the run in which the entry was computed */
+   SCIP_VAR**            vars;               /**< variables whose domains are stored */
+   SCIP_INTERVAL*        locdoms;            /**< local domains of vars before probing */
+   SCIP_INTERVAL*        probingdoms;        /**< domains of vars after propagation in probing */
+   int                   nvars;              /**< number of variables */
+   int                   varssize;           /**< size of the arrays */
+   SCIP_Bool             cutoff;             /**< whether propagation found indicator = 1 to be infeasible */
+};
+typedef struct ProbingCache PROBINGCACHE;
 
 /** nonlinear handler data */
 struct SCIP_ConsExpr_NlhdlrData
 {
-   SCIP_HASHMAP*         scvars;             /**< maps semicontinuous variables to their on/off bounds (SCVarData) */
+   SCVARDATA*            scvars;             /**< on/off bounds of semicontinuous variables */
+   SCIP_EVENTHDLR*       eventhdlr;          /**< event handler for tracking changes of semicontinuous variables */
+   SCIP_HASHMAP*         indexprs;           /**< maps indicator variables to the expressions depending on them (IndExprs) */
+   SCIP_HASHMAP*         probingcaches;      /**< maps indicator variables to the result of their last probing (ProbingCache) */
 
    /* parameters */
    int                   maxproprounds;      /**< maximal number of propagation rounds in probing */
@@ -104,6 +198,13 @@ struct SCIP_ConsExpr_NlhdlrData
    SCIP_Bool             tightenbounds;      /**< whether variable semicontinuity is used to tighten variable bounds */
    SCIP_Bool             adjrefpoint;        /**< whether to adjust the reference point if indicator is not 1 */
    SCIP_Bool             bigmcuts;           /**< whether to strengthen cuts for constraints with big-M structure */
+   SCIP_Bool             batchprobing;       /**< whether to probe each indicator only once per separation round for all expressions depending on it */
+   SCIP_Bool             probingcache;       /**< whether to reuse the result of probing propagation if the local domains did not change */
+   SCIP_Bool             cutpool;            /**< whether to store globally valid perspective cuts and reuse them before computing new ones */
+   int                   maxpoolcuts;        /**< maximal number of stored cuts per expression */
+   SCIP_Bool             closedform;         /**< whether to compute perspective tangents of exp, pow and entropy expressions in closed form */
+   SCIP_Bool             adaptiveprobing;    /**< whether a bandit algorithm decides for each expression whether probing is worth its cost */
+   SCIP_Real             probingcostweight;  /**< weight of the fraction of time spent in probing that is subtracted from the reward of probing */
 
    /* statistic counters */
    int                   ndetects;           /**< total number of expressions detected */
@@ -111,6 +212,22 @@ struct SCIP_ConsExpr_NlhdlrData
    int                   nnonconvexdetects;  /**< total number of nonconvex expressions detected */
    int                   nonlybigmdetects;   /**< total number of non-semicontinuous expressions detected that participate only in big-M constraints */
    int                   nbigmenfos;         /**< number of successfully separated cuts for big-M-like constraints */
+   int                   nbatchcuts;         /**< number of cuts computed for other expressions during batched probing */
+   int                   nprobingcachehits;  /**< number of times the propagation in probing could be skipped due to the cache */
+   int                   npoolcutsreused;    /**< number of times a stored cut was added instead of computing new cuts */
+   int                   nclosedformcuts;    /**< number of perspective cuts computed in closed form */
+   SCIP_Longint          nprobings;          /**< number of times probing was started */
+   SCIP_Longint          nprobingskips;      /**< number of enforcements in which adaptive probing decided not to probe */
+   SCIP_Longint          nprobingdomreds;    /**< number of domain reductions found by propagation in probing */
+   SCIP_Longint          ncutsgenerated;     /**< number of perspective cuts that were passed to the expression constraint handler */
+   SCIP_Longint          ncutsapplied;       /**< number of perspective cuts that separated */
+
+   /* clocks */
+   SCIP_CLOCK*           offvaluestime;      /**< time spent for computing the off values of expressions */
+   SCIP_CLOCK*           probingtime;        /**< time spent for setting up probing and propagating in probing */
+   SCIP_CLOCK*           estimatetime;       /**< time spent in the estimators of other nonlinear handlers */
+   SCIP_CLOCK*           indcoeftime;        /**< time spent for computing indicator coefficients of big-M cuts */
+   SCIP_CLOCK*           rowpreptime;        /**< time spent for cleaning up and adding the cuts */
 };
 
 /*
@@ -130,6 +247,30 @@ SCIP_RETCODE freeNlhdlrExprData(
 {
    int v;
 
+   for( v = 0; v < nlhdlrexprdata->npoolrows; ++v )
+   {
+      SCIP_CALL( SCIPreleaseRow(scip, &nlhdlrexprdata->poolrows[v]) );
+      SCIPfreeBlockMemoryArray(scip, &nlhdlrexprdata->poolrefpoints[v], nlhdlrexprdata->poolnrefvals[v]);
+   }
+   SCIPfreeBlockMemoryArrayNull(scip, &nlhdlrexprdata->poolnrefvals, nlhdlrexprdata->poolrowssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &nlhdlrexprdata->poolrefpoints, nlhdlrexprdata->poolrowssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &nlhdlrexprdata->poolinds, nlhdlrexprdata->poolrowssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &nlhdlrexprdata->poolrows, nlhdlrexprdata->poolrowssize);
+
+   if( nlhdlrexprdata->probingbandit != NULL )
+   {
+      SCIP_CALL( SCIPfreeBandit(scip, &nlhdlrexprdata->probingbandit) );
+   }
+
+   for( v = 0; v < nlhdlrexprdata->npendingcuts; ++v )
+   {
+      SCIPfreeRowprep(scip, &nlhdlrexprdata->pendingcuts[v]);
+   }
+   SCIPfreeBlockMemoryArrayNull(scip, &nlhdlrexprdata->pendingindpos, nlhdlrexprdata->pendingcutssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &nlhdlrexprdata->pendingbrscores, nlhdlrexprdata->pendingcutssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &nlhdlrexprdata->pendingcuts, nlhdlrexprdata->pendingcutssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &nlhdlrexprdata->batchedinds, nlhdlrexprdata->batchedindssize);
+
    if( nlhdlrexprdata->nindicators != 0 )
    {
       assert(nlhdlrexprdata->indicators != NULL);
@@ -210,114 +351,422 @@ SCIP_RETCODE addAuxVar(
  * Semicontinuous variable methods
  */
 
+/** creates the storage for semicontinuous variables */
+static
+SCIP_RETCODE createSCVarData(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCVARDATA**           scvars,             /**< pointer to store the semicontinuous variable data */
+   SCIP_EVENTHDLR*       eventhdlr           /**< event handler for tracking variable changes, or NULL if results of
+                                              *   semicontinuity checks should not be kept */
+   )
+{
+   assert(scvars != NULL);
+
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, scvars) );
+   (*scvars)->eventhdlr = eventhdlr;
+   (*scvars)->nruns = SCIPgetNRuns(scip);
+
+   return SCIP_OKAY;
+}
+
+/** frees the storage for semicontinuous variables */
+static
+SCIP_RETCODE freeSCVarData(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCVARDATA**           scvars              /**< pointer to the semicontinuous variable data */
+   )
+{
+   int i;
+
+   assert(scvars != NULL);
+   assert(*scvars != NULL);
+
+   for( i = 0; i < (*scvars)->neventvars; ++i )
+   {
+      SCIP_CALL( SCIPdropVarEvent(scip, (*scvars)->eventvars[i], EVENTHDLR_EVENTTYPE, (*scvars)->eventhdlr,
+            (SCIP_EVENTDATA*) *scvars, (*scvars)->filterposs[i]) );
+   }
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->filterposs, (*scvars)->eventvarssize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->eventvars, (*scvars)->eventvarssize);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->bvars, (*scvars)->entriessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->ubs1, (*scvars)->entriessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->lbs1, (*scvars)->entriessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->vals0, (*scvars)->entriessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->dirty, (*scvars)->indicessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->examined, (*scvars)->indicessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->rowsizes, (*scvars)->indicessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->nbnds, (*scvars)->indicessize);
+   SCIPfreeBlockMemoryArrayNull(scip, &(*scvars)->starts, (*scvars)->indicessize);
+   SCIPfreeBlockMemory(scip, scvars);
+
+   return SCIP_OKAY;
+}
+
+/** returns the number of on/off bounds of a variable, that is, 0 if the variable is not semicontinuous */
+static
+int getSCVarNBnds(
+   SCVARDATA*            scvars,             /**< semicontinuous variable data */
+   SCIP_VAR*             var                 /**< variable */
+   )
+{
+   int idx;
+
+   assert(scvars != NULL);
+   assert(var != NULL);
+
+   idx = SCIPvarGetIndex(var);
+
+   return idx < scvars->indicessize ? scvars->nbnds[idx] : 0;
+}
+
+/** returns the position of the first on/off bound of a semicontinuous variable in the packed arrays */
+static
+int getSCVarStart(
+   SCVARDATA*            scvars,             /**< semicontinuous variable data */
+   SCIP_VAR*             var                 /**< variable */
+   )
+{
+   assert(getSCVarNBnds(scvars, var) > 0);
+
+   return scvars->starts[SCIPvarGetIndex(var)];
+}
+
+/** ensures that the arrays indexed by variable indices can store an entry for a variable index */
+static
+SCIP_RETCODE ensureSCVarIndexSize(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCVARDATA*            scvars,             /**< semicontinuous variable data */
+   int                   idx                 /**< index of the variable */
+   )
+{
+   int newsize;
+   int i;
+
+   assert(scvars != NULL);
+   assert(idx >= 0);
+
+   if( idx < scvars->indicessize )
+      return SCIP_OKAY;
+
+   newsize = SCIPcalcMemGrowSize(scip, idx + 1);
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->starts, scvars->indicessize, newsize) );
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->nbnds, scvars->indicessize, newsize) );
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->rowsizes, scvars->indicessize, newsize) );
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->examined, scvars->indicessize, newsize) );
+   SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->dirty, scvars->indicessize, newsize) );
+   for( i = scvars->indicessize; i < newsize; ++i )
+   {
+      scvars->starts[i] = -1;
+      scvars->nbnds[i] = 0;
+      scvars->rowsizes[i] = 0;
+      scvars->examined[i] = FALSE;
+      scvars->dirty[i] = FALSE;
+   }
+   scvars->indicessize = newsize;
+
+   return SCIP_OKAY;
+}
+
+/** ensures that there is space for one more on/off bound in the row of a variable
+ *
+ * Might move the row to the end of the packed arrays. Then the previous positions of the row become unused.
+ */
+static
+SCIP_RETCODE ensureSCVarRowSize(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCVARDATA*            scvars,             /**< semicontinuous variable data */
+   int                   idx                 /**< index of the variable */
+   )
+{
+   int newsize;
+   int oldstart;
+
+   assert(scvars != NULL);
+   assert(idx >= 0);
+
+   SCIP_CALL( ensureSCVarIndexSize(scip, scvars, idx) );
+
+   if( scvars->nbnds[idx] < scvars->rowsizes[idx] )
+      return SCIP_OKAY;
+
+   /* a var has only few on/off bounds, so let the row grow slowly */
+   newsize = MAX(2 * scvars->rowsizes[idx], 2);
+
+   /* the last row can be extended in place, other rows are moved to the end */
+   oldstart = scvars->starts[idx];
+   if( oldstart >= 0 && oldstart + scvars->rowsizes[idx] == scvars->nentries )
+      scvars->nentries = oldstart;
+
+   if( scvars->nentries + newsize > scvars->entriessize )
+   {
+      int newentriessize;
+
+      newentriessize = SCIPcalcMemGrowSize(scip, scvars->nentries + newsize);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->vals0, scvars->entriessize, newentriessize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->lbs1, scvars->entriessize, newentriessize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->ubs1, scvars->entriessize, newentriessize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->bvars, scvars->entriessize, newentriessize) );
+      scvars->entriessize = newentriessize;
+   }
+
+   if( oldstart >= 0 && oldstart != scvars->nentries )
+   {
+      BMSmoveMemoryArray(&scvars->vals0[scvars->nentries], &scvars->vals0[oldstart], scvars->nbnds[idx]);
+      BMSmoveMemoryArray(&scvars->lbs1[scvars->nentries], &scvars->lbs1[oldstart], scvars->nbnds[idx]);
+      BMSmoveMemoryArray(&scvars->ubs1[scvars->nentries], &scvars->ubs1[oldstart], scvars->nbnds[idx]);
+      BMSmoveMemoryArray(&scvars->bvars[scvars->nentries], &scvars->bvars[oldstart], scvars->nbnds[idx]);
+   }
+
+   scvars->starts[idx] = scvars->nentries;
+   scvars->rowsizes[idx] = newsize;
+   scvars->nentries += newsize;
+
+   return SCIP_OKAY;
+}
+
 /** adds an indicator to the data of a semicontinuous variable */
 static
 SCIP_RETCODE addSCVarIndicator(
    SCIP*                 scip,               /**< SCIP data structure */
-   SCVARDATA*            scvdata,            /**< semicontinuous variable data */
+   SCVARDATA*            scvars,             /**< semicontinuous variable data */
+   SCIP_VAR*             var,                /**< semicontinuous variable */
    SCIP_VAR*             indicator,          /**< indicator to be added */
    SCIP_Real             val0,               /**< value of the variable when indicator == 0 */
    SCIP_Real             lb1,                /**< lower bound of the variable when indicator == 1 */
    SCIP_Real             ub1                 /**< upper bound of the variable when indicator == 1 */
    )
 {
-   int newsize;
+   int start;
+   int nbnds;
+   int idx;
    int i;
    SCIP_Bool found;
    int pos;
 
-   assert(scvdata != NULL);
+   assert(scvars != NULL);
+   assert(var != NULL);
    assert(indicator != NULL);
 
+   idx = SCIPvarGetIndex(var);
+   nbnds = getSCVarNBnds(scvars, var);
+
    /* find the position where to insert */
-   if( scvdata->bvars == NULL )
+   if( nbnds == 0 )
    {
-      assert(scvdata->nbnds == 0 && scvdata->bndssize == 0);
       found = FALSE;
       pos = 0;
    }
    else
    {
-      found = SCIPsortedvecFindPtr((void**)scvdata->bvars, SCIPvarComp, (void*)indicator, scvdata->nbnds, &pos);
+      found = SCIPsortedvecFindPtr((void**)&scvars->bvars[scvars->starts[idx]], SCIPvarComp, (void*)indicator, nbnds, &pos);
    }
 
    if( found )
       return SCIP_OKAY;
 
    /* ensure sizes */
-   if( scvdata->nbnds + 1 > scvdata->bndssize )
-   {
-      newsize = SCIPcalcMemGrowSize(scip, scvdata->nbnds + 1);
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvdata->bvars, scvdata->bndssize, newsize) );
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvdata->vals0, scvdata->bndssize, newsize) );
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvdata->lbs1, scvdata->bndssize, newsize) );
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvdata->ubs1, scvdata->bndssize, newsize) );
-      scvdata->bndssize = newsize;
-   }
-   assert(scvdata->nbnds + 1 <= scvdata->bndssize);
-   assert(scvdata->bvars != NULL);
+   SCIP_CALL( ensureSCVarRowSize(scip, scvars, idx) );
+   start = scvars->starts[idx];
+   assert(nbnds + 1 <= scvars->rowsizes[idx]);
 
    /* move entries if needed */
-   for( i = scvdata->nbnds; i > pos; --i )
+   for( i = start + nbnds; i > start + pos; --i )
    {
-      scvdata->bvars[i] = scvdata->bvars[i-1];
-      scvdata->vals0[i] = scvdata->vals0[i-1];
-      scvdata->lbs1[i] = scvdata->lbs1[i-1];
-      scvdata->ubs1[i] = scvdata->ubs1[i-1];
+      scvars->bvars[i] = scvars->bvars[i-1];
+      scvars->vals0[i] = scvars->vals0[i-1];
+      scvars->lbs1[i] = scvars->lbs1[i-1];
+      scvars->ubs1[i] = scvars->ubs1[i-1];
    }
 
-   scvdata->bvars[pos] = indicator;
-   scvdata->vals0[pos] = val0;
-   scvdata->lbs1[pos] = lb1;
-   scvdata->ubs1[pos] = ub1;
-   ++scvdata->nbnds;
+   scvars->bvars[start + pos] = indicator;
+   scvars->vals0[start + pos] = val0;
+   scvars->lbs1[start + pos] = lb1;
+   scvars->ubs1[start + pos] = ub1;
+   ++scvars->nbnds[idx];
+
+   if( nbnds == 0 )
+      ++scvars->nscvars;
 
    return SCIP_OKAY;
 }
 
-/** find scvardata of var and position of indicator in it
+/** finds the position of the on/off bounds of var with respect to indicator in the packed arrays of scvars
  *
- *  If indicator is not there, returns NULL.
+ *  If indicator is not there, returns FALSE.
  */
 static
-SCVARDATA* getSCVarDataInd(
-   SCIP_HASHMAP*         scvars,             /**< hashmap linking variables to scvardata */
+SCIP_Bool getSCVarDataInd(
+   SCVARDATA*            scvars,             /**< semicontinuous variable data */
    SCIP_VAR*             var,                /**< variable */
    SCIP_VAR*             indicator,          /**< indicator variable */
-   int*                  pos                 /**< pointer to store the position of indicator */
+   int*                  pos                 /**< pointer to store the position of indicator in the packed arrays */
    )
 {
-   SCIP_Bool exists;
-   SCVARDATA* scvdata;
+   int nbnds;
+   int start;
 
    assert(var != NULL);
    assert(scvars != NULL);
    assert(indicator != NULL);
+   assert(pos != NULL);
+
+   nbnds = getSCVarNBnds(scvars, var);
+   if( nbnds == 0 )
+      return FALSE;
+
+   /* look for the indicator variable */
+   start = scvars->starts[SCIPvarGetIndex(var)];
+   if( !SCIPsortedvecFindPtr((void**)&scvars->bvars[start], SCIPvarComp, (void*)indicator, nbnds, pos) )
+      return FALSE;
+
+   *pos += start;
+
+   return TRUE;
+}
+
+/** removes all on/off bounds of a variable */
+static
+void clearSCVarRow(
+   SCVARDATA*            scvars,             /**< semicontinuous variable data */
+   int                   idx                 /**< index of the variable */
+   )
+{
+   assert(scvars != NULL);
+   assert(0 <= idx && idx < scvars->indicessize);
+
+   if( scvars->nbnds[idx] > 0 )
+      --scvars->nscvars;
+   scvars->nbnds[idx] = 0;
+}
+
+/** marks a variable as checked for semicontinuity and starts tracking changes of its bounds
+ *
+ * Does nothing if scvars has no event handler or var is relaxation-only, so that the variable
+ * will be checked again the next time.
+ */
+static
+SCIP_RETCODE markSCVarExamined(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCVARDATA*            scvars,             /**< semicontinuous variable data */
+   SCIP_VAR*             var                 /**< variable */
+   )
+{
+   int idx;
+
+   assert(scvars != NULL);
+   assert(var != NULL);
+
+   if( scvars->eventhdlr == NULL || SCIPvarIsRelaxationOnly(var) || !SCIPvarIsTransformed(var) )
+      return SCIP_OKAY;
 
-   scvdata = (SCVARDATA*) SCIPhashmapGetImage(scvars, (void*)var);
-   if( scvdata != NULL )
+   idx = SCIPvarGetIndex(var);
+   SCIP_CALL( ensureSCVarIndexSize(scip, scvars, idx) );
+
+   scvars->dirty[idx] = FALSE;
+
+   if( scvars->examined[idx] )
+      return SCIP_OKAY;
+
+   if( scvars->neventvars + 1 > scvars->eventvarssize )
    {
-      /* look for the indicator variable */
-      exists = SCIPsortedvecFindPtr((void**)scvdata->bvars, SCIPvarComp, (void*)indicator, scvdata->nbnds, pos);
-      if( !exists )
-         return NULL;
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, scvars->neventvars + 1);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->eventvars, scvars->eventvarssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &scvars->filterposs, scvars->eventvarssize, newsize) );
+      scvars->eventvarssize = newsize;
+   }
+
+   SCIP_CALL( SCIPcatchVarEvent(scip, var, EVENTHDLR_EVENTTYPE, scvars->eventhdlr, (SCIP_EVENTDATA*) scvars,
+         &scvars->filterposs[scvars->neventvars]) );
+   scvars->eventvars[scvars->neventvars] = var;
+   ++scvars->neventvars;
+   scvars->examined[idx] = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** updates the semicontinuous variable data when a new run has started
+ *
+ * The on/off bounds of auxiliary variables are removed, since these variables are recreated in each run.
+ * Examined variables that have an indicator which is no longer active are marked to be checked again.
+ */
+static
+void updateSCVarDataRun(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCVARDATA*            scvars              /**< semicontinuous variable data */
+   )
+{
+   int idx;
+   int j;
+
+   assert(scvars != NULL);
+
+   if( scvars->nruns == SCIPgetNRuns(scip) )
+      return;
+
+   for( idx = 0; idx < scvars->indicessize; ++idx )
+   {
+      if( scvars->nbnds[idx] == 0 )
+         continue;
+
+      if( !scvars->examined[idx] )
+      {
+         clearSCVarRow(scvars, idx);
+         continue;
+      }
 
-      return scvdata;
+      for( j = scvars->starts[idx]; j < scvars->starts[idx] + scvars->nbnds[idx]; ++j )
+      {
+         if( !SCIPvarIsActive(scvars->bvars[j]) )
+         {
+            scvars->dirty[idx] = TRUE;
+            break;
+         }
+      }
    }
 
-   return NULL;
+   scvars->nruns = SCIPgetNRuns(scip);
+}
+
+/** processes events that signal a change of the global bounds or variable bounds of a variable */
+static
+SCIP_DECL_EVENTEXEC(processSCVarEvent)
+{  /*lint --e{715}*/
+   SCVARDATA* scvars;
+   int idx;
+
+   assert(eventdata != NULL);
+   assert(SCIPeventGetType(event) & EVENTHDLR_EVENTTYPE);
+
+   scvars = (SCVARDATA*) eventdata;
+   idx = SCIPvarGetIndex(SCIPeventGetVar(event));
+
+   if( idx < scvars->indicessize )
+      scvars->dirty[idx] = TRUE;
+
+   return SCIP_OKAY;
 }
 
-/** checks if a variable is semicontinuous and, if needed, updates the scvars hashmap
+/** checks if a variable is semicontinuous and, if needed, updates scvars
  *
  * A variable x is semicontinuous if its bounds depend on at least one binary variable called the indicator,
  * and indicator == 0 => x == x^0 for some real constant x^0.
+ *
+ * The on/off bounds are read from the variable bounds of x. These are shared with the rest of SCIP: implications that
+ * other constraint handlers derive, e.g., the implication binvar == 1 => slackvar <= 0 that is added for indicator
+ * constraints during presolving, are also stored as variable bounds of the implied continuous variable, see
+ * SCIPvarAddImplic(). Thus, no separate registry of indicator structure is needed here. The results are cached in
+ * scvars and only recomputed when the variable bounds change. Note that the perspective cuts separated by
+ * cons_indicator are for the linear constraint of an indicator constraint, while this handler separates the nonlinear
+ * terms, so the two do not generate the same cuts.
  */
 static
 SCIP_RETCODE varIsSemicontinuous(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_VAR*             var,                /**< the variable to check */
-   SCIP_HASHMAP*         scvars,             /**< semicontinuous variable information */
+   SCVARDATA*            scvars,             /**< semicontinuous variable information */
    SCIP_Bool*            result              /**< buffer to store whether var is semicontinuous */
    )
 {
@@ -338,7 +787,7 @@ SCIP_RETCODE varIsSemicontinuous(
    SCIP_Real* vubconstants;
    int nvlbs;
    int nvubs;
-   SCVARDATA* scvdata;
+   int idx;
    SCIP_VAR* bvar;
 
    assert(scip != NULL);
@@ -346,8 +795,21 @@ SCIP_RETCODE varIsSemicontinuous(
    assert(scvars != NULL);
    assert(result != NULL);
 
-   scvdata = (SCVARDATA*) SCIPhashmapGetImage(scvars, (void*)var);
-   if( scvdata != NULL )
+   idx = SCIPvarGetIndex(var);
+
+   /* nothing to do if it is known that var did not change since it was checked */
+   if( idx < scvars->indicessize && scvars->examined[idx] && !scvars->dirty[idx] )
+   {
+      *result = scvars->nbnds[idx] > 0;
+      return SCIP_OKAY;
+   }
+
+   if( idx < scvars->indicessize && scvars->dirty[idx] )
+   {
+      SCIPdebugMsg(scip, "bounds of var <%s> changed, checking semicontinuity again\n", SCIPvarGetName(var));
+      clearSCVarRow(scvars, idx);
+   }
+   else if( getSCVarNBnds(scvars, var) > 0 )
    {
       *result = TRUE;
       return SCIP_OKAY;
@@ -369,7 +831,7 @@ SCIP_RETCODE varIsSemicontinuous(
    /* Scan through lower bounds; for each binary vlbvar save the corresponding lb0 and lb1.
     * Then check if there is an upper bound with this vlbvar and save ub0 and ub1.
     * If the found bounds imply that the var value is fixed to some val0 when vlbvar = 0,
-    * save vlbvar and val0 to scvdata.
+    * save vlbvar and val0 to scvars.
     */
    for( c = 0; c < nvlbs; ++c )
    {
@@ -407,12 +869,7 @@ SCIP_RETCODE varIsSemicontinuous(
       SCIPdebugMsgPrint(scip, " -> <%s> in [%f, %f] (off), [%f, %f] (on)\n", SCIPvarGetName(var), lb0, ub0, lb1, ub1);
       if( SCIPisEQ(scip, lb0, ub0) && (!SCIPisEQ(scip, lb0, lb1) || !SCIPisEQ(scip, ub0, ub1)) )
       {
-         if( scvdata == NULL )
-         {
-            SCIP_CALL( SCIPallocClearBlockMemory(scip, &scvdata) );
-         }
-
-         SCIP_CALL( addSCVarIndicator(scip, scvdata, bvar, lb0, lb1, ub1) );
+         SCIP_CALL( addSCVarIndicator(scip, scvars, var, bvar, lb0, lb1, ub1) );
       }
    }
 
@@ -441,28 +898,24 @@ SCIP_RETCODE varIsSemicontinuous(
       SCIPdebugMsgPrint(scip, " -> <%s> in [%f, %f] (off), [%f, %f] (on)\n", SCIPvarGetName(var), lb0, ub0, lb1, ub1);
       if( SCIPisEQ(scip, lb0, ub0) && (!SCIPisEQ(scip, lb0, lb1) || !SCIPisEQ(scip, ub0, ub1)) )
       {
-         if( scvdata == NULL )
-         {
-            SCIP_CALL( SCIPallocClearBlockMemory(scip, &scvdata) );
-         }
-
-         SCIP_CALL( addSCVarIndicator(scip, scvdata, bvar, lb0, lb1, ub1) );
+         SCIP_CALL( addSCVarIndicator(scip, scvars, var, bvar, lb0, lb1, ub1) );
       }
    }
 
-   if( scvdata != NULL )
+   if( getSCVarNBnds(scvars, var) > 0 )
    {
 #ifdef SCIP_DEBUG
       SCIPdebugMsg(scip, "var <%s> has global bounds [%f, %f] and the following on/off bounds:\n", SCIPvarGetName(var), glb, gub);
-      for( c = 0; c < scvdata->nbnds; ++c )
+      for( c = getSCVarStart(scvars, var); c < getSCVarStart(scvars, var) + getSCVarNBnds(scvars, var); ++c )
       {
-         SCIPdebugMsg(scip, " c = %d, bvar <%s>: val0 = %f\n", c, SCIPvarGetName(scvdata->bvars[c]), scvdata->vals0[c]);
+         SCIPdebugMsg(scip, " c = %d, bvar <%s>: val0 = %f\n", c, SCIPvarGetName(scvars->bvars[c]), scvars->vals0[c]);
       }
 #endif
-      SCIP_CALL( SCIPhashmapInsert(scvars, var, scvdata) );
       *result = TRUE;
    }
 
+   SCIP_CALL( markSCVarExamined(scip, scvars, var) );
+
    return SCIP_OKAY;
 }
 
@@ -487,7 +940,6 @@ SCIP_RETCODE exprIsSemicontinuous(
 {
    int v;
    SCIP_Bool var_is_sc;
-   SCVARDATA* scvdata;
    SCIP_VAR* var;
    int nindicators;
    int nbnds0;
@@ -604,21 +1056,21 @@ SCIP_RETCODE exprIsSemicontinuous(
       if( linear != NULL && linear[v] )
          continue;
 
-      scvdata = (SCVARDATA*)SCIPhashmapGetImage(nlhdlrdata->scvars, (void*) nlhdlrexprdata->vars[v]);
-
       /* we should have exited earlier if there is a nonlinear non-semicontinuous variable */
-      assert(scvdata != NULL);
+      assert(getSCVarNBnds(nlhdlrdata->scvars, nlhdlrexprdata->vars[v]) > 0);
 
       if( indicators == NULL )
       {
-         SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &indicators, scvdata->bvars, scvdata->nbnds) );
-         nbnds0 = scvdata->nbnds;
+         nbnds0 = getSCVarNBnds(nlhdlrdata->scvars, nlhdlrexprdata->vars[v]);
+         SCIP_CALL( SCIPduplicateBlockMemoryArray(scip, &indicators,
+               &nlhdlrdata->scvars->bvars[getSCVarStart(nlhdlrdata->scvars, nlhdlrexprdata->vars[v])], nbnds0) );
          nindicators = nbnds0;
       }
       else
       {
-         SCIPcomputeArraysIntersectionPtr((void**)indicators, nindicators, (void**)scvdata->bvars, scvdata->nbnds,
-               SCIPvarComp, (void**)indicators, &nindicators);
+         SCIPcomputeArraysIntersectionPtr((void**)indicators, nindicators,
+               (void**)&nlhdlrdata->scvars->bvars[getSCVarStart(nlhdlrdata->scvars, nlhdlrexprdata->vars[v])],
+               getSCVarNBnds(nlhdlrdata->scvars, nlhdlrexprdata->vars[v]), SCIPvarComp, (void**)indicators, &nindicators);
       }
 
       /* if we have found out that the intersection is empty, expr is not semicontinuous */
@@ -698,6 +1150,10 @@ SCIP_RETCODE saveAuxVars(
 
 /** computes the 'off' value of the expression and the 'off' values of
   * semicontinuous auxiliary variables for each indicator variable
+  *
+  * Often, the 'off' values of the variables are the same for several indicators (e.g., when all variables are 0 for
+  * any indicator being 0). The expression is then evaluated only once for consecutive indicators with the same
+  * 'off' point; the values of the subexpressions from the last evaluation are still valid in this case.
   */
 static
 SCIP_RETCODE computeOffValues(
@@ -715,11 +1171,12 @@ SCIP_RETCODE computeOffValues(
    int norigvars;
    SCIP_Real* origvals0;
    SCIP_VAR** origvars;
-   SCVARDATA* scvdata;
    SCIP_VAR* auxvar;
    SCIP_CONSEXPR_EXPR* curexpr;
    SCIP_HASHMAP* auxvarmap;
    SCIP_Bool hasnonsc;
+   SCIP_Real* lastvals0;
+   SCIP_Bool evaluated;
    int pos;
 
    assert(expr != NULL);
@@ -727,10 +1184,12 @@ SCIP_RETCODE computeOffValues(
    SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(nlhdlrexprdata->exprvals0), nlhdlrexprdata->nindicators) );
    SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
    SCIP_CALL( SCIPallocBufferArray(scip, &origvals0, nlhdlrexprdata->nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lastvals0, nlhdlrexprdata->nvars) );
    SCIP_CALL( SCIPhashmapCreate(&auxvarmap, SCIPblkmem(scip), 10) );
    SCIP_CALL( SCIPexpriteratorCreate(&it, conshdlr, SCIPblkmem(scip)) );
    SCIP_CALL( SCIPduplicateBufferArray(scip, &origvars, nlhdlrexprdata->vars, nlhdlrexprdata->nvars) );
    norigvars = nlhdlrexprdata->nvars;
+   evaluated = FALSE;
 
    for( i = nlhdlrexprdata->nindicators - 1; i >= 0; --i )
    {
@@ -742,19 +1201,32 @@ SCIP_RETCODE computeOffValues(
          /* set vals0[v] = 0 if var is non-sc with respect to indicators[i] - then it will not
           * contribute to exprvals0[i] since any non-sc var must be linear
           */
-         scvdata = getSCVarDataInd(nlhdlrdata->scvars, origvars[v], nlhdlrexprdata->indicators[i], &pos);
-         if( scvdata == NULL )
+         if( !getSCVarDataInd(nlhdlrdata->scvars, origvars[v], nlhdlrexprdata->indicators[i], &pos) )
          {
             origvals0[v] = 0.0;
             hasnonsc = TRUE;
          }
          else
          {
-            origvals0[v] = scvdata->vals0[pos];
+            origvals0[v] = nlhdlrdata->scvars->vals0[pos];
          }
       }
-      SCIP_CALL( SCIPsetSolVals(scip, sol, norigvars, origvars, origvals0) );
-      SCIP_CALL( SCIPevalConsExprExpr(scip, conshdlr, expr, sol, 0) );
+
+      /* evaluate only if the 'off' point differs from the one of the last evaluation */
+      if( evaluated )
+      {
+         for( v = 0; v < norigvars && origvals0[v] == lastvals0[v]; ++v ) /*lint !e777*/
+            ;
+         evaluated = (v == norigvars);
+      }
+
+      if( !evaluated )
+      {
+         SCIP_CALL( SCIPsetSolVals(scip, sol, norigvars, origvars, origvals0) );
+         SCIP_CALL( SCIPevalConsExprExpr(scip, conshdlr, expr, sol, 0) );
+         BMScopyMemoryArray(lastvals0, origvals0, norigvars);
+         evaluated = TRUE;
+      }
 
       if( SCIPgetConsExprExprValue(expr) == SCIP_INVALID ) /*lint !e777*/
       {
@@ -768,7 +1240,7 @@ SCIP_RETCODE computeOffValues(
 
       nlhdlrexprdata->exprvals0[i] = SCIPgetConsExprExprValue(expr);
 
-      /* iterate through the expression and create scvdata for aux vars */
+      /* iterate through the expression and add on/off data of aux vars */
       SCIP_CALL( SCIPexpriteratorInit(it, expr, SCIP_CONSEXPRITERATOR_DFS, FALSE) );
       curexpr = SCIPexpriteratorGetCurrent(it);
 
@@ -794,9 +1266,8 @@ SCIP_RETCODE computeOffValues(
                if( SCIPgetConsExprExprHdlr(curexpr) == SCIPgetConsExprExprHdlrVar(conshdlr) )
                {
                   /* easy case: curexpr is a variable, can check semicontinuity immediately */
-                  scvdata = getSCVarDataInd(nlhdlrdata->scvars, SCIPgetConsExprExprVarVar(curexpr),
+                  issc = getSCVarDataInd(nlhdlrdata->scvars, SCIPgetConsExprExprVarVar(curexpr),
                         nlhdlrexprdata->indicators[i], &pos);
-                  issc = scvdata != NULL;
                }
                else if( SCIPgetConsExprExprHdlr(curexpr) != SCIPgetConsExprExprHdlrSum(conshdlr) )
                {
@@ -814,8 +1285,7 @@ SCIP_RETCODE computeOffValues(
                   for( v = 0; v < nchildvarexprs; ++v )
                   {
                      var = SCIPgetConsExprExprVarVar(childvarexprs[v]);
-                     scvdata = getSCVarDataInd(nlhdlrdata->scvars, var, nlhdlrexprdata->indicators[i], &pos);
-                     assert(scvdata != NULL);
+                     assert(getSCVarDataInd(nlhdlrdata->scvars, var, nlhdlrexprdata->indicators[i], &pos));
 
                      SCIP_CALL( SCIPreleaseConsExprExpr(scip, &childvarexprs[v]) );
                   }
@@ -827,24 +1297,10 @@ SCIP_RETCODE computeOffValues(
 
             if( issc )
             {
-               /* we know that all vars are semicontinuous with respect to exprdata->indicators; it remains to:
-                * - get or create the scvardata structure for auxvar
-                * - if had to create scvardata, add it to scvars hashmap
-                * - add the indicator and the off value (= curexpr's off value) to scvardata
+               /* we know that all vars are semicontinuous with respect to exprdata->indicators; it remains to
+                * add the indicator and the off value (= curexpr's off value) to the data of auxvar
                 */
-               scvdata = (SCVARDATA*) SCIPhashmapGetImage(nlhdlrdata->scvars, (void*)auxvar);
-               if( scvdata == NULL )
-               {
-                  SCIP_CALL( SCIPallocClearBlockMemory(scip, &scvdata) );
-                  SCIP_CALL( SCIPallocBlockMemoryArray(scip, &scvdata->bvars,  nlhdlrexprdata->nindicators) );
-                  SCIP_CALL( SCIPallocBlockMemoryArray(scip, &scvdata->vals0, nlhdlrexprdata->nindicators) );
-                  SCIP_CALL( SCIPallocBlockMemoryArray(scip, &scvdata->lbs1, nlhdlrexprdata->nindicators) );
-                  SCIP_CALL( SCIPallocBlockMemoryArray(scip, &scvdata->ubs1, nlhdlrexprdata->nindicators) );
-                  scvdata->bndssize = nlhdlrexprdata->nindicators;
-                  SCIP_CALL( SCIPhashmapInsert(nlhdlrdata->scvars, auxvar, scvdata) );
-               }
-
-               SCIP_CALL( addSCVarIndicator(scip, scvdata, nlhdlrexprdata->indicators[i],
+               SCIP_CALL( addSCVarIndicator(scip, nlhdlrdata->scvars, auxvar, nlhdlrexprdata->indicators[i],
                      SCIPgetConsExprExprValue(curexpr), SCIPvarGetLbGlobal(auxvar), SCIPvarGetUbGlobal(auxvar)) );
             }
 
@@ -857,6 +1313,7 @@ SCIP_RETCODE computeOffValues(
 
    SCIPexpriteratorFree(&it);
    SCIPhashmapFree(&auxvarmap);
+   SCIPfreeBufferArray(scip, &lastvals0);
    SCIPfreeBufferArray(scip, &origvals0);
    SCIPfreeBufferArray(scip, &origvars);
    SCIP_CALL( SCIPfreeSol(scip, &sol) );
@@ -868,55 +1325,291 @@ SCIP_RETCODE computeOffValues(
  * Probing and bound tightening methods
  */
 
-/** go into probing and set some variable bounds */
+/** computes the signature of the local domains of some variables */
 static
-SCIP_RETCODE startProbing(
+unsigned int computeDomainSignature(
+   SCIP_VAR**            vars,               /**< variables */
+   int                   nvars               /**< number of variables */
+   )
+{
+   unsigned int signature;
+   int v;
+
+   signature = (unsigned int) nvars;
+   for( v = 0; v < nvars; ++v )
+   {
+      signature = SCIPhashFour(signature, SCIPvarGetIndex(vars[v]), SCIPrealHashCode(SCIPvarGetLbLocal(vars[v])),
+            SCIPrealHashCode(SCIPvarGetUbLocal(vars[v])));
+   }
+
+   return signature;
+}
+
+/** finds the probing cache entry of an indicator if it was computed for the same variables and local domains */
+static
+PROBINGCACHE* findProbingCache(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata,     /**< nonlinear handler data */
-   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
    SCIP_VAR*             indicator,          /**< indicator variable */
-   SCIP_VAR**            probingvars,        /**< array of vars whose bounds we will change in probing */
-   SCIP_INTERVAL*        probingdoms,        /**< array of intervals to which bounds of probingvars will be changed in probing */
-   int                   nprobingvars,       /**< number of probing vars */
-   SCIP_SOL*             sol,                /**< solution to be separated */
-   SCIP_SOL**            solcopy,            /**< buffer for a copy of sol before going into probing; if *solcopy == sol, then copy is created */
-   SCIP_Bool*            cutoff_probing      /**< pointer to store whether indicator == 1 is infeasible */
+   unsigned int          signature,          /**< signature of the current local domains of vars */
+   SCIP_VAR**            vars,               /**< variables */
+   int                   nvars               /**< number of variables */
    )
 {
+   PROBINGCACHE* cache;
    int v;
-   SCIP_Real newlb;
-   SCIP_Real newub;
-   SCIP_Bool propagate;
 
-   propagate = SCIPgetDepth(scip) == 0;
+   if( nlhdlrdata->probingcaches == NULL )
+      return NULL;
 
-   /* if a copy of sol has not been created yet, then create one now and copy the relevant var values from sol,
-    * because sol can change after SCIPstartProbing, e.g., when linked to the LP solution
-    */
-   if( *solcopy == sol )
-   {
-      SCIP_CALL( SCIPcreateSol(scip, solcopy, NULL) );
-      for( v = 0; v < nlhdlrexprdata->nvars; ++v )
-      {
-         SCIP_CALL( SCIPsetSolVal(scip, *solcopy, nlhdlrexprdata->vars[v], SCIPgetSolVal(scip, sol, nlhdlrexprdata->vars[v])) );
-      }
-      for( v = 0; v < nlhdlrexprdata->nindicators; ++v )
-      {
-         SCIP_CALL( SCIPsetSolVal(scip, *solcopy, nlhdlrexprdata->indicators[v], SCIPgetSolVal(scip, sol, nlhdlrexprdata->indicators[v])) );
-      }
-   }
+   cache = (PROBINGCACHE*) SCIPhashmapGetImage(nlhdlrdata->probingcaches, (void*)indicator);
 
-   /* go into probing */
-   SCIP_CALL( SCIPstartProbing(scip) );
+   if( cache == NULL || cache->signature != signature || cache->nvars != nvars || cache->nruns != SCIPgetNRuns(scip) )
+      return NULL;
 
-   /* create a probing node */
-   SCIP_CALL( SCIPnewProbingNode(scip) );
+   /* the signature matches, make sure that the domains are really the same */
+   for( v = 0; v < nvars; ++v )
+   {
+      if( cache->vars[v] != vars[v] || cache->locdoms[v].inf != SCIPvarGetLbLocal(vars[v]) /*lint !e777*/
+         || cache->locdoms[v].sup != SCIPvarGetUbLocal(vars[v]) ) /*lint !e777*/
+         return NULL;
+   }
 
-   /* set indicator to 1 */
-   SCIP_CALL( SCIPchgVarLbProbing(scip, indicator, 1.0) );
+   return cache;
+}
 
-   /* apply stored bounds */
-   for( v = 0; v < nprobingvars; ++v )
+/** stores the local domains of some variables in the probing cache entry of an indicator
+ *
+ * Must be called before going into probing. The domains after propagation are stored by storeProbingCacheResult().
+ */
+static
+SCIP_RETCODE storeProbingCacheDomains(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata,     /**< nonlinear handler data */
+   SCIP_VAR*             indicator,          /**< indicator variable */
+   unsigned int          signature,          /**< signature of the current local domains of vars */
+   SCIP_VAR**            vars,               /**< variables */
+   int                   nvars,              /**< number of variables */
+   PROBINGCACHE**        cache               /**< buffer to store the cache entry */
+   )
+{
+   int v;
+
+   assert(!SCIPinProbing(scip));
+   assert(cache != NULL);
+
+   if( nlhdlrdata->probingcaches == NULL )
+   {
+      SCIP_CALL( SCIPhashmapCreate(&nlhdlrdata->probingcaches, SCIPblkmem(scip), SCIPgetNBinVars(scip)) );
+   }
+
+   *cache = (PROBINGCACHE*) SCIPhashmapGetImage(nlhdlrdata->probingcaches, (void*)indicator);
+   if( *cache == NULL )
+   {
+      SCIP_CALL( SCIPallocClearBlockMemory(scip, cache) );
+      SCIP_CALL( SCIPhashmapInsert(nlhdlrdata->probingcaches, (void*)indicator, *cache) );
+   }
+
+   if( (*cache)->varssize < nvars )
+   {
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, nvars);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(*cache)->vars, (*cache)->varssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(*cache)->locdoms, (*cache)->varssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &(*cache)->probingdoms, (*cache)->varssize, newsize) );
+      (*cache)->varssize = newsize;
+   }
+
+   for( v = 0; v < nvars; ++v )
+   {
+      (*cache)->vars[v] = vars[v];
+      SCIPintervalSetBounds(&(*cache)->locdoms[v], SCIPvarGetLbLocal(vars[v]), SCIPvarGetUbLocal(vars[v]));
+   }
+   (*cache)->nvars = nvars;
+   (*cache)->nruns = SCIPgetNRuns(scip);
+
+   /* mark the entry as invalid until the result is stored */
+   (*cache)->signature = signature + 1;
+
+   return SCIP_OKAY;
+}
+
+/** stores the domains after propagation in probing in a cache entry */
+static
+void storeProbingCacheResult(
+   PROBINGCACHE*         cache,              /**< cache entry */
+   unsigned int          signature,          /**< signature of the local domains the entry was created for */
+   SCIP_Bool             cutoff              /**< whether propagation found indicator = 1 to be infeasible */
+   )
+{
+   int v;
+
+   assert(cache != NULL);
+
+   for( v = 0; v < cache->nvars; ++v )
+   {
+      SCIPintervalSetBounds(&cache->probingdoms[v], SCIPvarGetLbLocal(cache->vars[v]), SCIPvarGetUbLocal(cache->vars[v]));
+   }
+   cache->cutoff = cutoff;
+   cache->signature = signature;
+}
+
+/** applies the domains stored in a probing cache entry in probing */
+static
+SCIP_RETCODE applyProbingCache(
+   SCIP*                 scip,               /**< SCIP data structure */
+   PROBINGCACHE*         cache,              /**< cache entry */
+   SCIP_Bool*            cutoff              /**< pointer to store whether indicator = 1 is infeasible */
+   )
+{
+   SCIP_VAR* var;
+   int v;
+
+   assert(SCIPinProbing(scip));
+   assert(cache != NULL);
+
+   *cutoff = cache->cutoff;
+
+   for( v = 0; v < cache->nvars && !*cutoff; ++v )
+   {
+      var = cache->vars[v];
+
+      /* the probing domains of the current call might be tighter than those the cache entry was computed with */
+      if( SCIPisFeasGT(scip, cache->probingdoms[v].inf, SCIPvarGetUbLocal(var))
+         || SCIPisFeasLT(scip, cache->probingdoms[v].sup, SCIPvarGetLbLocal(var)) )
+      {
+         *cutoff = TRUE;
+         break;
+      }
+
+      if( cache->probingdoms[v].inf > SCIPvarGetLbLocal(var) )
+      {
+         SCIP_CALL( SCIPchgVarLbProbing(scip, var, MIN(cache->probingdoms[v].inf, SCIPvarGetUbLocal(var))) );
+      }
+      if( cache->probingdoms[v].sup < SCIPvarGetUbLocal(var) )
+      {
+         SCIP_CALL( SCIPchgVarUbProbing(scip, var, MAX(cache->probingdoms[v].sup, SCIPvarGetLbLocal(var))) );
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** frees the probing cache */
+static
+void freeProbingCaches(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata      /**< nonlinear handler data */
+   )
+{
+   SCIP_HASHMAPENTRY* entry;
+   PROBINGCACHE* cache;
+   int c;
+
+   if( nlhdlrdata->probingcaches == NULL )
+      return;
+
+   for( c = 0; c < SCIPhashmapGetNEntries(nlhdlrdata->probingcaches); ++c )
+   {
+      entry = SCIPhashmapGetEntry(nlhdlrdata->probingcaches, c);
+      if( entry != NULL )
+      {
+         cache = (PROBINGCACHE*) SCIPhashmapEntryGetImage(entry);
+         SCIPfreeBlockMemoryArrayNull(scip, &cache->probingdoms, cache->varssize);
+         SCIPfreeBlockMemoryArrayNull(scip, &cache->locdoms, cache->varssize);
+         SCIPfreeBlockMemoryArrayNull(scip, &cache->vars, cache->varssize);
+         SCIPfreeBlockMemory(scip, &cache);
+      }
+   }
+   SCIPhashmapFree(&nlhdlrdata->probingcaches);
+}
+
+/** go into probing and set some variable bounds
+ *
+ * In the root node, the bounds are also propagated. If the probing cache is enabled, the result of the propagation
+ * is stored for the variables in cachevars, and reused the next time if their local domains did not change.
+ * Since local bounds in the root node can only become tighter (within a run), the stored bounds remain valid even if
+ * the domains of other variables changed in the meantime.
+ *
+ * Probing for different indicators is done one after another, since SCIP has a single probing node and
+ * SCIPstartProbing() fails if probing is already active. To reduce the probing effort, use batched probing and the
+ * probing cache.
+ */
+static
+SCIP_RETCODE startProbing(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata,     /**< nonlinear handler data */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   SCIP_VAR*             indicator,          /**< indicator variable */
+   SCIP_VAR**            probingvars,        /**< array of vars whose bounds we will change in probing */
+   SCIP_INTERVAL*        probingdoms,        /**< array of intervals to which bounds of probingvars will be changed in probing */
+   int                   nprobingvars,       /**< number of probing vars */
+   SCIP_VAR**            cachevars,          /**< variables for which the result of propagation is cached */
+   int                   ncachevars,         /**< number of variables in cachevars */
+   SCIP_SOL*             sol,                /**< solution to be separated */
+   SCIP_SOL**            solcopy,            /**< buffer for a copy of sol before going into probing; if *solcopy == sol, then copy is created */
+   SCIP_Bool*            cutoff_probing      /**< pointer to store whether indicator == 1 is infeasible */
+   )
+{
+   int v;
+   SCIP_Real newlb;
+   SCIP_Real newub;
+   SCIP_Bool propagate;
+   PROBINGCACHE* cache;
+   unsigned int signature;
+
+   propagate = SCIPgetDepth(scip) == 0;
+   cache = NULL;
+   signature = 0;
+
+   /* if a copy of sol has not been created yet, then create one now and copy the relevant var values from sol,
+    * because sol can change after SCIPstartProbing, e.g., when linked to the LP solution
+    */
+   if( *solcopy == sol )
+   {
+      SCIP_CALL( SCIPcreateSol(scip, solcopy, NULL) );
+      for( v = 0; v < nlhdlrexprdata->nvars; ++v )
+      {
+         SCIP_CALL( SCIPsetSolVal(scip, *solcopy, nlhdlrexprdata->vars[v], SCIPgetSolVal(scip, sol, nlhdlrexprdata->vars[v])) );
+      }
+      for( v = 0; v < nlhdlrexprdata->nindicators; ++v )
+      {
+         SCIP_CALL( SCIPsetSolVal(scip, *solcopy, nlhdlrexprdata->indicators[v], SCIPgetSolVal(scip, sol, nlhdlrexprdata->indicators[v])) );
+      }
+   }
+
+   /* look for a stored propagation result before the local domains are changed by probing */
+   if( propagate && nlhdlrdata->probingcache && ncachevars > 0 )
+   {
+      signature = computeDomainSignature(cachevars, ncachevars);
+      cache = findProbingCache(scip, nlhdlrdata, indicator, signature, cachevars, ncachevars);
+
+      if( cache != NULL )
+      {
+         ++nlhdlrdata->nprobingcachehits;
+      }
+      else
+      {
+         SCIP_CALL( storeProbingCacheDomains(scip, nlhdlrdata, indicator, signature, cachevars, ncachevars, &cache) );
+         assert(cache->signature != signature);
+      }
+   }
+
+   SCIP_CALL( SCIPstartClock(scip, nlhdlrdata->probingtime) );
+   ++nlhdlrdata->nprobings;
+
+   /* go into probing */
+   SCIP_CALL( SCIPstartProbing(scip) );
+
+   /* create a probing node */
+   SCIP_CALL( SCIPnewProbingNode(scip) );
+
+   /* set indicator to 1 */
+   SCIP_CALL( SCIPchgVarLbProbing(scip, indicator, 1.0) );
+
+   /* apply stored bounds */
+   for( v = 0; v < nprobingvars; ++v )
    {
       newlb = SCIPintervalGetInf(probingdoms[v]);
       newub = SCIPintervalGetSup(probingdoms[v]);
@@ -935,9 +1628,23 @@ SCIP_RETCODE startProbing(
    {
       SCIP_Longint ndomreds;
 
-      SCIP_CALL( SCIPpropagateProbing(scip, nlhdlrdata->maxproprounds, cutoff_probing, &ndomreds) );
+      if( cache != NULL && cache->signature == signature )
+      {
+         /* the local domains are the same as in the last probing for this indicator */
+         SCIP_CALL( applyProbingCache(scip, cache, cutoff_probing) );
+      }
+      else
+      {
+         SCIP_CALL( SCIPpropagateProbing(scip, nlhdlrdata->maxproprounds, cutoff_probing, &ndomreds) );
+         nlhdlrdata->nprobingdomreds += ndomreds;
+
+         if( cache != NULL )
+            storeProbingCacheResult(cache, signature, *cutoff_probing);
+      }
    }
 
+   SCIP_CALL( SCIPstopClock(scip, nlhdlrdata->probingtime) );
+
    return SCIP_OKAY;
 }
 
@@ -963,7 +1670,7 @@ SCIP_RETCODE analyseVarOnoffBounds(
    SCIP_Bool*            reduceddom          /**< pointer to store whether any variables were fixed */
    )
 {
-   SCVARDATA* scvdata;
+   SCVARDATA* scvars;
    int pos;
    SCIP_Real sclb;
    SCIP_Real scub;
@@ -981,7 +1688,7 @@ SCIP_RETCODE analyseVarOnoffBounds(
 
    *infeas = FALSE;
    *reduceddom = FALSE;
-   scvdata = getSCVarDataInd(nlhdlrdata->scvars, var, indicator, &pos);
+   scvars = nlhdlrdata->scvars;
    if( doprobing )
    {
       assert(probinglb != NULL);
@@ -992,13 +1699,13 @@ SCIP_RETCODE analyseVarOnoffBounds(
    }
 
    /* nothing to do for non-semicontinuous variables */
-   if( scvdata == NULL )
+   if( !getSCVarDataInd(scvars, var, indicator, &pos) )
    {
       return SCIP_OKAY;
    }
 
-   sclb = indvalue ? scvdata->lbs1[pos] : scvdata->vals0[pos];
-   scub = indvalue ? scvdata->ubs1[pos] : scvdata->vals0[pos];
+   sclb = indvalue ? scvars->lbs1[pos] : scvars->vals0[pos];
+   scub = indvalue ? scvars->ubs1[pos] : scvars->vals0[pos];
    loclb = SCIPvarGetLbLocal(var);
    locub = SCIPvarGetUbLocal(var);
 
@@ -1088,7 +1795,7 @@ SCIP_RETCODE analyseVarOnoffBounds(
    }
 
    SCIPdebugMsg(scip, "%s in [%g, %g] instead of [%g, %g] (vals0 = %g)\n", SCIPvarGetName(var), sclb, scub,
-                SCIPvarGetLbLocal(var), SCIPvarGetUbLocal(var), scvdata->vals0[pos]);
+                SCIPvarGetLbLocal(var), SCIPvarGetUbLocal(var), scvars->vals0[pos]);
 
    return SCIP_OKAY;
 }
@@ -1202,13 +1909,12 @@ SCIP_RETCODE analyseOnoffBounds(
 static
 SCIP_RETCODE tightenOnBounds(
    SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
-   SCIP_HASHMAP*         scvars,             /**< hashmap with semicontinuous variables */
+   SCVARDATA*            scvars,             /**< semicontinuous variable data */
    SCIP_VAR*             indicator           /**< indicator variable */
    )
 {
    int v;
    SCIP_VAR* var;
-   SCVARDATA* scvdata;
    int pos;
    SCIP_Real lb;
    SCIP_Real ub;
@@ -1218,12 +1924,10 @@ SCIP_RETCODE tightenOnBounds(
       var = nlhdlrexprdata->vars[v];
       lb = SCIPvarGetLbLocal(var);
       ub = SCIPvarGetUbLocal(var);
-      scvdata = getSCVarDataInd(scvars, var, indicator, &pos);
-
-      if( scvdata != NULL )
+      if( getSCVarDataInd(scvars, var, indicator, &pos) )
       {
-         scvdata->lbs1[pos] = MAX(scvdata->lbs1[pos], lb);
-         scvdata->ubs1[pos] = MIN(scvdata->ubs1[pos], ub);
+         scvars->lbs1[pos] = MAX(scvars->lbs1[pos], lb);
+         scvars->ubs1[pos] = MIN(scvars->ubs1[pos], ub);
       }
    }
 
@@ -1231,913 +1935,2172 @@ SCIP_RETCODE tightenOnBounds(
 }
 
 /*
- * Callback methods of nonlinear handler
+ * Methods for the cut pool
  */
 
-/** nonlinear handler copy callback */
+/** adds those stored cuts for an indicator to the LP that are violated by the LP solution */
 static
-SCIP_DECL_CONSEXPR_NLHDLRCOPYHDLR(nlhdlrCopyhdlrPerspective)
-{ /*lint --e{715}*/
-   assert(targetscip != NULL);
-   assert(targetconsexprhdlr != NULL);
-   assert(sourcenlhdlr != NULL);
-   assert(strcmp(SCIPgetConsExprNlhdlrName(sourcenlhdlr), NLHDLR_NAME) == 0);
-
-   SCIP_CALL( SCIPincludeConsExprNlhdlrPerspective(targetscip, targetconsexprhdlr) );
+SCIP_RETCODE separatePoolCuts(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata,     /**< nonlinear handler data */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   SCIP_VAR*             indicator,          /**< indicator variable */
+   SCIP_Bool*            separated,          /**< buffer to store whether a stored cut was added */
+   SCIP_RESULT*          result              /**< pointer to update the result */
+   )
+{
+   SCIP_Bool infeasible;
+   int r;
 
-   return SCIP_OKAY;
-}
+   assert(nlhdlrexprdata != NULL);
+   assert(separated != NULL);
+   assert(result != NULL);
 
+   *separated = FALSE;
 
-/** callback to free data of handler */
-static
-SCIP_DECL_CONSEXPR_NLHDLRFREEHDLRDATA(nlhdlrFreehdlrdataPerspective)
-{ /*lint --e{715}*/
-   SCIPfreeBlockMemory(scip, nlhdlrdata);
+   for( r = 0; r < nlhdlrexprdata->npoolrows; ++r )
+   {
+      if( nlhdlrexprdata->poolinds[r] != indicator || SCIProwIsInLP(nlhdlrexprdata->poolrows[r]) )
+         continue;
 
-   return SCIP_OKAY;
-}
+      if( SCIPgetRowLPFeasibility(scip, nlhdlrexprdata->poolrows[r]) >= -SCIPgetLPFeastol(scip) )
+         continue;
 
+      SCIP_CALL( SCIPaddRow(scip, nlhdlrexprdata->poolrows[r], FALSE, &infeasible) );
+      ++nlhdlrdata->npoolcutsreused;
+      *separated = TRUE;
 
-/** callback to free expression specific data */
-static
-SCIP_DECL_CONSEXPR_NLHDLRFREEEXPRDATA(nlhdlrFreeExprDataPerspective)
-{  /*lint --e{715}*/
-   SCIP_CALL( freeNlhdlrExprData(scip, *nlhdlrexprdata) );
-   SCIPfreeBlockMemory(scip, nlhdlrexprdata);
+      if( infeasible )
+      {
+         *result = SCIP_CUTOFF;
+         return SCIP_OKAY;
+      }
+      *result = SCIP_SEPARATED;
+   }
 
    return SCIP_OKAY;
 }
 
-/** callback to be called in initialization */
+/** stores a globally valid perspective cut in the cut pool of an expression
+ *
+ * If there is already a cut for the same indicator with the same reference point, nothing is stored.
+ * If the pool is full, the oldest cut is removed.
+ */
 static
-SCIP_DECL_CONSEXPR_NLHDLRINIT(nlhdlrInitPerspective)
-{  /*lint --e{715}*/
-   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
-
-   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
-   assert(nlhdlrdata != NULL);
-
-   nlhdlrdata->ndetects = 0;
-   nlhdlrdata->nconvexdetects = 0;
-   nlhdlrdata->nnonconvexdetects = 0;
-   nlhdlrdata->nonlybigmdetects = 0;
-   nlhdlrdata->nbigmenfos = 0;
+SCIP_RETCODE addPoolCut(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata,     /**< nonlinear handler data */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   SCIP_CONS*            cons,               /**< expression constraint */
+   SCIP_VAR*             indicator,          /**< indicator variable */
+   SCIP_ROWPREP*         rowprep,            /**< cut that has been added */
+   SCIP_SOL*             sol                 /**< solution for which the cut was computed */
+   )
+{
+   SCIP_Real* refpoint;
+   int r;
+   int v;
 
-   return SCIP_OKAY;
-}
+   assert(nlhdlrexprdata != NULL);
+   assert(rowprep != NULL);
 
-/** callback to be called in deinitialization */
-static
-SCIP_DECL_CONSEXPR_NLHDLREXIT(nlhdlrExitPerspective)
-{  /*lint --e{715}*/
-   SCIP_HASHMAPENTRY* entry;
-   SCVARDATA* data;
-   int c;
-   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   if( rowprep->local || nlhdlrdata->maxpoolcuts <= 0 )
+      return SCIP_OKAY;
 
-   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
-   assert(nlhdlrdata != NULL);
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &refpoint, nlhdlrexprdata->nvars) );
+   for( v = 0; v < nlhdlrexprdata->nvars; ++v )
+      refpoint[v] = SCIPgetSolVal(scip, sol, nlhdlrexprdata->vars[v]);
 
-   if( nlhdlrdata->scvars != NULL )
+   /* check whether this cut is already stored */
+   for( r = 0; r < nlhdlrexprdata->npoolrows; ++r )
    {
-      for( c = 0; c < SCIPhashmapGetNEntries(nlhdlrdata->scvars); ++c )
+      if( nlhdlrexprdata->poolinds[r] != indicator || nlhdlrexprdata->poolnrefvals[r] != nlhdlrexprdata->nvars )
+         continue;
+
+      for( v = 0; v < nlhdlrexprdata->nvars; ++v )
       {
-         entry = SCIPhashmapGetEntry(nlhdlrdata->scvars, c);
-         if( entry != NULL )
-         {
-            data = (SCVARDATA*) SCIPhashmapEntryGetImage(entry);
-            SCIPfreeBlockMemoryArray(scip, &data->ubs1, data->bndssize);
-            SCIPfreeBlockMemoryArray(scip, &data->lbs1, data->bndssize);
-            SCIPfreeBlockMemoryArray(scip, &data->vals0, data->bndssize);
-            SCIPfreeBlockMemoryArray(scip, &data->bvars, data->bndssize);
-            SCIPfreeBlockMemory(scip, &data);
-         }
+         if( !SCIPisFeasEQ(scip, nlhdlrexprdata->poolrefpoints[r][v], refpoint[v]) )
+            break;
       }
-      SCIPhashmapFree(&nlhdlrdata->scvars);
-      assert(nlhdlrdata->scvars == NULL);
-   }
 
-   if( nlhdlrdata->ndetects > 0 )
-   {
-      SCIPinfoMessage(scip, NULL, "\nndetects%s = %d", SCIPgetSubscipDepth(scip) > 0 ? " (in subscip)" : "",
-            nlhdlrdata->ndetects);
+      if( v == nlhdlrexprdata->nvars )
+      {
+         SCIPfreeBlockMemoryArray(scip, &refpoint, nlhdlrexprdata->nvars);
+         return SCIP_OKAY;
+      }
    }
 
-   if( nlhdlrdata->nconvexdetects > 0 )
+   /* remove the oldest cut if the pool is full */
+   if( nlhdlrexprdata->npoolrows >= nlhdlrdata->maxpoolcuts )
    {
-      SCIPinfoMessage(scip, NULL, "\nnconvexdetects%s = %d", SCIPgetSubscipDepth(scip) > 0 ? " (in subscip)" : "",
-            nlhdlrdata->nconvexdetects);
-   }
+      SCIP_CALL( SCIPreleaseRow(scip, &nlhdlrexprdata->poolrows[0]) );
+      SCIPfreeBlockMemoryArray(scip, &nlhdlrexprdata->poolrefpoints[0], nlhdlrexprdata->poolnrefvals[0]);
 
-   if( nlhdlrdata->nnonconvexdetects > 0 )
-   {
-      SCIPinfoMessage(scip, NULL, "\nnnonconvexdetects%s = %d", SCIPgetSubscipDepth(scip) > 0 ? " (in subscip)" : "",
-            nlhdlrdata->nnonconvexdetects);
+      for( r = 1; r < nlhdlrexprdata->npoolrows; ++r )
+      {
+         nlhdlrexprdata->poolrows[r-1] = nlhdlrexprdata->poolrows[r];
+         nlhdlrexprdata->poolinds[r-1] = nlhdlrexprdata->poolinds[r];
+         nlhdlrexprdata->poolrefpoints[r-1] = nlhdlrexprdata->poolrefpoints[r];
+         nlhdlrexprdata->poolnrefvals[r-1] = nlhdlrexprdata->poolnrefvals[r];
+      }
+      --nlhdlrexprdata->npoolrows;
    }
 
-   if( nlhdlrdata->nonlybigmdetects > 0 )
+   if( nlhdlrexprdata->npoolrows + 1 > nlhdlrexprdata->poolrowssize )
    {
-      SCIPinfoMessage(scip, NULL, "\nnonlybigmdetects%s = %d", SCIPgetSubscipDepth(scip) > 0 ? " (in subscip)" : "",
-                      nlhdlrdata->nonlybigmdetects);
+      int newsize;
+
+      newsize = SCIPcalcMemGrowSize(scip, nlhdlrexprdata->npoolrows + 1);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->poolrows, nlhdlrexprdata->poolrowssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->poolinds, nlhdlrexprdata->poolrowssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->poolrefpoints, nlhdlrexprdata->poolrowssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->poolnrefvals, nlhdlrexprdata->poolrowssize, newsize) );
+      nlhdlrexprdata->poolrowssize = newsize;
    }
 
-   if( nlhdlrdata->nbigmenfos > 0 )
-   {
-      SCIPinfoMessage(scip, NULL, "\nbigmenfors%s = %d", SCIPgetSubscipDepth(scip) > 0 ? " (in subscip)" : "",
-                      nlhdlrdata->nbigmenfos);
-   }
+   r = nlhdlrexprdata->npoolrows;
+   SCIP_CALL( SCIPgetRowprepRowCons(scip, &nlhdlrexprdata->poolrows[r], rowprep, cons) );
+   nlhdlrexprdata->poolinds[r] = indicator;
+   nlhdlrexprdata->poolrefpoints[r] = refpoint;
+   nlhdlrexprdata->poolnrefvals[r] = nlhdlrexprdata->nvars;
+   ++nlhdlrexprdata->npoolrows;
 
    return SCIP_OKAY;
 }
 
-/** determines if a constraint is big-M, that is, becomes reduntant when some indicator(s) are at 0 */
+/*
+ * Methods for batched probing
+ */
+
+/** adds an expression to the lists of expressions of all its indicators */
 static
-SCIP_RETCODE consIsBigM(
-   SCIP*                 scip,               /** SCIP data structure */
-   SCIP_CONSHDLR*        conshdlr,           /** nonlinear constraint handler */
-   SCIP_CONSEXPR_NLHDLR* nlhdlr,             /** perspective nonlinear handler */
-   SCIP_CONS*            cons,               /** constraint */
-   SCIP_CONSEXPR_EXPR*   expr,               /** expression */
-   SCIP_VAR**            vars,               /** expression variables */
-   int                   nvars,              /** number of expression variables */
-   SCIP_Bool             hasnondefault,      /** whether expr has a non-default estimator */
-   SCIP_Bool*            success             /** buffer to store whether the constraint is big-M */
-   )
-{
-   SCIP_VAR** indicators;
-   int nindicators;
-   int indicatorssize;
-   int v;
+SCIP_RETCODE registerIndicatorExpr(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata,     /**< nonlinear handler data */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   SCIP_CONSEXPR_EXPR*   expr                /**< expression */
+   )
+{
+   INDEXPRS* indexprs;
+   int newsize;
    int i;
-   int j;
-   int c;
-   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
-   SCVARDATA** scvdatas;
-   SCIP_INTERVAL activity;
-   SCIP_INTERVAL* childactivities;
+   int e;
 
-   assert(conshdlr != NULL);
-   assert(nlhdlr != NULL);
-   assert(cons != NULL);
+   assert(nlhdlrdata != NULL);
+   assert(nlhdlrexprdata != NULL);
    assert(expr != NULL);
-   assert(vars != NULL);
-   assert(success != NULL);
 
-   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
-   indicators = NULL;
-   nindicators = 0;
-   indicatorssize = 0;
-   SCIP_CALL( SCIPallocBufferArray(scip, &scvdatas, nvars) );
+   if( nlhdlrexprdata->nindicators == 0 )
+      return SCIP_OKAY;
 
-   /* get list of all indicators */
-   for( v = 0; v < nvars; ++v )
+   if( nlhdlrdata->indexprs == NULL )
    {
-      SCIP_Bool sc;
+      SCIP_CALL( SCIPhashmapCreate(&(nlhdlrdata->indexprs), SCIPblkmem(scip), SCIPgetNBinVars(scip)) );
+   }
 
-      SCIP_CALL(varIsSemicontinuous(scip, vars[v], nlhdlrdata->scvars, &sc) );
-      if( !sc )
+   for( i = 0; i < nlhdlrexprdata->nindicators; ++i )
+   {
+      indexprs = (INDEXPRS*) SCIPhashmapGetImage(nlhdlrdata->indexprs, (void*)nlhdlrexprdata->indicators[i]);
+      if( indexprs == NULL )
       {
-         scvdatas[v] = NULL;
-         continue;
+         SCIP_CALL( SCIPallocClearBlockMemory(scip, &indexprs) );
+         SCIP_CALL( SCIPhashmapInsert(nlhdlrdata->indexprs, (void*)nlhdlrexprdata->indicators[i], indexprs) );
       }
 
-      scvdatas[v] = (SCVARDATA*) SCIPhashmapGetImage(nlhdlrdata->scvars, (void*)vars[v]);
-      assert(scvdatas[v] != NULL);
+      /* nothing to do if expr is already registered for this indicator */
+      for( e = 0; e < indexprs->nexprs && indexprs->exprs[e] != expr; ++e )
+         ;
+      if( e < indexprs->nexprs )
+         continue;
 
-      /* add all indicators from scvdata to indicators (i.e., make a union) */
-      for( i = 0; i < scvdatas[v]->nbnds; ++i )
+      if( indexprs->nexprs + 1 > indexprs->exprssize )
       {
-         SCIP_Bool found;
-         int pos;
+         newsize = SCIPcalcMemGrowSize(scip, indexprs->nexprs + 1);
+         SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &indexprs->exprs, indexprs->exprssize, newsize) );
+         indexprs->exprssize = newsize;
+      }
+      assert(indexprs->nexprs + 1 <= indexprs->exprssize);
 
-         if( indicators == NULL )
-         {
-            assert(nindicators == 0 && indicatorssize == 0);
-            found = FALSE;
-            pos = 0;
-         }
-         else
-         {
-            found = SCIPsortedvecFindPtr((void**)indicators, SCIPvarComp, (void*)scvdatas[v]->bvars[i], nindicators, &pos);
-         }
-         if( found )
-            continue;
+      indexprs->exprs[indexprs->nexprs] = expr;
+      ++indexprs->nexprs;
+   }
 
-         /* ensure sizes */
-         if( nindicators + 1 > indicatorssize )
-         {
-            int newsize;
-            newsize = SCIPcalcMemGrowSize(scip, nindicators + 1);
-            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &indicators, indicatorssize, newsize) );
-            indicatorssize = newsize;
-         }
-         assert(nindicators + 1 <= indicatorssize);
-         assert(indicators != NULL);
+   return SCIP_OKAY;
+}
 
-         /* move entries if needed */
-         for( j = nindicators; j > pos; --j )
+/** removes an expression from the lists of expressions of all its indicators */
+static
+void unregisterIndicatorExpr(
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata,     /**< nonlinear handler data */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   SCIP_CONSEXPR_EXPR*   expr                /**< expression */
+   )
+{
+   INDEXPRS* indexprs;
+   int i;
+   int e;
+
+   assert(nlhdlrdata != NULL);
+   assert(nlhdlrexprdata != NULL);
+
+   if( nlhdlrdata->indexprs == NULL )
+      return;
+
+   for( i = 0; i < nlhdlrexprdata->nindicators; ++i )
+   {
+      indexprs = (INDEXPRS*) SCIPhashmapGetImage(nlhdlrdata->indexprs, (void*)nlhdlrexprdata->indicators[i]);
+      if( indexprs == NULL )
+         continue;
+
+      for( e = 0; e < indexprs->nexprs; ++e )
+      {
+         if( indexprs->exprs[e] == expr )
          {
-            indicators[j] = indicators[j-1];
+            indexprs->exprs[e] = indexprs->exprs[indexprs->nexprs - 1];
+            --indexprs->nexprs;
+            break;
          }
-
-         indicators[pos] = scvdatas[v]->bvars[i];
-         ++nindicators;
       }
    }
+}
 
-   if( nindicators > 0 )
-   {
-      SCIP_CONSEXPR_BNDDATA scdata;
+/** frees the map from indicators to expressions */
+static
+SCIP_RETCODE freeIndicatorExprs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata      /**< nonlinear handler data */
+   )
+{
+   SCIP_HASHMAPENTRY* entry;
+   INDEXPRS* indexprs;
+   int c;
 
-      SCIP_CALL( SCIPallocBufferArray(scip, &scdata.vars, nvars + 1) );
-      SCIP_CALL( SCIPallocBufferArray(scip, &scdata.lbs, nvars + 1) );
-      SCIP_CALL( SCIPallocBufferArray(scip, &scdata.ubs, nvars + 1) );
+   if( nlhdlrdata->indexprs == NULL )
+      return SCIP_OKAY;
 
-      if( SCIPgetConsExprExprHdlr(expr) == SCIPgetConsExprExprHdlrSum(conshdlr) )
+   for( c = 0; c < SCIPhashmapGetNEntries(nlhdlrdata->indexprs); ++c )
+   {
+      entry = SCIPhashmapGetEntry(nlhdlrdata->indexprs, c);
+      if( entry != NULL )
       {
-         SCIP_CALL(SCIPallocBufferArray(scip, &childactivities, SCIPgetConsExprExprNChildren(expr)) );
+         indexprs = (INDEXPRS*) SCIPhashmapEntryGetImage(entry);
+         SCIPfreeBlockMemoryArrayNull(scip, &indexprs->exprs, indexprs->exprssize);
+         SCIPfreeBlockMemory(scip, &indexprs);
       }
+   }
+   SCIPhashmapFree(&nlhdlrdata->indexprs);
 
-      for( i = 0; i < nindicators; ++i )
-      {
-         SCIP_Longint ndomreds;
-         SCIP_Bool cutoff;
-         SCIP_Bool redundant;
+   return SCIP_OKAY;
+}
 
-         if( cons != NULL )
-         {
-            SCIP_Bool indincons = FALSE; /* whether indicator is one of the cons vars */
+/** makes sure that the batch data of an expression belongs to the current separation round
+ *
+ * A round is identified by the current node, the number of solved LPs and the side that is estimated.
+ * Pending cuts from an earlier round are freed.
+ */
+static
+SCIP_RETCODE updateBatchData(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   SCIP_Bool             overestimate        /**< whether the expression needs to be overestimated */
+   )
+{
+   SCIP_Longint nodenum;
+   SCIP_Longint nlps;
+   int r;
 
-            /* fill in intevalvardata */
-            for( v = 0; v < nvars; ++v )
-            {
-               scdata.vars[v] = vars[v];
-               if( scvdatas[v] != NULL )
-               {
-                  SCIP_Bool found;
-                  int pos;
+   assert(nlhdlrexprdata != NULL);
+   assert(!SCIPinProbing(scip));
 
-                  found = SCIPsortedvecFindPtr((void**)scvdatas[v]->bvars, SCIPvarComp, (void*)indicators[i], scvdatas[v]->nbnds, &pos);
-                  if( found )
-                  {
-                     scdata.lbs[v] = scvdatas[v]->vals0[pos];
-                     scdata.ubs[v] = scvdatas[v]->vals0[pos];
-                  }
-               }
-               else if( vars[v] == indicators[i] )
-               {
-                  indincons = TRUE;
-                  scdata.lbs[v] = 0.0;
-                  scdata.ubs[v] = 0.0;
-               }
-               else
-               {
-                  scdata.lbs[v] = SCIPvarGetLbGlobal(vars[v]);
-                  scdata.ubs[v] = SCIPvarGetUbGlobal(vars[v]);
-               }
-            }
+   nodenum = SCIPnodeGetNumber(SCIPgetCurrentNode(scip));
+   nlps = SCIPgetNLPs(scip);
 
-            if( !indincons )
-            {
-               scdata.vars[nvars] = indicators[i];
-               scdata.lbs[nvars] = 0.0;
-               scdata.ubs[nvars] = 0.0;
-               scdata.nvars = nvars+1;
-            }
-            else
-            {
-               scdata.vars[nvars] = NULL;
-               scdata.nvars = nvars;
-            }
+   if( nlhdlrexprdata->batchedinds != NULL && nlhdlrexprdata->batchnode == nodenum
+      && nlhdlrexprdata->batchnlps == nlps && nlhdlrexprdata->batchoverestimate == overestimate )
+      return SCIP_OKAY;
 
-#ifdef SCIP_DEBUG
-            SCIPdebugMsg(scip,  "\nscdata for indicator %s: ", SCIPvarGetName(indicators[i]));
-            for( v = 0; v < nvars + 1; ++v )
-            {
-               assert(scdata.vars[v] != NULL || v == nvars);
-               SCIPdebugMsg(scip,  "\n%s %g %g", SCIPvarGetName(scdata.vars[v]), scdata.lbs[v], scdata.ubs[v]);
-            }
-#endif
+   for( r = 0; r < nlhdlrexprdata->npendingcuts; ++r )
+   {
+      SCIPfreeRowprep(scip, &nlhdlrexprdata->pendingcuts[r]);
+   }
+   nlhdlrexprdata->npendingcuts = 0;
 
-            SCIP_CALL( SCIPisConsRedundantWithinBounds(scip, conshdlr, cons, &cutoff, &redundant, &scdata, &activity, childactivities) );
+   if( nlhdlrexprdata->batchedindssize < nlhdlrexprdata->nindicators )
+   {
+      SCIPfreeBlockMemoryArrayNull(scip, &nlhdlrexprdata->batchedinds, nlhdlrexprdata->batchedindssize);
+      SCIP_CALL( SCIPallocBlockMemoryArray(scip, &nlhdlrexprdata->batchedinds, nlhdlrexprdata->nindicators) );
+      nlhdlrexprdata->batchedindssize = nlhdlrexprdata->nindicators;
+   }
+   if( nlhdlrexprdata->batchedindssize > 0 )
+   {
+      BMSclearMemoryArray(nlhdlrexprdata->batchedinds, nlhdlrexprdata->batchedindssize);
+   }
 
-            if( redundant )
-            {
-               int nlockspos;
-               int nlocksneg;
-               SCIP_Real hasrhs;
-               SCIP_Real haslhs;
+   nlhdlrexprdata->batchnode = nodenum;
+   nlhdlrexprdata->batchnlps = nlps;
+   nlhdlrexprdata->batchoverestimate = overestimate;
 
-               hasrhs = !SCIPisInfinity(scip, SCIPgetRhsConsExpr(scip, cons));
-               haslhs = !SCIPisInfinity(scip, -SCIPgetLhsConsExpr(scip, cons));
+   return SCIP_OKAY;
+}
 
-               if( (SCIPgetConsExprExprHdlr(expr) != SCIPgetConsExprExprHdlrSum(conshdlr)) || hasnondefault )
-               {
-                  SCIP_Bool bigm = FALSE;
+/** stores a cut that has been computed for an expression while probing on behalf of another expression */
+static
+SCIP_RETCODE addPendingCut(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   SCIP_ROWPREP*         rowprep,            /**< perspective cut */
+   SCIP_Bool             addedbranchscores,  /**< whether branching scores were added when computing the cut */
+   int                   indpos              /**< position of the indicator the cut belongs to */
+   )
+{
+   int newsize;
 
-                  nlockspos = SCIPgetConsExprExprNLocksPos(expr);
-                  nlocksneg = SCIPgetConsExprExprNLocksNeg(expr);
+   assert(nlhdlrexprdata != NULL);
+   assert(rowprep != NULL);
+   assert(indpos >= 0 && indpos < nlhdlrexprdata->nindicators);
 
-                  /* check locks, mark expr as bigm with this indicator */
-                  if( nlockspos == 1 && nlocksneg == 0 )
-                  {
-                     if( hasrhs && !haslhs )
-                     {
-//                        SCIPinfoMessage(scip, NULL, "\nexpr %p can be set to its max when indicator %s is 0\n",
-//                                        expr, SCIPvarGetName(indicators[i]));
-                        bigm = TRUE;
-                        SCIPsetConsExprExprBigMMax(expr, TRUE);
-                     }
+   if( nlhdlrexprdata->npendingcuts + 1 > nlhdlrexprdata->pendingcutssize )
+   {
+      newsize = SCIPcalcMemGrowSize(scip, nlhdlrexprdata->npendingcuts + 1);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->pendingcuts, nlhdlrexprdata->pendingcutssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->pendingbrscores, nlhdlrexprdata->pendingcutssize, newsize) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->pendingindpos, nlhdlrexprdata->pendingcutssize, newsize) );
+      nlhdlrexprdata->pendingcutssize = newsize;
+   }
+   assert(nlhdlrexprdata->npendingcuts + 1 <= nlhdlrexprdata->pendingcutssize);
 
-                     else if( !hasrhs && haslhs )
-                     {
-//                        SCIPinfoMessage(scip, NULL, "\nexpr %p can be set to its min when indicator %s is 0\n",
-//                                        expr, SCIPvarGetName(indicators[i]));
-                        bigm = TRUE;
-                        SCIPsetConsExprExprBigMMax(expr, FALSE);
-                     }
-                  }
+   nlhdlrexprdata->pendingcuts[nlhdlrexprdata->npendingcuts] = rowprep;
+   nlhdlrexprdata->pendingbrscores[nlhdlrexprdata->npendingcuts] = addedbranchscores;
+   nlhdlrexprdata->pendingindpos[nlhdlrexprdata->npendingcuts] = indpos;
+   ++nlhdlrexprdata->npendingcuts;
 
-                  if( nlocksneg == 1 && nlockspos == 0 )
-                  {
-                     if( !hasrhs && haslhs )
-                     {
-//                        SCIPinfoMessage(scip, NULL, "\nexpr %p can be set to its max when indicator %s is 0\n",
-//                                        expr, SCIPvarGetName(indicators[i]));
-                        bigm = TRUE;
-                        SCIPsetConsExprExprBigMMax(expr, TRUE);
-                     }
-                     else if( hasrhs && !haslhs )
-                     {
-//                        SCIPinfoMessage(scip, NULL, "\nexpr %p can be set to its min when indicator %s is 0\n",
-//                                        expr, SCIPvarGetName(indicators[i]));
-                        bigm = TRUE;
-                        SCIPsetConsExprExprBigMMax(expr, FALSE);
-                     }
-                  }
-                  if( bigm )
-                  {
-                     SCIPsetConsExprExprBigM(expr, TRUE);
-                     SCIP_CALL( SCIPaddConsExprExprBigMIndicator(scip, expr, indicators[i], activity) );
-                  }
-               }
-               else
-               {
-                  /* if a sum expression has only the default nlhdlr, mark its children as bigm instead */
-                  for( c = 0; c < SCIPgetConsExprExprNChildren(expr); ++c )
-                  {
-                     SCIP_Bool bigm = FALSE;
-                     SCIP_CONSEXPR_EXPR* child;
+   return SCIP_OKAY;
+}
 
-                     child = SCIPgetConsExprExprChildren(expr)[c];
-                     nlockspos = SCIPgetConsExprExprNLocksPos(child);
-                     nlocksneg = SCIPgetConsExprExprNLocksNeg(child);
+/** moves the pending cuts of an indicator to the rowpreps array and marks the indicator as not batched anymore */
+static
+SCIP_RETCODE takePendingCuts(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   int                   indpos,             /**< position of the indicator */
+   SCIP_PTRARRAY*        rowpreps,           /**< array to store the cuts */
+   SCIP_BOOLARRAY*       addedbranchscores,  /**< array to store whether branching scores were added for the cuts */
+   int*                  nrowpreps           /**< pointer to number of entries in rowpreps, will be updated */
+   )
+{
+   int r;
+   int nkept;
 
-                     if( nlockspos == 1 && nlocksneg == 0 )
-                     {
-                        if( hasrhs && !haslhs )
-                        {
-//                           SCIPinfoMessage(scip, NULL, "\nchild %p can be set to its max when indicator %s is 0\n",
-//                                           child, SCIPvarGetName(indicators[i]));
-                           bigm = TRUE;
-                           SCIPsetConsExprExprBigMMax(child, TRUE);
-                        }
+   assert(nlhdlrexprdata != NULL);
+   assert(nlhdlrexprdata->batchedinds != NULL);
+   assert(nrowpreps != NULL);
 
-                        else if( !hasrhs && haslhs )
-                        {
-//                           SCIPinfoMessage(scip, NULL, "\nchild %p can be set to its min when indicator %s is 0\n",
-//                                           child, SCIPvarGetName(indicators[i]));
-                           bigm = TRUE;
-                           SCIPsetConsExprExprBigMMax(child, FALSE);
-                        }
+   nkept = 0;
+   for( r = 0; r < nlhdlrexprdata->npendingcuts; ++r )
+   {
+      if( nlhdlrexprdata->pendingindpos[r] == indpos )
+      {
+         SCIP_CALL( SCIPsetPtrarrayVal(scip, rowpreps, *nrowpreps, nlhdlrexprdata->pendingcuts[r]) );
+         SCIP_CALL( SCIPsetBoolarrayVal(scip, addedbranchscores, *nrowpreps, nlhdlrexprdata->pendingbrscores[r]) );
+         ++*nrowpreps;
+      }
+      else
+      {
+         nlhdlrexprdata->pendingcuts[nkept] = nlhdlrexprdata->pendingcuts[r];
+         nlhdlrexprdata->pendingbrscores[nkept] = nlhdlrexprdata->pendingbrscores[r];
+         nlhdlrexprdata->pendingindpos[nkept] = nlhdlrexprdata->pendingindpos[r];
+         ++nkept;
+      }
+   }
+   nlhdlrexprdata->npendingcuts = nkept;
 
-                     }
-                     else if( nlocksneg == 1 && nlockspos == 0 )
-                     {
-                        if( !hasrhs && haslhs )
-                        {
-//                           SCIPinfoMessage(scip, NULL, "\nchild %p can be set to its max when indicator %s is 0\n",
-//                                           child, SCIPvarGetName(indicators[i]));
-                           bigm = TRUE;
-                           SCIPsetConsExprExprBigMMax(child, TRUE);
-                        }
-                        else if( hasrhs && !haslhs )
-                        {
-//                           SCIPinfoMessage(scip, NULL, "\nchild %p can be set to its min when indicator %s is 0\n",
-//                                           child, SCIPvarGetName(indicators[i]));
-                           bigm = TRUE;
-                           SCIPsetConsExprExprBigMMax(child, FALSE);
-                        }
-                     }
-                     if( bigm )
-                     {
-                        SCIPsetConsExprExprBigM(child, TRUE);
-                        SCIP_CALL( SCIPaddConsExprExprBigMIndicator(scip, child, indicators[i], childactivities[c]) );
-                     }
-                  }
-               }
-            }
+   /* if the expression is enforced again in this round, the cuts have to be recomputed */
+   nlhdlrexprdata->batchedinds[indpos] = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/*
+ * Callback methods of nonlinear handler
+ */
+
+/** nonlinear handler copy callback */
+static
+SCIP_DECL_CONSEXPR_NLHDLRCOPYHDLR(nlhdlrCopyhdlrPerspective)
+{ /*lint --e{715}*/
+   assert(targetscip != NULL);
+   assert(targetconsexprhdlr != NULL);
+   assert(sourcenlhdlr != NULL);
+   assert(strcmp(SCIPgetConsExprNlhdlrName(sourcenlhdlr), NLHDLR_NAME) == 0);
+
+   SCIP_CALL( SCIPincludeConsExprNlhdlrPerspective(targetscip, targetconsexprhdlr) );
+
+   return SCIP_OKAY;
+}
+
+
+/** callback to free data of handler */
+static
+SCIP_DECL_CONSEXPR_NLHDLRFREEHDLRDATA(nlhdlrFreehdlrdataPerspective)
+{ /*lint --e{715}*/
+   SCIP_CALL( SCIPfreeClock(scip, &(*nlhdlrdata)->rowpreptime) );
+   SCIP_CALL( SCIPfreeClock(scip, &(*nlhdlrdata)->indcoeftime) );
+   SCIP_CALL( SCIPfreeClock(scip, &(*nlhdlrdata)->estimatetime) );
+   SCIP_CALL( SCIPfreeClock(scip, &(*nlhdlrdata)->probingtime) );
+   SCIP_CALL( SCIPfreeClock(scip, &(*nlhdlrdata)->offvaluestime) );
+
+   SCIPfreeBlockMemory(scip, nlhdlrdata);
+
+   return SCIP_OKAY;
+}
+
+
+/** callback to free expression specific data */
+static
+SCIP_DECL_CONSEXPR_NLHDLRFREEEXPRDATA(nlhdlrFreeExprDataPerspective)
+{  /*lint --e{715}*/
+   unregisterIndicatorExpr(SCIPgetConsExprNlhdlrData(nlhdlr), *nlhdlrexprdata, expr);
+
+   SCIP_CALL( freeNlhdlrExprData(scip, *nlhdlrexprdata) );
+   SCIPfreeBlockMemory(scip, nlhdlrexprdata);
+
+   return SCIP_OKAY;
+}
+
+/** callback to be called in initialization */
+static
+SCIP_DECL_CONSEXPR_NLHDLRINIT(nlhdlrInitPerspective)
+{  /*lint --e{715}*/
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   assert(nlhdlrdata != NULL);
+
+   nlhdlrdata->ndetects = 0;
+   nlhdlrdata->nconvexdetects = 0;
+   nlhdlrdata->nnonconvexdetects = 0;
+   nlhdlrdata->nonlybigmdetects = 0;
+   nlhdlrdata->nbigmenfos = 0;
+   nlhdlrdata->nbatchcuts = 0;
+   nlhdlrdata->nprobingcachehits = 0;
+   nlhdlrdata->npoolcutsreused = 0;
+   nlhdlrdata->nclosedformcuts = 0;
+   nlhdlrdata->nprobings = 0;
+   nlhdlrdata->nprobingskips = 0;
+   nlhdlrdata->nprobingdomreds = 0;
+   nlhdlrdata->ncutsgenerated = 0;
+   nlhdlrdata->ncutsapplied = 0;
+
+   SCIP_CALL( SCIPresetClock(scip, nlhdlrdata->offvaluestime) );
+   SCIP_CALL( SCIPresetClock(scip, nlhdlrdata->probingtime) );
+   SCIP_CALL( SCIPresetClock(scip, nlhdlrdata->estimatetime) );
+   SCIP_CALL( SCIPresetClock(scip, nlhdlrdata->indcoeftime) );
+   SCIP_CALL( SCIPresetClock(scip, nlhdlrdata->rowpreptime) );
+
+   return SCIP_OKAY;
+}
+
+/** callback to be called in deinitialization */
+static
+SCIP_DECL_CONSEXPR_NLHDLREXIT(nlhdlrExitPerspective)
+{  /*lint --e{715}*/
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   assert(nlhdlrdata != NULL);
+
+   if( nlhdlrdata->scvars != NULL )
+   {
+      SCIP_CALL( freeSCVarData(scip, &nlhdlrdata->scvars) );
+      assert(nlhdlrdata->scvars == NULL);
+   }
+
+   SCIP_CALL( freeIndicatorExprs(scip, nlhdlrdata) );
+   assert(nlhdlrdata->indexprs == NULL);
+
+   freeProbingCaches(scip, nlhdlrdata);
+   assert(nlhdlrdata->probingcaches == NULL);
+
+   return SCIP_OKAY;
+}
+
+/** output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUT(tableOutputPerspective)
+{ /*lint --e{715}*/
+   SCIP_CONSEXPR_NLHDLR* nlhdlr;
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   SCIP_CONSHDLR* conshdlr;
+
+   conshdlr = SCIPfindConshdlr(scip, "expr");
+   assert(conshdlr != NULL);
+   nlhdlr = SCIPfindConsExprNlhdlr(conshdlr, NLHDLR_NAME);
+   assert(nlhdlr != NULL);
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   assert(nlhdlrdata != NULL);
+
+   /* the detection and total enforcement times are reported in the nonlinear handler table of cons_expr */
+   SCIPinfoMessage(scip, file, "Perspective Nlhdlr : %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s %10s\n",
+         "Detects", "Convex", "Nonconvex", "OnlyBigM", "CutsGen", "CutsAppl", "BigMCuts", "PoolReused", "ClosedForm",
+         "BatchCuts", "Probings", "CacheHits", "ProbSkips");
+   SCIPinfoMessage(scip, file, "  %-17s:", "Counts");
+   SCIPinfoMessage(scip, file, " %10d", nlhdlrdata->ndetects);
+   SCIPinfoMessage(scip, file, " %10d", nlhdlrdata->nconvexdetects);
+   SCIPinfoMessage(scip, file, " %10d", nlhdlrdata->nnonconvexdetects);
+   SCIPinfoMessage(scip, file, " %10d", nlhdlrdata->nonlybigmdetects);
+   SCIPinfoMessage(scip, file, " %10" SCIP_LONGINT_FORMAT, nlhdlrdata->ncutsgenerated);
+   SCIPinfoMessage(scip, file, " %10" SCIP_LONGINT_FORMAT, nlhdlrdata->ncutsapplied);
+   SCIPinfoMessage(scip, file, " %10d", nlhdlrdata->nbigmenfos);
+   SCIPinfoMessage(scip, file, " %10d", nlhdlrdata->npoolcutsreused);
+   SCIPinfoMessage(scip, file, " %10d", nlhdlrdata->nclosedformcuts);
+   SCIPinfoMessage(scip, file, " %10d", nlhdlrdata->nbatchcuts);
+   SCIPinfoMessage(scip, file, " %10" SCIP_LONGINT_FORMAT, nlhdlrdata->nprobings);
+   SCIPinfoMessage(scip, file, " %10d", nlhdlrdata->nprobingcachehits);
+   SCIPinfoMessage(scip, file, " %10" SCIP_LONGINT_FORMAT, nlhdlrdata->nprobingskips);
+   SCIPinfoMessage(scip, file, "\n");
+
+   SCIPinfoMessage(scip, file, "  %-17s: %10s %10s %10s %10s %10s %10s %10s\n", "Times", "OffValues", "Probing",
+         "Estimate", "IndCoef", "Rowprep", "AvgProbing", "AvgDomReds");
+   SCIPinfoMessage(scip, file, "  %-17s:", "");
+   SCIPinfoMessage(scip, file, " %10.2f", SCIPgetClockTime(scip, nlhdlrdata->offvaluestime));
+   SCIPinfoMessage(scip, file, " %10.2f", SCIPgetClockTime(scip, nlhdlrdata->probingtime));
+   SCIPinfoMessage(scip, file, " %10.2f", SCIPgetClockTime(scip, nlhdlrdata->estimatetime));
+   SCIPinfoMessage(scip, file, " %10.2f", SCIPgetClockTime(scip, nlhdlrdata->indcoeftime));
+   SCIPinfoMessage(scip, file, " %10.2f", SCIPgetClockTime(scip, nlhdlrdata->rowpreptime));
+   if( nlhdlrdata->nprobings > 0 )
+   {
+      SCIPinfoMessage(scip, file, " %10.4f", SCIPgetClockTime(scip, nlhdlrdata->probingtime) / nlhdlrdata->nprobings);
+      SCIPinfoMessage(scip, file, " %10.2f", (SCIP_Real)nlhdlrdata->nprobingdomreds / nlhdlrdata->nprobings);
+   }
+   else
+   {
+      SCIPinfoMessage(scip, file, " %10s %10s", "-", "-");
+   }
+   SCIPinfoMessage(scip, file, "\n");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonPerspective)
+{ /*lint --e{715}*/
+   SCIP_CONSEXPR_NLHDLR* nlhdlr;
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   SCIP_CONSHDLR* conshdlr;
+
+   conshdlr = SCIPfindConshdlr(scip, "expr");
+   assert(conshdlr != NULL);
+   nlhdlr = SCIPfindConsExprNlhdlr(conshdlr, NLHDLR_NAME);
+   assert(nlhdlr != NULL);
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   assert(nlhdlrdata != NULL);
+
+   SCIPinfoMessage(scip, file, "{\"detects\":%d,\"convex\":%d,\"nonconvex\":%d,\"onlybigm\":%d,"
+      "\"cutsgen\":%" SCIP_LONGINT_FORMAT ",\"cutsappl\":%" SCIP_LONGINT_FORMAT ",\"bigmcuts\":%d,\"poolreused\":%d,"
+      "\"closedform\":%d,\"batchcuts\":%d,\"probings\":%" SCIP_LONGINT_FORMAT ",\"cachehits\":%d,"
+      "\"probingskips\":%" SCIP_LONGINT_FORMAT ",\"probingdomreds\":%" SCIP_LONGINT_FORMAT ",",
+      nlhdlrdata->ndetects, nlhdlrdata->nconvexdetects, nlhdlrdata->nnonconvexdetects, nlhdlrdata->nonlybigmdetects,
+      nlhdlrdata->ncutsgenerated, nlhdlrdata->ncutsapplied, nlhdlrdata->nbigmenfos, nlhdlrdata->npoolcutsreused,
+      nlhdlrdata->nclosedformcuts, nlhdlrdata->nbatchcuts, nlhdlrdata->nprobings, nlhdlrdata->nprobingcachehits,
+      nlhdlrdata->nprobingskips, nlhdlrdata->nprobingdomreds);
+   SCIPinfoMessage(scip, file, "\"offvaluestime\":%.15g,\"probingtime\":%.15g,\"estimatetime\":%.15g,"
+      "\"indcoeftime\":%.15g,\"rowpreptime\":%.15g}",
+      SCIPgetClockTime(scip, nlhdlrdata->offvaluestime), SCIPgetClockTime(scip, nlhdlrdata->probingtime),
+      SCIPgetClockTime(scip, nlhdlrdata->estimatetime), SCIPgetClockTime(scip, nlhdlrdata->indcoeftime),
+      SCIPgetClockTime(scip, nlhdlrdata->rowpreptime));
+
+   return SCIP_OKAY;
+}
+
+/** determines if a constraint is big-M, that is, becomes reduntant when some indicator(s) are at 0 */
+static
+SCIP_RETCODE consIsBigM(
+   SCIP*                 scip,               /** SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /** nonlinear constraint handler */
+   SCIP_CONSEXPR_NLHDLR* nlhdlr,             /** perspective nonlinear handler */
+   SCIP_CONS*            cons,               /** constraint */
+   SCIP_CONSEXPR_EXPR*   expr,               /** expression */
+   SCIP_VAR**            vars,               /** expression variables */
+   int                   nvars,              /** number of expression variables */
+   SCIP_Bool             hasnondefault,      /** whether expr has a non-default estimator */
+   SCIP_Bool*            success             /** buffer to store whether the constraint is big-M */
+   )
+{
+   SCIP_VAR** indicators;
+   int nindicators;
+   int indicatorssize;
+   int v;
+   int i;
+   int j;
+   int c;
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   SCIP_Bool* issc;
+   SCIP_INTERVAL activity;
+   SCIP_INTERVAL* childactivities;
+
+   assert(conshdlr != NULL);
+   assert(nlhdlr != NULL);
+   assert(cons != NULL);
+   assert(expr != NULL);
+   assert(vars != NULL);
+   assert(success != NULL);
+
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   indicators = NULL;
+   nindicators = 0;
+   indicatorssize = 0;
+   SCIP_CALL( SCIPallocBufferArray(scip, &issc, nvars) );
+
+   /* get list of all indicators */
+   for( v = 0; v < nvars; ++v )
+   {
+      SCIP_VAR** bvars;
+      int nbnds;
+
+      SCIP_CALL(varIsSemicontinuous(scip, vars[v], nlhdlrdata->scvars, &issc[v]) );
+      if( !issc[v] )
+         continue;
+
+      bvars = &nlhdlrdata->scvars->bvars[getSCVarStart(nlhdlrdata->scvars, vars[v])];
+      nbnds = getSCVarNBnds(nlhdlrdata->scvars, vars[v]);
+
+      /* add all indicators of vars[v] to indicators (i.e., make a union) */
+      for( i = 0; i < nbnds; ++i )
+      {
+         SCIP_Bool found;
+         int pos;
+
+         if( indicators == NULL )
+         {
+            assert(nindicators == 0 && indicatorssize == 0);
+            found = FALSE;
+            pos = 0;
+         }
+         else
+         {
+            found = SCIPsortedvecFindPtr((void**)indicators, SCIPvarComp, (void*)bvars[i], nindicators, &pos);
+         }
+         if( found )
+            continue;
+
+         /* ensure sizes */
+         if( nindicators + 1 > indicatorssize )
+         {
+            int newsize;
+            newsize = SCIPcalcMemGrowSize(scip, nindicators + 1);
+            SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &indicators, indicatorssize, newsize) );
+            indicatorssize = newsize;
+         }
+         assert(nindicators + 1 <= indicatorssize);
+         assert(indicators != NULL);
+
+         /* move entries if needed */
+         for( j = nindicators; j > pos; --j )
+         {
+            indicators[j] = indicators[j-1];
          }
+
+         indicators[pos] = bvars[i];
+         ++nindicators;
       }
+   }
+
+   if( nindicators > 0 )
+   {
+      SCIP_CONSEXPR_BNDDATA scdata;
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &scdata.vars, nvars + 1) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &scdata.lbs, nvars + 1) );
+      SCIP_CALL( SCIPallocBufferArray(scip, &scdata.ubs, nvars + 1) );
+
       if( SCIPgetConsExprExprHdlr(expr) == SCIPgetConsExprExprHdlrSum(conshdlr) )
       {
-         SCIPfreeBufferArray(scip, &childactivities);
+         SCIP_CALL(SCIPallocBufferArray(scip, &childactivities, SCIPgetConsExprExprNChildren(expr)) );
       }
-      SCIPfreeBufferArray(scip, &scdata.vars);
-      SCIPfreeBufferArray(scip, &scdata.lbs);
-      SCIPfreeBufferArray(scip, &scdata.ubs);
+
+      for( i = 0; i < nindicators; ++i )
+      {
+         SCIP_Longint ndomreds;
+         SCIP_Bool cutoff;
+         SCIP_Bool redundant;
+
+         if( cons != NULL )
+         {
+            SCIP_Bool indincons = FALSE; /* whether indicator is one of the cons vars */
+
+            /* fill in intevalvardata */
+            for( v = 0; v < nvars; ++v )
+            {
+               scdata.vars[v] = vars[v];
+               if( issc[v] )
+               {
+                  int pos;
+
+                  if( getSCVarDataInd(nlhdlrdata->scvars, vars[v], indicators[i], &pos) )
+                  {
+                     scdata.lbs[v] = nlhdlrdata->scvars->vals0[pos];
+                     scdata.ubs[v] = nlhdlrdata->scvars->vals0[pos];
+                  }
+               }
+               else if( vars[v] == indicators[i] )
+               {
+                  indincons = TRUE;
+                  scdata.lbs[v] = 0.0;
+                  scdata.ubs[v] = 0.0;
+               }
+               else
+               {
+                  scdata.lbs[v] = SCIPvarGetLbGlobal(vars[v]);
+                  scdata.ubs[v] = SCIPvarGetUbGlobal(vars[v]);
+               }
+            }
+
+            if( !indincons )
+            {
+               scdata.vars[nvars] = indicators[i];
+               scdata.lbs[nvars] = 0.0;
+               scdata.ubs[nvars] = 0.0;
+               scdata.nvars = nvars+1;
+            }
+            else
+            {
+               scdata.vars[nvars] = NULL;
+               scdata.nvars = nvars;
+            }
+
+#ifdef SCIP_DEBUG
+            SCIPdebugMsg(scip,  "\nscdata for indicator %s: ", SCIPvarGetName(indicators[i]));
+            for( v = 0; v < nvars + 1; ++v )
+            {
+               assert(scdata.vars[v] != NULL || v == nvars);
+               SCIPdebugMsg(scip,  "\n%s %g %g", SCIPvarGetName(scdata.vars[v]), scdata.lbs[v], scdata.ubs[v]);
+            }
+#endif
+
+            SCIP_CALL( SCIPisConsRedundantWithinBounds(scip, conshdlr, cons, &cutoff, &redundant, &scdata, &activity, childactivities) );
+
+            if( redundant )
+            {
+               int nlockspos;
+               int nlocksneg;
+               SCIP_Real hasrhs;
+               SCIP_Real haslhs;
+
+               hasrhs = !SCIPisInfinity(scip, SCIPgetRhsConsExpr(scip, cons));
+               haslhs = !SCIPisInfinity(scip, -SCIPgetLhsConsExpr(scip, cons));
+
+               if( (SCIPgetConsExprExprHdlr(expr) != SCIPgetConsExprExprHdlrSum(conshdlr)) || hasnondefault )
+               {
+                  SCIP_Bool bigm = FALSE;
+
+                  nlockspos = SCIPgetConsExprExprNLocksPos(expr);
+                  nlocksneg = SCIPgetConsExprExprNLocksNeg(expr);
+
+                  /* check locks, mark expr as bigm with this indicator */
+                  if( nlockspos == 1 && nlocksneg == 0 )
+                  {
+                     if( hasrhs && !haslhs )
+                     {
+//                        SCIPinfoMessage(scip, NULL, "\nexpr %p can be set to its max when indicator %s is 0\n",
+//                                        expr, SCIPvarGetName(indicators[i]));
+                        bigm = TRUE;
+                        SCIPsetConsExprExprBigMMax(expr, TRUE);
+                     }
+
+                     else if( !hasrhs && haslhs )
+                     {
+//                        SCIPinfoMessage(scip, NULL, "\nexpr %p can be set to its min when indicator %s is 0\n",
+//                                        expr, SCIPvarGetName(indicators[i]));
+                        bigm = TRUE;
+                        SCIPsetConsExprExprBigMMax(expr, FALSE);
+                     }
+                  }
+
+                  if( nlocksneg == 1 && nlockspos == 0 )
+                  {
+                     if( !hasrhs && haslhs )
+                     {
+//                        SCIPinfoMessage(scip, NULL, "\nexpr %p can be set to its max when indicator %s is 0\n",
+//                                        expr, SCIPvarGetName(indicators[i]));
+                        bigm = TRUE;
+                        SCIPsetConsExprExprBigMMax(expr, TRUE);
+                     }
+                     else if( hasrhs && !haslhs )
+                     {
+//                        SCIPinfoMessage(scip, NULL, "\nexpr %p can be set to its min when indicator %s is 0\n",
+//                                        expr, SCIPvarGetName(indicators[i]));
+                        bigm = TRUE;
+                        SCIPsetConsExprExprBigMMax(expr, FALSE);
+                     }
+                  }
+                  if( bigm )
+                  {
+                     SCIPsetConsExprExprBigM(expr, TRUE);
+                     SCIP_CALL( SCIPaddConsExprExprBigMIndicator(scip, expr, indicators[i], activity) );
+                  }
+               }
+               else
+               {
+                  /* if a sum expression has only the default nlhdlr, mark its children as bigm instead */
+                  for( c = 0; c < SCIPgetConsExprExprNChildren(expr); ++c )
+                  {
+                     SCIP_Bool bigm = FALSE;
+                     SCIP_CONSEXPR_EXPR* child;
+
+                     child = SCIPgetConsExprExprChildren(expr)[c];
+                     nlockspos = SCIPgetConsExprExprNLocksPos(child);
+                     nlocksneg = SCIPgetConsExprExprNLocksNeg(child);
+
+                     if( nlockspos == 1 && nlocksneg == 0 )
+                     {
+                        if( hasrhs && !haslhs )
+                        {
+//                           SCIPinfoMessage(scip, NULL, "\nchild %p can be set to its max when indicator %s is 0\n",
+//                                           child, SCIPvarGetName(indicators[i]));
+                           bigm = TRUE;
+                           SCIPsetConsExprExprBigMMax(child, TRUE);
+                        }
+
+                        else if( !hasrhs && haslhs )
+                        {
+//                           SCIPinfoMessage(scip, NULL, "\nchild %p can be set to its min when indicator %s is 0\n",
+//                                           child, SCIPvarGetName(indicators[i]));
+                           bigm = TRUE;
+                           SCIPsetConsExprExprBigMMax(child, FALSE);
+                        }
+
+                     }
+                     else if( nlocksneg == 1 && nlockspos == 0 )
+                     {
+                        if( !hasrhs && haslhs )
+                        {
+//                           SCIPinfoMessage(scip, NULL, "\nchild %p can be set to its max when indicator %s is 0\n",
+//                                           child, SCIPvarGetName(indicators[i]));
+                           bigm = TRUE;
+                           SCIPsetConsExprExprBigMMax(child, TRUE);
+                        }
+                        else if( hasrhs && !haslhs )
+                        {
+//                           SCIPinfoMessage(scip, NULL, "\nchild %p can be set to its min when indicator %s is 0\n",
+//                                           child, SCIPvarGetName(indicators[i]));
+                           bigm = TRUE;
+                           SCIPsetConsExprExprBigMMax(child, FALSE);
+                        }
+                     }
+                     if( bigm )
+                     {
+                        SCIPsetConsExprExprBigM(child, TRUE);
+                        SCIP_CALL( SCIPaddConsExprExprBigMIndicator(scip, child, indicators[i], childactivities[c]) );
+                     }
+                  }
+               }
+            }
+         }
+      }
+      if( SCIPgetConsExprExprHdlr(expr) == SCIPgetConsExprExprHdlrSum(conshdlr) )
+      {
+         SCIPfreeBufferArray(scip, &childactivities);
+      }
+      SCIPfreeBufferArray(scip, &scdata.vars);
+      SCIPfreeBufferArray(scip, &scdata.lbs);
+      SCIPfreeBufferArray(scip, &scdata.ubs);
+   }
+
+   SCIPfreeBlockMemoryArrayNull(scip, &indicators, indicatorssize);
+   SCIPfreeBufferArray(scip, &issc);
+
+   return SCIP_OKAY;
+}
+
+/** callback to detect structure in expression tree
+ *
+ *  We are looking for expressions g(x), where x is a vector of semicontinuous variables that all share at least one
+ *  indicator variable.
+ */
+static
+SCIP_DECL_CONSEXPR_NLHDLRDETECT(nlhdlrDetectPerspective)
+{ /*lint --e{715}*/
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   SCIP_CONSEXPR_EXPR** varexprs;
+   SCIP_Bool success = FALSE;
+   int i;
+   SCIP_Bool hassepabelow = FALSE;
+   SCIP_Bool hassepaabove = FALSE;
+   SCIP_Bool hasnondefault = FALSE;
+   /* some variables for statistics */
+   SCIP_Bool hasconvexsepa = FALSE;
+   SCIP_Bool hasnonconvexsepa = FALSE;
+   SCIP_Bool bigm = FALSE;
+   int nvars;
+   SCIP_VAR** vars;
+
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+
+   assert(scip != NULL);
+   assert(nlhdlr != NULL);
+   assert(expr != NULL);
+   assert(participating != NULL);
+   assert(enforcing != NULL);
+   assert(nlhdlrexprdata != NULL);
+   assert(nlhdlrdata != NULL);
+
+   /* do not run if we will have no auxvar to add a cut for */
+   if( SCIPgetConsExprExprNAuxvarUses(expr) == 0 )
+      return SCIP_OKAY;
+
+   if( SCIPgetNBinVars(scip) == 0 )
+   {
+      SCIPdebugMsg(scip, "problem has no binary variables, not running perspective detection\n");
+      return SCIP_OKAY;
+   }
+
+   for( i = 0; i < SCIPgetConsExprExprNEnfos(expr); ++i )
+   {
+      SCIP_CONSEXPR_NLHDLR* nlhdlr2;
+      SCIP_CONSEXPR_EXPRENFO_METHOD nlhdlr2participates;
+      SCIP_Bool sepabelowusesactivity;
+      SCIP_Bool sepaaboveusesactivity;
+      SCIPgetConsExprExprEnfoData(expr, i, &nlhdlr2, NULL, &nlhdlr2participates, &sepabelowusesactivity, &sepaaboveusesactivity, NULL);
+
+      if( (nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPABOTH) == 0 )
+         continue;
+
+      if( !SCIPhasConsExprNlhdlrEstimate(nlhdlr2) )
+         continue;
+
+      if( strcmp(SCIPgetConsExprNlhdlrName(nlhdlr2), "default") != 0 )
+         hasnondefault = TRUE;
+
+      /* If we are supposed to run only on convex expressions, than check whether there is a nlhdlr
+       * that participates in separation without using activity for it. Otherwise, check for
+       * participation regardless of activity usage.
+       */
+      if( (nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPABELOW) && (!nlhdlrdata->convexonly || !sepabelowusesactivity) )
+         hassepabelow = TRUE;
+
+      if( (nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPAABOVE) && (!nlhdlrdata->convexonly || !sepaaboveusesactivity) )
+         hassepaabove = TRUE;
+
+      /* save more sepa information for statistics */
+      if( ((nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPABELOW) && !sepabelowusesactivity) ||
+          ((nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPAABOVE) && !sepaaboveusesactivity) )
+         hasconvexsepa = TRUE;
+
+      if( ((nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPABELOW) && sepabelowusesactivity) ||
+          ((nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPAABOVE) && sepaaboveusesactivity) )
+         hasnonconvexsepa = TRUE;
+   }
+
+   /* get varexprs */
+   SCIP_CALL( SCIPgetConsExprExprNVars(scip, conshdlr, expr, &nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &vars, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varexprs, nvars) );
+   SCIP_CALL( SCIPgetConsExprExprVarExprs(scip, conshdlr, expr, varexprs, &nvars) );
+   for( i = 0; i < nvars; ++i )
+   {
+      vars[i] = SCIPgetConsExprExprVarVar(varexprs[i]);
+      SCIP_CALL( SCIPreleaseConsExprExpr(scip, &varexprs[i]) );
+      SCIP_CALL( SCIPcaptureVar(scip, vars[i]) );
+   }
+   SCIPsortPtr((void**) vars, SCIPvarComp, nvars);
+   SCIPfreeBufferArray(scip, &varexprs);
+
+   if( nlhdlrdata->scvars == NULL )
+   {
+      SCIP_CALL( createSCVarData(scip, &nlhdlrdata->scvars, nlhdlrdata->eventhdlr) );
+   }
+   else
+   {
+      updateSCVarDataRun(scip, nlhdlrdata->scvars);
+   }
+
+   if( cons != NULL && SCIPgetSubscipDepth(scip) == 0 && nlhdlrdata->bigmcuts )
+   {
+      SCIP_CALL( consIsBigM(scip, conshdlr, nlhdlr, cons, expr, vars, nvars, hasnondefault, &bigm) );
+   }
+
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
+   }
+   SCIPfreeBlockMemoryArray(scip, &vars, nvars);
+
+   /* If no other nlhdlr separates, neither does perspective (if convexonly, only separation
+    * without using activity counts)
+    */
+   if( !hassepabelow && !hassepaabove )
+   {
+      SCIPdebugMsg(scip, "no nlhdlr separates without using activity, not running perspective detection\n");
+      return SCIP_OKAY;
+   }
+
+   /* If a sum expression is handled only by default nlhdlr, then all the children will have auxiliary vars.
+    * Since the sum will then be linear in auxiliary variables, perspective can't improve anything for it
+    */
+   if( SCIPgetConsExprExprHdlr(expr) == SCIPgetConsExprExprHdlrSum(conshdlr) && !hasnondefault )
+   {
+      SCIPdebugMsg(scip, "sum expr only has default exprhdlr, not running perspective detection\n");
+      return SCIP_OKAY;
+   }
+
+#ifdef SCIP_DEBUG
+   SCIPdebugMsg(scip, "Called perspective detect, expr = %p: ", expr);
+   SCIPprintConsExprExpr(scip, conshdlr, expr, NULL);
+   SCIPdebugMsgPrint(scip, "\n");
+#endif
+
+   /* allocate memory */
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, nlhdlrexprdata) );
+#ifdef SCIP_DISABLED_CODE
+   /* move this up for the purposes of consIsBigM */
+   if( nlhdlrdata->scvars == NULL )
+   {
+      SCIP_CALL( createSCVarData(scip, &nlhdlrdata->scvars, nlhdlrdata->eventhdlr) );
+   }
+#endif
+
+   /* save varexprs to nlhdlrexprdata */
+   SCIP_CALL( SCIPgetConsExprExprNVars(scip, conshdlr, expr, &(*nlhdlrexprdata)->nvars) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*nlhdlrexprdata)->vars, (*nlhdlrexprdata)->nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &varexprs, (*nlhdlrexprdata)->nvars) );
+   (*nlhdlrexprdata)->varssize = (*nlhdlrexprdata)->nvars;
+   SCIP_CALL( SCIPgetConsExprExprVarExprs(scip, conshdlr, expr, varexprs, &(*nlhdlrexprdata)->nvars) );
+   for( i = 0; i < (*nlhdlrexprdata)->nvars; ++i )
+   {
+      (*nlhdlrexprdata)->vars[i] = SCIPgetConsExprExprVarVar(varexprs[i]);
+      SCIP_CALL( SCIPreleaseConsExprExpr(scip, &varexprs[i]) );
+      SCIP_CALL( SCIPcaptureVar(scip, (*nlhdlrexprdata)->vars[i]) );
+   }
+   SCIPsortPtr((void**) (*nlhdlrexprdata)->vars, SCIPvarComp, (*nlhdlrexprdata)->nvars);
+   SCIPfreeBufferArray(scip, &varexprs);
+
+   /* check if expr is semicontinuous and save indicator variables */
+   SCIP_CALL( exprIsSemicontinuous(scip, conshdlr, nlhdlrdata, *nlhdlrexprdata, expr, &success) );
+
+   if( !success && SCIPgetConsExprExprBigM(expr) )
+   {
+      /* expr is not semicontinuous, but can be treated as such due to participating in a big-M constraint */
+      ++(nlhdlrdata->nonlybigmdetects);
+      success = TRUE;
+      (*nlhdlrexprdata)->onlybigm = TRUE;
+   }
+
+   if( success )
+   {
+      assert(*nlhdlrexprdata != NULL);
+      assert((*nlhdlrexprdata)->nindicators > 0 || SCIPgetConsExprExprBigM(expr));
+
+      if( hassepaabove )
+         *participating |= SCIP_CONSEXPR_EXPRENFO_SEPAABOVE;
+      if( hassepabelow )
+         *participating |= SCIP_CONSEXPR_EXPRENFO_SEPABELOW;
+
+      ++(nlhdlrdata->ndetects);
+
+      if( hasconvexsepa )
+         ++(nlhdlrdata->nconvexdetects);
+      if( hasnonconvexsepa && !nlhdlrdata->convexonly )
+         ++(nlhdlrdata->nnonconvexdetects);
+
+#ifdef SCIP_DEBUG
+      SCIPinfoMessage(scip, NULL, "detected an on/off expr: ");
+      SCIPprintConsExprExpr(scip, conshdlr, expr, NULL);
+      SCIPinfoMessage(scip, NULL, "\n");
+#endif
+   }
+   else if( *nlhdlrexprdata != NULL )
+   {
+      SCIP_CALL( nlhdlrFreeExprDataPerspective(scip, nlhdlr, expr, nlhdlrexprdata) );
+   }
+
+   return SCIP_OKAY;
+}
+
+
+/** auxiliary evaluation callback of nonlinear handler */
+static
+SCIP_DECL_CONSEXPR_NLHDLREVALAUX(nlhdlrEvalauxPerspective)
+{ /*lint --e{715}*/
+   int e;
+   SCIP_Real maxdiff;
+   SCIP_Real auxvarvalue;
+   SCIP_Real enfoauxval;
+
+   assert(scip != NULL);
+   assert(expr != NULL);
+   assert(auxvalue != NULL);
+
+   auxvarvalue = SCIPgetSolVal(scip, sol, SCIPgetConsExprExprAuxVar(expr));
+   maxdiff = 0.0;
+   *auxvalue = auxvarvalue;
+
+   /* use the auxvalue from one of the other nlhdlrs that estimates for this expr: take the one that is farthest
+    * from the current value of auxvar
+    */
+   for( e = 0; e < SCIPgetConsExprExprNEnfos(expr); ++e )
+   {
+      SCIP_CONSEXPR_NLHDLR* nlhdlr2;
+      SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlr2exprdata;
+      SCIP_CONSEXPR_EXPRENFO_METHOD nlhdlr2participation;
+
+      SCIPgetConsExprExprEnfoData(expr, e, &nlhdlr2, &nlhdlr2exprdata, &nlhdlr2participation, NULL, NULL, NULL);
+
+      /* skip nlhdlr that do not participate or do not provide estimate */
+      if( (nlhdlr2participation & SCIP_CONSEXPR_EXPRENFO_SEPABOTH) == 0 || !SCIPhasConsExprNlhdlrEstimate(nlhdlr2) )
+         continue;
+
+      SCIP_CALL( SCIPevalauxConsExprNlhdlr(scip, nlhdlr2, expr, nlhdlr2exprdata, &enfoauxval, sol) );
+
+      SCIPsetConsExprExprEnfoAuxValue(expr, e, enfoauxval);
+
+      if( REALABS(enfoauxval - auxvarvalue) > maxdiff && enfoauxval != SCIP_INVALID ) /*lint !e777*/
+      {
+         maxdiff = REALABS(enfoauxval - auxvarvalue);
+         *auxvalue = enfoauxval;
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
+/** separation initialization method of a nonlinear handler */
+static
+SCIP_DECL_CONSEXPR_NLHDLRINITSEPA(nlhdlrInitSepaPerspective)
+{ /*lint --e{715}*/
+   int sindicators;
+   SCIP_CONSEXPR_EXPR* curexpr;
+   SCIP_VAR* var;
+   int i;
+   SCIP_CONSEXPR_BNDDATA scdata;
+   int nvars;
+   SCIP_VAR** vars;
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   SCIP_VAR** scauxvars;
+   int nscauxvars;
+   SCIP_Real* auxvals0;
+
+   sindicators = nlhdlrexprdata->nindicators;
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+
+   /* save auxiliary variables */
+   SCIP_CALL( saveAuxVars(scip, conshdlr, SCIPgetConsExprNlhdlrData(nlhdlr), nlhdlrexprdata, expr) );
+
+   /* compute 'off' values of expr and subexprs (and thus auxvars too) */
+   SCIP_CALL( SCIPstartClock(scip, nlhdlrdata->offvaluestime) );
+   SCIP_CALL( computeOffValues(scip, conshdlr, nlhdlrdata, nlhdlrexprdata, expr) );
+   SCIP_CALL( SCIPstopClock(scip, nlhdlrdata->offvaluestime) );
+
+   nvars = nlhdlrexprdata->nvars;
+   vars = nlhdlrexprdata->vars;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &scdata.vars, nvars + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &scdata.lbs, nvars + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &scdata.ubs, nvars + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &scauxvars, nvars + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &auxvals0, nvars + 1) );
+
+   /* for each indicator, do propagation at 0 to add any remaining semi-continuous auxvars */
+   for( i = 0; i < SCIPgetConsExprExprNBigMIndicators(expr); ++i )
+   {
+      SCIP_Bool indincons = FALSE; /* whether indicator is one of the cons vars */
+      int v;
+      SCIP_VAR* indicator = SCIPgetConsExprExprBigMIndicators(expr)[i];
+      SCIP_Bool cutoff;
+
+      /* fill in intevalvardata */
+      for( v = 0; v < nvars; ++v )
+      {
+         int pos;
+
+         scdata.vars[v] = vars[v];
+
+         if( getSCVarDataInd(nlhdlrdata->scvars, vars[v], indicator, &pos) )
+         {
+            scdata.lbs[v] = nlhdlrdata->scvars->vals0[pos];
+            scdata.ubs[v] = nlhdlrdata->scvars->vals0[pos];
+         }
+         else if( vars[v] == indicator )
+         {
+            indincons = TRUE;
+            scdata.lbs[v] = 0.0;
+            scdata.ubs[v] = 0.0;
+         }
+         else
+         {
+            scdata.lbs[v] = SCIPvarGetLbGlobal(vars[v]);
+            scdata.ubs[v] = SCIPvarGetUbGlobal(vars[v]);
+         }
+      }
+
+      if( !indincons )
+      {
+         scdata.vars[nvars] = indicator;
+         scdata.lbs[nvars] = 0.0;
+         scdata.ubs[nvars] = 0.0;
+         scdata.nvars = nvars+1;
+      }
+      else
+      {
+         scdata.vars[nvars] = NULL;
+         scdata.nvars = nvars;
+      }
+
+      nscauxvars = 0;
+
+      /* evaluate expression activity at 0 and get bounds on auxiliary variables */
+      SCIP_CALL( SCIPcomputeZeroAuxValues(scip, conshdlr, expr, &cutoff, &scdata, scauxvars, &nscauxvars, auxvals0) );
+
+      /* save any newly detected semicontinuous variables */
+      for( v = 0; v < nscauxvars; ++v )
+      {
+         SCIP_CALL( addSCVarIndicator(scip, nlhdlrdata->scvars, scauxvars[v], indicator, auxvals0[v], SCIPvarGetLbGlobal(scauxvars[v]), SCIPvarGetUbGlobal(scauxvars[v])) );
+      }
+   } /* indicator */
+
+   /* some indicator variables might have been removed if evaluation failed, check how many remain */
+   if( nlhdlrexprdata->nindicators == 0 )
+   {
+      SCIPfreeBlockMemoryArray(scip, &nlhdlrexprdata->indicators, sindicators);
+      SCIPfreeBlockMemoryArray(scip, &nlhdlrexprdata->exprvals0, sindicators);
+   }
+   else if( nlhdlrexprdata->nindicators < sindicators )
+   {
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->indicators, sindicators, nlhdlrexprdata->nindicators) );
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->exprvals0, sindicators, nlhdlrexprdata->nindicators) );
+   }
+
+   /* remember which expressions depend on which indicators for batched probing */
+   SCIP_CALL( registerIndicatorExpr(scip, nlhdlrdata, nlhdlrexprdata, expr) );
+
+   SCIPfreeBufferArray(scip, &auxvals0);
+   SCIPfreeBufferArray(scip, &scauxvars);
+   SCIPfreeBufferArray(scip, &scdata.ubs);
+   SCIPfreeBufferArray(scip, &scdata.lbs);
+   SCIPfreeBufferArray(scip, &scdata.vars);
+
+   return SCIP_OKAY;
+}
+
+
+/** separation deinitialization method of a nonlinear handler (called during CONSEXITSOL) */
+#if 0
+static
+SCIP_DECL_CONSEXPR_NLHDLREXITSEPA(nlhdlrExitSepaPerspective)
+{ /*lint --e{715}*/
+   SCIPerrorMessage("method of perspective nonlinear handler not implemented yet\n");
+   SCIPABORT(); /*lint --e{527}*/
+
+   return SCIP_OKAY;
+}
+#endif
+
+static
+SCIP_RETCODE computeIndicatorCoef(
+   SCIP*                 scip,
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata,
+   SCIP_ROWPREP*         rowprep,
+   SCIP_VAR*             auxvar,
+   SCIP_VAR*             indicator,
+   SCIP_Bool             max,
+   SCIP_Real*            cst0,
+   SCIP_INTERVAL         activity
+   )
+{
+   SCIP_Bool allfixed;
+   int i;
+   int j;
+   SCIP_VAR* var;
+   SCIP_Real cutval_min;
+   SCIP_Real cutval_max;
+
+   *cst0 = SCIP_INVALID;
+
+   /* assemble box */
+   allfixed = TRUE;
+   cutval_min = -rowprep->side;
+   cutval_max = -rowprep->side;
+   for( i = 0; i < rowprep->nvars; ++i )
+   {
+      SCIP_Real vlb;
+      SCIP_Real vub;
+      int pos;
+
+      var = rowprep->vars[i];
+      assert(var != NULL);
+
+      if( getSCVarDataInd(nlhdlrdata->scvars, var, indicator, &pos) )
+      {
+         vlb = nlhdlrdata->scvars->vals0[pos];
+         vub = nlhdlrdata->scvars->vals0[pos];
+      }
+      else if( var == indicator )
+      {
+         vlb = 0.0;
+         vub = 0.0;
+      }
+      else
+      {
+         vlb = SCIPvarGetLbLocal(var);
+         vub = SCIPvarGetUbLocal(var);
+      }
+
+      if( var == auxvar )
+      {
+         vlb = MAX(vlb, SCIPintervalGetInf(activity));
+         vub = MAX(vub, SCIPintervalGetSup(activity));
+      }
+
+      SCIPdebugMsg(scip, "\nbounds on %s (index %d) at 0 are [%g,%g]", SCIPvarGetName(var), i, vlb, vub);
+
+      if( SCIPisInfinity(scip, vub) || SCIPisInfinity(scip, -vlb) )
+      {
+         SCIPdebugMsg(scip, "bound at infinity, no bigm cut strengthening possible\n");
+         return SCIP_OKAY;
+      }
+
+      if( !SCIPisRelEQ(scip, vlb, vub) )
+         allfixed = FALSE;
+
+      if( rowprep->coefs[i] > 0 )
+      {
+         cutval_min += rowprep->coefs[i] * vlb;
+         cutval_max += rowprep->coefs[i] * vub;
+      }
+      else
+      {
+         cutval_min += rowprep->coefs[i] * vub;
+         cutval_max += rowprep->coefs[i] * vlb;
+      }
+   }
+
+   if( allfixed )
+   {
+      SCIPdebugMsg(scip, "all variables fixed, skip big-M perspectify (it should have been handled as semi-continuous)\n");
+      return SCIP_OKAY;
+   }
+
+   *cst0 = rowprep->sidetype == SCIP_SIDETYPE_RIGHT ? -cutval_max : -cutval_min;
+   SCIPdebugMsg(scip, "\ncst0 = %g", *cst0);
+
+   return SCIP_OKAY;
+}
+
+/** finds the nonlinear handlers whose estimators can be perspectivied for an expression
+ *
+ * Also decides whether the violation is large enough for probing to be useful.
+ * If evalaux is TRUE, then the auxiliary values of the other nonlinear handlers are recomputed first, since the
+ * values stored in the expression are only up to date if enforcement was called for this expression.
+ */
+static
+SCIP_RETCODE collectEnfoNlhdlrs(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_CONSEXPR_NLHDLR* nlhdlr,             /**< perspective nonlinear handler */
+   SCIP_CONSEXPR_EXPR*   expr,               /**< expression */
+   SCIP_SOL*             sol,                /**< solution to be separated */
+   SCIP_Bool             overestimate,       /**< whether the expression needs to be overestimated */
+   SCIP_Bool             allowweakcuts,      /**< whether we allow for weak cuts */
+   SCIP_Bool             evalaux,            /**< whether the auxiliary values of the nonlinear handlers need to be computed */
+   int*                  enfoposs,           /**< array to store the positions of suitable enforcements */
+   int*                  nenfos,             /**< pointer to store the number of suitable enforcements */
+   SCIP_Bool*            doprobing           /**< pointer to store whether probing could be useful */
+   )
+{
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   int j;
+
+   assert(enfoposs != NULL);
+   assert(nenfos != NULL);
+   assert(doprobing != NULL);
+
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   assert(nlhdlrdata != NULL);
+
+   *doprobing = FALSE;
+   *nenfos = 0;
+
+   /* find suitable nlhdlrs and check if there is enough violation to do probing */
+   for( j = 0; j < SCIPgetConsExprExprNEnfos(expr); ++j )
+   {
+      SCIP_CONSEXPR_NLHDLR* nlhdlr2;
+      SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlr2exprdata;
+      SCIP_CONSEXPR_EXPRENFO_METHOD nlhdlr2participate;
+      SCIP_Real nlhdlr2auxvalue;
+      SCIP_Real violation;
+      SCIP_Bool violbelow;
+      SCIP_Bool violabove;
+      SCIP_Bool sepausesactivity = FALSE;
+
+      SCIPgetConsExprExprEnfoData(expr, j, &nlhdlr2, &nlhdlr2exprdata, &nlhdlr2participate, !overestimate ? &sepausesactivity : NULL, overestimate ? &sepausesactivity: NULL, &nlhdlr2auxvalue);  /*lint !e826*/
+
+      if( nlhdlr2 == nlhdlr )
+         continue;
+
+      /* if nlhdlr2 cannot estimate, then cannot use it */
+      if( !SCIPhasConsExprNlhdlrEstimate(nlhdlr2) )
+         continue;
+
+      /* if nlhdlr2 does not participate in the separation on the desired side (overestimate), then skip it */
+      if( (nlhdlr2participate & (overestimate ? SCIP_CONSEXPR_EXPRENFO_SEPAABOVE : SCIP_CONSEXPR_EXPRENFO_SEPABELOW)) == 0 )
+         continue;
+
+      /* if only working on convex-looking expressions, then skip nlhdlr if it uses activity for estimates */
+      if( nlhdlrdata->convexonly && sepausesactivity )
+         continue;
+
+      if( evalaux )
+      {
+         SCIP_CALL( SCIPevalauxConsExprNlhdlr(scip, nlhdlr2, expr, nlhdlr2exprdata, &nlhdlr2auxvalue, sol) );
+         SCIPsetConsExprExprEnfoAuxValue(expr, j, nlhdlr2auxvalue);
+
+         if( nlhdlr2auxvalue == SCIP_INVALID ) /*lint !e777*/
+            continue;
+      }
+
+      /* evalaux should have called evalaux of nlhdlr2 by now
+       * check whether handling the violation for nlhdlr2 requires under- or overestimation and this fits to overestimate flag
+       */
+      SCIP_CALL( SCIPgetConsExprExprAbsAuxViolation(scip, conshdlr, expr, nlhdlr2auxvalue,
+            sol, &violation, &violbelow, &violabove) );
+      assert(violation >= 0.0);
+
+      if( (overestimate && !violabove) || (!overestimate && !violbelow) )
+         continue;
+
+      /* if violation is small, cuts would likely be weak - skip perspectification */
+      if( !allowweakcuts && violation < SCIPfeastol(scip) )
+         continue;
+
+      enfoposs[*nenfos] = j;
+      ++(*nenfos);
+
+      /* enable probing if tightening the domain could be useful for nlhdlr and violation is above threshold */
+      if( sepausesactivity && violation >= nlhdlrdata->minviolprobing )
+         *doprobing = TRUE;
    }
 
-   SCIPfreeBlockMemoryArrayNull(scip, &indicators, indicatorssize);
-   SCIPfreeBufferArray(scip, &scvdatas);
-
    return SCIP_OKAY;
 }
 
-/** callback to detect structure in expression tree
+/** checks whether an expression is a univariate function of a variable for which the perspective of a tangent can
+ *  be computed in closed form
  *
- *  We are looking for expressions g(x), where x is a vector of semicontinuous variables that all share at least one
- *  indicator variable.
+ * This is the case for exp(x), x^p and -x*log(x) if the function is convex (when underestimating) or concave
+ * (when overestimating) on the global domain of x.
  */
 static
-SCIP_DECL_CONSEXPR_NLHDLRDETECT(nlhdlrDetectPerspective)
-{ /*lint --e{715}*/
-   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
-   SCIP_CONSEXPR_EXPR** varexprs;
-   SCIP_Bool success = FALSE;
-   int i;
-   SCIP_Bool hassepabelow = FALSE;
-   SCIP_Bool hassepaabove = FALSE;
-   SCIP_Bool hasnondefault = FALSE;
-   /* some variables for statistics */
-   SCIP_Bool hasconvexsepa = FALSE;
-   SCIP_Bool hasnonconvexsepa = FALSE;
-   SCIP_Bool bigm = FALSE;
-   int nvars;
-   SCIP_VAR** vars;
+SCIP_Bool hasClosedFormTangent(
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_CONSEXPR_EXPR*   expr,               /**< expression */
+   SCIP_Bool             overestimate,       /**< whether the expression needs to be overestimated */
+   SCIP_VAR**            var                 /**< buffer to store the argument of the function */
+   )
+{
+   SCIP_CONSEXPR_EXPRHDLR* exprhdlr;
+   SCIP_CONSEXPR_EXPR* child;
+   SCIP_Bool convex;
+   SCIP_Bool concave;
+   SCIP_Real lb;
 
-   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   assert(var != NULL);
 
-   assert(scip != NULL);
-   assert(nlhdlr != NULL);
-   assert(expr != NULL);
-   assert(participating != NULL);
-   assert(enforcing != NULL);
-   assert(nlhdlrexprdata != NULL);
-   assert(nlhdlrdata != NULL);
+   *var = NULL;
 
-   /* do not run if we will have no auxvar to add a cut for */
-   if( SCIPgetConsExprExprNAuxvarUses(expr) == 0 )
-      return SCIP_OKAY;
+   if( SCIPgetConsExprExprNChildren(expr) != 1 )
+      return FALSE;
 
-   if( SCIPgetNBinVars(scip) == 0 )
+   child = SCIPgetConsExprExprChildren(expr)[0];
+   if( !SCIPisConsExprExprVar(child) )
+      return FALSE;
+
+   lb = SCIPvarGetLbGlobal(SCIPgetConsExprExprVarVar(child));
+   exprhdlr = SCIPgetConsExprExprHdlr(expr);
+   convex = FALSE;
+   concave = FALSE;
+
+   if( exprhdlr == SCIPgetConsExprExprHdlrExponential(conshdlr) )
    {
-      SCIPdebugMsg(scip, "problem has no binary variables, not running perspective detection\n");
-      return SCIP_OKAY;
+      convex = TRUE;
    }
+   else if( exprhdlr == SCIPgetConsExprExprHdlrPower(conshdlr) )
+   {
+      SCIP_Real exponent;
 
-   for( i = 0; i < SCIPgetConsExprExprNEnfos(expr); ++i )
+      exponent = SCIPgetConsExprExprPowExponent(expr);
+
+      /* x^p is convex on R for even integer p; for x >= 0 it is convex for p >= 1 and concave for 0 < p < 1 */
+      if( exponent > 0.0 && EPSISINT(exponent / 2.0, 0.0) ) /*lint !e835*/
+         convex = TRUE;
+      else if( lb >= 0.0 && exponent >= 1.0 )
+         convex = TRUE;
+      else if( lb >= 0.0 && exponent > 0.0 )
+         concave = TRUE;
+   }
+   else if( exprhdlr == SCIPgetConsExprExprHdlrEntropy(conshdlr) && lb >= 0.0 )
    {
-      SCIP_CONSEXPR_NLHDLR* nlhdlr2;
-      SCIP_CONSEXPR_EXPRENFO_METHOD nlhdlr2participates;
-      SCIP_Bool sepabelowusesactivity;
-      SCIP_Bool sepaaboveusesactivity;
-      SCIPgetConsExprExprEnfoData(expr, i, &nlhdlr2, NULL, &nlhdlr2participates, &sepabelowusesactivity, &sepaaboveusesactivity, NULL);
+      concave = TRUE;
+   }
 
-      if( (nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPABOTH) == 0 )
-         continue;
+   if( (overestimate && !concave) || (!overestimate && !convex) )
+      return FALSE;
 
-      if( !SCIPhasConsExprNlhdlrEstimate(nlhdlr2) )
-         continue;
+   *var = SCIPgetConsExprExprVarVar(child);
 
-      if( strcmp(SCIPgetConsExprNlhdlrName(nlhdlr2), "default") != 0 )
-         hasnondefault = TRUE;
+   return TRUE;
+}
 
-      /* If we are supposed to run only on convex expressions, than check whether there is a nlhdlr
-       * that participates in separation without using activity for it. Otherwise, check for
-       * participation regardless of activity usage.
-       */
-      if( (nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPABELOW) && (!nlhdlrdata->convexonly || !sepabelowusesactivity) )
-         hassepabelow = TRUE;
+/** computes the perspective of a tangent of a univariate function f(x) in closed form
+ *
+ * The tangent at the reference point x^ is f(x^) + f'(x^)(x - x^). As in estimatePerspective, it is perspectivied
+ * by adding (1-z)(f(x0) - f(x^) + f'(x^)(x^ - x0)) if this strengthens it; otherwise the plain tangent is used. This avoids asking other nonlinear handlers for estimators and,
+ * since the tangent does not depend on the bounds of x, it also makes probing unnecessary.
+ *
+ * The cut is stored in rowpreps at position *nrowpreps. If no cut could be computed, success is set to FALSE.
+ */
+static
+SCIP_RETCODE estimateClosedForm(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata,     /**< nonlinear handler data */
+   SCIP_CONSEXPR_EXPR*   expr,               /**< expression */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   int                   indpos,             /**< position of the indicator in nlhdlrexprdata->indicators */
+   SCIP_VAR*             var,                /**< argument of the function, as found by hasClosedFormTangent */
+   SCIP_SOL*             sol,                /**< solution to be separated */
+   SCIP_Bool             overestimate,       /**< whether the expression needs to be overestimated */
+   SCIP_PTRARRAY*        rowpreps,           /**< array to store the perspectivied cuts */
+   SCIP_BOOLARRAY*       addedbranchscores2, /**< array to store whether branching scores were added for the cuts */
+   int*                  nrowpreps,          /**< pointer to number of entries in rowpreps, will be updated */
+   SCIP_Bool*            success             /**< buffer to store whether a cut was computed */
+   )
+{
+   SCIP_CONSEXPR_EXPRHDLR* exprhdlr;
+   SCIP_ROWPREP* rowprep;
+   SCIP_VAR* indicator;
+   SCIP_Real refpoint;
+   SCIP_Real val0;
+   SCIP_Real fval;
+   SCIP_Real deriv;
+   SCIP_Real cst0;
+   SCIP_Bool perspectivy;
+   int pos;
 
-      if( (nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPAABOVE) && (!nlhdlrdata->convexonly || !sepaaboveusesactivity) )
-         hassepaabove = TRUE;
+   assert(success != NULL);
 
-      /* save more sepa information for statistics */
-      if( ((nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPABELOW) && !sepabelowusesactivity) ||
-          ((nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPAABOVE) && !sepaaboveusesactivity) )
-         hasconvexsepa = TRUE;
+   *success = FALSE;
+   indicator = nlhdlrexprdata->indicators[indpos];
 
-      if( ((nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPABELOW) && sepabelowusesactivity) ||
-          ((nlhdlr2participates & SCIP_CONSEXPR_EXPRENFO_SEPAABOVE) && sepaaboveusesactivity) )
-         hasnonconvexsepa = TRUE;
-   }
+   if( !getSCVarDataInd(nlhdlrdata->scvars, var, indicator, &pos) )
+      return SCIP_OKAY;
 
-   /* get varexprs */
-   SCIP_CALL( SCIPgetConsExprExprNVars(scip, conshdlr, expr, &nvars) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &vars, nvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &varexprs, nvars) );
-   SCIP_CALL( SCIPgetConsExprExprVarExprs(scip, conshdlr, expr, varexprs, &nvars) );
-   for( i = 0; i < nvars; ++i )
-   {
-      vars[i] = SCIPgetConsExprExprVarVar(varexprs[i]);
-      SCIP_CALL( SCIPreleaseConsExprExpr(scip, &varexprs[i]) );
-      SCIP_CALL( SCIPcaptureVar(scip, vars[i]) );
-   }
-   SCIPsortPtr((void**) vars, SCIPvarComp, nvars);
-   SCIPfreeBufferArray(scip, &varexprs);
+   val0 = nlhdlrdata->scvars->vals0[pos];
+   refpoint = SCIPgetSolVal(scip, sol, var);
 
-   if( nlhdlrdata->scvars == NULL )
+   if( nlhdlrdata->adjrefpoint )
    {
-      SCIP_CALL( SCIPhashmapCreate(&(nlhdlrdata->scvars), SCIPblkmem(scip), SCIPgetNVars(scip)) );
+      /* x^adj = (x* - x0) / z* + x0, see estimatePerspective */
+      refpoint = (refpoint - val0) / MAX(SCIPgetSolVal(scip, sol, indicator), 0.1) + val0;
    }
 
-   if( cons != NULL && SCIPgetSubscipDepth(scip) == 0 && nlhdlrdata->bigmcuts )
-   {
-      SCIP_CALL( consIsBigM(scip, conshdlr, nlhdlr, cons, expr, vars, nvars, hasnondefault, &bigm) );
-   }
+   /* the tangent is only needed at points that x can take when the indicator is 1 */
+   refpoint = MAX(refpoint, nlhdlrdata->scvars->lbs1[pos]);
+   refpoint = MIN(refpoint, nlhdlrdata->scvars->ubs1[pos]);
 
-   for( i = 0; i < nvars; ++i )
-   {
-      SCIP_CALL( SCIPreleaseVar(scip, &vars[i]) );
-   }
-   SCIPfreeBlockMemoryArray(scip, &vars, nvars);
+   exprhdlr = SCIPgetConsExprExprHdlr(expr);
 
-   /* If no other nlhdlr separates, neither does perspective (if convexonly, only separation
-    * without using activity counts)
-    */
-   if( !hassepabelow && !hassepaabove )
+   if( exprhdlr == SCIPgetConsExprExprHdlrExponential(conshdlr) )
    {
-      SCIPdebugMsg(scip, "no nlhdlr separates without using activity, not running perspective detection\n");
-      return SCIP_OKAY;
+      fval = exp(refpoint);
+      deriv = fval;
    }
-
-   /* If a sum expression is handled only by default nlhdlr, then all the children will have auxiliary vars.
-    * Since the sum will then be linear in auxiliary variables, perspective can't improve anything for it
-    */
-   if( SCIPgetConsExprExprHdlr(expr) == SCIPgetConsExprExprHdlrSum(conshdlr) && !hasnondefault )
+   else if( exprhdlr == SCIPgetConsExprExprHdlrPower(conshdlr) )
    {
-      SCIPdebugMsg(scip, "sum expr only has default exprhdlr, not running perspective detection\n");
-      return SCIP_OKAY;
-   }
+      SCIP_Real exponent;
 
-#ifdef SCIP_DEBUG
-   SCIPdebugMsg(scip, "Called perspective detect, expr = %p: ", expr);
-   SCIPprintConsExprExpr(scip, conshdlr, expr, NULL);
-   SCIPdebugMsgPrint(scip, "\n");
-#endif
+      exponent = SCIPgetConsExprExprPowExponent(expr);
 
-   /* allocate memory */
-   SCIP_CALL( SCIPallocClearBlockMemory(scip, nlhdlrexprdata) );
-#ifdef SCIP_DISABLED_CODE
-   /* move this up for the purposes of consIsBigM */
-   if( nlhdlrdata->scvars == NULL )
-   {
-      SCIP_CALL( SCIPhashmapCreate(&(nlhdlrdata->scvars), SCIPblkmem(scip), SCIPgetNVars(scip)) );
-   }
-#endif
+      if( !EPSISINT(exponent / 2.0, 0.0) ) /*lint !e835*/
+      {
+         /* the function is only defined for x >= 0 and the derivative of x^p, p < 1, is not finite at 0 */
+         if( refpoint <= 0.0 && exponent < 1.0 )
+            return SCIP_OKAY;
+         refpoint = MAX(refpoint, 0.0);
+      }
 
-   /* save varexprs to nlhdlrexprdata */
-   SCIP_CALL( SCIPgetConsExprExprNVars(scip, conshdlr, expr, &(*nlhdlrexprdata)->nvars) );
-   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(*nlhdlrexprdata)->vars, (*nlhdlrexprdata)->nvars) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &varexprs, (*nlhdlrexprdata)->nvars) );
-   (*nlhdlrexprdata)->varssize = (*nlhdlrexprdata)->nvars;
-   SCIP_CALL( SCIPgetConsExprExprVarExprs(scip, conshdlr, expr, varexprs, &(*nlhdlrexprdata)->nvars) );
-   for( i = 0; i < (*nlhdlrexprdata)->nvars; ++i )
-   {
-      (*nlhdlrexprdata)->vars[i] = SCIPgetConsExprExprVarVar(varexprs[i]);
-      SCIP_CALL( SCIPreleaseConsExprExpr(scip, &varexprs[i]) );
-      SCIP_CALL( SCIPcaptureVar(scip, (*nlhdlrexprdata)->vars[i]) );
+      fval = pow(refpoint, exponent);
+      deriv = exponent * pow(refpoint, exponent - 1.0);
    }
-   SCIPsortPtr((void**) (*nlhdlrexprdata)->vars, SCIPvarComp, (*nlhdlrexprdata)->nvars);
-   SCIPfreeBufferArray(scip, &varexprs);
+   else
+   {
+      assert(exprhdlr == SCIPgetConsExprExprHdlrEntropy(conshdlr));
 
-   /* check if expr is semicontinuous and save indicator variables */
-   SCIP_CALL( exprIsSemicontinuous(scip, conshdlr, nlhdlrdata, *nlhdlrexprdata, expr, &success) );
+      /* the derivative of -x*log(x) is not finite at 0 */
+      if( refpoint <= 0.0 )
+         return SCIP_OKAY;
 
-   if( !success && SCIPgetConsExprExprBigM(expr) )
-   {
-      /* expr is not semicontinuous, but can be treated as such due to participating in a big-M constraint */
-      ++(nlhdlrdata->nonlybigmdetects);
-      success = TRUE;
-      (*nlhdlrexprdata)->onlybigm = TRUE;
+      fval = -refpoint * log(refpoint);
+      deriv = -log(refpoint) - 1.0;
    }
 
-   if( success )
-   {
-      assert(*nlhdlrexprdata != NULL);
-      assert((*nlhdlrexprdata)->nindicators > 0 || SCIPgetConsExprExprBigM(expr));
+   if( !SCIPisFinite(fval) || !SCIPisFinite(deriv) || SCIPisInfinity(scip, REALABS(fval))
+      || SCIPisInfinity(scip, REALABS(deriv)) )
+      return SCIP_OKAY;
 
-      if( hassepaabove )
-         *participating |= SCIP_CONSEXPR_EXPRENFO_SEPAABOVE;
-      if( hassepabelow )
-         *participating |= SCIP_CONSEXPR_EXPRENFO_SEPABELOW;
+   /* cst0 = g0 - c - a*x0 with c = f(x^) - f'(x^)x^ and a = f'(x^) */
+   cst0 = nlhdlrexprdata->exprvals0[indpos] - fval + deriv * (refpoint - val0);
 
-      ++(nlhdlrdata->ndetects);
+   /* only perspectivy when it strengthens the cut and when the absolute value of cst0 is not too small, see
+    * estimatePerspective; otherwise the plain tangent is used
+    */
+   perspectivy = (overestimate ? SCIPisNegative(scip, cst0) : SCIPisPositive(scip, cst0))
+      && REALABS(deriv) / REALABS(cst0) <= SCIP_CONSEXPR_CUTMAXRANGE;
 
-      if( hasconvexsepa )
-         ++(nlhdlrdata->nconvexdetects);
-      if( hasnonconvexsepa && !nlhdlrdata->convexonly )
-         ++(nlhdlrdata->nnonconvexdetects);
+   SCIP_CALL( SCIPcreateRowprepFromPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, FALSE) );
+   (void) SCIPsnprintf(rowprep->name, SCIP_MAXSTRLEN, "%sestimate_closedform%p", overestimate ? "over" : "under",
+         (void*)expr);
 
-#ifdef SCIP_DEBUG
-      SCIPinfoMessage(scip, NULL, "detected an on/off expr: ");
-      SCIPprintConsExprExpr(scip, conshdlr, expr, NULL);
-      SCIPinfoMessage(scip, NULL, "\n");
-#endif
-   }
-   else if( *nlhdlrexprdata != NULL )
+   SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, var, deriv) );
+   SCIPaddRowprepConstant(rowprep, fval - deriv * refpoint);
+   if( perspectivy )
    {
-      SCIP_CALL( nlhdlrFreeExprDataPerspective(scip, nlhdlr, expr, nlhdlrexprdata) );
+      /* add cst0 - cst0*z */
+      SCIPaddRowprepConstant(rowprep, cst0);
+      SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, indicator, -cst0) );
    }
+   SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, SCIPgetConsExprExprAuxVar(expr), -1.0) );
+
+   SCIPdebugMsg(scip, "closed-form perspective cut: \n");
+#ifdef SCIP_DEBUG
+   SCIPprintRowprep(scip, rowprep, NULL);
+#endif
+
+   SCIP_CALL( SCIPsetPtrarrayVal(scip, rowpreps, *nrowpreps, rowprep) );
+   SCIP_CALL( SCIPsetBoolarrayVal(scip, addedbranchscores2, *nrowpreps, FALSE) );
+   ++(*nrowpreps);
+
+   ++nlhdlrdata->nclosedformcuts;
+   *success = TRUE;
 
    return SCIP_OKAY;
 }
 
-
-/** auxiliary evaluation callback of nonlinear handler */
+/** asks the suitable nonlinear handlers for estimators of an expression and perspectivies them w.r.t. one indicator
+ *
+ * The perspectivied cuts are stored in rowpreps, starting at position *nrowpreps.
+ */
 static
-SCIP_DECL_CONSEXPR_NLHDLREVALAUX(nlhdlrEvalauxPerspective)
-{ /*lint --e{715}*/
-   int e;
-   SCIP_Real maxdiff;
-   SCIP_Real auxvarvalue;
-   SCIP_Real enfoauxval;
+SCIP_RETCODE estimatePerspective(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_CONSEXPR_NLHDLR* nlhdlr,             /**< perspective nonlinear handler */
+   SCIP_CONSEXPR_EXPR*   expr,               /**< expression */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   int                   indpos,             /**< position of the indicator in nlhdlrexprdata->indicators */
+   SCIP_SOL*             sol,                /**< solution to be separated (a copy that stays valid in probing) */
+   int*                  enfoposs,           /**< positions of the enforcements to be used */
+   int                   nenfos,             /**< number of enforcements to be used */
+   SCIP_Bool             overestimate,       /**< whether the expression needs to be overestimated */
+   SCIP_Bool             addbranchscores,    /**< whether to register branching scores */
+   SCIP_PTRARRAY*        rowpreps2,          /**< working array for the estimators of a nonlinear handler */
+   SCIP_PTRARRAY*        rowpreps,           /**< array to store the perspectivied cuts */
+   SCIP_BOOLARRAY*       addedbranchscores2, /**< array to store whether branching scores were added for the cuts */
+   int*                  nrowpreps           /**< pointer to number of entries in rowpreps, will be updated */
+   )
+{
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   SCIP_ROWPREP* rowprep;
+   SCIP_VAR* auxvar;
+   SCIP_VAR* indicator;
+   SCIP_SOL* soladj;
+   SCIP_Bool issc;
+   SCIP_Real cst0;
+   SCIP_Real indval;
+   int minidx;
+   int maxidx;
+   int pos;
+   int r;
+   int v;
+   int j;
 
-   assert(scip != NULL);
-   assert(expr != NULL);
-   assert(auxvalue != NULL);
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   auxvar = SCIPgetConsExprExprAuxVar(expr);
+   indicator = nlhdlrexprdata->indicators[indpos];
+   soladj = NULL;
 
-   auxvarvalue = SCIPgetSolVal(scip, sol, SCIPgetConsExprExprAuxVar(expr));
-   maxdiff = 0.0;
-   *auxvalue = auxvarvalue;
+   assert(auxvar != NULL);
 
-   /* use the auxvalue from one of the other nlhdlrs that estimates for this expr: take the one that is farthest
-    * from the current value of auxvar
-    */
-   for( e = 0; e < SCIPgetConsExprExprNEnfos(expr); ++e )
+   if( nlhdlrdata->adjrefpoint )
    {
-      SCIP_CONSEXPR_NLHDLR* nlhdlr2;
-      SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlr2exprdata;
-      SCIP_CONSEXPR_EXPRENFO_METHOD nlhdlr2participation;
+      /* make sure that when we adjust the point, we don't divide by something too close to 0.0 */
+      indval = MAX(SCIPgetSolVal(scip, sol, indicator), 0.1);
 
-      SCIPgetConsExprExprEnfoData(expr, e, &nlhdlr2, &nlhdlr2exprdata, &nlhdlr2participation, NULL, NULL, NULL);
+      /* create an adjusted point x^adj = (x* - x0) / z* + x0 */
+      SCIP_CALL( SCIPcreateSol(scip, &soladj, NULL) );
+      for( v = 0; v < nlhdlrexprdata->nvars; ++v )
+      {
+         if( SCIPvarGetStatus(nlhdlrexprdata->vars[v]) == SCIP_VARSTATUS_FIXED )
+            continue;
 
-      /* skip nlhdlr that do not participate or do not provide estimate */
-      if( (nlhdlr2participation & SCIP_CONSEXPR_EXPRENFO_SEPABOTH) == 0 || !SCIPhasConsExprNlhdlrEstimate(nlhdlr2) )
-         continue;
+         issc = getSCVarDataInd(nlhdlrdata->scvars, nlhdlrexprdata->vars[v], indicator, &pos);
+
+         /* a non-semicontinuous variable must be linear in expr; skip it */
+         if( !issc )
+            continue;
+
+         SCIP_CALL( SCIPsetSolVal(scip, soladj, nlhdlrexprdata->vars[v],
+               (SCIPgetSolVal(scip, sol, nlhdlrexprdata->vars[v]) - nlhdlrdata->scvars->vals0[pos]) / indval
+               + nlhdlrdata->scvars->vals0[pos]) );
+      }
+      for( v = 0; v < nlhdlrexprdata->nindicators; ++v )
+      {
+         if( SCIPvarGetStatus(nlhdlrexprdata->indicators[v]) == SCIP_VARSTATUS_FIXED )
+            continue;
+
+         SCIP_CALL( SCIPsetSolVal(scip, soladj, nlhdlrexprdata->indicators[v],
+               SCIPgetSolVal(scip, sol, nlhdlrexprdata->indicators[v])) );
+      }
+      if( SCIPvarGetStatus(auxvar) != SCIP_VARSTATUS_FIXED )
+         SCIP_CALL( SCIPsetSolVal(scip, soladj, auxvar, SCIPgetSolVal(scip, sol, auxvar)) );
+   }
 
-      SCIP_CALL( SCIPevalauxConsExprNlhdlr(scip, nlhdlr2, expr, nlhdlr2exprdata, &enfoauxval, sol) );
+   /* use cuts from every suitable nlhdlr */
+   for( j = 0; j < nenfos; ++j )
+   {
+      SCIP_Bool addedbranchscores2j;
+      SCIP_CONSEXPR_NLHDLR* nlhdlr2;
+      SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlr2exprdata;
+      SCIP_Real nlhdlr2auxvalue;
+      SCIP_Bool success2;
 
-      SCIPsetConsExprExprEnfoAuxValue(expr, e, enfoauxval);
+      SCIPgetConsExprExprEnfoData(expr, enfoposs[j], &nlhdlr2, &nlhdlr2exprdata, NULL, NULL, NULL, &nlhdlr2auxvalue);
+      assert(SCIPhasConsExprNlhdlrEstimate(nlhdlr2) && nlhdlr2 != nlhdlr);
 
-      if( REALABS(enfoauxval - auxvarvalue) > maxdiff && enfoauxval != SCIP_INVALID ) /*lint !e777*/
+      if( nlhdlrdata->adjrefpoint )
       {
-         maxdiff = REALABS(enfoauxval - auxvarvalue);
-         *auxvalue = enfoauxval;
+         SCIP_CALL( SCIPevalauxConsExprNlhdlr(scip, nlhdlr2, expr, nlhdlr2exprdata, &nlhdlr2auxvalue, soladj) );
+         SCIPsetConsExprExprEnfoAuxValue(expr, enfoposs[j], nlhdlr2auxvalue);
       }
-   }
 
-   return SCIP_OKAY;
-}
+      SCIPdebugMsg(scip, "asking nonlinear handler %s to %sestimate\n", SCIPgetConsExprNlhdlrName(nlhdlr2), overestimate ? "over" : "under");
 
-/** separation initialization method of a nonlinear handler */
-static
-SCIP_DECL_CONSEXPR_NLHDLRINITSEPA(nlhdlrInitSepaPerspective)
-{ /*lint --e{715}*/
-   int sindicators;
-   SCIP_CONSEXPR_EXPR* curexpr;
-   SCIP_VAR* var;
-   int i;
-   SCIP_CONSEXPR_BNDDATA scdata;
-   int nvars;
-   SCIP_VAR** vars;
-   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
-   SCIP_VAR** scauxvars;
-   int nscauxvars;
-   SCIP_Real* auxvals0;
+      /* ask the nonlinear handler for an estimator */
+      SCIP_CALL( SCIPstartClock(scip, nlhdlrdata->estimatetime) );
+      SCIP_CALL( SCIPestimateConsExprNlhdlr(scip, conshdlr, nlhdlr2, expr,
+            nlhdlr2exprdata, nlhdlrdata->adjrefpoint ? soladj : sol,
+            nlhdlr2auxvalue, overestimate, SCIPgetSolVal(scip, sol, auxvar),
+            rowpreps2, &success2, addbranchscores, &addedbranchscores2j) );
+      SCIP_CALL( SCIPstopClock(scip, nlhdlrdata->estimatetime) );
 
-   sindicators = nlhdlrexprdata->nindicators;
-   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+      minidx = SCIPgetPtrarrayMinIdx(scip, rowpreps2);
+      maxidx = SCIPgetPtrarrayMaxIdx(scip, rowpreps2);
 
-   /* save auxiliary variables */
-   SCIP_CALL( saveAuxVars(scip, conshdlr, SCIPgetConsExprNlhdlrData(nlhdlr), nlhdlrexprdata, expr) );
+      assert((success2 && minidx <= maxidx) || (!success2 && minidx > maxidx));
 
-   /* compute 'off' values of expr and subexprs (and thus auxvars too) */
-   SCIP_CALL( computeOffValues(scip, conshdlr, SCIPgetConsExprNlhdlrData(nlhdlr), nlhdlrexprdata, expr) );
+      /* perspectivy all cuts from nlhdlr2 and add them to rowpreps */
+      for( r = minidx; r <= maxidx; ++r )
+      {
+         SCIP_Real maxcoef;
 
-   nvars = nlhdlrexprdata->nvars;
-   vars = nlhdlrexprdata->vars;
+         rowprep = (SCIP_ROWPREP*) SCIPgetPtrarrayVal(scip, rowpreps2, r);
+         assert(rowprep != NULL);
 
-   SCIP_CALL( SCIPallocBufferArray(scip, &scdata.vars, nvars + 1) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &scdata.lbs, nvars + 1) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &scdata.ubs, nvars + 1) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &scauxvars, nvars + 1) );
-   SCIP_CALL( SCIPallocBufferArray(scip, &auxvals0, nvars + 1) );
+#ifdef SCIP_DEBUG
+         SCIPinfoMessage(scip, NULL, "rowprep for expr ");
+         SCIPprintConsExprExpr(scip, conshdlr, expr, NULL);
+         SCIPinfoMessage(scip, NULL, "rowprep before perspectivy is: \n");
+         SCIPprintRowprep(scip, rowprep, NULL);
+#endif
 
-   /* for each indicator, do propagation at 0 to add any remaining semi-continuous auxvars */
-   for( i = 0; i < SCIPgetConsExprExprNBigMIndicators(expr); ++i )
-   {
-      SCIP_Bool indincons = FALSE; /* whether indicator is one of the cons vars */
-      int v;
-      SCIP_VAR* indicator = SCIPgetConsExprExprBigMIndicators(expr)[i];
-      SCVARDATA* scvdata;
-      SCIP_Bool cutoff;
+         /* given a rowprep: sum aixi + sum biyi + c, where xi are semicontinuous variables and yi are
+          * non-semicontinuous variables (which appear in expr linearly, which detect must have ensured),
+          * perspectivy the semicontinuous part by adding (1-z)(g0 - c - sum aix0i) (the constant is
+          * treated as belonging to the semicontinuous part)
+          */
 
-      /* fill in scvdatas and intevalvardata */
-      for( v = 0; v < nvars; ++v )
-      {
-         SCIP_Bool found = FALSE;
-         int pos;
+         /* we want cst0 = g0 - c - sum aix0i; first add g0 - c */
+         cst0 = nlhdlrexprdata->exprvals0[indpos] + rowprep->side;
 
-         scdata.vars[v] = vars[v];
-         scvdata = (SCVARDATA *) SCIPhashmapGetImage(nlhdlrdata->scvars, (void *) vars[v]);
-         if( scvdata != NULL )
-         {
-            found = SCIPsortedvecFindPtr((void **) scvdata->bvars, SCIPvarComp, (void *) indicator,
-                                         scvdata->nbnds, &pos);
-         }
+         maxcoef = 0.0;
 
-         if( found )
+         for( v = 0; v < rowprep->nvars; ++v )
          {
-            scdata.lbs[v] = scvdata->vals0[pos];
-            scdata.ubs[v] = scvdata->vals0[pos];
+            if( REALABS( rowprep->coefs[v]) > maxcoef )
+            {
+               maxcoef = REALABS(rowprep->coefs[v]);
+            }
+
+            issc = getSCVarDataInd(nlhdlrdata->scvars, rowprep->vars[v], indicator, &pos);
+
+            /* a non-semicontinuous variable must be linear in expr; skip it */
+            if( !issc )
+               continue;
+
+            cst0 -= rowprep->coefs[v] * nlhdlrdata->scvars->vals0[pos];
          }
-         else if( vars[v] == indicator )
+
+         /* only perspectivy when the absolute value of cst0 is not too small
+          * TODO on ex1252a there was cst0=0 - ok to still use the cut?
+         */
+         if( cst0 == 0.0 || maxcoef / REALABS(cst0) <= SCIP_CONSEXPR_CUTMAXRANGE )
          {
-            indincons = TRUE;
-            scdata.lbs[v] = 0.0;
-            scdata.ubs[v] = 0.0;
+            /* update the rowprep by adding cst0 - cst0*z */
+            SCIPaddRowprepConstant(rowprep, cst0);
+            SCIP_CALL(SCIPaddRowprepTerm(scip, rowprep, indicator, -cst0));
          }
          else
          {
-            scdata.lbs[v] = SCIPvarGetLbGlobal(vars[v]);
-            scdata.ubs[v] = SCIPvarGetUbGlobal(vars[v]);
+            SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
+            continue;
          }
-      }
-
-      if( !indincons )
-      {
-         scdata.vars[nvars] = indicator;
-         scdata.lbs[nvars] = 0.0;
-         scdata.ubs[nvars] = 0.0;
-         scdata.nvars = nvars+1;
-      }
-      else
-      {
-         scdata.vars[nvars] = NULL;
-         scdata.nvars = nvars;
-      }
-
-      nscauxvars = 0;
 
-      /* evaluate expression activity at 0 and get bounds on auxiliary variables */
-      SCIP_CALL( SCIPcomputeZeroAuxValues(scip, conshdlr, expr, &cutoff, &scdata, scauxvars, &nscauxvars, auxvals0) );
+         SCIP_CALL(SCIPaddRowprepTerm(scip, rowprep, auxvar, -1.0));
 
-      /* save any newly detected semicontinuous variables */
-      for( v = 0; v < nscauxvars; ++v )
-      {
-         scvdata = (SCVARDATA *) SCIPhashmapGetImage(nlhdlrdata->scvars, (void *) scauxvars[v]);
-         if( scvdata == NULL )
-         {
-            SCIP_CALL( SCIPallocClearBlockMemory(scip, &scvdata) );
-            SCIP_CALL( SCIPhashmapInsert(nlhdlrdata->scvars, scauxvars[v], scvdata) );
-         }
+         SCIPdebugMsg(scip, "rowprep after perspectivy is: \n");
+#ifdef SCIP_DEBUG
+         SCIPprintRowprep(scip, rowprep, NULL);
+#endif
 
-         SCIP_CALL( addSCVarIndicator(scip, scvdata, indicator, auxvals0[v], SCIPvarGetLbGlobal(scauxvars[v]), SCIPvarGetUbGlobal(scauxvars[v])) );
+         SCIP_CALL( SCIPsetPtrarrayVal(scip, rowpreps, *nrowpreps, rowprep) );
+         SCIP_CALL( SCIPsetBoolarrayVal(scip, addedbranchscores2, *nrowpreps, addedbranchscores2j) );
+         ++(*nrowpreps);
       }
-   } /* indicator */
 
-   /* some indicator variables might have been removed if evaluation failed, check how many remain */
-   if( nlhdlrexprdata->nindicators == 0 )
-   {
-      SCIPfreeBlockMemoryArray(scip, &nlhdlrexprdata->indicators, sindicators);
-      SCIPfreeBlockMemoryArray(scip, &nlhdlrexprdata->exprvals0, sindicators);
+      SCIP_CALL( SCIPclearPtrarray(scip, rowpreps2) );
    }
-   else if( nlhdlrexprdata->nindicators < sindicators )
+
+   if( soladj != NULL )
    {
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->indicators, sindicators, nlhdlrexprdata->nindicators) );
-      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &nlhdlrexprdata->exprvals0, sindicators, nlhdlrexprdata->nindicators) );
+      SCIP_CALL( SCIPfreeSol(scip, &soladj) );
    }
 
-   SCIPfreeBufferArray(scip, &auxvals0);
-   SCIPfreeBufferArray(scip, &scauxvars);
-   SCIPfreeBufferArray(scip, &scdata.ubs);
-   SCIPfreeBufferArray(scip, &scdata.lbs);
-   SCIPfreeBufferArray(scip, &scdata.vars);
-
    return SCIP_OKAY;
 }
 
-
-/** separation deinitialization method of a nonlinear handler (called during CONSEXITSOL) */
-#if 0
+/** copies the values of all variables relevant for an expression to a solution */
 static
-SCIP_DECL_CONSEXPR_NLHDLREXITSEPA(nlhdlrExitSepaPerspective)
-{ /*lint --e{715}*/
-   SCIPerrorMessage("method of perspective nonlinear handler not implemented yet\n");
-   SCIPABORT(); /*lint --e{527}*/
+SCIP_RETCODE copyExprSolVals(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_EXPR*   expr,               /**< expression */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   SCIP_SOL*             sol,                /**< solution to copy values from */
+   SCIP_SOL*             solcopy             /**< solution to copy values to */
+   )
+{
+   int v;
+
+   for( v = 0; v < nlhdlrexprdata->nvars; ++v )
+   {
+      SCIP_CALL( SCIPsetSolVal(scip, solcopy, nlhdlrexprdata->vars[v], SCIPgetSolVal(scip, sol, nlhdlrexprdata->vars[v])) );
+   }
+   for( v = 0; v < nlhdlrexprdata->nindicators; ++v )
+   {
+      SCIP_CALL( SCIPsetSolVal(scip, solcopy, nlhdlrexprdata->indicators[v], SCIPgetSolVal(scip, sol, nlhdlrexprdata->indicators[v])) );
+   }
+   SCIP_CALL( SCIPsetSolVal(scip, solcopy, SCIPgetConsExprExprAuxVar(expr),
+         SCIPgetSolVal(scip, sol, SCIPgetConsExprExprAuxVar(expr))) );
 
    return SCIP_OKAY;
 }
-#endif
 
+/** probes an indicator once for all expressions that depend on it and computes their perspective cuts
+ *
+ * All expressions that have the indicator and whose auxiliary variable is violated on the same side as for expr
+ * are collected. The probing domains suggested for each of them are merged, probing (with indicator = 1) is started
+ * only once and every collected expression computes its perspective cuts from this probing state.
+ * The cuts of expr are stored in rowpreps; the cuts of the other expressions are stored as pending cuts in their
+ * nonlinear handler expression data and are used when they are enforced in the same round.
+ */
 static
-SCIP_RETCODE computeIndicatorCoef(
-   SCIP*                 scip,
-   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata,
-   SCIP_ROWPREP*         rowprep,
-   SCIP_VAR*             auxvar,
-   SCIP_VAR*             indicator,
-   SCIP_Bool             max,
-   SCIP_Real*            cst0,
-   SCIP_INTERVAL         activity
+SCIP_RETCODE probeIndicatorBatch(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSHDLR*        conshdlr,           /**< expression constraint handler */
+   SCIP_CONSEXPR_NLHDLR* nlhdlr,             /**< perspective nonlinear handler */
+   SCIP_CONSEXPR_EXPR*   expr,               /**< expression */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nlhdlr expression data */
+   int                   indpos,             /**< position of the indicator in nlhdlrexprdata->indicators */
+   SCIP_SOL*             sol,                /**< solution to be separated */
+   int*                  enfoposs,           /**< positions of the enforcements to be used for expr */
+   int                   nenfos,             /**< number of enforcements to be used for expr */
+   SCIP_Bool             overestimate,       /**< whether the expressions need to be overestimated */
+   SCIP_Bool             allowweakcuts,      /**< whether we allow for weak cuts */
+   SCIP_Bool             addbranchscores,    /**< whether to register branching scores for expr */
+   SCIP_VAR**            probingvars,        /**< variables whose bounds are changed in probing for expr */
+   SCIP_INTERVAL*        probingdoms,        /**< domains to which the bounds of probingvars are changed */
+   int                   nprobingvars,       /**< number of probing variables of expr */
+   SCIP_PTRARRAY*        rowpreps2,          /**< working array for the estimators of a nonlinear handler */
+   SCIP_PTRARRAY*        rowpreps,           /**< array to store the perspectivied cuts of expr */
+   SCIP_BOOLARRAY*       addedbranchscores2, /**< array to store whether branching scores were added for the cuts */
+   int*                  nrowpreps,          /**< pointer to number of entries in rowpreps, will be updated */
+   SCIP_Bool*            indfixed,           /**< buffer to store whether the indicator has been fixed */
+   SCIP_RESULT*          result              /**< pointer to update the result */
    )
 {
-   SCIP_Bool allfixed;
-   int i;
-   int j;
-   SCIP_VAR* var;
-   SCIP_Real cutval_min;
-   SCIP_Real cutval_max;
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   SCIP_CONSEXPR_EXPR** batchexprs;
+   SCIP_CONSEXPR_NLHDLREXPRDATA** batchexprdatas;
+   SCIP_PTRARRAY* batchrowpreps;
+   SCIP_BOOLARRAY* batchbrscores;
+   SCIP_HASHMAP* probingmap;
+   SCIP_VAR** mergedvars;
+   SCIP_INTERVAL* mergeddoms;
+   SCIP_VAR** cachevars;
+   SCIP_VAR* indicator;
+   SCIP_SOL* batchsol;
+   INDEXPRS* indexprs;
+   int** batchenfoposs;
+   int* batchnenfos;
+   int* batchindposs;
+   int nbatch;
+   int nmerged;
+   int mergedsize;
+   int ncachevars;
+   int e;
+   int v;
+   SCIP_Bool cutoff_probing;
 
-   *cst0 = SCIP_INVALID;
+   assert(nlhdlrexprdata != NULL);
+   assert(indfixed != NULL);
+   assert(result != NULL);
+   assert(!SCIPinProbing(scip));
 
-   /* assemble box */
-   allfixed = TRUE;
-   cutval_min = -rowprep->side;
-   cutval_max = -rowprep->side;
-   for( i = 0; i < rowprep->nvars; ++i )
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   indicator = nlhdlrexprdata->indicators[indpos];
+   *indfixed = FALSE;
+
+   indexprs = nlhdlrdata->indexprs != NULL ? (INDEXPRS*) SCIPhashmapGetImage(nlhdlrdata->indexprs, (void*)indicator) : NULL;
+   e = indexprs != NULL ? indexprs->nexprs : 0;
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchexprs, e + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchexprdatas, e + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchenfoposs, e + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchnenfos, e + 1) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &batchindposs, e + 1) );
+   SCIP_CALL( SCIPhashmapCreate(&probingmap, SCIPblkmem(scip), nprobingvars + 1) );
+
+   /* the probing domains of expr are the first merged domains */
+   mergedsize = MAX(nprobingvars, 1);
+   SCIP_CALL( SCIPallocBufferArray(scip, &mergedvars, mergedsize) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &mergeddoms, mergedsize) );
+   for( nmerged = 0; nmerged < nprobingvars; ++nmerged )
    {
-      SCVARDATA* scvdata;
-      SCIP_Bool found = FALSE;
-      SCIP_Real vlb;
-      SCIP_Real vub;
-      int pos;
+      mergedvars[nmerged] = probingvars[nmerged];
+      mergeddoms[nmerged] = probingdoms[nmerged];
+      SCIP_CALL( SCIPhashmapInsertInt(probingmap, (void*)probingvars[nmerged], nmerged) );
+   }
 
-      var = rowprep->vars[i];
-      assert(var != NULL);
-      scvdata = (SCVARDATA*) SCIPhashmapGetImage(nlhdlrdata->scvars, (void*)var);
+   /* collect the other expressions that depend on indicator and need a cut on the same side */
+   nbatch = 0;
+   for( e = 0; indexprs != NULL && e < indexprs->nexprs; ++e )
+   {
+      SCIP_CONSEXPR_NLHDLREXPRDATA* exprdata2;
+      SCIP_CONSEXPR_EXPR* expr2;
+      SCIP_VAR** probingvars2;
+      SCIP_INTERVAL* probingdoms2;
+      int nprobingvars2;
+      SCIP_Bool doprobing2;
+      int pos2;
+
+      expr2 = indexprs->exprs[e];
+      if( expr2 == expr || SCIPgetConsExprExprAuxVar(expr2) == NULL )
+         continue;
+
+      exprdata2 = SCIPgetConsExprNlhdlrExprData(nlhdlr, expr2);
+      if( exprdata2 == NULL || !SCIPsortedvecFindPtr((void**)exprdata2->indicators, SCIPvarComp, (void*)indicator,
+            exprdata2->nindicators, &pos2) )
+         continue;
 
-      if( scvdata != NULL )
+      SCIP_CALL( updateBatchData(scip, exprdata2, overestimate) );
+      if( exprdata2->batchedinds[pos2] )
+         continue;
+
+      SCIP_CALL( SCIPallocBufferArray(scip, &batchenfoposs[nbatch], SCIPgetConsExprExprNEnfos(expr2)) );
+      SCIP_CALL( collectEnfoNlhdlrs(scip, conshdlr, nlhdlr, expr2, sol, overestimate, allowweakcuts, TRUE,
+            batchenfoposs[nbatch], &batchnenfos[nbatch], &doprobing2) );
+
+      if( batchnenfos[nbatch] == 0 )
       {
-         found = SCIPsortedvecFindPtr((void **) scvdata->bvars, SCIPvarComp, (void *) indicator, scvdata->nbnds, &pos);
+         SCIPfreeBufferArray(scip, &batchenfoposs[nbatch]);
+         continue;
       }
 
-      if( found )
+      /* get the bounds that expr2 would like to see in probing (this might also tighten bounds in the current node) */
+      probingvars2 = NULL;
+      probingdoms2 = NULL;
+      nprobingvars2 = 0;
+      doprobing2 = TRUE;
+      SCIP_CALL( analyseOnoffBounds(scip, nlhdlrdata, exprdata2, indicator, &probingvars2, &probingdoms2,
+            &nprobingvars2, &doprobing2, result) );
+
+      for( v = 0; v < nprobingvars2; ++v )
       {
-         vlb = scvdata->vals0[pos];
-         vub = scvdata->vals0[pos];
+         int mpos;
+
+         mpos = SCIPhashmapGetImageInt(probingmap, (void*)probingvars2[v]);
+         if( mpos != INT_MAX )
+         {
+            /* intersect with the domain that is already there */
+            mergeddoms[mpos].inf = MAX(mergeddoms[mpos].inf, probingdoms2[v].inf);
+            mergeddoms[mpos].sup = MIN(mergeddoms[mpos].sup, probingdoms2[v].sup);
+            continue;
+         }
+
+         if( nmerged + 1 > mergedsize )
+         {
+            mergedsize = SCIPcalcMemGrowSize(scip, nmerged + 1);
+            SCIP_CALL( SCIPreallocBufferArray(scip, &mergedvars, mergedsize) );
+            SCIP_CALL( SCIPreallocBufferArray(scip, &mergeddoms, mergedsize) );
+         }
+         mergedvars[nmerged] = probingvars2[v];
+         mergeddoms[nmerged] = probingdoms2[v];
+         SCIP_CALL( SCIPhashmapInsertInt(probingmap, (void*)probingvars2[v], nmerged) );
+         ++nmerged;
       }
-      else if( var == indicator )
+
+      SCIPfreeBufferArrayNull(scip, &probingvars2);
+      SCIPfreeBufferArrayNull(scip, &probingdoms2);
+
+      batchexprs[nbatch] = expr2;
+      batchexprdatas[nbatch] = exprdata2;
+      batchindposs[nbatch] = pos2;
+      ++nbatch;
+
+      /* the bound analysis of expr2 might have found infeasibility or fixed the indicator */
+      if( *result == SCIP_CUTOFF || SCIPvarGetLbLocal(indicator) >= 0.5 || SCIPvarGetUbLocal(indicator) <= 0.5 )
       {
-         vlb = 0.0;
-         vub = 0.0;
+         *indfixed = TRUE;
+         goto TERMINATE;
       }
-      else
+   }
+
+   /* the intersection of probing domains might be empty, in which case indicator = 1 is infeasible */
+   for( v = 0; v < nmerged; ++v )
+   {
+      if( SCIPisFeasGT(scip, mergeddoms[v].inf, mergeddoms[v].sup) )
+         break;
+   }
+
+   if( v < nmerged )
+   {
+      SCIP_Bool cutoff;
+      SCIP_Bool fixed;
+
+      SCIP_CALL( SCIPfixVar(scip, indicator, 0.0, &cutoff, &fixed) );
+      if( cutoff )
+         *result = SCIP_CUTOFF;
+      else if( fixed )
+         *result = SCIP_REDUCEDDOM;
+      *indfixed = TRUE;
+      goto TERMINATE;
+   }
+
+   /* copy the values of all expressions, since sol can change in probing */
+   SCIP_CALL( SCIPcreateSol(scip, &batchsol, NULL) );
+   SCIP_CALL( copyExprSolVals(scip, expr, nlhdlrexprdata, sol, batchsol) );
+   for( e = 0; e < nbatch; ++e )
+   {
+      SCIP_CALL( copyExprSolVals(scip, batchexprs[e], batchexprdatas[e], sol, batchsol) );
+   }
+
+   /* the propagation result is needed for the variables of all expressions in the batch */
+   ncachevars = nlhdlrexprdata->nvars;
+   for( e = 0; e < nbatch; ++e )
+      ncachevars += batchexprdatas[e]->nvars;
+   SCIP_CALL( SCIPallocBufferArray(scip, &cachevars, ncachevars) );
+   BMScopyMemoryArray(cachevars, nlhdlrexprdata->vars, nlhdlrexprdata->nvars);
+   ncachevars = nlhdlrexprdata->nvars;
+   for( e = 0; e < nbatch; ++e )
+   {
+      BMScopyMemoryArray(&cachevars[ncachevars], batchexprdatas[e]->vars, batchexprdatas[e]->nvars);
+      ncachevars += batchexprdatas[e]->nvars;
+   }
+   SCIPsortPtr((void**)cachevars, SCIPvarComp, ncachevars);
+   v = 0;
+   for( e = 0; e < ncachevars; ++e )
+   {
+      if( v == 0 || cachevars[e] != cachevars[v-1] )
+         cachevars[v++] = cachevars[e];
+   }
+   ncachevars = v;
+
+   SCIP_CALL( startProbing(scip, nlhdlrdata, nlhdlrexprdata, indicator, mergedvars, mergeddoms, nmerged,
+         cachevars, ncachevars, sol, &batchsol, &cutoff_probing) );
+
+   SCIPfreeBufferArray(scip, &cachevars);
+
+   if( SCIPgetDepth(scip) == 0 )
+   { /* we are in the root node and startProbing did propagation */
+      if( cutoff_probing )
       {
-         vlb = SCIPvarGetLbLocal(var);
-         vub = SCIPvarGetUbLocal(var);
+         SCIP_Bool cutoff;
+         SCIP_Bool fixed;
+
+         /* indicator == 1 is infeasible -> set indicator to 0 */
+         SCIP_CALL( SCIPendProbing(scip) );
+         SCIP_CALL( SCIPfixVar(scip, indicator, 0.0, &cutoff, &fixed) );
+
+         if( cutoff )
+            *result = SCIP_CUTOFF;
+         *indfixed = TRUE;
+
+         SCIP_CALL( SCIPfreeSol(scip, &batchsol) );
+         goto TERMINATE;
       }
 
-      if( var == auxvar )
+      /* probing propagation in the root node can provide better on/off bounds */
+      SCIP_CALL( tightenOnBounds(nlhdlrexprdata, nlhdlrdata->scvars, indicator) );
+      for( e = 0; e < nbatch; ++e )
       {
-         vlb = MAX(vlb, SCIPintervalGetInf(activity));
-         vub = MAX(vub, SCIPintervalGetSup(activity));
+         SCIP_CALL( tightenOnBounds(batchexprdatas[e], nlhdlrdata->scvars, indicator) );
       }
+   }
 
-      SCIPdebugMsg(scip, "\nbounds on %s (index %d) at 0 are [%g,%g]", SCIPvarGetName(var), i, vlb, vub);
+   /* compute the cuts of expr */
+   SCIP_CALL( estimatePerspective(scip, conshdlr, nlhdlr, expr, nlhdlrexprdata, indpos, batchsol, enfoposs, nenfos,
+         overestimate, addbranchscores, rowpreps2, rowpreps, addedbranchscores2, nrowpreps) );
 
-      if( SCIPisInfinity(scip, vub) || SCIPisInfinity(scip, -vlb) )
-      {
-         SCIPdebugMsg(scip, "bound at infinity, no bigm cut strengthening possible\n");
-         return SCIP_OKAY;
-      }
+   /* compute the cuts of the other expressions from the same probing state and keep them for later */
+   SCIP_CALL( SCIPcreatePtrarray(scip, &batchrowpreps) );
+   SCIP_CALL( SCIPcreateBoolarray(scip, &batchbrscores) );
+   for( e = 0; e < nbatch; ++e )
+   {
+      int nbatchrowpreps;
+      int r;
 
-      if( !SCIPisRelEQ(scip, vlb, vub) )
-         allfixed = FALSE;
+      nbatchrowpreps = 0;
+      SCIP_CALL( estimatePerspective(scip, conshdlr, nlhdlr, batchexprs[e], batchexprdatas[e], batchindposs[e], batchsol,
+            batchenfoposs[e], batchnenfos[e], overestimate, FALSE, rowpreps2, batchrowpreps, batchbrscores,
+            &nbatchrowpreps) );
 
-      if( rowprep->coefs[i] > 0 )
-      {
-         cutval_min += rowprep->coefs[i] * vlb;
-         cutval_max += rowprep->coefs[i] * vub;
-      }
-      else
+      for( r = 0; r < nbatchrowpreps; ++r )
       {
-         cutval_min += rowprep->coefs[i] * vub;
-         cutval_max += rowprep->coefs[i] * vlb;
+         SCIP_CALL( addPendingCut(scip, batchexprdatas[e], (SCIP_ROWPREP*) SCIPgetPtrarrayVal(scip, batchrowpreps, r),
+               SCIPgetBoolarrayVal(scip, batchbrscores, r), batchindposs[e]) );
       }
+      batchexprdatas[e]->batchedinds[batchindposs[e]] = TRUE;
+      nlhdlrdata->nbatchcuts += nbatchrowpreps;
+
+      SCIP_CALL( SCIPclearPtrarray(scip, batchrowpreps) );
    }
+   SCIP_CALL( SCIPfreeBoolarray(scip, &batchbrscores) );
+   SCIP_CALL( SCIPfreePtrarray(scip, &batchrowpreps) );
 
-   if( allfixed )
+   SCIP_CALL( SCIPendProbing(scip) );
+   SCIP_CALL( SCIPfreeSol(scip, &batchsol) );
+
+ TERMINATE:
+   for( e = nbatch - 1; e >= 0; --e )
    {
-      SCIPdebugMsg(scip, "all variables fixed, skip big-M perspectify (it should have been handled as semi-continuous)\n");
-      return SCIP_OKAY;
+      SCIPfreeBufferArray(scip, &batchenfoposs[e]);
    }
-
-   *cst0 = rowprep->sidetype == SCIP_SIDETYPE_RIGHT ? -cutval_max : -cutval_min;
-   SCIPdebugMsg(scip, "\ncst0 = %g", *cst0);
+   SCIPfreeBufferArray(scip, &mergeddoms);
+   SCIPfreeBufferArray(scip, &mergedvars);
+   SCIPhashmapFree(&probingmap);
+   SCIPfreeBufferArray(scip, &batchindposs);
+   SCIPfreeBufferArray(scip, &batchnenfos);
+   SCIPfreeBufferArray(scip, &batchenfoposs);
+   SCIPfreeBufferArray(scip, &batchexprdatas);
+   SCIPfreeBufferArray(scip, &batchexprs);
 
    return SCIP_OKAY;
 }
@@ -2170,7 +4133,13 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
    int* enfoposs;
    SCIP_SOL* soladj;
    int pos;
-   SCVARDATA* scvdata;
+   SCIP_Bool issc;
+   SCIP_VAR* closedformvar;
+   int probingaction;
+   SCIP_Real auxviol;
+   SCIP_Real maxcutviol;
+   SCIP_Real starttime;
+   SCIP_Real startprobingtime;
 
    nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
 
@@ -2201,59 +4170,9 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
 
    SCIP_CALL( SCIPallocBufferArray(scip, &enfoposs, SCIPgetConsExprExprNEnfos(expr) - 1) );
 
-   doprobing = FALSE;
-   nenfos = 0;
-
    /* find suitable nlhdlrs and check if there is enough violation to do probing */
-   for( j = 0; j < SCIPgetConsExprExprNEnfos(expr); ++j )
-   {
-      SCIP_CONSEXPR_NLHDLR* nlhdlr2;
-      SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlr2exprdata;
-      SCIP_CONSEXPR_EXPRENFO_METHOD nlhdlr2participate;
-      SCIP_Real nlhdlr2auxvalue;
-      SCIP_Real violation;
-      SCIP_Bool violbelow;
-      SCIP_Bool violabove;
-      SCIP_Bool sepausesactivity = FALSE;
-
-      SCIPgetConsExprExprEnfoData(expr, j, &nlhdlr2, &nlhdlr2exprdata, &nlhdlr2participate, !overestimate ? &sepausesactivity : NULL, overestimate ? &sepausesactivity: NULL, &nlhdlr2auxvalue);  /*lint !e826*/
-
-      if( nlhdlr2 == nlhdlr )
-         continue;
-
-      /* if nlhdlr2 cannot estimate, then cannot use it */
-      if( !SCIPhasConsExprNlhdlrEstimate(nlhdlr2) )
-         continue;
-
-      /* if nlhdlr2 does not participate in the separation on the desired side (overestimate), then skip it */
-      if( (nlhdlr2participate & (overestimate ? SCIP_CONSEXPR_EXPRENFO_SEPAABOVE : SCIP_CONSEXPR_EXPRENFO_SEPABELOW)) == 0 )
-         continue;
-
-      /* if only working on convex-looking expressions, then skip nlhdlr if it uses activity for estimates */
-      if( nlhdlrdata->convexonly && sepausesactivity )
-         continue;
-
-      /* evalaux should have called evalaux of nlhdlr2 by now
-       * check whether handling the violation for nlhdlr2 requires under- or overestimation and this fits to overestimate flag
-       */
-      SCIP_CALL( SCIPgetConsExprExprAbsAuxViolation(scip, conshdlr, expr, nlhdlr2auxvalue,
-            sol, &violation, &violbelow, &violabove) );
-      assert(violation >= 0.0);
-
-      if( (overestimate && !violabove) || (!overestimate && !violbelow) )
-         continue;
-
-      /* if violation is small, cuts would likely be weak - skip perspectification */
-      if( !allowweakcuts && violation < SCIPfeastol(scip) )
-         continue;
-
-      enfoposs[nenfos] = j;
-      ++nenfos;
-
-      /* enable probing if tightening the domain could be useful for nlhdlr and violation is above threshold */
-      if( sepausesactivity && violation >= nlhdlrdata->minviolprobing )
-         doprobing = TRUE;
-   }
+   SCIP_CALL( collectEnfoNlhdlrs(scip, conshdlr, nlhdlr, expr, sol, overestimate, allowweakcuts, FALSE, enfoposs,
+         &nenfos, &doprobing) );
 
    if( nenfos == 0 )
    {
@@ -2275,6 +4194,38 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
    if( SCIPinProbing(scip) || SCIPgetSubscipDepth(scip) != 0 )
       doprobing = FALSE;
 
+   /* in adaptive probing, the bandit of the expression decides whether probing is done */
+   probingaction = -1;
+   auxviol = 0.0;
+   maxcutviol = 0.0;
+   starttime = 0.0;
+   startprobingtime = 0.0;
+   if( doprobing && nlhdlrdata->adaptiveprobing )
+   {
+      if( nlhdlrexprdata->probingbandit == NULL )
+      {
+         /* prefer probing as long as there are no observations */
+         SCIP_Real priorities[2] = {0.0, 1.0};
+
+         SCIP_CALL( SCIPcreateBanditEpsgreedy(scip, &nlhdlrexprdata->probingbandit, priorities, BANDIT_EPS, FALSE,
+               0.9, 0, 2, BANDIT_SEED) );
+      }
+
+      SCIP_CALL( SCIPbanditSelect(nlhdlrexprdata->probingbandit, &probingaction) );
+
+      if( probingaction == 0 )
+      {
+         doprobing = FALSE;
+         ++nlhdlrdata->nprobingskips;
+      }
+
+      if( auxvalue != SCIP_INVALID ) /*lint !e777*/
+         auxviol = overestimate ? SCIPgetSolVal(scip, sol, auxvar) - auxvalue : auxvalue - SCIPgetSolVal(scip, sol, auxvar);
+      startprobingtime = SCIPgetClockTime(scip, nlhdlrdata->probingtime);
+      starttime = startprobingtime + SCIPgetClockTime(scip, nlhdlrdata->estimatetime)
+         + SCIPgetClockTime(scip, nlhdlrdata->rowpreptime);
+   }
+
    nrowpreps = 0;
    *result = SCIP_DIDNOTFIND;
    solcopy = sol;
@@ -2284,18 +4235,21 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
    SCIP_CALL( SCIPcreatePtrarray(scip, &rowpreps) );
    SCIP_CALL( SCIPcreateBoolarray(scip, &addedbranchscores2) );
 
+   /* for exp, pow and entropy of a variable, perspective tangents can be computed without other nlhdlrs and probing */
+   closedformvar = NULL;
+   if( nlhdlrdata->closedform )
+      (void) hasClosedFormTangent(conshdlr, expr, overestimate, &closedformvar);
+
    /* build cuts for every indicator variable */
    for( i = 0; i < nlhdlrexprdata->nindicators && !stop; ++i )
    {
-      int v;
-      int minidx;
-      int maxidx;
       int r;
       SCIP_VAR** probingvars;
       SCIP_INTERVAL* probingdoms;
       int nprobingvars;
       SCIP_Bool doprobingind;
-      SCIP_Real indval;
+      SCIP_Bool usebatch;
+      SCIP_Bool closedform;
 
       indicator = nlhdlrexprdata->indicators[i];
       probingvars = NULL;
@@ -2320,215 +4274,137 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
          goto TERMINATE;
       }
 
-      if( doprobingind )
+      /* stored cuts that are violated make the computation of new cuts for this indicator unnecessary */
+      if( nlhdlrdata->cutpool && sol == NULL && !SCIPinProbing(scip) )
       {
-         SCIP_Bool propagate;
-         SCIP_Bool cutoff_probing;
-         SCIP_Bool cutoff;
-         SCIP_Bool fixed;
-
-#ifndef NDEBUG
-         SCIP_Real* solvals;
-         SCIP_CALL( SCIPallocBufferArray(scip, &solvals, nlhdlrexprdata->nvars) );
-         for( v = 0; v < nlhdlrexprdata->nvars; ++v )
-         {
-            solvals[v] = SCIPgetSolVal(scip, sol, nlhdlrexprdata->vars[v]);
-         }
-#endif
-
-         propagate = SCIPgetDepth(scip) == 0;
+         SCIP_Bool separated;
 
-         SCIP_CALL( startProbing(scip, nlhdlrdata, nlhdlrexprdata, indicator, probingvars, probingdoms, nprobingvars,
-               sol, &solcopy, &cutoff_probing) );
+         SCIP_CALL( separatePoolCuts(scip, nlhdlrdata, nlhdlrexprdata, indicator, &separated, result) );
 
-#ifndef NDEBUG
-         for( v = 0; v < nlhdlrexprdata->nvars; ++v )
+         if( *result == SCIP_CUTOFF )
          {
-            assert(solvals[v] == SCIPgetSolVal(scip, solcopy, nlhdlrexprdata->vars[v])); /*lint !e777*/
+            SCIPfreeBufferArrayNull(scip, &probingvars);
+            SCIPfreeBufferArrayNull(scip, &probingdoms);
+            goto TERMINATE;
          }
-         SCIPfreeBufferArray(scip, &solvals);
-#endif
-
-         if( propagate )
-         { /* we are in the root node and startProbing did propagation */
-            /* probing propagation might have detected infeasibility */
-            if( cutoff_probing )
-            {
-               /* indicator == 1 is infeasible -> set indicator to 0 */
-               SCIPfreeBufferArrayNull(scip, &probingvars);
-               SCIPfreeBufferArrayNull(scip, &probingdoms);
-
-               SCIP_CALL( SCIPendProbing(scip) );
-
-               SCIP_CALL( SCIPfixVar(scip, indicator, 0.0, &cutoff, &fixed) );
-
-               if( cutoff )
-               {
-                  *result = SCIP_CUTOFF;
-                  goto TERMINATE;
-               }
-
-               continue;
-            }
 
-            /* probing propagation in the root node can provide better on/off bounds */
-            SCIP_CALL( tightenOnBounds(nlhdlrexprdata, nlhdlrdata->scvars, indicator) );
+         if( separated )
+         {
+            SCIPfreeBufferArrayNull(scip, &probingvars);
+            SCIPfreeBufferArrayNull(scip, &probingdoms);
+            continue;
          }
       }
 
-      if( nlhdlrdata->adjrefpoint )
+      closedform = FALSE;
+      if( closedformvar != NULL )
       {
-         /* make sure that when we adjust the point, we don't divide by something too close to 0.0 */
-         indval = MAX(SCIPgetSolVal(scip, solcopy, indicator), 0.1);
-
-         /* create an adjusted point x^adj = (x* - x0) / z* + x0 */
-         SCIP_CALL( SCIPcreateSol(scip, &soladj, NULL) );
-         for( v = 0; v < nlhdlrexprdata->nvars; ++v )
-         {
-            if( SCIPvarGetStatus(nlhdlrexprdata->vars[v]) == SCIP_VARSTATUS_FIXED )
-               continue;
-
-            scvdata = getSCVarDataInd(nlhdlrdata->scvars, nlhdlrexprdata->vars[v], indicator, &pos);
-
-            /* a non-semicontinuous variable must be linear in expr; skip it */
-            if( scvdata == NULL )
-               continue;
-
-            SCIP_CALL( SCIPsetSolVal(scip, soladj, nlhdlrexprdata->vars[v],
-                  (SCIPgetSolVal(scip, solcopy, nlhdlrexprdata->vars[v]) - scvdata->vals0[pos]) / indval
-                  + scvdata->vals0[pos]) );
-         }
-         for( v = 0; v < nlhdlrexprdata->nindicators; ++v )
-         {
-            if( SCIPvarGetStatus(nlhdlrexprdata->indicators[v]) == SCIP_VARSTATUS_FIXED )
-               continue;
+         SCIP_CALL( estimateClosedForm(scip, conshdlr, nlhdlrdata, expr, nlhdlrexprdata, i, closedformvar, sol,
+               overestimate, rowpreps, addedbranchscores2, &nrowpreps, &closedform) );
+      }
 
-            SCIP_CALL( SCIPsetSolVal(scip, soladj, nlhdlrexprdata->indicators[v],
-                  SCIPgetSolVal(scip, solcopy, nlhdlrexprdata->indicators[v])) );
-         }
-         if( SCIPvarGetStatus(auxvar) != SCIP_VARSTATUS_FIXED )
-            SCIP_CALL( SCIPsetSolVal(scip, soladj, auxvar, SCIPgetSolVal(scip, solcopy, auxvar)) );
+      /* in batched mode, the cuts for this indicator might already have been computed when probing for another expression */
+      usebatch = !closedform && nlhdlrdata->batchprobing && doprobing && sol == NULL;
+      if( usebatch )
+      {
+         SCIP_CALL( updateBatchData(scip, nlhdlrexprdata, overestimate) );
       }
 
-      /* use cuts from every suitable nlhdlr */
-      for( j = 0; j < nenfos; ++j )
+      if( closedform )
       {
-         SCIP_Bool addedbranchscores2j;
-         SCIP_CONSEXPR_NLHDLR* nlhdlr2;
-         SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlr2exprdata;
-         SCIP_Real nlhdlr2auxvalue;
-         SCIP_Bool success2;
+         assert(nrowpreps > 0);
+      }
+      else if( usebatch && nlhdlrexprdata->batchedinds[i] )
+      {
+         SCIP_CALL( takePendingCuts(scip, nlhdlrexprdata, i, rowpreps, addedbranchscores2, &nrowpreps) );
+      }
+      else if( usebatch && doprobingind )
+      {
+         SCIP_Bool indfixed;
 
-         SCIPgetConsExprExprEnfoData(expr, enfoposs[j], &nlhdlr2, &nlhdlr2exprdata, NULL, NULL, NULL, &nlhdlr2auxvalue);
-         assert(SCIPhasConsExprNlhdlrEstimate(nlhdlr2) && nlhdlr2 != nlhdlr);
+         SCIP_CALL( probeIndicatorBatch(scip, conshdlr, nlhdlr, expr, nlhdlrexprdata, i, sol, enfoposs, nenfos,
+               overestimate, allowweakcuts, addbranchscores, probingvars, probingdoms, nprobingvars, rowpreps2, rowpreps,
+               addedbranchscores2, &nrowpreps, &indfixed, result) );
 
-         if( nlhdlrdata->adjrefpoint )
+         if( indfixed )
          {
-            SCIP_CALL( SCIPevalauxConsExprNlhdlr(scip, nlhdlr2, expr, nlhdlr2exprdata, &nlhdlr2auxvalue, soladj) );
-            SCIPsetConsExprExprEnfoAuxValue(expr, j, nlhdlr2auxvalue);
-         }
+            SCIPfreeBufferArrayNull(scip, &probingvars);
+            SCIPfreeBufferArrayNull(scip, &probingdoms);
 
-         SCIPdebugMsg(scip, "asking nonlinear handler %s to %sestimate\n", SCIPgetConsExprNlhdlrName(nlhdlr2), overestimate ? "over" : "under");
+            if( *result == SCIP_CUTOFF || SCIPvarGetUbLocal(indicator) <= 0.5 )
+               goto TERMINATE;
 
-         /* ask the nonlinear handler for an estimator */
-         if( nlhdlrdata->adjrefpoint )
-         {
-            SCIP_CALL( SCIPestimateConsExprNlhdlr(scip, conshdlr, nlhdlr2, expr,
-                  nlhdlr2exprdata, soladj,
-                  nlhdlr2auxvalue, overestimate, SCIPgetSolVal(scip, solcopy, auxvar),
-                  rowpreps2, &success2, addbranchscores, &addedbranchscores2j) );
+            continue;
          }
-         else
+      }
+      else
+      {
+         if( doprobingind )
          {
-            SCIP_CALL( SCIPestimateConsExprNlhdlr(scip, conshdlr, nlhdlr2, expr,
-                  nlhdlr2exprdata, solcopy,
-                  nlhdlr2auxvalue, overestimate, SCIPgetSolVal(scip, solcopy, auxvar),
-                  rowpreps2, &success2, addbranchscores, &addedbranchscores2j) );
-         }
+            SCIP_Bool propagate;
+            SCIP_Bool cutoff_probing;
+            SCIP_Bool cutoff;
+            SCIP_Bool fixed;
 
-         minidx = SCIPgetPtrarrayMinIdx(scip, rowpreps2);
-         maxidx = SCIPgetPtrarrayMaxIdx(scip, rowpreps2);
+#ifndef NDEBUG
+            SCIP_Real* solvals;
+            int v;
 
-         assert((success2 && minidx <= maxidx) || (!success2 && minidx > maxidx));
+            SCIP_CALL( SCIPallocBufferArray(scip, &solvals, nlhdlrexprdata->nvars) );
+            for( v = 0; v < nlhdlrexprdata->nvars; ++v )
+            {
+               solvals[v] = SCIPgetSolVal(scip, sol, nlhdlrexprdata->vars[v]);
+            }
+#endif
 
-         /* perspectivy all cuts from nlhdlr2 and add them to rowpreps */
-         for( r = minidx; r <= maxidx; ++r )
-         {
-            SCIP_Real maxcoef;
+            propagate = SCIPgetDepth(scip) == 0;
 
-            rowprep = (SCIP_ROWPREP*) SCIPgetPtrarrayVal(scip, rowpreps2, r);
-            assert(rowprep != NULL);
+            SCIP_CALL( startProbing(scip, nlhdlrdata, nlhdlrexprdata, indicator, probingvars, probingdoms, nprobingvars,
+                  nlhdlrexprdata->vars, nlhdlrexprdata->nvars, sol, &solcopy, &cutoff_probing) );
 
-#ifdef SCIP_DEBUG
-            SCIPinfoMessage(scip, NULL, "rowprep for expr ");
-            SCIPprintConsExprExpr(scip, conshdlr, expr, NULL);
-            SCIPinfoMessage(scip, NULL, "rowprep before perspectivy is: \n");
-            SCIPprintRowprep(scip, rowprep, NULL);
+#ifndef NDEBUG
+            for( v = 0; v < nlhdlrexprdata->nvars; ++v )
+            {
+               assert(solvals[v] == SCIPgetSolVal(scip, solcopy, nlhdlrexprdata->vars[v])); /*lint !e777*/
+            }
+            SCIPfreeBufferArray(scip, &solvals);
 #endif
 
-            /* given a rowprep: sum aixi + sum biyi + c, where xi are semicontinuous variables and yi are
-             * non-semicontinuous variables (which appear in expr linearly, which detect must have ensured),
-             * perspectivy the semicontinuous part by adding (1-z)(g0 - c - sum aix0i) (the constant is
-             * treated as belonging to the semicontinuous part)
-             */
-
-            /* we want cst0 = g0 - c - sum aix0i; first add g0 - c */
-            cst0 = nlhdlrexprdata->exprvals0[i] + rowprep->side;
+            if( propagate )
+            { /* we are in the root node and startProbing did propagation */
+               /* probing propagation might have detected infeasibility */
+               if( cutoff_probing )
+               {
+                  /* indicator == 1 is infeasible -> set indicator to 0 */
+                  SCIPfreeBufferArrayNull(scip, &probingvars);
+                  SCIPfreeBufferArrayNull(scip, &probingdoms);
 
-            maxcoef = 0.0;
+                  SCIP_CALL( SCIPendProbing(scip) );
 
-            for( v = 0; v < rowprep->nvars; ++v )
-            {
-               if( REALABS( rowprep->coefs[v]) > maxcoef )
-               {
-                  maxcoef = REALABS(rowprep->coefs[v]);
-               }
+                  SCIP_CALL( SCIPfixVar(scip, indicator, 0.0, &cutoff, &fixed) );
 
-               scvdata = getSCVarDataInd(nlhdlrdata->scvars, rowprep->vars[v], indicator, &pos);
+                  if( cutoff )
+                  {
+                     *result = SCIP_CUTOFF;
+                     goto TERMINATE;
+                  }
 
-               /* a non-semicontinuous variable must be linear in expr; skip it */
-               if( scvdata == NULL )
                   continue;
+               }
 
-               cst0 -= rowprep->coefs[v] * scvdata->vals0[pos];
-            }
-
-            /* only perspectivy when the absolute value of cst0 is not too small
-             * TODO on ex1252a there was cst0=0 - ok to still use the cut?
-            */
-            if( cst0 == 0.0 || maxcoef / REALABS(cst0) <= SCIP_CONSEXPR_CUTMAXRANGE )
-            {
-               /* update the rowprep by adding cst0 - cst0*z */
-               SCIPaddRowprepConstant(rowprep, cst0);
-               SCIP_CALL(SCIPaddRowprepTerm(scip, rowprep, indicator, -cst0));
-            }
-            else
-            {
-               SCIPfreeRowprep(scip, &rowprep);
-               continue;
+               /* probing propagation in the root node can provide better on/off bounds */
+               SCIP_CALL( tightenOnBounds(nlhdlrexprdata, nlhdlrdata->scvars, indicator) );
             }
-
-            SCIP_CALL(SCIPaddRowprepTerm(scip, rowprep, auxvar, -1.0));
-
-            SCIPdebugMsg(scip, "rowprep after perspectivy is: \n");
-#ifdef SCIP_DEBUG
-            SCIPprintRowprep(scip, rowprep, NULL);
-#endif
-
-            SCIP_CALL( SCIPsetPtrarrayVal(scip, rowpreps, nrowpreps, rowprep) );
-            SCIP_CALL( SCIPsetBoolarrayVal(scip, addedbranchscores2, nrowpreps, addedbranchscores2j) );
-            ++nrowpreps;
          }
 
-         SCIP_CALL( SCIPclearPtrarray(scip, rowpreps2) );
-      }
-
-      if( nlhdlrdata->adjrefpoint )
-         SCIP_CALL( SCIPfreeSol(scip, &soladj) );
+         /* use cuts from every suitable nlhdlr */
+         SCIP_CALL( estimatePerspective(scip, conshdlr, nlhdlr, expr, nlhdlrexprdata, i, solcopy, enfoposs, nenfos,
+               overestimate, addbranchscores, rowpreps2, rowpreps, addedbranchscores2, &nrowpreps) );
 
-      if( doprobingind )
-      {
-         SCIP_CALL( SCIPendProbing(scip) );
+         if( doprobingind )
+         {
+            SCIP_CALL( SCIPendProbing(scip) );
+         }
       }
 
       /* add all cuts found for indicator i */
@@ -2545,12 +4421,27 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
          (void) strcat(rowprep->name, "_persp_indicator_");
          (void) strcat(rowprep->name, SCIPvarGetName(indicator));
 
+         /* the violation is needed for the reward of the bandit and has to be computed before the rowprep is modified */
+         if( probingaction >= 0 )
+            maxcutviol = MAX(maxcutviol, SCIPgetRowprepViolation(scip, rowprep, sol, NULL));
+
+         SCIP_CALL( SCIPstartClock(scip, nlhdlrdata->rowpreptime) );
          SCIP_CALL( SCIPprocessConsExprRowprep(scip, conshdlr, nlhdlr, cons, expr, rowprep, overestimate, auxvar,
                auxvalue, allowweakcuts, SCIPgetBoolarrayVal(scip, addedbranchscores2, r), addbranchscores, solcopy,
                &resultr) );
+         SCIP_CALL( SCIPstopClock(scip, nlhdlrdata->rowpreptime) );
+         ++nlhdlrdata->ncutsgenerated;
+
+         if( resultr == SCIP_SEPARATED && nlhdlrdata->cutpool && sol == NULL && cons != NULL && !SCIPinProbing(scip) )
+         {
+            SCIP_CALL( addPoolCut(scip, nlhdlrdata, nlhdlrexprdata, cons, indicator, rowprep, solcopy) );
+         }
 
          if( resultr == SCIP_SEPARATED )
+         {
             *result = SCIP_SEPARATED;
+            ++nlhdlrdata->ncutsapplied;
+         }
          else if( resultr == SCIP_CUTOFF )
          {
             *result = SCIP_CUTOFF;
@@ -2572,7 +4463,7 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
       for( r = SCIPgetPtrarrayMinIdx(scip, rowpreps); r <= SCIPgetPtrarrayMaxIdx(scip, rowpreps); ++r )
       {
          rowprep = (SCIP_ROWPREP*) SCIPgetPtrarrayVal(scip, rowpreps, r);
-         SCIPfreeRowprep(scip, &rowprep);
+         SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
       }
 
       SCIPfreeBufferArrayNull(scip, &probingvars);
@@ -2580,6 +4471,24 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
       SCIP_CALL( SCIPclearPtrarray(scip, rowpreps) );
    }
 
+   /* update the bandit: the reward is the violation of the best cut relative to the violation of the auxiliary
+    * variable, and for probing the fraction of the time that was spent in probing is subtracted
+    */
+   if( probingaction >= 0 && *result != SCIP_CUTOFF )
+   {
+      SCIP_Real reward;
+      SCIP_Real totaltime;
+
+      reward = auxviol > 0.0 ? MIN(maxcutviol / auxviol, 2.0) / 2.0 : 0.0;
+
+      totaltime = SCIPgetClockTime(scip, nlhdlrdata->probingtime) + SCIPgetClockTime(scip, nlhdlrdata->estimatetime)
+         + SCIPgetClockTime(scip, nlhdlrdata->rowpreptime) - starttime;
+      if( probingaction == 1 && totaltime > 0.0 )
+         reward -= nlhdlrdata->probingcostweight * (SCIPgetClockTime(scip, nlhdlrdata->probingtime) - startprobingtime) / totaltime;
+
+      SCIP_CALL( SCIPbanditUpdate(nlhdlrexprdata->probingbandit, probingaction, MAX(reward, 0.0)) );
+   }
+
    /* generate cuts for the big-M indicators */
    for( i = 0; i < SCIPgetConsExprExprNBigMIndicators(expr); ++i )
    {
@@ -2635,7 +4544,7 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
          propagate = SCIPgetDepth(scip) == 0;
 
          SCIP_CALL( startProbing(scip, nlhdlrdata, nlhdlrexprdata, indicator, probingvars, probingdoms, nprobingvars,
-                                 sol, &solcopy, &cutoff_probing) );
+                                 nlhdlrexprdata->vars, nlhdlrexprdata->nvars, sol, &solcopy, &cutoff_probing) );
 
 #ifndef NDEBUG
          for( v = 0; v < nlhdlrexprdata->nvars; ++v )
@@ -2684,10 +4593,10 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
             if( SCIPvarGetStatus(nlhdlrexprdata->vars[v]) == SCIP_VARSTATUS_FIXED )
                continue;
 
-            scvdata = getSCVarDataInd(nlhdlrdata->scvars, nlhdlrexprdata->vars[v], indicator, &pos);
+            issc = getSCVarDataInd(nlhdlrdata->scvars, nlhdlrexprdata->vars[v], indicator, &pos);
 
             /* a non-semicontinuous variable will keep its value in soladj */
-            if( scvdata == NULL )
+            if( !issc )
             {
                SCIP_CALL( SCIPsetSolVal(scip, soladj, nlhdlrexprdata->vars[v],
                                         (SCIPgetSolVal(scip, solcopy, nlhdlrexprdata->vars[v]))) );
@@ -2695,8 +4604,8 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
             else
             {
                SCIP_CALL( SCIPsetSolVal(scip, soladj, nlhdlrexprdata->vars[v],
-                                        (SCIPgetSolVal(scip, solcopy, nlhdlrexprdata->vars[v]) - scvdata->vals0[pos]) / indval
-                                        + scvdata->vals0[pos]) );
+                                        (SCIPgetSolVal(scip, solcopy, nlhdlrexprdata->vars[v]) - nlhdlrdata->scvars->vals0[pos]) / indval
+                                        + nlhdlrdata->scvars->vals0[pos]) );
             }
 
          }
@@ -2730,7 +4639,7 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
          if( nlhdlrdata->adjrefpoint )
          {
             SCIP_CALL( SCIPevalauxConsExprNlhdlr(scip, nlhdlr2, expr, nlhdlr2exprdata, &nlhdlr2auxvalue, soladj) );
-            SCIPsetConsExprExprEnfoAuxValue(expr, j, nlhdlr2auxvalue);
+            SCIPsetConsExprExprEnfoAuxValue(expr, enfoposs[j], nlhdlr2auxvalue);
          }
 
          SCIP_CALL( SCIPgetConsExprExprAbsAuxViolation(scip, conshdlr, expr, nlhdlr2auxvalue, nlhdlrdata->adjrefpoint ? soladj : solcopy, &violationabs, NULL, NULL) );
@@ -2740,6 +4649,7 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
          SCIPdebugMsg(scip, "asking nonlinear handler %s to %sestimate\n", SCIPgetConsExprNlhdlrName(nlhdlr2), overestimate ? "over" : "under");
 
          /* ask the nonlinear handler for an estimator */
+         SCIP_CALL( SCIPstartClock(scip, nlhdlrdata->estimatetime) );
          if( nlhdlrdata->adjrefpoint )
          {
             SCIP_CALL( SCIPestimateConsExprNlhdlr(scip, conshdlr, nlhdlr2, expr,
@@ -2754,6 +4664,7 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
                                                   nlhdlr2auxvalue, overestimate, SCIPgetSolVal(scip, solcopy, auxvar),
                                                   rowpreps2, &success2, violation > 0 ? addbranchscores : FALSE, &addedbranchscores2j) );
          }
+         SCIP_CALL( SCIPstopClock(scip, nlhdlrdata->estimatetime) );
 
          minidx = SCIPgetPtrarrayMinIdx(scip, rowpreps2);
          maxidx = SCIPgetPtrarrayMaxIdx(scip, rowpreps2);
@@ -2772,8 +4683,10 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
 //            SCIPprintConsExprExpr(scip, conshdlr, expr, NULL);
 //            SCIPinfoMessage(scip, NULL, "\nfinding cst0 for cut ");
 //            SCIPprintRowprep(scip, rowprep, NULL);
+            SCIP_CALL( SCIPstartClock(scip, nlhdlrdata->indcoeftime) );
             SCIP_CALL( computeIndicatorCoef(scip, nlhdlrdata, rowprep, auxvar, indicator, SCIPgetConsExprExprBigMMax(expr), &cst0,
                                             SCIPgetConsExprExprBigMActivity(expr, i)) );
+            SCIP_CALL( SCIPstopClock(scip, nlhdlrdata->indcoeftime) );
 
             /* adjust and add the cut */
 
@@ -2816,7 +4729,7 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
             }
             else
             {
-               SCIPfreeRowprep(scip, &rowprep);
+               SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
                continue;
             }
 
@@ -2855,14 +4768,18 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
          (void) strcat(rowprep->name, "_persp_indicator_");
          (void) strcat(rowprep->name, SCIPvarGetName(indicator));
 
+         SCIP_CALL( SCIPstartClock(scip, nlhdlrdata->rowpreptime) );
          SCIP_CALL( SCIPprocessConsExprRowprep(scip, conshdlr, nlhdlr, cons, expr, rowprep, overestimate, auxvar,
                                                auxvalue, allowweakcuts, SCIPgetBoolarrayVal(scip, addedbranchscores2, r), addbranchscores, solcopy,
                                                &resultr) );
+         SCIP_CALL( SCIPstopClock(scip, nlhdlrdata->rowpreptime) );
+         ++nlhdlrdata->ncutsgenerated;
 
          if( resultr == SCIP_SEPARATED )
          {
             *result = SCIP_SEPARATED;
             ++nlhdlrdata->nbigmenfos;
+            ++nlhdlrdata->ncutsapplied;
          }
          else if( resultr == SCIP_CUTOFF )
          {
@@ -2886,7 +4803,7 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoPerspective)
       for( r = SCIPgetPtrarrayMinIdx(scip, rowpreps); r <= SCIPgetPtrarrayMaxIdx(scip, rowpreps); ++r )
       {
          rowprep = (SCIP_ROWPREP*) SCIPgetPtrarrayVal(scip, rowpreps, r);
-         SCIPfreeRowprep(scip, &rowprep);
+         SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
       }
 
       SCIPfreeBufferArrayNull(scip, &probingvars);
@@ -2945,6 +4862,17 @@ SCIP_RETCODE SCIPincludeConsExprNlhdlrPerspective(
       NLHDLR_ENFOPRIORITY, nlhdlrDetectPerspective, nlhdlrEvalauxPerspective, nlhdlrdata) );
    assert(nlhdlr != NULL);
 
+   /* include handler for events that signal changes of semicontinuous variables */
+   SCIP_CALL( SCIPincludeEventhdlrBasic(scip, &nlhdlrdata->eventhdlr, EVENTHDLR_NAME, EVENTHDLR_DESC,
+         processSCVarEvent, NULL) );
+   assert(nlhdlrdata->eventhdlr != NULL);
+
+   SCIP_CALL( SCIPcreateClock(scip, &nlhdlrdata->offvaluestime) );
+   SCIP_CALL( SCIPcreateClock(scip, &nlhdlrdata->probingtime) );
+   SCIP_CALL( SCIPcreateClock(scip, &nlhdlrdata->estimatetime) );
+   SCIP_CALL( SCIPcreateClock(scip, &nlhdlrdata->indcoeftime) );
+   SCIP_CALL( SCIPcreateClock(scip, &nlhdlrdata->rowpreptime) );
+
    SCIP_CALL( SCIPaddIntParam(scip, "constraints/expr/nlhdlr/" NLHDLR_NAME "/maxproprounds",
            "maximal number of propagation rounds in probing",
            &nlhdlrdata->maxproprounds, FALSE, DEFAULT_MAXPROPROUNDS, -1, INT_MAX, NULL, NULL) );
@@ -2981,6 +4909,41 @@ SCIP_RETCODE SCIPincludeConsExprNlhdlrPerspective(
          "whether to strengthen cuts for constraints with big-M structure",
          &nlhdlrdata->bigmcuts, FALSE, DEFAULT_BIGMCUTS, NULL, NULL) );
 
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/expr/nlhdlr/" NLHDLR_NAME "/batchprobing",
+         "whether to probe each indicator only once per separation round for all expressions depending on it",
+         &nlhdlrdata->batchprobing, FALSE, DEFAULT_BATCHPROBING, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/expr/nlhdlr/" NLHDLR_NAME "/probingcache",
+         "whether to reuse the result of probing propagation for an indicator if the local domains did not change",
+         &nlhdlrdata->probingcache, FALSE, DEFAULT_PROBINGCACHE, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/expr/nlhdlr/" NLHDLR_NAME "/cutpool",
+         "whether to store globally valid perspective cuts and reuse them before computing new ones",
+         &nlhdlrdata->cutpool, FALSE, DEFAULT_CUTPOOL, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddIntParam(scip, "constraints/expr/nlhdlr/" NLHDLR_NAME "/maxpoolcuts",
+         "maximal number of stored perspective cuts per expression",
+         &nlhdlrdata->maxpoolcuts, FALSE, DEFAULT_MAXPOOLCUTS, 0, INT_MAX, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/expr/nlhdlr/" NLHDLR_NAME "/closedform",
+         "whether to compute perspective tangents of exp, pow and entropy expressions in closed form",
+         &nlhdlrdata->closedform, FALSE, DEFAULT_CLOSEDFORM, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddBoolParam(scip, "constraints/expr/nlhdlr/" NLHDLR_NAME "/adaptiveprobing",
+         "whether a bandit algorithm decides for each expression whether probing is worth its cost",
+         &nlhdlrdata->adaptiveprobing, FALSE, DEFAULT_ADAPTIVEPROBING, NULL, NULL) );
+
+   SCIP_CALL( SCIPaddRealParam(scip, "constraints/expr/nlhdlr/" NLHDLR_NAME "/probingcostweight",
+         "weight of the fraction of time spent in probing that is subtracted from the reward of probing in adaptive probing",
+         &nlhdlrdata->probingcostweight, FALSE, DEFAULT_PROBINGCOSTWEIGHT, 0.0, 1.0, NULL, NULL) );
+
+
+   /* statistic table */
+   assert(SCIPfindTable(scip, TABLE_NAME_PERSPECTIVE) == NULL);
+   SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_PERSPECTIVE, TABLE_DESC_PERSPECTIVE, TRUE,
+         NULL, NULL, NULL, NULL, NULL, NULL, tableOutputPerspective,
+         NULL, TABLE_POSITION_PERSPECTIVE, TABLE_EARLIEST_STAGE_PERSPECTIVE) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_PERSPECTIVE), tableOutputJsonPerspective) );
 
    SCIPsetConsExprNlhdlrCopyHdlr(scip, nlhdlr, nlhdlrCopyhdlrPerspective);
    SCIPsetConsExprNlhdlrFreeHdlrData(scip, nlhdlr, nlhdlrFreehdlrdataPerspective);
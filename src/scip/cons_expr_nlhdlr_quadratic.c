@@ -627,7 +627,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateQuadratic)
    *success = FALSE;
    *addedbranchscores = FALSE;
 
-   SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
+   SCIP_CALL( SCIPcreateRowprepFromPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
 
    SCIPgetConsExprQuadraticData(quaddata, &constant, &nlinexprs, &linexprs, &lincoefs, &nquadexprs, &nbilinexprterms);
 
@@ -670,7 +670,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateQuadratic)
          nadjbilin == 0 && SCIPvarGetType(var) < SCIP_VARTYPE_CONTINUOUS, &coef, &constant, success);
       if( !*success )
       {
-         SCIPfreeRowprep(scip, &rowprep);
+         SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
          return SCIP_OKAY;
       }
 
@@ -701,7 +701,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateQuadratic)
          var2), &coef, &coef2, &constant, success);
       if( !*success )
       {
-         SCIPfreeRowprep(scip, &rowprep);
+         SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
          return SCIP_OKAY;
       }
 
@@ -726,6 +726,168 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateQuadratic)
    return SCIP_OKAY;
 }
 
+/** nonlinear handler batch estimation callback
+ *
+ * The part of the gradient estimator that does not depend on the point, i.e., the constant and the linear terms, is
+ * set up once and copied for every point. Only the linearizations of the square and bilinear terms are computed
+ * per point, using the solution values of the quadratic variables.
+ */
+static
+SCIP_DECL_CONSEXPR_NLHDLRESTIMATEBATCH(nlhdlrEstimateBatchQuadratic)
+{  /*lint --e{715}*/
+   SCIP_CONSEXPR_QUADEXPR* quaddata;
+   SCIP_CONSEXPR_EXPR** linexprs;
+   SCIP_ROWPREP* linrowprep;
+   SCIP_VAR** quadvars;
+   SCIP_Real* sqrcoefs;
+   SCIP_Real* quadvals;
+   SCIP_Real* bilincoefs;
+   SCIP_Bool* sqrintegral;
+   int* bilinidx1;
+   int* bilinidx2;
+   SCIP_Real* lincoefs;
+   SCIP_Real constant;
+   int nbilinexprterms;
+   int nquadexprs;
+   int nlinexprs;
+   int j;
+   int k;
+
+   assert(scip != NULL);
+   assert(expr != NULL);
+   assert(nlhdlrexprdata != NULL);
+   assert(rowpreps != NULL);
+   assert(nlhdlrexprdata->curvature != SCIP_EXPRCURV_UNKNOWN);
+   assert(!overestimate || nlhdlrexprdata->curvature == SCIP_EXPRCURV_CONCAVE);
+   assert( overestimate || nlhdlrexprdata->curvature == SCIP_EXPRCURV_CONVEX);
+
+   quaddata = nlhdlrexprdata->quaddata;
+   SCIPgetConsExprQuadraticData(quaddata, &constant, &nlinexprs, &linexprs, &lincoefs, &nquadexprs, &nbilinexprterms);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &quadvars, nquadexprs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sqrcoefs, nquadexprs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &sqrintegral, nquadexprs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &quadvals, nquadexprs) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &bilincoefs, nbilinexprterms) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &bilinidx1, nbilinexprterms) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &bilinidx2, nbilinexprterms) );
+
+   /* set up the part of the estimator that does not depend on the point: constant and linear terms */
+   SCIP_CALL( SCIPcreateRowprep(scip, &linrowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, FALSE) );
+   SCIP_CALL( SCIPensureRowprepSize(scip, linrowprep, nlinexprs + nquadexprs) );
+   SCIPaddRowprepConstant(linrowprep, constant);
+
+   for( j = 0; j < nlinexprs; ++j )
+   {
+      SCIP_CALL( SCIPaddRowprepTerm(scip, linrowprep, SCIPgetConsExprExprAuxVar(linexprs[j]), lincoefs[j]) );
+   }
+
+   for( j = 0; j < nquadexprs; ++j )
+   {
+      SCIP_CONSEXPR_EXPR* qexpr;
+      SCIP_Real lincoef;
+      int* adjbilin;
+      int nadjbilin;
+      int b;
+
+      SCIPgetConsExprQuadraticQuadTermData(quaddata, j, &qexpr, &lincoef, &sqrcoefs[j], &nadjbilin, &adjbilin, NULL);
+      assert(qexpr != NULL);
+
+      quadvars[j] = SCIPgetConsExprExprAuxVar(qexpr);
+      assert(quadvars[j] != NULL);
+      sqrintegral[j] = nadjbilin == 0 && SCIPvarGetType(quadvars[j]) < SCIP_VARTYPE_CONTINUOUS;
+
+      SCIP_CALL( SCIPaddRowprepTerm(scip, linrowprep, quadvars[j], lincoef) );
+
+      /* store bilinear terms as pairs of indices of quadratic variables */
+      for( b = 0; b < nadjbilin; ++b )
+      {
+         SCIP_CONSEXPR_EXPR* qexpr1;
+         int pos2;
+
+         SCIPgetConsExprQuadraticBilinTermData(quaddata, adjbilin[b], &qexpr1, NULL, &bilincoefs[adjbilin[b]], &pos2, NULL);
+
+         if( qexpr1 == qexpr )
+         {
+            bilinidx1[adjbilin[b]] = j;
+            bilinidx2[adjbilin[b]] = pos2;
+         }
+      }
+   }
+
+   for( k = 0; k < nsols; ++k )
+   {
+      SCIP_ROWPREP* rowprep;
+      SCIP_Bool success;
+
+      rowpreps[k] = NULL;
+
+      SCIP_CALL( SCIPgetSolVals(scip, sols[k], nquadexprs, quadvars, quadvals) );
+
+      SCIP_CALL( SCIPcopyRowprep(scip, &rowprep, linrowprep) );
+      SCIP_CALL( SCIPensureRowprepSize(scip, rowprep, nquadexprs + 2 * nbilinexprterms) );
+
+      /* add linearization of square terms */
+      success = TRUE;
+      for( j = 0; j < nquadexprs && success; ++j )
+      {
+         SCIP_Real coef = 0.0;
+         SCIP_Real cst = 0.0;
+
+         SCIPaddSquareLinearization(scip, sqrcoefs[j], quadvals[j], sqrintegral[j], &coef, &cst, &success);
+
+         SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, quadvars[j], coef) );
+         SCIPaddRowprepConstant(rowprep, cst);
+      }
+
+      /* add linearization of bilinear terms */
+      for( j = 0; j < nbilinexprterms && success; ++j )
+      {
+         SCIP_Real coef = 0.0;
+         SCIP_Real coef2 = 0.0;
+         SCIP_Real cst = 0.0;
+
+         SCIPaddBilinLinearization(scip, bilincoefs[j], quadvals[bilinidx1[j]], quadvals[bilinidx2[j]], &coef, &coef2,
+            &cst, &success);
+
+         SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, quadvars[bilinidx1[j]], coef) );
+         SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, quadvars[bilinidx2[j]], coef2) );
+         SCIPaddRowprepConstant(rowprep, cst);
+      }
+
+      if( !success )
+      {
+         SCIPfreeRowprep(scip, &rowprep);
+         continue;
+      }
+
+      /* merge coefficients that belong to same variable */
+      SCIPmergeRowprepTerms(scip, rowprep);
+
+      rowprep->local = FALSE;
+
+      (void) SCIPsnprintf(rowprep->name, SCIP_MAXSTRLEN, "%sestimate_quadratic%p_%s%d",
+         overestimate ? "over" : "under",
+         (void*)expr,
+         sols[k] != NULL ? "sol" : "lp",
+         sols[k] != NULL ? SCIPsolGetIndex(sols[k]) : SCIPgetNLPs(scip));
+
+      rowpreps[k] = rowprep;
+   }
+
+   SCIPfreeRowprep(scip, &linrowprep);
+
+   SCIPfreeBufferArray(scip, &bilinidx2);
+   SCIPfreeBufferArray(scip, &bilinidx1);
+   SCIPfreeBufferArray(scip, &bilincoefs);
+   SCIPfreeBufferArray(scip, &quadvals);
+   SCIPfreeBufferArray(scip, &sqrintegral);
+   SCIPfreeBufferArray(scip, &sqrcoefs);
+   SCIPfreeBufferArray(scip, &quadvars);
+
+   return SCIP_OKAY;
+}
+
 /** nonlinear handler forward propagation callback
  *
  * This method should solve the problem
@@ -1515,6 +1677,7 @@ SCIP_RETCODE SCIPincludeConsExprNlhdlrQuadratic(
    SCIPsetConsExprNlhdlrCopyHdlr(scip, nlhdlr, nlhdlrcopyHdlrQuadratic);
    SCIPsetConsExprNlhdlrFreeExprData(scip, nlhdlr, nlhdlrfreeExprDataQuadratic);
    SCIPsetConsExprNlhdlrSepa(scip, nlhdlr, NULL, NULL, nlhdlrEstimateQuadratic, NULL);
+   SCIPsetConsExprNlhdlrEstimateBatch(scip, nlhdlr, nlhdlrEstimateBatchQuadratic);
    SCIPsetConsExprNlhdlrProp(scip, nlhdlr, nlhdlrIntevalQuadratic, nlhdlrReversepropQuadratic);
 
    return SCIP_OKAY;
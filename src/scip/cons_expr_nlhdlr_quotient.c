@@ -52,6 +52,13 @@ struct SCIP_ConsExpr_NlhdlrExprData
    SCIP_Real             denomcoef;          /**< coefficient of the denominator */
    SCIP_Real             denomconst;         /**< constant of the denominator */
    SCIP_Real             constant;           /**< constant */
+
+   /* data below is derived from the coefficients once at detection, so that the propagation kernels do not
+    * need to recompute it in every call
+    */
+   SCIP_Bool             isunivariate;       /**< whether numerator and denominator expression are the same */
+   SCIP_Bool             isconstant;         /**< whether the quotient is constant, i.e., numcoef * denomconst = numconst * denomcoef */
+   SCIP_INTERVAL         asymptote;          /**< enclosure of numcoef / denomcoef, the limit of the quotient for infinite arguments */
 };
 
 /*
@@ -90,6 +97,11 @@ SCIP_RETCODE exprdataCreate(
    (*nlhdlrexprdata)->denomconst = denomconst;
    (*nlhdlrexprdata)->constant = constant;
 
+   (*nlhdlrexprdata)->isunivariate = (numexpr == denomexpr);
+   (*nlhdlrexprdata)->isconstant = (numcoef * denomconst - numconst * denomcoef == 0.0);
+   SCIPintervalSet(&(*nlhdlrexprdata)->asymptote, numcoef);
+   SCIPintervalDivScalar(SCIP_INTERVAL_INFINITY, &(*nlhdlrexprdata)->asymptote, (*nlhdlrexprdata)->asymptote, denomcoef);
+
    /* capture expressions */
    SCIPcaptureConsExprExpr(numexpr);
    SCIPcaptureConsExprExpr(denomexpr);
@@ -342,16 +354,22 @@ SCIP_RETCODE detectExpr(
    return SCIP_OKAY;
 }
 
-/** helper method to compute interval for (a x + b) / (c x + d) + e */
+/** interval evaluation kernel for the univariate quotient (a x + b) / (c x + d) + e
+ *
+ * Takes the data that depends on the coefficients only, i.e., whether the quotient is constant and an enclosure of
+ * its asymptote a / c, as precomputed arguments.
+ */
 static
-SCIP_INTERVAL intEvalQuotient(
+SCIP_INTERVAL intEvalQuotientUnivariate(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_INTERVAL         bnds,               /**< bounds on x */
    SCIP_Real             a,                  /**< coefficient in numerator */
    SCIP_Real             b,                  /**< constant in numerator */
    SCIP_Real             c,                  /**< coefficient in denominator */
    SCIP_Real             d,                  /**< constant in denominator */
-   SCIP_Real             e                   /**< constant */
+   SCIP_Real             e,                  /**< constant */
+   SCIP_Bool             isconstant,         /**< whether a d = b c */
+   SCIP_INTERVAL         asymptote           /**< enclosure of a / c */
    )
 {
    SCIP_INTERVAL result;
@@ -380,7 +398,7 @@ SCIP_INTERVAL intEvalQuotient(
    }
 
    /* a d = b c implies that f(x) = b / d + e, i.e., f is constant */
-   if( a*d - b*c == 0.0 )
+   if( isconstant )
    {
       SCIPintervalSet(&result, b / d + e);
       return result;
@@ -399,8 +417,7 @@ SCIP_INTERVAL intEvalQuotient(
       /* set the resulting interval to a / c if the bounds is infinite */
       if( SCIPisInfinity(scip, REALABS(val)) )
       {
-         SCIPintervalSet(&quotinterval, a);
-         SCIPintervalDivScalar(SCIP_INTERVAL_INFINITY, &quotinterval, quotinterval, c);
+         quotinterval = asymptote;
       }
       else
       {
@@ -426,15 +443,21 @@ SCIP_INTERVAL intEvalQuotient(
    return result;
 }
 
-/** helper method to compute reverse propagation for (a x + b) / (c x + d) + e */
+/** reverse propagation kernel for the univariate quotient (a x + b) / (c x + d) + e
+ *
+ * Takes the data that depends on the coefficients only, i.e., whether the quotient is constant and an enclosure of
+ * its asymptote a / c, as precomputed arguments.
+ */
 static
-SCIP_INTERVAL reversepropQuotient(
+SCIP_INTERVAL reversepropQuotientUnivariate(
    SCIP_INTERVAL         bnds,               /**< bounds on (a x + b) / (c x + d) + e */
    SCIP_Real             a,                  /**< coefficient in numerator */
    SCIP_Real             b,                  /**< constant in numerator */
    SCIP_Real             c,                  /**< coefficient in denominator */
    SCIP_Real             d,                  /**< constant in denominator */
-   SCIP_Real             e                   /**< constant */
+   SCIP_Real             e,                  /**< constant */
+   SCIP_Bool             isconstant,         /**< whether a d = b c */
+   SCIP_INTERVAL         asymptote           /**< enclosure of a / c */
    )
 {
    SCIP_INTERVAL result;
@@ -450,7 +473,7 @@ SCIP_INTERVAL reversepropQuotient(
    SCIPintervalSubScalar(SCIP_INTERVAL_INFINITY, &bnds, bnds, e);
 
    /* if the expression is constant or the limit lies inside the domain, nothing can be propagated */
-   if( a*d - b*c == 0.0 || (bnds.inf < a / c && bnds.sup > a / c) )
+   if( isconstant || (bnds.inf < asymptote.sup && bnds.sup > asymptote.inf) )
    {
       SCIPintervalSetEntire(SCIP_INTERVAL_INFINITY, &result);
       return result;
@@ -1034,7 +1057,7 @@ SCIP_DECL_CONSEXPR_NLHDLRDETECT(nlhdlrDetectQuotient)
       if( SCIPgetConsExprExprNAuxvarUses(expr) > 0 )
          *participating = SCIP_CONSEXPR_EXPRENFO_SEPABOTH;
 
-      if( (*nlhdlrexprdata)->numexpr == (*nlhdlrexprdata)->denomexpr )
+      if( (*nlhdlrexprdata)->isunivariate )
       {
          /* if univariate, then we also do inteval and reverseprop */
          *participating |= SCIP_CONSEXPR_EXPRENFO_ACTIVITY;
@@ -1109,11 +1132,11 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateQuotient)
    auxvarx = SCIPgetConsExprExprAuxVar(nlhdlrexprdata->numexpr);
    auxvary = SCIPgetConsExprExprAuxVar(nlhdlrexprdata->denomexpr);
 
-   SCIP_CALL( SCIPcreateRowprep(scip, &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
+   SCIP_CALL( SCIPcreateRowprepFromPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep, overestimate ? SCIP_SIDETYPE_LEFT : SCIP_SIDETYPE_RIGHT, TRUE) );
 
-   if( auxvarx == auxvary )
+   if( nlhdlrexprdata->isunivariate )
    {
-      assert(nlhdlrexprdata->numexpr == nlhdlrexprdata->denomexpr);
+      assert(auxvarx == auxvary);
 
       /* univariate case */
       SCIP_CALL( estimateUnivariateQuotient(scip, sol, auxvarx, nlhdlrexprdata->numcoef, nlhdlrexprdata->numconst,
@@ -1122,7 +1145,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateQuotient)
    }
    else
    {
-      assert(nlhdlrexprdata->numexpr != nlhdlrexprdata->denomexpr);
+      assert(auxvarx != auxvary);
 
       /* bivariate case */
       SCIP_CALL( estimateBivariateQuotient(scip, auxvarx, auxvary, SCIPgetConsExprExprAuxVar(expr), sol,
@@ -1137,7 +1160,7 @@ SCIP_DECL_CONSEXPR_NLHDLRESTIMATE(nlhdlrEstimateQuotient)
    }
    else
    {
-      SCIPfreeRowprep(scip, &rowprep);
+      SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
    }
 
    /* add branching scores if requested */
@@ -1180,14 +1203,15 @@ SCIP_DECL_CONSEXPR_NLHDLRINTEVAL(nlhdlrIntevalQuotient)
    /* it is not possible to compute tighter intervals if both expressions are different
     * we should not be called in this case, as we haven't said we would participate in this activity in detect
     */
-   assert(nlhdlrexprdata->numexpr == nlhdlrexprdata->denomexpr);
+   assert(nlhdlrexprdata->isunivariate);
 
    /* get activity of the numerator (= denominator) expression */
    bnds = SCIPgetConsExprExprActivity(scip, nlhdlrexprdata->numexpr);
 
    /* call interval evaluation for the univariate quotient expression */
-   *interval = intEvalQuotient(scip, bnds, nlhdlrexprdata->numcoef, nlhdlrexprdata->numconst,
-      nlhdlrexprdata->denomcoef, nlhdlrexprdata->denomconst, nlhdlrexprdata->constant);
+   *interval = intEvalQuotientUnivariate(scip, bnds, nlhdlrexprdata->numcoef, nlhdlrexprdata->numconst,
+      nlhdlrexprdata->denomcoef, nlhdlrexprdata->denomconst, nlhdlrexprdata->constant, nlhdlrexprdata->isconstant,
+      nlhdlrexprdata->asymptote);
 
    return SCIP_OKAY;
 }
@@ -1206,7 +1230,7 @@ SCIP_DECL_CONSEXPR_NLHDLRREVERSEPROP(nlhdlrReversepropQuotient)
    /* it is not possible to compute tighter intervals if both expressions are different
     * we should not be called in this case, as we haven't said we would participate in this activity in detect
     */
-   assert(nlhdlrexprdata->numexpr == nlhdlrexprdata->denomexpr);
+   assert(nlhdlrexprdata->isunivariate);
 
    SCIPdebugMsg(scip, "call reverse propagation for expression (%g %p + %g) / (%g %p + %g) + %g bounds [%g,%g]\n",
       nlhdlrexprdata->numcoef, (void*)nlhdlrexprdata->numexpr, nlhdlrexprdata->numconst,
@@ -1214,8 +1238,9 @@ SCIP_DECL_CONSEXPR_NLHDLRREVERSEPROP(nlhdlrReversepropQuotient)
       nlhdlrexprdata->constant, bounds.inf, bounds.sup);
 
    /* call reverse propagation */
-   result = reversepropQuotient(bounds, nlhdlrexprdata->numcoef, nlhdlrexprdata->numconst,
-      nlhdlrexprdata->denomcoef, nlhdlrexprdata->denomconst, nlhdlrexprdata->constant);
+   result = reversepropQuotientUnivariate(bounds, nlhdlrexprdata->numcoef, nlhdlrexprdata->numconst,
+      nlhdlrexprdata->denomcoef, nlhdlrexprdata->denomconst, nlhdlrexprdata->constant, nlhdlrexprdata->isconstant,
+      nlhdlrexprdata->asymptote);
 
    SCIPdebugMsg(scip, "try to tighten bounds of %p: [%g,%g] -> [%g,%g]\n",
       (void*)nlhdlrexprdata->numexpr, SCIPgetConsExprExprBounds(scip, conshdlr, nlhdlrexprdata->numexpr).inf,
@@ -41,7 +41,6 @@
 #include "scip/cons_expr_sum.h"
 #include "scip/cons_expr_var.h"
 #include "scip/debug.h"
-#include "nlpi/nlpi_ipopt.h"
 #include "scip/cons_expr_rowprep.h"
 
 
@@ -419,6 +418,49 @@ SCIP_Real evalSingleTerm(
    return result;
 }
 
+/** evaluates all terms \f$v_i^T x + \beta_i\f$ at once
+ *
+ *  The solution values of the auxiliary variables are gathered in a single pass and stored in auxvals, so that
+ *  separating several disaggregation cuts of the same cone does not need to look them up again for every cut.
+ */
+static
+SCIP_RETCODE evalAllTerms(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nonlinear handler expression data */
+   SCIP_SOL*             sol,                /**< solution */
+   SCIP_Real*            auxvals,            /**< buffer to store values of auxiliary variables (length nvars) */
+   SCIP_Real*            termvals            /**< buffer to store values of terms (length nterms) */
+   )
+{
+   SCIP_VAR** auxvars;
+   int i;
+   int k;
+
+   assert(scip != NULL);
+   assert(nlhdlrexprdata != NULL);
+   assert(auxvals != NULL);
+   assert(termvals != NULL);
+
+   SCIP_CALL( SCIPallocBufferArray(scip, &auxvars, nlhdlrexprdata->nvars) );
+
+   for( i = 0; i < nlhdlrexprdata->nvars; ++i )
+      auxvars[i] = SCIPgetConsExprExprAuxVar(nlhdlrexprdata->vars[i]);
+
+   SCIP_CALL( SCIPgetSolVals(scip, sol, nlhdlrexprdata->nvars, auxvars, auxvals) );
+
+   SCIPfreeBufferArray(scip, &auxvars);
+
+   for( k = 0; k < nlhdlrexprdata->nterms; ++k )
+   {
+      termvals[k] = nlhdlrexprdata->offsets[k];
+
+      for( i = nlhdlrexprdata->termbegins[k]; i < nlhdlrexprdata->termbegins[k + 1]; ++i )
+         termvals[k] += nlhdlrexprdata->transcoefs[i] * auxvals[nlhdlrexprdata->transcoefsidx[i]];
+   }
+
+   return SCIP_OKAY;
+}
+
 /** computes gradient cut for a 2D or 3D SOC. A 3D SOC looks like
  *  \f[
  *    \sqrt{ (v_1^T x + \beta_1)^2 + (v_2^T x + \beta_2)^2 } \leq v_3^T x + \beta_3
@@ -577,7 +619,7 @@ SCIP_RETCODE generateCutSolSOC(
  *  and the gradient cut is then \f$f(x^*, y^*) + \nabla f(x^*,y^*)((x,y) - (x^*, y^*)) \leq 0\f$.
  */
 static
-SCIP_RETCODE generateCutSolDisagg(
+SCIP_RETCODE generateCutSolDisaggVals(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_CONSEXPR_EXPR*   expr,               /**< expression */
    SCIP_CONS*            cons,               /**< the constraint that expr is part of */
@@ -585,7 +627,10 @@ SCIP_RETCODE generateCutSolDisagg(
    SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, /**< nonlinear handler expression data */
    int                   disaggidx,          /**< index of disaggregation to separate */
    SCIP_Real             mincutviolation,    /**< minimal required cut violation */
+   SCIP_Real*            auxvals,            /**< values of auxiliary variables in sol, see evalAllTerms() */
+   SCIP_Real             lhsval,             /**< value of the term with index disaggidx */
    SCIP_Real             rhsval,             /**< value of the rhs term */
+   SCIP_Real             disvarval,          /**< value of the disaggregation variable with index disaggidx */
    SCIP_ROW**            cut                 /**< pointer to store a cut */
    )
 {
@@ -598,8 +643,6 @@ SCIP_RETCODE generateCutSolDisagg(
    SCIP_VAR* cutvar;
    SCIP_Real cutcoef;
    SCIP_Real fvalue;
-   SCIP_Real disvarval;
-   SCIP_Real lhsval;
    SCIP_Real constant;
    SCIP_Real denominator;
    int ncutvars;
@@ -611,6 +654,7 @@ SCIP_RETCODE generateCutSolDisagg(
    assert(nlhdlrexprdata != NULL);
    assert(disaggidx < nlhdlrexprdata->nterms);
    assert(mincutviolation >= 0.0);
+   assert(auxvals != NULL);
    assert(cut != NULL);
 
    vars = nlhdlrexprdata->vars;
@@ -624,10 +668,6 @@ SCIP_RETCODE generateCutSolDisagg(
 
    *cut = NULL;
 
-   disvarval = SCIPgetSolVal(scip, sol, disvars[disaggidx]);
-
-   lhsval = evalSingleTerm(scip, nlhdlrexprdata, sol, disaggidx);
-
    denominator = SQRT(4.0 * SQR(lhsval) + SQR(rhsval - disvarval));
 
    /* compute value of function to be separated (f(x*,y*)) */
@@ -669,7 +709,7 @@ SCIP_RETCODE generateCutSolDisagg(
 
       SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, cutvar, cutcoef) );
 
-      constant += cutcoef * SCIPgetSolVal(scip, sol, cutvar);
+      constant += cutcoef * auxvals[transcoefsidx[i]];
    }
 
    /* add terms for v_n */
@@ -683,7 +723,7 @@ SCIP_RETCODE generateCutSolDisagg(
 
       SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, cutvar, cutcoef) );
 
-      constant += cutcoef * SCIPgetSolVal(scip, sol, cutvar);
+      constant += cutcoef * auxvals[transcoefsidx[i]];
    }
 
    /* add term for disvar: cutcoef is the the partial derivative w.r.t. the disaggregation variable */
@@ -692,7 +732,7 @@ SCIP_RETCODE generateCutSolDisagg(
 
    SCIP_CALL( SCIPaddRowprepTerm(scip, rowprep, cutvar, cutcoef) );
 
-   constant += cutcoef * SCIPgetSolVal(scip, sol, cutvar);
+   constant += cutcoef * disvarval;
 
    /* add side */
    SCIPaddRowprepSide(rowprep, constant - fvalue);
@@ -1935,6 +1975,7 @@ SCIP_RETCODE detectSocQuadraticComplex(
    SCIP_Bool rhsissoc;
    SCIP_Bool lhsissoc;
    SCIP_Bool isquadratic;
+   SCIP_Bool eigsuccess;
 
    assert(conshdlr != NULL);
    assert(expr != NULL);
@@ -1993,7 +2034,8 @@ SCIP_RETCODE detectSocQuadraticComplex(
    /* compute eigenvalues and vectors, A = PDP^t
     * note: eigvecmatrix stores P^t, i.e., P^t_{i,j} = eigvecmatrix[i*nvars+j]
     */
-   if( LapackDsyev(TRUE, nvars, eigvecmatrix, eigvals) != SCIP_OKAY )
+   SCIP_CALL( SCIPcomputeConsExprEigenDecomposition(scip, conshdlr, TRUE, nvars, eigvecmatrix, eigvals, &eigsuccess) );
+   if( !eigsuccess )
    {
       SCIPdebugMsg(scip, "Failed to compute eigenvalues and eigenvectors for expression:\n");
 
@@ -2531,6 +2573,9 @@ static
 SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoSoc)
 { /*lint --e{715}*/
    SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   SCIP_Real* auxvals;
+   SCIP_Real* termvals;
+   SCIP_Real* disvarvals;
    SCIP_Real rhsval;
    int ndisaggrs;
    int k;
@@ -2612,12 +2657,21 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoSoc)
       *result = SCIP_SEPARATED;
    }
 
+   /* evaluate all terms and disaggregation variables once instead of for every disaggregation cut */
+   SCIP_CALL( SCIPallocBufferArray(scip, &auxvals, nlhdlrexprdata->nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &termvals, nlhdlrexprdata->nterms) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &disvarvals, ndisaggrs) );
+
+   SCIP_CALL( evalAllTerms(scip, nlhdlrexprdata, sol, auxvals, termvals) );
+   SCIP_CALL( SCIPgetSolVals(scip, sol, ndisaggrs, nlhdlrexprdata->disvars, disvarvals) );
+
    for( k = 0; k < ndisaggrs && *result != SCIP_CUTOFF; ++k )
    {
       SCIP_ROW* row;
 
       /* compute gradient cut */
-      SCIP_CALL( generateCutSolDisagg(scip, expr, cons, sol, nlhdlrexprdata, k, SCIPgetLPFeastol(scip), rhsval, &row) );
+      SCIP_CALL( generateCutSolDisaggVals(scip, expr, cons, sol, nlhdlrexprdata, k, SCIPgetLPFeastol(scip), auxvals,
+            termvals[k], rhsval, disvarvals[k], &row) );
 
       if( row != NULL )
       {
@@ -2650,6 +2704,10 @@ SCIP_DECL_CONSEXPR_NLHDLRENFO(nlhdlrEnfoSoc)
       }
    }
 
+   SCIPfreeBufferArray(scip, &disvarvals);
+   SCIPfreeBufferArray(scip, &termvals);
+   SCIPfreeBufferArray(scip, &auxvals);
+
    return SCIP_OKAY;
 }
 
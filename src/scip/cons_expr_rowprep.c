@@ -45,6 +45,14 @@
 #define M_SQRT2 sqrt(2.0)
 #endif
 
+/** pool of rowpreps that can be reused */
+struct SCIP_RowPrepPool
+{
+   SCIP_ROWPREP**        rowpreps;           /**< rowpreps that are currently not in use */
+   int                   nrowpreps;          /**< number of rowpreps in pool */
+   int                   rowprepssize;       /**< size of rowpreps array */
+};
+
 /** creates a SCIP_ROWPREP datastructure
  *
  * Initial cut represents 0 <= 0.
@@ -114,6 +122,106 @@ SCIP_RETCODE SCIPcopyRowprep(
    return SCIP_OKAY;
 }
 
+/** creates a pool for reusing SCIP_ROWPREP datastructures */
+SCIP_RETCODE SCIPcreateRowprepPool(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWPREPPOOL**    pool                /**< buffer to store pointer to pool */
+   )
+{
+   assert(scip != NULL);
+   assert(pool != NULL);
+
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, pool) );
+
+   return SCIP_OKAY;
+}
+
+/** frees a pool of SCIP_ROWPREP datastructures and all rowpreps stored in it */
+void SCIPfreeRowprepPool(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWPREPPOOL**    pool                /**< pointer that stores pointer to pool */
+   )
+{
+   int i;
+
+   assert(scip != NULL);
+   assert(pool != NULL);
+   assert(*pool != NULL);
+
+   for( i = 0; i < (*pool)->nrowpreps; ++i )
+      SCIPfreeRowprep(scip, &(*pool)->rowpreps[i]);
+
+   SCIPfreeBlockMemoryArrayNull(scip, &(*pool)->rowpreps, (*pool)->rowprepssize);
+   SCIPfreeBlockMemory(scip, pool);
+}
+
+/** creates a SCIP_ROWPREP datastructure, reusing a rowprep from a pool if possible
+ *
+ * Initial row represents 0 <= 0.
+ */
+SCIP_RETCODE SCIPcreateRowprepFromPool(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWPREPPOOL*     pool,               /**< pool of rowpreps, or NULL */
+   SCIP_ROWPREP**        rowprep,            /**< buffer to store pointer to rowprep */
+   SCIP_SIDETYPE         sidetype,           /**< whether cut will be or lower-equal or larger-equal type */
+   SCIP_Bool             local               /**< whether cut will be valid only locally */
+   )
+{
+   assert(scip != NULL);
+   assert(rowprep != NULL);
+
+   if( pool == NULL || pool->nrowpreps == 0 )
+   {
+      SCIP_CALL( SCIPcreateRowprep(scip, rowprep, sidetype, local) );
+      return SCIP_OKAY;
+   }
+
+   *rowprep = pool->rowpreps[--pool->nrowpreps];
+   assert(*rowprep != NULL);
+
+   /* reset everything but the arrays */
+   (*rowprep)->nvars = 0;
+   (*rowprep)->side = 0.0;
+   (*rowprep)->sidetype = sidetype;
+   (*rowprep)->local = local;
+   (*rowprep)->name[0] = '\0';
+   (*rowprep)->recordmodifications = FALSE;
+   (*rowprep)->nmodifiedvars = 0;
+   (*rowprep)->modifiedside = FALSE;
+
+   return SCIP_OKAY;
+}
+
+/** gives a SCIP_ROWPREP datastructure back to a pool for later reuse */
+SCIP_RETCODE SCIPreleaseRowprepToPool(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWPREPPOOL*     pool,               /**< pool of rowpreps, or NULL */
+   SCIP_ROWPREP**        rowprep             /**< pointer that stores pointer to rowprep; set to NULL */
+   )
+{
+   assert(scip != NULL);
+   assert(rowprep != NULL);
+   assert(*rowprep != NULL);
+
+   if( pool == NULL )
+   {
+      SCIPfreeRowprep(scip, rowprep);
+      return SCIP_OKAY;
+   }
+
+   if( pool->nrowpreps == pool->rowprepssize )
+   {
+      int newsize = SCIPcalcMemGrowSize(scip, pool->nrowpreps + 1);
+      SCIP_CALL( SCIPreallocBlockMemoryArray(scip, &pool->rowpreps, pool->rowprepssize, newsize) );
+      pool->rowprepssize = newsize;
+   }
+
+   pool->rowpreps[pool->nrowpreps++] = *rowprep;
+   *rowprep = NULL;
+
+   return SCIP_OKAY;
+}
+
 /** ensures that rowprep has space for at least given number of additional terms
  *
  * Useful when knowing in advance how many terms will be added.
@@ -601,6 +709,13 @@ SCIP_RETCODE rowprepCleanupSortTerms(
       {
          SCIP_Real* abscoefs;
 
+         /* estimators are often already sorted, e.g., after a previous cleanup, so check this first */
+         for( i = 1; i < rowprep->nvars; ++i )
+            if( REALABS(rowprep->coefs[i-1]) < REALABS(rowprep->coefs[i]) )
+               break;
+         if( i == rowprep->nvars )
+            break;
+
          SCIP_CALL( SCIPallocBufferArray(scip, &abscoefs, rowprep->nvars) );
          for( i = 0; i < rowprep->nvars; ++i )
             abscoefs[i] = REALABS(rowprep->coefs[i]);
@@ -892,11 +1007,15 @@ SCIP_RETCODE rowprepCleanupIntegralCoefs(
 {
    SCIP_Real coef;
    SCIP_Real roundcoef;
+   SCIP_Real eps;
    int i;
 
    assert(scip != NULL);
    assert(rowprep != NULL);
 
+   /* we do the same as SCIPround() and SCIPisEQ(), but avoid the function calls in this loop */
+   eps = SCIPepsilon(scip);
+
    /* Coefficients smaller than epsilon are rounded to 0.0 when added to row and
     * coefficients very close to integral values are rounded to integers when added to LP.
     * Both cases can be problematic if variable value is very large (bad numerics).
@@ -911,8 +1030,8 @@ SCIP_RETCODE rowprepCleanupIntegralCoefs(
    for( i = 0; i < rowprep->nvars; ++i )
    {
       coef = rowprep->coefs[i];
-      roundcoef = SCIPround(scip, coef);
-      if( coef != roundcoef && SCIPisEQ(scip, coef, roundcoef) ) /*lint !e777*/
+      roundcoef = EPSROUND(coef, eps);
+      if( coef != roundcoef && EPSEQ(coef, roundcoef, eps) ) /*lint !e777*/
       {
          SCIP_Real xbnd;
          SCIP_VAR* var;
@@ -1447,12 +1566,26 @@ int SCIPscaleRowprep(
    if( v == 0.5 )
       --expon;
 
-   /* multiply each coefficient by 2^expon */
-   for( i = 0; i < rowprep->nvars; ++i )
-      rowprep->coefs[i] = ldexp(rowprep->coefs[i], expon);
+   /* multiply each coefficient and the side by 2^expon
+    * if 2^expon is a normalized number, then multiplying by it is exact (unless the result over- or underflows),
+    * so we can do this instead of calling ldexp for every coefficient
+    */
+   if( expon >= DBL_MIN_EXP && expon < DBL_MAX_EXP )
+   {
+      SCIP_Real scale = ldexp(1.0, expon);
 
-   /* multiply side by 2^expon */
-   rowprep->side = ldexp(rowprep->side, expon);
+      for( i = 0; i < rowprep->nvars; ++i )
+         rowprep->coefs[i] *= scale;
+
+      rowprep->side *= scale;
+   }
+   else
+   {
+      for( i = 0; i < rowprep->nvars; ++i )
+         rowprep->coefs[i] = ldexp(rowprep->coefs[i], expon);
+
+      rowprep->side = ldexp(rowprep->side, expon);
+   }
 
    return expon;
 }
@@ -63,6 +63,45 @@ SCIP_RETCODE SCIPcopyRowprep(
    SCIP_ROWPREP*         source              /**< rowprep to copy */
 );
 
+/** creates a pool for reusing SCIP_ROWPREP datastructures */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateRowprepPool(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWPREPPOOL**    pool                /**< buffer to store pointer to pool */
+);
+
+/** frees a pool of SCIP_ROWPREP datastructures and all rowpreps stored in it */
+SCIP_EXPORT
+void SCIPfreeRowprepPool(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWPREPPOOL**    pool                /**< pointer that stores pointer to pool */
+);
+
+/** creates a SCIP_ROWPREP datastructure, reusing a rowprep from a pool if possible
+ *
+ * Initial row represents 0 <= 0. A rowprep taken from the pool keeps its arrays for terms, so rowpreps created this
+ * way usually need no memory allocations. If pool is NULL, then this is the same as SCIPcreateRowprep().
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPcreateRowprepFromPool(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWPREPPOOL*     pool,               /**< pool of rowpreps, or NULL */
+   SCIP_ROWPREP**        rowprep,            /**< buffer to store pointer to rowprep */
+   SCIP_SIDETYPE         sidetype,           /**< whether cut will be or lower-equal or larger-equal type */
+   SCIP_Bool             local               /**< whether cut will be valid only locally */
+);
+
+/** gives a SCIP_ROWPREP datastructure back to a pool for later reuse
+ *
+ * The rowprep does not need to originate from the pool. If pool is NULL, then this is the same as SCIPfreeRowprep().
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPreleaseRowprepToPool(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_ROWPREPPOOL*     pool,               /**< pool of rowpreps, or NULL */
+   SCIP_ROWPREP**        rowprep             /**< pointer that stores pointer to rowprep; set to NULL */
+);
+
 /** ensures that rowprep has space for at least given number of additional terms
  *
  * Useful when knowing in advance how many terms will be added.
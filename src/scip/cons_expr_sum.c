@@ -745,7 +745,9 @@ static
 SCIP_DECL_CONSEXPR_EXPRINTEVAL(intevalSum)
 {  /*lint --e{715}*/
    SCIP_CONSEXPR_EXPRDATA* exprdata;
+   SCIP_INTERVAL* childintervals;
    SCIP_INTERVAL suminterval;
+   int nchildren;
    int c;
 
    assert(expr != NULL);
@@ -753,37 +755,34 @@ SCIP_DECL_CONSEXPR_EXPRINTEVAL(intevalSum)
    exprdata = SCIPgetConsExprExprData(expr);
    assert(exprdata != NULL);
 
-   SCIPintervalSet(interval, exprdata->constant);
+   nchildren = SCIPgetConsExprExprNChildren(expr);
 
-   SCIPdebugMsg(scip, "inteval %p with %d children: %.20g", (void*)expr, SCIPgetConsExprExprNChildren(expr), exprdata->constant);
+   SCIPdebugMsg(scip, "inteval %p with %d children: %.20g", (void*)expr, nchildren, exprdata->constant);
 
-   for( c = 0; c < SCIPgetConsExprExprNChildren(expr); ++c )
-   {
-      SCIP_INTERVAL childinterval;
+   SCIP_CALL( SCIPallocBufferArray(scip, &childintervals, nchildren) );
 
-      childinterval = SCIPgetConsExprExprActivity(scip, SCIPgetConsExprExprChildren(expr)[c]);
-      if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, childinterval) )
+   for( c = 0; c < nchildren; ++c )
+   {
+      childintervals[c] = SCIPgetConsExprExprActivity(scip, SCIPgetConsExprExprChildren(expr)[c]);
+      if( SCIPintervalIsEmpty(SCIP_INTERVAL_INFINITY, childintervals[c]) )
       {
          SCIPintervalSetEmpty(interval);
-         break;
-      }
+         SCIPfreeBufferArray(scip, &childintervals);
 
-      /* compute coefficients[c] * childinterval and add the result to the so far computed interval */
-      if( exprdata->coefficients[c] == 1.0 )
-      {
-         SCIPintervalAdd(SCIP_INTERVAL_INFINITY, interval, *interval, childinterval);
-      }
-      else
-      {
-         SCIPintervalMulScalar(SCIP_INTERVAL_INFINITY, &suminterval, childinterval, exprdata->coefficients[c]);
-         SCIPintervalAdd(SCIP_INTERVAL_INFINITY, interval, *interval, suminterval);
+         return SCIP_OKAY;
       }
 
-      SCIPdebugMsgPrint(scip, " %+.20g*[%.20g,%.20g]", exprdata->coefficients[c], childinterval.inf, childinterval.sup);
-
+      SCIPdebugMsgPrint(scip, " %+.20g*[%.20g,%.20g]", exprdata->coefficients[c], childintervals[c].inf, childintervals[c].sup);
    }
+
+   /* compute sum_c coefficients[c] * childinterval[c] with one change of the rounding mode and add the constant */
+   SCIPintervalScalprodScalars(SCIP_INTERVAL_INFINITY, &suminterval, nchildren, childintervals, exprdata->coefficients);
+   SCIPintervalAddScalar(SCIP_INTERVAL_INFINITY, interval, suminterval, exprdata->constant);
+
    SCIPdebugMsgPrint(scip, " = [%.20g,%.20g]\n", interval->inf, interval->sup);
 
+   SCIPfreeBufferArray(scip, &childintervals);
+
    return SCIP_OKAY;
 }
 
@@ -5563,9 +5563,34 @@ SCIP_RETCODE SCIPseparateKnapsackCuts(
    if( usegubs )
    {
       SCIP_GUBSET* gubset;
+      SCIP_Bool hasfracvals;
+      int j;
 
       SCIPdebugMsg(scip, "separate LMCI1-GUB cuts:\n");
 
+      /* the GUB partition is expensive to compute and only used if x* is fractional for the knapsack variables; thus,
+       * check this first in the same way as getCover(), which is still called to tighten the variables that do not
+       * fit into the knapsack
+       */
+      hasfracvals = FALSE;
+      for( j = 0; j < nvars && !hasfracvals; ++j )
+      {
+         hasfracvals = weights[j] <= capacity && !SCIPisFeasEQ(scip, solvals[j], 1.0)
+            && !SCIPisFeasEQ(scip, solvals[j], 0.0);
+      }
+
+      if( !hasfracvals )
+      {
+         modtransused = TRUE;
+         SCIP_CALL( getCover(scip, vars, nvars, weights, capacity, solvals, covervars, noncovervars, &ncovervars,
+               &nnoncovervars, &coverweight, &coverfound, modtransused, &ntightened, &fractional) );
+         assert(!fractional);
+
+         SCIPdebugMsg(scip, "   LMCI1-GUB terminated by no variable with fractional LP value.\n");
+
+         goto TERMINATE;
+      }
+
       /* initializes partion of knapsack variables into nonoverlapping GUB constraints */
       SCIP_CALL( GUBsetCreate(scip, &gubset, nvars, weights, capacity) );
 
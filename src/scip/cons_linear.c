@@ -1289,19 +1289,28 @@ void consdataRecomputeMinactivity(
    SCIP_CONSDATA*        consdata            /**< linear constraint data */
    )
 {
-   int i;
+   SCIP_Real activity;
+   SCIP_Real infinity;
+   SCIP_Real hugevalue;
    SCIP_Real bound;
+   SCIP_Real contribution;
+   int i;
 
-   consdata->minactivity = 0;
+   /* the limits are fetched once, so that the loop only consists of bound lookups, comparisons, and additions */
+   infinity = SCIPinfinity(scip);
+   hugevalue = SCIPgetHugeValue(scip);
+   activity = 0.0;
 
    for( i = consdata->nvars - 1; i >= 0; --i )
    {
       bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetLbLocal(consdata->vars[i]) : SCIPvarGetUbLocal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         consdata->minactivity += consdata->vals[i] * bound;
+      contribution = consdata->vals[i] * bound;
+      if( REALABS(bound) < infinity && REALABS(contribution) < hugevalue )
+         activity += contribution;
    }
 
+   consdata->minactivity = activity;
+
    /* the activity was just computed from scratch and is valid now */
    consdata->validminact = TRUE;
 
@@ -1316,19 +1325,28 @@ void consdataRecomputeMaxactivity(
    SCIP_CONSDATA*        consdata            /**< linear constraint data */
    )
 {
-   int i;
+   SCIP_Real activity;
+   SCIP_Real infinity;
+   SCIP_Real hugevalue;
    SCIP_Real bound;
+   SCIP_Real contribution;
+   int i;
 
-   consdata->maxactivity = 0;
+   /* the limits are fetched once, so that the loop only consists of bound lookups, comparisons, and additions */
+   infinity = SCIPinfinity(scip);
+   hugevalue = SCIPgetHugeValue(scip);
+   activity = 0.0;
 
    for( i = consdata->nvars - 1; i >= 0; --i )
    {
       bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetUbLocal(consdata->vars[i]) : SCIPvarGetLbLocal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         consdata->maxactivity += consdata->vals[i] * bound;
+      contribution = consdata->vals[i] * bound;
+      if( REALABS(bound) < infinity && REALABS(contribution) < hugevalue )
+         activity += contribution;
    }
 
+   consdata->maxactivity = activity;
+
    /* the activity was just computed from scratch and is valid now */
    consdata->validmaxact = TRUE;
 
@@ -1343,19 +1361,28 @@ void consdataRecomputeGlbMinactivity(
    SCIP_CONSDATA*        consdata            /**< linear constraint data */
    )
 {
-   int i;
+   SCIP_Real activity;
+   SCIP_Real infinity;
+   SCIP_Real hugevalue;
    SCIP_Real bound;
+   SCIP_Real contribution;
+   int i;
 
-   consdata->glbminactivity = 0;
+   /* the limits are fetched once, so that the loop only consists of bound lookups, comparisons, and additions */
+   infinity = SCIPinfinity(scip);
+   hugevalue = SCIPgetHugeValue(scip);
+   activity = 0.0;
 
    for( i = consdata->nvars - 1; i >= 0; --i )
    {
       bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetLbGlobal(consdata->vars[i]) : SCIPvarGetUbGlobal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         consdata->glbminactivity += consdata->vals[i] * bound;
+      contribution = consdata->vals[i] * bound;
+      if( REALABS(bound) < infinity && REALABS(contribution) < hugevalue )
+         activity += contribution;
    }
 
+   consdata->glbminactivity = activity;
+
    /* the activity was just computed from scratch and is valid now */
    consdata->validglbminact = TRUE;
 
@@ -1370,19 +1397,28 @@ void consdataRecomputeGlbMaxactivity(
    SCIP_CONSDATA*        consdata            /**< linear constraint data */
    )
 {
-   int i;
+   SCIP_Real activity;
+   SCIP_Real infinity;
+   SCIP_Real hugevalue;
    SCIP_Real bound;
+   SCIP_Real contribution;
+   int i;
 
-   consdata->glbmaxactivity = 0;
+   /* the limits are fetched once, so that the loop only consists of bound lookups, comparisons, and additions */
+   infinity = SCIPinfinity(scip);
+   hugevalue = SCIPgetHugeValue(scip);
+   activity = 0.0;
 
    for( i = consdata->nvars - 1; i >= 0; --i )
    {
       bound = (consdata->vals[i] > 0.0 ) ? SCIPvarGetUbGlobal(consdata->vars[i]) : SCIPvarGetLbGlobal(consdata->vars[i]);
-      if( !SCIPisInfinity(scip, bound) && !SCIPisInfinity(scip, -bound)
-         && !SCIPisHugeValue(scip, consdata->vals[i] * bound) && !SCIPisHugeValue(scip, -consdata->vals[i] * bound) )
-         consdata->glbmaxactivity += consdata->vals[i] * bound;
+      contribution = consdata->vals[i] * bound;
+      if( REALABS(bound) < infinity && REALABS(contribution) < hugevalue )
+         activity += contribution;
    }
 
+   consdata->glbmaxactivity = activity;
+
    /* the activity was just computed from scratch and is valid now */
    consdata->validglbmaxact = TRUE;
 
@@ -7053,7 +7089,15 @@ SCIP_RETCODE tightenVarBounds(
 
 #define MAXTIGHTENROUNDS 10
 
-/** tightens bounds of variables in constraint due to activity bounds */
+/** tightens bounds of variables in constraint due to activity bounds
+ *
+ *  The bounds are tightened one variable at a time on purpose: each tightening updates the activities through the
+ *  bound change events, so the variables that follow in the same pass already benefit from it, and each change gets
+ *  its own inference information for conflict analysis. The repropagation that these events trigger is cheap: the
+ *  events reset consdata->boundstightened, the loop below runs until no bound changes anymore since the last change
+ *  (or MAXTIGHTENROUNDS is reached), and the next call for this constraint returns early because boundstightened was
+ *  set again in that last pass.
+ */
 static
 SCIP_RETCODE tightenBounds(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -13521,6 +13565,13 @@ SCIP_RETCODE preprocessConstraintPairs(
          && ((negsignature0 | negsignature1) == negsignature0); /* negsignature0 >= negsignature1 (as bit vector) */
       cons1isequality = SCIPisEQ(scip, consdata1->lhs, consdata1->rhs);
       tryaggregation = (cons0isequality || cons1isequality) && (maxaggrnormscale > 0.0);
+
+      /* an aggregation needs common variables; if the signatures are disjoint, no variable with a non-fixed
+       * contribution appears in both constraints, and we avoid merging the supports of the pair only for aggregation
+       */
+      if( tryaggregation && ((possignature0 | negsignature0) & (possignature1 | negsignature1)) == 0 )
+         tryaggregation = FALSE;
+
       if( !cons0dominateslhs && !cons1dominateslhs && !cons0dominatesrhs && !cons1dominatesrhs
          && !coefsequal && !coefsnegated && !tryaggregation )
          continue;
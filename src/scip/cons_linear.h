@@ -125,6 +125,10 @@ SCIP_RETCODE SCIPincludeLinconsUpgrade(
 /** creates and captures a linear constraint
  *
  *  @note the constraint gets captured, hence at one point you have to release it using the method SCIPreleaseCons()
+ *
+ *  @note passing all coefficients at creation is cheaper than adding them one by one with SCIPaddCoefLinear(),
+ *        since the coefficient arrays are copied once instead of being grown repeatedly and the per-coefficient
+ *        bookkeeping of the constraint data (e.g., invalidating activities and the sorting status) is avoided
  */
 SCIP_EXPORT
 SCIP_RETCODE SCIPcreateConsLinear(
@@ -1790,13 +1790,16 @@ SCIP_RETCODE propagateFullOrbitopeCons(
       nrowsused = m;
    roworder = consdata->roworder;
 
-   /* Initialize lexicographically minimal matrix by fixed entries at the current node.
-    * Free entries in the last column are set to 0.
+   /* Initialize lexicographically minimal and maximal matrices by fixed entries at the current node in one pass, such
+    * that the local bounds of each variable are read only once. Free entries in the last column are set to 0 in the
+    * lexmin matrix and free entries in the first column are set to 1 in the lexmax matrix.
     */
    SCIP_CALL( SCIPallocBufferArray(scip, &lexminfixes, nrowsused) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lexmaxfixes, nrowsused) );
    for (i = 0; i < nrowsused; ++i)
    {
       SCIP_CALL( SCIPallocBufferArray(scip, &lexminfixes[i], n) ); /*lint !e866*/
+      SCIP_CALL( SCIPallocBufferArray(scip, &lexmaxfixes[i], n) ); /*lint !e866*/
    }
 
    for (i = 0; i < nrowsused; ++i)
@@ -1808,11 +1811,20 @@ SCIP_RETCODE propagateFullOrbitopeCons(
       for (j = 0; j < n; ++j)
       {
          if ( SCIPvarGetLbLocal(vars[origrow][j]) > 0.5 )
+         {
             lexminfixes[i][j] = 1;
-         else if ( SCIPvarGetUbLocal(vars[origrow][j]) < 0.5 || j == n - 1 )
+            lexmaxfixes[i][j] = 1;
+         }
+         else if ( SCIPvarGetUbLocal(vars[origrow][j]) < 0.5 )
+         {
             lexminfixes[i][j] = 0;
+            lexmaxfixes[i][j] = 0;
+         }
          else
-            lexminfixes[i][j] = 2;
+         {
+            lexminfixes[i][j] = j == n - 1 ? 0 : 2;
+            lexmaxfixes[i][j] = j == 0 ? 1 : 2;
+         }
       }
    }
 
@@ -1820,41 +1832,15 @@ SCIP_RETCODE propagateFullOrbitopeCons(
    SCIP_CALL( findLexMinFace(vars, lexminfixes, roworder, NULL, infeasible, m, n,
          nrowsused, NULL, FALSE) );
 
-   if ( *infeasible == TRUE )
-      goto FREELEXMIN;
-
-   /* Initialize lexicographically maximal matrix by fixed entries at the current node.
-    * Free entries in the first column are set to 1.
-    */
-   SCIP_CALL( SCIPallocBufferArray(scip, &lexmaxfixes, nrowsused) );
-   for (i = 0; i < nrowsused; ++i)
-   {
-      SCIP_CALL( SCIPallocBufferArray(scip, &lexmaxfixes[i], n) ); /*lint !e866*/
-   }
-
-   for (i = 0; i < nrowsused; ++i)
-   {
-      int origrow;
-
-      origrow = roworder[i];
-
-      for (j = 0; j < n; ++j)
-      {
-         if ( SCIPvarGetUbLocal(vars[origrow][j]) < 0.5 )
-            lexmaxfixes[i][j] = 0;
-         else if ( SCIPvarGetLbLocal(vars[origrow][j]) > 0.5 || j == 0 )
-            lexmaxfixes[i][j] = 1;
-         else
-            lexmaxfixes[i][j] = 2;
-      }
-   }
+   if ( *infeasible )
+      goto FREELEXMATRICES;
 
    /* find lexicographically maximal face of hypercube containing lexmax fixes */
    SCIP_CALL( findLexMaxFace(vars, lexmaxfixes, roworder, NULL, infeasible, m, n,
          nrowsused, NULL, FALSE) );
 
    if ( *infeasible )
-      goto FREELEXMAX;
+      goto FREELEXMATRICES;
 
    /* Find for each column j the minimal row in which lexminfixes and lexmaxfixes differ. Fix all entries above this
     * row to the corresponding value in lexminfixes (or lexmaxfixes).
@@ -1883,14 +1869,13 @@ SCIP_RETCODE propagateFullOrbitopeCons(
       }
    }
 
- FREELEXMAX:
-   for (i = 0; i < nrowsused; ++i)
+ FREELEXMATRICES:
+   for (i = nrowsused - 1; i >= 0; --i)
+   {
       SCIPfreeBufferArray(scip, &lexmaxfixes[i]);
-   SCIPfreeBufferArray(scip, &lexmaxfixes);
-
- FREELEXMIN:
-   for (i = 0; i < nrowsused; ++i)
       SCIPfreeBufferArray(scip, &lexminfixes[i]);
+   }
+   SCIPfreeBufferArray(scip, &lexmaxfixes);
    SCIPfreeBufferArray(scip, &lexminfixes);
 
    return SCIP_OKAY;
@@ -27,6 +27,13 @@
  * \f]
  * where all x are binary and all c are integer
  *
+ * Each product is represented by an and-constraint whose resultant replaces the product in an underlying linear
+ * constraint (possibly upgraded to knapsack, setppc, or logicor). This handler does not propagate itself: the linear
+ * constraint propagates with its minimal and maximal activities over the resultants, which corresponds to slack
+ * tracking over the terms, and the and-constraints pass fixings of resultants to and from their operands with watched
+ * variables. A native propagation over the terms would not derive more reductions, and the same linearization is
+ * needed for the LP relaxation anyway.
+ *
  * @todo Add eventhandling.
  */
 
@@ -18,6 +18,10 @@
  * @brief  constraint handler for quadratic constraints \f$\textrm{lhs} \leq \sum_{i,j=1}^n a_{i,j} x_ix_j + \sum_{i=1}^n b_i x_i \leq \textrm{rhs}\f$
  * @author Stefan Vigerske
  *
+ * @note This handler, like cons_nonlinear, cons_abspower, cons_bivariate, and cons_soc, is not compiled into libscip
+ *       and not included by SCIPincludeDefaultPlugins() anymore. All readers create expression constraints
+ *       (cons_expr) directly, so quadratic structure is detected once by the expression handler's nonlinear handlers
+ *       and no translation from a legacy constraint is needed.
  */
 
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
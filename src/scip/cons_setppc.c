@@ -8748,6 +8748,13 @@ SCIP_DECL_CONSGETNVARS(consGetNVarsSetppc)
  * Callback methods of event handler
  */
 
+/** processes the bound change events of the variables of a set partitioning / packing / covering constraint
+ *
+ *  Each event only updates the counters of fixed variables in O(1); the variables are only scanned in
+ *  processFixings() when the counters show that the constraint can propagate. Replacing the counters by bitsets of
+ *  the fixing status would not reduce the number of events, since every constraint of a variable has to be informed
+ *  about its fixing anyway, and would need additional memory per constraint and variable.
+ */
 static
 SCIP_DECL_EVENTEXEC(eventExecSetppc)
 {  /*lint --e{715}*/
@@ -334,11 +334,10 @@ SCIP_Bool isConnectedSOS1(
    /* for debugging */
    if ( adjacencymatrix == NULL )
    {
-      int succvertex;
       int* succ;
       int nsucc1;
       int nsucc2;
-      int j;
+      int pos;
 
       nsucc1 = SCIPdigraphGetNSuccessors(conflictgraph, vertex1);
       nsucc2 = SCIPdigraphGetNSuccessors(conflictgraph, vertex2);
@@ -352,17 +351,11 @@ SCIP_Bool isConnectedSOS1(
          SCIPswapInts(&nsucc1, &nsucc2);
       }
 
+      /* sorting is cheap if the successors are already sorted from a previous call */
       succ = SCIPdigraphGetSuccessors(conflictgraph, vertex1);
       SCIPsortInt(succ, nsucc1);
 
-      for (j = 0; j < nsucc1; ++j)
-      {
-         succvertex = succ[j];
-         if ( succvertex == vertex2 )
-            return TRUE;
-         else if ( succvertex > vertex2 )
-            return FALSE;
-      }
+      return SCIPsortedvecFindInt(succ, vertex2, nsucc1, &pos);
    }
    else
    {
@@ -4444,7 +4444,17 @@ SCIP_DECL_CONSCHECK(consCheckVarbound)
 }
 
 
-/** domain propagation method of constraint handler */
+/** domain propagation method of constraint handler
+ *
+ *  Only constraints marked by the bound change event handler are propagated, so each bound change costs one event
+ *  and at most one call of propagateCons() per constraint containing the variable. The same relation is also known to
+ *  prop_vbounds, since presolving adds it as variable lower/upper bound of x (see consdata->varboundsadded), but the
+ *  two propagations are not redundant: prop_vbounds only sees the relation after it has been added in presolving, can
+ *  be disabled independently, and propagates chains of variable bounds globally in topological order, whereas
+ *  propagateCons() handles the constraint with its current sides and coefficient and resolves its own reductions in
+ *  conflict analysis with bound widening. Letting one of them skip the relation would therefore lose reductions
+ *  whenever the other one is disabled or has not seen the relation yet.
+ */
 static
 SCIP_DECL_CONSPROP(consPropVarbound)
 {  /*lint --e{715}*/
@@ -111,14 +111,20 @@
 
 #define NROWS 5
 
+#define WORDBITS                     64 /**< number of matrix columns stored in one word of a bit-packed row */
+#define GETENTRY(row, j)  ( ((row)[(j) / WORDBITS] >> ((j) % WORDBITS)) & 1 ) /**< entry in column j of bit-packed row */
+
 
 /*
  * Data structures
  */
 
-/** type used for matrix entries in function checkGauss() */
+/** type used for rhs and solution entries in function checkGauss() */
 typedef unsigned short Type;
 
+/** type used for the words of the bit-packed matrix rows in function checkGauss() */
+typedef uint64_t Word;
+
 /** constraint data for xor constraints */
 struct SCIP_ConsData
 {
@@ -2138,6 +2144,8 @@ SCIP_RETCODE separateCons(
  *  Here, \f$A \in R^{m \times n},\; b \in R^m\f$. On exit, the vector @p p contains a permutation of the row indices
  *  used for pivoting and the function returns the rank @p r of @p A. For each row \f$i = 1, \ldots, r\f$, the entry @p
  *  s[i] contains the column index of the first nonzero in row @p i.
+ *
+ *  The rows of @p A are bit-packed (@see GETENTRY()), so that eliminating a row is a sequence of word-wise xors.
  */
 static
 int computeRowEcholonGF2(
@@ -2146,20 +2154,24 @@ int computeRowEcholonGF2(
    int                   n,                  /**< number of columns */
    int*                  p,                  /**< row permutation */
    int*                  s,                  /**< steps indicators of the row echolon form */
-   Type**                A,                  /**< matrix */
+   Word**                A,                  /**< bit-packed matrix */
    Type*                 b                   /**< rhs */
    )
 {
+   int nwords;
    int pi;
    int i;
    int j;
    int k;
+   int w;
 
    assert( A != NULL );
    assert( b != NULL );
    assert( p != NULL );
    assert( s != NULL );
 
+   nwords = (n + WORDBITS - 1) / WORDBITS;
+
    /* init permutation and step indicators */
    for (i = 0; i < m; ++i)
    {
@@ -2183,7 +2195,7 @@ int computeRowEcholonGF2(
       {
          /* search in current column j */
          k = i;
-         while ( k < m && A[p[k]][j] == 0 )
+         while ( k < m && GETENTRY(A[p[k]], j) == 0 )
             ++k;
 
          /* found pivot */
@@ -2205,7 +2217,7 @@ int computeRowEcholonGF2(
 
       /* store step index */
       s[i] = j;
-      assert( A[p[k]][j] != 0 );
+      assert( GETENTRY(A[p[k]], j) != 0 );
 
       /* swap row indices */
       if ( k != i )
@@ -2215,17 +2227,17 @@ int computeRowEcholonGF2(
          p[k] = h;
       }
       pi = p[i];
-      assert( A[pi][s[i]] != 0 );
+      assert( GETENTRY(A[pi], s[i]) != 0 );
 
-      /* do elimination */
+      /* do elimination; the pivot row has no nonzeros in front of column s[i], so we can start with the word of s[i] */
       for (k = i+1; k < m; ++k)
       {
          int pk = p[k];
          /* if entry in leading column is nonzero (otherwise we already have a 0) */
-         if ( A[pk][s[i]] != 0 )
+         if ( GETENTRY(A[pk], s[i]) != 0 )
          {
-            for (j = s[i]; j < n; ++j)
-               A[pk][j] = A[pk][j] ^ A[pi][j];  /*lint !e732*/
+            for (w = s[i] / WORDBITS; w < nwords; ++w)
+               A[pk][w] ^= A[pi][w];
             b[pk] = b[pk] ^ b[pi];  /*lint !e732*/
          }
       }
@@ -2255,7 +2267,7 @@ void solveRowEcholonGF2(
    int                   r,                  /**< rank of matrix */
    int*                  p,                  /**< row permutation */
    int*                  s,                  /**< steps indicators of the row echolon form */
-   Type**                A,                  /**< matrix */
+   Word**                A,                  /**< bit-packed matrix */
    Type*                 b,                  /**< rhs */
    Type*                 x                   /**< solution vector on exit */
    )
@@ -2289,7 +2301,7 @@ void solveRowEcholonGF2(
       for (k = i+1; k < r; ++k)
       {
          assert( i <= s[k] && s[k] <= n );
-         if ( A[p[i]][s[k]] != 0 )
+         if ( GETENTRY(A[p[i]], s[k]) != 0 )
             val = val ^ x[s[k]];  /*lint !e732*/
       }
 
@@ -2327,7 +2339,7 @@ SCIP_RETCODE checkSystemGF2(
    SCIP_Real* xorvals;
    SCIP_VAR** xorvars;
    SCIP_Bool noaggr = TRUE;
-   Type** A;
+   Word** A;
    Type* b;
    int* s;
    int* p;
@@ -2336,6 +2348,7 @@ SCIP_RETCODE checkSystemGF2(
    int nconssactive = 0;
    int nconssmat = 0;
    int nvarsmat = 0;
+   int nwords;
    int nvars;
    int rank;
    int i;
@@ -2463,7 +2476,8 @@ SCIP_RETCODE checkSystemGF2(
       xorbackidx[xoridx[j]] = j;
    }
 
-   /* init matrix and rhs */
+   /* init bit-packed matrix and rhs */
+   nwords = (nvarsmat + WORDBITS - 1) / WORDBITS;
    SCIP_CALL( SCIPallocBufferArray(scip, &b, nconssactive) );
    SCIP_CALL( SCIPallocBufferArray(scip, &A, nconssactive) );
    for (i = 0; i < nconss; ++i)
@@ -2476,8 +2490,8 @@ SCIP_RETCODE checkSystemGF2(
       assert( consdata != NULL );
       assert( consdata->nvars > 0 );
 
-      SCIP_CALL( SCIPallocBufferArray(scip, &(A[nconssmat]), nvarsmat) ); /*lint !e866*/
-      BMSclearMemoryArray(A[nconssmat], nvarsmat); /*lint !e866*/
+      SCIP_CALL( SCIPallocBufferArray(scip, &(A[nconssmat]), nwords) ); /*lint !e866*/
+      BMSclearMemoryArray(A[nconssmat], nwords); /*lint !e866*/
 
       /* correct rhs w.r.t. to fixed variables and count nonfixed variables in constraint */
       b[nconssmat] = (Type) consdata->rhs;
@@ -2552,7 +2566,7 @@ SCIP_RETCODE checkSystemGF2(
                idx = SCIPhashmapGetImageInt(varhash, var);
                assert( idx < nvarsmat );
                assert( 0 <= xorbackidx[idx] && xorbackidx[idx] < nvarsmat );
-               A[nconssmat][xorbackidx[idx]] = 1;
+               A[nconssmat][xorbackidx[idx] / WORDBITS] |= (Word) 1 << (xorbackidx[idx] % WORDBITS);
             }
          }
       }
@@ -2570,7 +2584,7 @@ SCIP_RETCODE checkSystemGF2(
    for (i = 0; i < nconssmat; ++i)
    {
       for (j = 0; j < nvarsmat; ++j)
-         SCIPinfoMessage(scip, NULL, "%d ", A[i][j]);
+         SCIPinfoMessage(scip, NULL, "%d ", (int) GETENTRY(A[i], j));
       SCIPinfoMessage(scip, NULL, " = %d\n", b[i]);
    }
    SCIPinfoMessage(scip, NULL, "\n");
@@ -2591,7 +2605,7 @@ SCIP_RETCODE checkSystemGF2(
       for (i = 0; i < nconssmat; ++i)
       {
          for (j = 0; j < nvarsmat; ++j)
-            SCIPinfoMessage(scip, NULL, "%d ", A[p[i]][j]);
+            SCIPinfoMessage(scip, NULL, "%d ", (int) GETENTRY(A[p[i]], j));
          SCIPinfoMessage(scip, NULL, " = %d\n", b[p[i]]);
       }
       SCIPinfoMessage(scip, NULL, "\n");
@@ -41,6 +41,7 @@
 
 #include "scip/struct_cutpool.h"
 
+#define CUTPOOL_MINBATCHCUTS        100 /**< minimal number of cuts to process for computing their LP activities at once */
 
 
 /*
@@ -61,9 +62,8 @@ SCIP_DECL_HASHGETKEY(hashGetKeyCut)
    return cut->row;
 }
 
-/** returns TRUE iff both cuts are identical */
-static
-SCIP_DECL_HASHKEYEQ(hashKeyEqCut)
+/** returns TRUE iff both rows are identical up to scaling, ignoring the sides; the user pointer is the global settings */
+SCIP_DECL_HASHKEYEQ(SCIPcutpoolHashKeyEqRow)
 {  /*lint --e{715}*/
    SCIP_ROW* row1;
    SCIP_ROW* row2;
@@ -242,8 +242,10 @@ SCIP_DECL_HASHKEYEQ(hashKeyEqCut)
    return TRUE;
 }
 
-static
-SCIP_DECL_HASHKEYVAL(hashKeyValCut)
+/** returns the hash value of a row that is compatible with SCIPcutpoolHashKeyEqRow(); the user pointer is the global
+ *  settings
+ */
+SCIP_DECL_HASHKEYVAL(SCIPcutpoolHashKeyValRow)
 {  /*lint --e{715}*/
    SCIP_ROW* row;
    int i;
@@ -410,6 +412,123 @@ SCIP_Real SCIPcutGetLPActivityQuot(
    return (nlpsaftercreation > 0 ? activeinlpcounter / (SCIP_Real)nlpsaftercreation : 0.0);
 }
 
+/** extends the row-wise mirror of the cuts to all cuts of the pool */
+static
+SCIP_RETCODE cutpoolUpdateMatrix(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   int nnz;
+   int c;
+   int i;
+
+   assert(cutpool != NULL);
+   assert(cutpool->nmatcuts <= cutpool->ncuts);
+
+   if( cutpool->nmatcuts == cutpool->ncuts )
+      return SCIP_OKAY;
+
+   if( cutpool->matbegsize < cutpool->ncuts + 1 )
+   {
+      int newsize = SCIPsetCalcMemGrowSize(set, cutpool->ncuts + 1);
+      SCIP_ALLOC( BMSreallocMemoryArray(&cutpool->matbeg, newsize) );
+      cutpool->matbegsize = newsize;
+   }
+
+   if( cutpool->nmatcuts == 0 )
+      cutpool->matbeg[0] = 0;
+
+   /* count the nonzeros of the cuts to append */
+   nnz = cutpool->matbeg[cutpool->nmatcuts];
+   for( c = cutpool->nmatcuts; c < cutpool->ncuts; ++c )
+      nnz += cutpool->cuts[c]->row->len;
+
+   if( cutpool->matsize < nnz )
+   {
+      int newsize = SCIPsetCalcMemGrowSize(set, nnz);
+      SCIP_ALLOC( BMSreallocMemoryArray(&cutpool->matcolidx, newsize) );
+      SCIP_ALLOC( BMSreallocMemoryArray(&cutpool->matvals, newsize) );
+      cutpool->matsize = newsize;
+   }
+
+   /* rows in the pool are locked, so their coefficients do not change while they are mirrored */
+   nnz = cutpool->matbeg[cutpool->nmatcuts];
+   for( c = cutpool->nmatcuts; c < cutpool->ncuts; ++c )
+   {
+      SCIP_ROW* row = cutpool->cuts[c]->row;
+
+      assert(row->nlocks > 0);
+
+      for( i = 0; i < row->len; ++i )
+      {
+         cutpool->matcolidx[nnz] = row->cols[i]->index;
+         cutpool->matvals[nnz] = row->vals[i];
+         ++nnz;
+      }
+      cutpool->matbeg[c+1] = nnz;
+   }
+   cutpool->nmatcuts = cutpool->ncuts;
+
+   return SCIP_OKAY;
+}
+
+/** computes the activities in the current LP solution of all cuts from a given position on that are not in the LP
+ *  and whose activity is not up to date, as one product of the mirrored cuts with the LP solution
+ *
+ *  The activities are stored in the rows, where they are picked up by SCIProwGetLPEfficacy().
+ */
+static
+SCIP_RETCODE cutpoolComputeLPActivities(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_LP*              lp,                 /**< current LP data */
+   int                   firstcut            /**< first cut to consider */
+   )
+{
+   SCIP_Real* primsol;
+   int c;
+   int i;
+
+   assert(cutpool != NULL);
+   assert(lp != NULL);
+   assert(lp->validsollp == stat->lpcount);
+
+   SCIP_CALL( cutpoolUpdateMatrix(cutpool, set) );
+
+   /* solution values of all columns, indexed by SCIP_COL::index; columns that are not in the LP contribute 0 */
+   SCIP_CALL( SCIPsetAllocCleanBufferArray(set, &primsol, stat->ncolidx) );
+   for( i = 0; i < lp->ncols; ++i )
+   {
+      assert(lp->cols[i]->index < stat->ncolidx);
+      primsol[lp->cols[i]->index] = lp->cols[i]->primsol;
+   }
+
+   for( c = firstcut; c < cutpool->ncuts; ++c )
+   {
+      SCIP_ROW* row = cutpool->cuts[c]->row;
+      SCIP_Real activity;
+
+      if( SCIProwIsInLP(row) || row->validactivitylp == stat->lpcount )
+         continue;
+
+      activity = row->constant;
+      for( i = cutpool->matbeg[c]; i < cutpool->matbeg[c+1]; ++i )
+         activity += cutpool->matvals[i] * primsol[cutpool->matcolidx[i]];
+
+      row->activity = activity;
+      row->validactivitylp = stat->lpcount;
+   }
+
+   /* clean buffer */
+   for( i = 0; i < lp->ncols; ++i )
+      primsol[lp->cols[i]->index] = 0.0;
+   SCIPsetFreeCleanBufferArray(set, &primsol);
+
+   return SCIP_OKAY;
+}
+
 /*
  * Cutpool methods
  */
@@ -432,9 +551,15 @@ SCIP_RETCODE SCIPcutpoolCreate(
 
    SCIP_CALL( SCIPhashtableCreate(&(*cutpool)->hashtable, blkmem, 
          (set->misc_usesmalltables ? SCIP_HASHSIZE_CUTPOOLS_SMALL : SCIP_HASHSIZE_CUTPOOLS),
-         hashGetKeyCut, hashKeyEqCut, hashKeyValCut, (void*) set) );
+         hashGetKeyCut, SCIPcutpoolHashKeyEqRow, SCIPcutpoolHashKeyValRow, (void*) set) );
 
    (*cutpool)->cuts = NULL;
+   (*cutpool)->matbeg = NULL;
+   (*cutpool)->matcolidx = NULL;
+   (*cutpool)->matvals = NULL;
+   (*cutpool)->matbegsize = 0;
+   (*cutpool)->matsize = 0;
+   (*cutpool)->nmatcuts = 0;
    (*cutpool)->cutssize = 0;
    (*cutpool)->ncuts = 0;
    (*cutpool)->nremovablecuts = 0;
@@ -473,6 +598,9 @@ SCIP_RETCODE SCIPcutpoolFree(
    /* free hash table */
    SCIPhashtableFree(&(*cutpool)->hashtable);
 
+   BMSfreeMemoryArrayNull(&(*cutpool)->matvals);
+   BMSfreeMemoryArrayNull(&(*cutpool)->matcolidx);
+   BMSfreeMemoryArrayNull(&(*cutpool)->matbeg);
    BMSfreeMemoryArrayNull(&(*cutpool)->cuts);
    BMSfreeMemory(cutpool);
 
@@ -503,6 +631,7 @@ SCIP_RETCODE SCIPcutpoolClear(
 
    cutpool->ncuts = 0;
    cutpool->nremovablecuts = 0;
+   cutpool->nmatcuts = 0;
 
    return SCIP_OKAY;
 }
@@ -560,6 +689,9 @@ SCIP_RETCODE cutpoolDelCut(
 
    --cutpool->ncuts;
    cutpool->firstunprocessed = MIN(cutpool->firstunprocessed, cutpool->ncuts);
+
+   /* the mirror of the cuts stays valid up to the position of the deleted cut */
+   cutpool->nmatcuts = MIN(cutpool->nmatcuts, pos);
    cutpool->firstunprocessedsol = MIN(cutpool->firstunprocessedsol, cutpool->ncuts);
 
    /* move the last cut of the pool to the free position */
@@ -578,6 +710,43 @@ SCIP_RETCODE cutpoolDelCut(
    return SCIP_OKAY;
 }
 
+/** removes all cuts from the cut pool that are not in the current LP and were not violated in the last separation
+ *  round that processed them
+ */
+SCIP_RETCODE SCIPcutpoolShrink(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_LP*              lp,                 /**< current LP data */
+   int*                  ndelcuts            /**< pointer to store the number of removed cuts */
+   )
+{
+   int c;
+
+   assert(cutpool != NULL);
+   assert(ndelcuts != NULL);
+
+   *ndelcuts = 0;
+
+   /* traverse backwards, because cutpoolDelCut() moves the last cut of the pool to the free position */
+   for( c = cutpool->ncuts - 1; c >= 0; --c )
+   {
+      SCIP_CUT* cut;
+
+      cut = cutpool->cuts[c];
+      assert(cut != NULL);
+
+      if( cut->age > 0 && !SCIProwIsInLP(cut->row) )
+      {
+         SCIP_CALL( cutpoolDelCut(cutpool, blkmem, set, stat, lp, cut) );
+         ++(*ndelcuts);
+      }
+   }
+
+   return SCIP_OKAY;
+}
+
 /** checks if cut is already existing */
 SCIP_Bool SCIPcutpoolIsCutNew(
    SCIP_CUTPOOL*         cutpool,            /**< cut pool */
@@ -891,7 +1060,18 @@ SCIP_RETCODE SCIPcutpoolSeparate(
    oldncuts = SCIPsepastoreGetNCuts(sepastore);
    nefficaciouscuts = 0;
 
-   /* process all unprocessed cuts in the pool */
+   /* for many cuts, compute the activities w.r.t. the LP solution at once */
+   if( sol == NULL && cutpool->ncuts - firstunproc >= CUTPOOL_MINBATCHCUTS )
+   {
+      SCIP_CALL( cutpoolComputeLPActivities(cutpool, set, stat, lp, firstunproc) );
+   }
+
+   /* process all unprocessed cuts in the pool
+    *
+    * Each iteration may change the data of later iterations: computing the efficacy updates the cached activity of the
+    * row, adding a cut modifies the separation storage, and deleting an aged cut moves the last cut of the pool to
+    * position c.
+    */
    cutoff = FALSE;
    for( c = firstunproc; c < cutpool->ncuts; ++c )
    {
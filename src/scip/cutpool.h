@@ -34,6 +34,7 @@
 #include "scip/type_sol.h"
 #include "scip/type_stat.h"
 #include "scip/type_lp.h"
+#include "scip/type_misc.h"
 #include "scip/type_sepastore.h"
 #include "scip/type_cutpool.h"
 #include "scip/pub_cutpool.h"
@@ -42,6 +43,17 @@
 extern "C" {
 #endif
 
+/** returns TRUE iff both rows are identical up to scaling, ignoring the sides; the user pointer is the global settings
+ *
+ *  Both rows must be nonempty and have valid minimal and maximal column indices.
+ */
+SCIP_DECL_HASHKEYEQ(SCIPcutpoolHashKeyEqRow);
+
+/** returns the hash value of a row that is compatible with SCIPcutpoolHashKeyEqRow(); the user pointer is the global
+ *  settings
+ */
+SCIP_DECL_HASHKEYVAL(SCIPcutpoolHashKeyValRow);
+
 /** creates cut pool */
 SCIP_RETCODE SCIPcutpoolCreate(
    SCIP_CUTPOOL**        cutpool,            /**< pointer to store cut pool */
@@ -67,6 +79,18 @@ SCIP_RETCODE SCIPcutpoolClear(
    SCIP_LP*              lp                  /**< current LP data */
    );
 
+/** removes all cuts from the cut pool that are not in the current LP and were not violated in the last separation
+ *  round that processed them
+ */
+SCIP_RETCODE SCIPcutpoolShrink(
+   SCIP_CUTPOOL*         cutpool,            /**< cut pool */
+   BMS_BLKMEM*           blkmem,             /**< block memory */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_STAT*            stat,               /**< problem statistics data */
+   SCIP_LP*              lp,                 /**< current LP data */
+   int*                  ndelcuts            /**< pointer to store the number of removed cuts */
+   );
+
 /** checks if cut is already existing */
 SCIP_Bool SCIPcutpoolIsCutNew(
    SCIP_CUTPOOL*         cutpool,            /**< cut pool */
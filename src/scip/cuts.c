@@ -748,6 +748,10 @@ SCIP_RETCODE cutTightenCoefsQuad(
 
          SCIPquadprecProdQD(*cutrhs, *cutrhs, intscalar);
 
+         /* the maximal activity after scaling to integral values is recomputed in the same pass */
+         QUAD_ASSIGN(maxacttmp, 0.0);
+         maxabsintval = 0.0;
+
          for( i = 0; i < *cutnnz; )
          {
             SCIP_Real QUAD(val);
@@ -767,8 +771,21 @@ SCIP_RETCODE cutTightenCoefsQuad(
 
             if( intval != 0.0 )
             {
+               SCIP_Real bound;
+
                QUAD_ASSIGN(val, intval);
                QUAD_ARRAY_STORE(cutcoefs, cutinds[i], val);
+
+               if( intval < 0.0 )
+                  bound = cutislocal ? SCIPvarGetLbLocal(vars[cutinds[i]]) : SCIPvarGetLbGlobal(vars[cutinds[i]]);
+               else
+                  bound = cutislocal ? SCIPvarGetUbLocal(vars[cutinds[i]]) : SCIPvarGetUbGlobal(vars[cutinds[i]]);
+
+               maxabsintval = MAX(maxabsintval, REALABS(intval));
+
+               SCIPquadprecProdQD(val, val, bound);
+               SCIPquadprecSumQQ(maxacttmp, maxacttmp, val);
+
                ++i;
             }
             else
@@ -783,41 +800,6 @@ SCIP_RETCODE cutTightenCoefsQuad(
 
          SCIPquadprecEpsFloorQ(*cutrhs, *cutrhs, SCIPfeastol(scip)); /*lint !e666*/
 
-         /* recompute the maximal activity after scaling to integral values */
-         QUAD_ASSIGN(maxacttmp, 0.0);
-         maxabsintval = 0.0;
-
-         for( i = 0; i < *cutnnz; ++i )
-         {
-            SCIP_Real QUAD(val);
-
-            assert(cutinds[i] >= 0);
-            assert(vars[cutinds[i]] != NULL);
-
-            QUAD_ARRAY_LOAD(val, cutcoefs, cutinds[i]);
-
-            if( QUAD_TO_DBL(val) < 0.0 )
-            {
-               SCIP_Real lb = cutislocal ? SCIPvarGetLbLocal(vars[cutinds[i]]) : SCIPvarGetLbGlobal(vars[cutinds[i]]);
-
-               maxabsintval = MAX(maxabsintval, -QUAD_TO_DBL(val));
-
-               SCIPquadprecProdQD(val, val, lb);
-
-               SCIPquadprecSumQQ(maxacttmp, maxacttmp, val);
-            }
-            else
-            {
-               SCIP_Real ub = cutislocal ? SCIPvarGetUbLocal(vars[cutinds[i]]) : SCIPvarGetUbGlobal(vars[cutinds[i]]);
-
-               maxabsintval = MAX(maxabsintval, QUAD_TO_DBL(val));
-
-               SCIPquadprecProdQD(val, val, ub);
-
-               SCIPquadprecSumQQ(maxacttmp, maxacttmp, val);
-            }
-         }
-
          maxact = QUAD_TO_DBL(maxacttmp);
 
          assert(EPSISINT(maxact, 1e-4));
@@ -1132,6 +1114,10 @@ SCIP_RETCODE cutTightenCoefs(
 
          SCIPquadprecProdQD(*cutrhs, *cutrhs, intscalar);
 
+         /* the maximal activity after scaling to integral values is recomputed in the same pass */
+         QUAD_ASSIGN(maxacttmp, 0.0);
+         maxabsintval = 0.0;
+
          for( i = 0; i < *cutnnz; )
          {
             SCIP_Real val;
@@ -1151,7 +1137,19 @@ SCIP_RETCODE cutTightenCoefs(
 
             if( intval != 0.0 )
             {
+               SCIP_Real bound;
+
                cutcoefs[cutinds[i]] = intval;
+
+               if( intval < 0.0 )
+                  bound = cutislocal ? SCIPvarGetLbLocal(vars[cutinds[i]]) : SCIPvarGetLbGlobal(vars[cutinds[i]]);
+               else
+                  bound = cutislocal ? SCIPvarGetUbLocal(vars[cutinds[i]]) : SCIPvarGetUbGlobal(vars[cutinds[i]]);
+
+               maxabsintval = MAX(maxabsintval, REALABS(intval));
+
+               SCIPquadprecSumQD(maxacttmp, maxacttmp, intval * bound);
+
                ++i;
             }
             else
@@ -1165,41 +1163,6 @@ SCIP_RETCODE cutTightenCoefs(
 
          SCIPquadprecEpsFloorQ(*cutrhs, *cutrhs, SCIPfeastol(scip)); /*lint !e666*/
 
-         /* recompute the maximal activity after scaling to integral values */
-         QUAD_ASSIGN(maxacttmp, 0.0);
-         maxabsintval = 0.0;
-
-         for( i = 0; i < *cutnnz; ++i )
-         {
-            SCIP_Real val;
-
-            assert(cutinds[i] >= 0);
-            assert(vars[cutinds[i]] != NULL);
-
-            val = cutcoefs[cutinds[i]];
-
-            if( val < 0.0 )
-            {
-               SCIP_Real lb = cutislocal ? SCIPvarGetLbLocal(vars[cutinds[i]]) : SCIPvarGetLbGlobal(vars[cutinds[i]]);
-
-               maxabsintval = MAX(maxabsintval, -val);
-
-               val *= lb;
-
-               SCIPquadprecSumQD(maxacttmp, maxacttmp, val);
-            }
-            else
-            {
-               SCIP_Real ub = cutislocal ? SCIPvarGetUbLocal(vars[cutinds[i]]) : SCIPvarGetUbGlobal(vars[cutinds[i]]);
-
-               maxabsintval = MAX(maxabsintval, val);
-
-               val *= ub;
-
-               SCIPquadprecSumQD(maxacttmp, maxacttmp, val);
-            }
-         }
-
          maxact = QUAD_TO_DBL(maxacttmp);
 
          assert(EPSISINT(maxact, 1e-4));
@@ -2436,13 +2399,37 @@ SCIP_Real SCIPaggrRowGetRhs(
    return QUAD_TO_DBL(aggrrow->rhs);
 }
 
+/** computes a 64 bit signature of the support of the given cut: a bit per hashed column index
+ *
+ *  Cuts with disjoint signatures have disjoint supports, so they are orthogonal and the computation of their scalar
+ *  product can be skipped.
+ */
+static
+uint64_t getCutSupportSignature(
+   SCIP_ROW*             cut                 /**< cut to compute signature for */
+   )
+{
+   uint64_t signature;
+   int i;
+
+   assert(cut != NULL);
+
+   signature = 0;
+   for( i = 0; i < cut->len; ++i )
+      signature |= SCIPhashSignature64(cut->cols[i]->index);
+
+   return signature;
+}
+
 /** filters the given array of cuts to enforce a maximum parallelism constraints
  *  for the given cut; moves filtered cuts to the end of the array and returns number of selected cuts */
 static
 int filterWithParallelism(
    SCIP_ROW*             cut,                /**< cut to filter orthogonality with */
+   uint64_t              cutsignature,       /**< support signature of the cut to filter orthogonality with */
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   uint64_t*             signatures,         /**< array with support signatures of cuts to perform selection algorithm */
    int                   ncuts,              /**< number of cuts in given array */
    SCIP_Real             goodscore,          /**< threshold for the score to be considered a good cut */
    SCIP_Real             goodmaxparall,      /**< maximal parallelism for good cuts */
@@ -2454,20 +2441,33 @@ int filterWithParallelism(
    assert( cut != NULL );
    assert( ncuts == 0 || cuts != NULL );
    assert( ncuts == 0 || scores != NULL );
+   assert( ncuts == 0 || signatures != NULL );
 
    for( i = ncuts - 1; i >= 0; --i )
    {
       SCIP_Real thisparall;
       SCIP_Real thismaxparall;
 
+      /* cuts with disjoint supports are orthogonal and are never filtered */
+      if( (cutsignature & signatures[i]) == 0 )
+      {
+         assert(SCIProwGetParallelism(cut, cuts[i], 'e') == 0.0); /*lint !e777*/
+         continue;
+      }
+
       thisparall = SCIProwGetParallelism(cut, cuts[i], 'e');
       thismaxparall = scores[i] >= goodscore ? goodmaxparall : maxparall;
 
       if( thisparall > thismaxparall )
       {
+         uint64_t tmpsignature;
+
          --ncuts;
          SCIPswapPointers((void**) &cuts[i], (void**) &cuts[ncuts]);
          SCIPswapReals(&scores[i], &scores[ncuts]);
+         tmpsignature = signatures[i];
+         signatures[i] = signatures[ncuts];
+         signatures[ncuts] = tmpsignature;
       }
    }
 
@@ -2479,16 +2479,19 @@ static
 void selectBestCut(
    SCIP_ROW**            cuts,               /**< array with cuts to perform selection algorithm */
    SCIP_Real*            scores,             /**< array with scores of cuts to perform selection algorithm */
+   uint64_t*             signatures,         /**< array with support signatures of cuts to perform selection algorithm */
    int                   ncuts               /**< number of cuts in given array */
    )
 {
    int i;
    int bestpos;
    SCIP_Real bestscore;
+   uint64_t tmpsignature;
 
    assert(ncuts > 0);
    assert(cuts != NULL);
    assert(scores != NULL);
+   assert(signatures != NULL);
 
    bestscore = scores[0];
    bestpos = 0;
@@ -2504,6 +2507,9 @@ void selectBestCut(
 
    SCIPswapPointers((void**) &cuts[bestpos], (void**) &cuts[0]);
    SCIPswapReals(&scores[bestpos], &scores[0]);
+   tmpsignature = signatures[bestpos];
+   signatures[bestpos] = signatures[0];
+   signatures[0] = tmpsignature;
 }
 
 /** perform a cut selection algorithm for the given array of cuts; the array is partitioned
@@ -2531,6 +2537,7 @@ SCIP_RETCODE SCIPselectCuts(
 {
    int i;
    SCIP_Real* scores;
+   uint64_t* signatures;
    SCIP_Real goodscore;
    SCIP_Real badscore;
    SCIP_Real efficacyfac;
@@ -2547,6 +2554,11 @@ SCIP_RETCODE SCIPselectCuts(
    *nselectedcuts = 0;
 
    SCIP_CALL( SCIPallocBufferArray(scip, &scores, ncuts) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &signatures, ncuts) );
+
+   /* compute the support signatures once, since every cut is compared to every selected cut */
+   for( i = 0; i < ncuts; ++i )
+      signatures[i] = getCutSupportSignature(cuts[i]);
 
    sol = SCIPgetBestSol(scip);
 
@@ -2640,17 +2652,20 @@ SCIP_RETCODE SCIPselectCuts(
       int nnonforcedcuts;
       SCIP_ROW** nonforcedcuts;
       SCIP_Real* nonforcedscores;
+      uint64_t* nonforcedsignatures;
 
       /* adjust pointers to the beginning of the non-forced cuts */
       nnonforcedcuts = ncuts - nforcedcuts;
       nonforcedcuts = cuts + nforcedcuts;
       nonforcedscores = scores + nforcedcuts;
+      nonforcedsignatures = signatures + nforcedcuts;
 
       /* select the forced cuts first */
       *nselectedcuts = nforcedcuts;
       for( i = 0; i < nforcedcuts && nnonforcedcuts > 0; ++i )
       {
-         nnonforcedcuts = filterWithParallelism(cuts[i], nonforcedcuts, nonforcedscores, nnonforcedcuts, goodscore, goodmaxparall, maxparall);
+         nnonforcedcuts = filterWithParallelism(cuts[i], signatures[i], nonforcedcuts, nonforcedscores,
+            nonforcedsignatures, nnonforcedcuts, goodscore, goodmaxparall, maxparall);
       }
 
       /* if the maximal number of cuts was exceeded after selecting the forced cuts, we can stop here */
@@ -2661,9 +2676,11 @@ SCIP_RETCODE SCIPselectCuts(
       while( nnonforcedcuts > 0 )
       {
          SCIP_ROW* selectedcut;
+         uint64_t selectedsignature;
 
-         selectBestCut(nonforcedcuts, nonforcedscores, nnonforcedcuts);
+         selectBestCut(nonforcedcuts, nonforcedscores, nonforcedsignatures, nnonforcedcuts);
          selectedcut = nonforcedcuts[0];
+         selectedsignature = nonforcedsignatures[0];
 
          /* if the best cut of the remaining cuts is considered bad, we discard it and all remaining cuts */
          if( nonforcedscores[0] < badscore )
@@ -2678,13 +2695,16 @@ SCIP_RETCODE SCIPselectCuts(
          /* move the pointers to the next position and filter the remaining cuts to enforce the maximum parallelism constraint */
          ++nonforcedcuts;
          ++nonforcedscores;
+         ++nonforcedsignatures;
          --nnonforcedcuts;
 
-         nnonforcedcuts = filterWithParallelism(selectedcut, nonforcedcuts, nonforcedscores, nnonforcedcuts, goodscore, goodmaxparall, maxparall);
+         nnonforcedcuts = filterWithParallelism(selectedcut, selectedsignature, nonforcedcuts, nonforcedscores,
+            nonforcedsignatures, nnonforcedcuts, goodscore, goodmaxparall, maxparall);
       }
    }
 
   TERMINATE:
+   SCIPfreeBufferArray(scip, &signatures);
    SCIPfreeBufferArray(scip, &scores);
 
    return SCIP_OKAY;
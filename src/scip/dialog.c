@@ -951,6 +951,38 @@ SCIP_DECL_SORTPTRCOMP(dialogComp)
    return strcmp( SCIPdialogGetName((SCIP_DIALOG*)elem1), SCIPdialogGetName((SCIP_DIALOG*)elem2) );
 }
 
+/** returns the position of the first sub-dialog whose name is not smaller than the given name in the array of
+ *  sub-dialogs, which is sorted w.r.t. the names
+ */
+static
+int dialogGetEntryPos(
+   SCIP_DIALOG**         subdialogs,         /**< sorted array of sub-dialogs */
+   int                   nsubdialogs,        /**< number of sub-dialogs */
+   const char*           entryname           /**< name of the dialog entry to find */
+   )
+{
+   int left;
+   int right;
+
+   assert(subdialogs != NULL || nsubdialogs == 0);
+   assert(entryname != NULL);
+
+   left = 0;
+   right = nsubdialogs;
+   while( left < right )
+   {
+      int middle;
+
+      middle = left + (right - left) / 2;
+      if( strcmp(SCIPdialogGetName(subdialogs[middle]), entryname) < 0 )
+         left = middle + 1;
+      else
+         right = middle;
+   }
+
+   return left;
+}
+
 /** adds a sub-dialog to the given dialog as menu entry and captures the sub-dialog */
 SCIP_RETCODE SCIPdialogAddEntry(
    SCIP_DIALOG*          dialog,             /**< dialog */
@@ -998,14 +1030,9 @@ SCIP_Bool SCIPdialogHasEntry(
    /* check entryname w.r.t. available dialog options */
    subdialogs = SCIPdialogGetSubdialogs(dialog);
    nsubdialogs = SCIPdialogGetNSubdialogs(dialog);
-   for( i = 0; i < nsubdialogs; ++i )
-   {
-      /* check, if the sub-dialog's name matches entryname */
-      if( strcmp(entryname, SCIPdialogGetName(subdialogs[i])) == 0 )
-         return TRUE;
-   }
+   i = dialogGetEntryPos(subdialogs, nsubdialogs, entryname);
 
-   return FALSE;
+   return (i < nsubdialogs && strcmp(entryname, SCIPdialogGetName(subdialogs[i])) == 0);
 }
 
 /** searches the dialog for entries corresponding to the given name;
@@ -1039,18 +1066,22 @@ int SCIPdialogFindEntry(
    nsubdialogs = SCIPdialogGetNSubdialogs(dialog);
    namelen = (unsigned int) strlen(entryname);
    nfound = 0;
-   for( i = 0; i < nsubdialogs; ++i )
+
+   /* the entries whose names begin with entryname follow each other in the sorted sub-dialogs array, starting with
+    * the one that matches entryname exactly, if existing
+    */
+   for( i = dialogGetEntryPos(subdialogs, nsubdialogs, entryname); i < nsubdialogs; ++i )
    {
       /* check, if the beginning of the sub-dialog's name matches entryname */
-      if( strncmp(entryname, SCIPdialogGetName(subdialogs[i]), namelen) == 0 )
-      {
-         *subdialog = subdialogs[i];
-         nfound++;
+      if( strncmp(entryname, SCIPdialogGetName(subdialogs[i]), namelen) != 0 )
+         break;
 
-         /* if entryname exactly matches the sub-dialog's name, use this sub-dialog */
-         if( namelen == (unsigned int) strlen(SCIPdialogGetName(subdialogs[i])) )
-            return 1;
-      }
+      *subdialog = subdialogs[i];
+      nfound++;
+
+      /* if entryname exactly matches the sub-dialog's name, use this sub-dialog */
+      if( namelen == (unsigned int) strlen(SCIPdialogGetName(subdialogs[i])) )
+         return 1;
    }
 
    if( nfound != 1 )
@@ -1775,6 +1775,20 @@ SCIP_DECL_DIALOGEXEC(SCIPdialogExecDisplayStatistics)
    return SCIP_OKAY;
 }
 
+/** dialog execution method for the display jsonstatistics command */
+SCIP_DECL_DIALOGEXEC(SCIPdialogExecDisplayJsonStatistics)
+{  /*lint --e{715}*/
+   SCIP_CALL( SCIPdialoghdlrAddHistory(dialoghdlr, dialog, NULL, FALSE) );
+
+   SCIPdialogMessage(scip, NULL, "\n");
+   SCIP_CALL( SCIPprintStatisticsJson(scip, NULL) );
+   SCIPdialogMessage(scip, NULL, "\n");
+
+   *nextdialog = SCIPdialoghdlrGetRoot(dialoghdlr);
+
+   return SCIP_OKAY;
+}
+
 /** dialog execution method for the display reoptstatistics command */
 SCIP_DECL_DIALOGEXEC(SCIPdialogExecDisplayReoptStatistics)
 {  /*lint --e{715}*/
@@ -3787,6 +3801,50 @@ SCIP_DECL_DIALOGEXEC(SCIPdialogExecWriteStatistics)
    return SCIP_OKAY;
 }
 
+/** dialog execution method for the write jsonstatistics command */
+static
+SCIP_DECL_DIALOGEXEC(SCIPdialogExecWriteJsonStatistics)
+{  /*lint --e{715}*/
+   char* filename;
+   SCIP_Bool endoffile;
+
+   SCIPdialogMessage(scip, NULL, "\n");
+
+   SCIP_CALL( SCIPdialoghdlrGetWord(dialoghdlr, dialog, "enter filename: ", &filename, &endoffile) );
+   if( endoffile )
+   {
+      *nextdialog = NULL;
+      return SCIP_OKAY;
+   }
+   if( filename[0] != '\0' )
+   {
+      FILE* file;
+
+      SCIP_CALL( SCIPdialoghdlrAddHistory(dialoghdlr, dialog, filename, TRUE) );
+
+      file = fopen(filename, "w");
+      if( file == NULL )
+      {
+         SCIPdialogMessage(scip, NULL, "error creating file <%s>\n", filename);
+         SCIPprintSysError(filename);
+         SCIPdialoghdlrClearBuffer(dialoghdlr);
+      }
+      else
+      {
+         SCIP_CALL_FINALLY( SCIPprintStatisticsJson(scip, file), fclose(file) );
+
+         SCIPdialogMessage(scip, NULL, "written statistics in JSON format to file <%s>\n", filename);
+         fclose(file);
+      }
+   } /*lint !e593*/
+
+   SCIPdialogMessage(scip, NULL, "\n");
+
+   *nextdialog = SCIPdialoghdlrGetRoot(dialoghdlr);
+
+   return SCIP_OKAY;
+}
+
 /** dialog execution method for the write transproblem command */
 static
 SCIP_DECL_DIALOGEXEC(SCIPdialogExecWriteTransproblem)
@@ -4301,6 +4359,17 @@ SCIP_RETCODE SCIPincludeDialogDefault(
       SCIP_CALL( SCIPreleaseDialog(scip, &dialog) );
    }
 
+   /* display statistics in JSON format */
+   if( !SCIPdialogHasEntry(submenu, "jsonstatistics") )
+   {
+      SCIP_CALL( SCIPincludeDialog(scip, &dialog,
+            NULL,
+            SCIPdialogExecDisplayJsonStatistics, NULL, NULL,
+            "jsonstatistics", "display problem and optimization statistics in JSON format", FALSE, NULL) );
+      SCIP_CALL( SCIPaddDialogEntry(scip, submenu, dialog) );
+      SCIP_CALL( SCIPreleaseDialog(scip, &dialog) );
+   }
+
    /* display reoptimization statistics */
    if( !SCIPdialogHasEntry(submenu, "reoptstatistics") )
    {
@@ -4604,6 +4673,17 @@ SCIP_RETCODE SCIPincludeDialogDefault(
       SCIP_CALL( SCIPreleaseDialog(scip, &dialog) );
    }
 
+   /* write statistics in JSON format */
+   if( !SCIPdialogHasEntry(submenu, "jsonstatistics") )
+   {
+      SCIP_CALL( SCIPincludeDialog(scip, &dialog,
+            NULL,
+            SCIPdialogExecWriteJsonStatistics, NULL, NULL,
+            "jsonstatistics", "write statistics in JSON format to file", FALSE, NULL) );
+      SCIP_CALL( SCIPaddDialogEntry(scip, submenu, dialog) );
+      SCIP_CALL( SCIPreleaseDialog(scip, &dialog) );
+   }
+
    /* write transproblem */
    if( !SCIPdialogHasEntry(submenu, "transproblem") )
    {
@@ -3061,3 +3061,41 @@ SCIP_Real SCIPgetTreesizeEstimation(
    assert(tspos != TSPOS_NONE);
    return (tspos == TSPOS_NONE ? -1.0 : timeSeriesEstimate(eventhdlrdata->timeseries[tspos], eventhdlrdata->treedata));
 }
+
+/** returns an estimation of the remaining solving time in seconds, or -1 if no estimation is available yet */
+SCIP_Real SCIPgetTreesizeEstimationRemainingTime(
+   SCIP*                 scip                /**< SCIP data structure */
+   )
+{
+   SCIP_EVENTHDLR* eventhdlr;
+   SCIP_EVENTHDLRDATA* eventhdlrdata;
+   TREEDATA* treedata;
+   SCIP_Real estim;
+   SCIP_Real timepernode;
+
+   assert(scip != NULL);
+
+   eventhdlr = SCIPfindEventhdlr(scip, EVENTHDLR_NAME);
+   if( eventhdlr == NULL )
+   {
+      SCIPwarningMessage(scip, "SCIPgetTreesizeEstimationRemainingTime() called, but event handler " EVENTHDLR_NAME " is missing.\n");
+      return -1.0;
+   }
+
+   eventhdlrdata = SCIPeventhdlrGetData(eventhdlr);
+   assert(eventhdlrdata != NULL);
+
+   treedata = eventhdlrdata->treedata;
+   assert(treedata != NULL);
+
+   if( treedata->nvisited == 0 )
+      return -1.0;
+
+   estim = SCIPgetTreesizeEstimation(scip);
+   if( estim < 0.0 )
+      return -1.0;
+
+   timepernode = MAX(SCIPgetSolvingTime(scip) - SCIPgetPresolvingTime(scip), 0.0) / (SCIP_Real)treedata->nvisited;
+
+   return MAX(estim - (SCIP_Real)treedata->nvisited, 0.0) * timepernode;
+}
@@ -61,6 +61,17 @@ SCIP_Real SCIPgetTreesizeEstimation(
    SCIP*                 scip                /**< SCIP data structure */
    );
 
+/** returns an estimation of the remaining solving time in seconds, or -1 if no estimation is available yet
+ *
+ *  The estimation extrapolates the average time spent per visited node so far to the nodes that remain according to
+ *  SCIPgetTreesizeEstimation(). Like all SCIP methods, it must be called from the thread that runs the solve, e.g.,
+ *  from an event handler or display callback.
+ */
+SCIP_EXPORT
+SCIP_Real SCIPgetTreesizeEstimationRemainingTime(
+   SCIP*                 scip                /**< SCIP data structure */
+   );
+
 #ifdef __cplusplus
 }
 #endif
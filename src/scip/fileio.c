@@ -34,14 +34,41 @@
 /* file i/o using zlib */
 #include <zlib.h>
 
+/* size of the internal buffers of zlib; the default of 8KB results in many small reads and inflate calls, which
+ * slows down reading large (compressed) files considerably
+ */
+#define ZLIB_BUFFER_LEN 131072
+
+/** enlarges the internal buffers of a freshly opened zlib stream; must be called before the first read or write */
+static
+void setZlibBuffer(
+   gzFile                file                /**< zlib file, or NULL */
+   )
+{
+#if ZLIB_VERNUM >= 0x1240
+   if( file != NULL )
+      (void) gzbuffer(file, ZLIB_BUFFER_LEN);
+#endif
+}
+
 SCIP_FILE* SCIPfopen(const char *path, const char *mode)
 {
-   return (SCIP_FILE*)gzopen(path, mode);
+   gzFile file;
+
+   file = gzopen(path, mode);
+   setZlibBuffer(file);
+
+   return (SCIP_FILE*)file;
 }
 
 SCIP_FILE* SCIPfdopen(int fildes, const char *mode)
 {
-   return (SCIP_FILE*)gzdopen(fildes, mode);
+   gzFile file;
+
+   file = gzdopen(fildes, mode);
+   setZlibBuffer(file);
+
+   return (SCIP_FILE*)file;
 }
 
 size_t SCIPfread(void *ptr, size_t size, size_t nmemb, SCIP_FILE *stream)
@@ -1173,7 +1173,14 @@ SCIP_RETCODE SCIPheurExitsol(
    return SCIP_OKAY;
 }
 
-/** should the heuristic be executed at the given depth, frequency, timing, ... */
+/** should the heuristic be executed at the given depth, frequency, timing, ...
+ *
+ *  @note this static schedule only decides whether a heuristic is called.  Each heuristic controls its own effort
+ *        relative to the main search: LNS heuristics derive their node limits from the number of nodes the main
+ *        SCIP has solved and pause after failures (e.g., heur_crossover.c, heur_gins.c).  Diving heuristics bound
+ *        their LP iterations by a quotient of the main LP iterations (maxlpiterquot).  heur_alns.c and
+ *        heur_adaptivediving.c use bandit or score selection within their families.
+ */
 SCIP_Bool SCIPheurShouldBeExecuted(
    SCIP_HEUR*            heur,               /**< primal heuristic */
    int                   depth,              /**< depth of current node */
@@ -1248,6 +1255,7 @@ SCIP_RETCODE SCIPheurExec(
    SCIP_RESULT*          result              /**< pointer to store the result of the callback method */
    )
 {
+   SCIP_RETCODE retcode;
    SCIP_Bool execute;
    SCIP_Bool delayed;
 
@@ -1287,8 +1295,11 @@ SCIP_RETCODE SCIPheurExec(
       /* start timing */
       SCIPclockStart(heur->heurclock, set);
 
-      /* call external method */
-      SCIP_CALL( heur->heurexec(set->scip, heur, heurtiming, nodeinfeasible, result) );
+      /* call external method; the trace event is closed also if the call fails */
+      SCIPstartTraceEvent(set->scip, SCIP_TRACECAT_HEUR, heur->name);
+      retcode = heur->heurexec(set->scip, heur, heurtiming, nodeinfeasible, result);
+      SCIPstopTraceEvent(set->scip, SCIP_TRACECAT_HEUR, heur->name);
+      SCIP_CALL( retcode );
 
       /* stop timing */
       SCIPclockStop(heur->heurclock, set);
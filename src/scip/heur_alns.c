@@ -1985,7 +1985,13 @@ SCIP_BANDIT* getBandit(
    return heurdata->bandit;
 }
 
-/** select a neighborhood depending on the selected bandit algorithm */
+/** select a neighborhood depending on the selected bandit algorithm
+ *
+ *  @note exactly one neighborhood is selected and solved per call of the heuristic.  The bandit learns from the reward
+ *        of each sub-SCIP solve before the next selection, and the sub-SCIP limits (nodes, time, memory) are derived
+ *        from the remaining budget of the main SCIP.  Since the selection depends on the rewards of all previous
+ *        solves, neighborhoods are solved one after another.
+ */
 static
 SCIP_RETCODE selectNeighborhood(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -360,6 +360,35 @@ SCIP_RETCODE updateVariableRounding(
 }
 
 
+/** computes a hash value of the rounded values of the given integer variables in a solution
+ *
+ *  two solutions whose values agree on the given variables have the same hash value, so cycles of the pumping loop only
+ *  need to be checked explicitly for previous rounded solutions with the same hash value
+ */
+static
+uint32_t hashRoundedSol(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SOL*             sol,                /**< rounded solution */
+   SCIP_VAR**            vars,               /**< integer variables */
+   int                   nvars               /**< number of integer variables */
+   )
+{
+   uint32_t hash;
+   int i;
+
+   assert(vars != NULL || nvars == 0);
+
+   hash = 0;
+   for( i = 0; i < nvars; i++ )
+   {
+      SCIP_Real solval = SCIPgetSolVal(scip, sol, vars[i]);
+
+      hash = SCIPhashTwo(hash, SCIPrealHashCode(SCIPfloor(scip, solval + 0.5)));
+   }
+
+   return hash;
+}
+
 /** flips the roundings of the most fractional variables, if a 1-cycle was found */
 static
 SCIP_RETCODE handle1Cycle(
@@ -705,6 +734,8 @@ SCIP_DECL_HEUREXEC(heurExecFeaspump)
    SCIP_SOL** lastroundedsols;/* solutions of the last pumping rounds (depending on heurdata->cyclelength) */
    SCIP_SOL* closestsol;      /* rounded solution closest to the LP relaxation: used for stage3 */
    SCIP_Real* lastalphas;     /* alpha values associated to solutions in lastroundedsols */
+   uint32_t* lasthashes;      /* hash values of the solutions in lastroundedsols */
+   uint32_t roundedhash;      /* hash value of the current rounded solution */
 
    SCIP* probingscip;         /* copied SCIP structure, used for round-and-propagate loop of feasibility pump 2.0 */
    SCIP_HASHMAP* varmapfw;    /* mapping of SCIP variables to sub-SCIP variables */
@@ -752,6 +783,7 @@ SCIP_DECL_HEUREXEC(heurExecFeaspump)
    SCIP_Bool success;
    SCIP_Bool lperror;
    SCIP_Bool* cycles;           /* are there short cycles */
+   SCIP_Bool cyclepossible;     /* does some previous rounded solution have the hash value of the current one */
 
    SCIP_RETCODE retcode;
 
@@ -913,11 +945,13 @@ SCIP_DECL_HEUREXEC(heurExecFeaspump)
    SCIP_CALL( SCIPallocBufferArray(scip, &mostfracvals, maxflips) );
    SCIP_CALL( SCIPallocBufferArray(scip, &lastroundedsols, heurdata->cyclelength) );
    SCIP_CALL( SCIPallocBufferArray(scip, &lastalphas, heurdata->cyclelength) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &lasthashes, heurdata->cyclelength) );
    SCIP_CALL( SCIPallocBufferArray(scip, &cycles, heurdata->cyclelength) );
 
    for( j = 0; j < heurdata->cyclelength; j++ )
    {
       SCIP_CALL( SCIPcreateSol(scip, &lastroundedsols[j], heur) );
+      lasthashes[j] = 0;
    }
 
    closestsol = NULL;
@@ -1083,13 +1117,19 @@ SCIP_DECL_HEUREXEC(heurExecFeaspump)
 
       SCIPfreeBufferArray(scip, &pseudocands);
 
-      /* initialize cycle check */
+      /* initialize cycle check; a j-cycle is only possible if the hash values of the rounded solutions agree */
       minimum = MIN(heurdata->cyclelength, nloops-1);
+      roundedhash = hashRoundedSol(scip, heurdata->roundedsol, vars, nbinvars+nintvars);
+      cyclepossible = FALSE;
       for( j = 0; j < heurdata->cyclelength; j++ )
-         cycles[j] = (nloops > j+1) && (REALABS(lastalphas[j] - alpha) < heurdata->alphadiff);
+      {
+         cycles[j] = (nloops > j+1) && (REALABS(lastalphas[j] - alpha) < heurdata->alphadiff)
+            && lasthashes[j] == roundedhash;
+         cyclepossible = cyclepossible || cycles[j];
+      }
 
       /* check for j-cycles */
-      for( i = 0; i < nbinvars+nintvars; i++ )
+      for( i = 0; i < nbinvars+nintvars && cyclepossible; i++ )
       {
          solval = SCIPgetSolVal(scip, heurdata->roundedsol, vars[i]);
 
@@ -1211,9 +1251,11 @@ SCIP_DECL_HEUREXEC(heurExecFeaspump)
       {
          lastroundedsols[j] = lastroundedsols[j-1];
          lastalphas[j] = lastalphas[j-1];
+         lasthashes[j] = lasthashes[j-1];
       }
       lastroundedsols[0] = heurdata->roundedsol;
       lastalphas[0] = alpha;
+      lasthashes[0] = hashRoundedSol(scip, lastroundedsols[0], vars, nbinvars+nintvars);
       heurdata->roundedsol = tmpsol;
 
       /* check for improvement in number of fractionals */
@@ -1323,6 +1365,7 @@ SCIP_DECL_HEUREXEC(heurExecFeaspump)
    }
 
    SCIPfreeBufferArray(scip, &cycles);
+   SCIPfreeBufferArray(scip, &lasthashes);
    SCIPfreeBufferArray(scip, &lastalphas);
    SCIPfreeBufferArray(scip, &lastroundedsols);
    SCIPfreeBufferArray(scip, &mostfracvals);
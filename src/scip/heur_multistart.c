@@ -655,7 +655,12 @@ SCIP_RETCODE clusterPointsGreedy(
    return SCIP_OKAY;
 }
 
-/** calls the sub-NLP heuristic for a given cluster */
+/** calls the sub-NLP heuristic for a given cluster
+ *
+ *  @note the clusters are solved one after another.  Every call goes through the single sub-SCIP that heur_subnlp.c
+ *        keeps in its heuristic data (see SCIPapplyHeurSubNlp()), and solutions are added to the main SCIP as they
+ *        are found.  The NLP solves can therefore not run on separate threads.
+ */
 static
 SCIP_RETCODE solveNLP(
    SCIP*                 scip,               /**< SCIP data structure */
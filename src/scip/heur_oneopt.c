@@ -90,7 +90,10 @@ SCIP_Real calcShiftVal(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_VAR*             var,                /**< variable that should be shifted */
    SCIP_Real             solval,             /**< current solution value */
-   SCIP_Real*            activities          /**< LP row activities */
+   SCIP_Real*            activities,         /**< LP row activities */
+   int*                  blockingrow         /**< pointer to store the LP position of the row that prevents any shift,
+                                              *   -1 if the shift is prevented by the bounds or objective, and -2 if
+                                              *   the variable is not blocked, or NULL */
    )
 {
    SCIP_Real lb;
@@ -112,6 +115,9 @@ SCIP_Real calcShiftVal(
    obj = SCIPvarGetObj(var);
    shiftdown = TRUE;
 
+   if( blockingrow != NULL )
+      *blockingrow = -2;
+
    /* determine shifting direction and maximal possible shifting w.r.t. corresponding bound */
    if( obj > 0.0 && SCIPisFeasGE(scip, solval - 1.0, lb) )
       shiftval = SCIPfeasFloor(scip, solval - lb);
@@ -121,7 +127,11 @@ SCIP_Real calcShiftVal(
       shiftdown = FALSE;
    }
    else
+   {
+      if( blockingrow != NULL )
+         *blockingrow = -1;
       return 0.0;
+   }
 
    SCIPdebugMsg(scip, "Try to shift %s variable <%s> with\n", shiftdown ? "down" : "up", SCIPvarGetName(var) );
    SCIPdebugMsg(scip, "    lb:<%g> <= val:<%g> <= ub:<%g> and obj:<%g> by at most: <%g>\n", lb, solval, ub, obj, shiftval);
@@ -167,6 +177,10 @@ SCIP_Real calcShiftVal(
          shiftval = MIN(shiftval, shiftvalrow);
          /* shiftvalrow might be negative, if we detected infeasibility -> make sure that shiftval is >= 0 */
          shiftval = MAX(shiftval, 0.0);
+
+         /* remember the row that prevents the variable from being shifted at all */
+         if( shiftval == 0.0 && blockingrow != NULL )
+            *blockingrow = rowpos;
       }
    }
    if( shiftdown )
@@ -185,6 +199,8 @@ static
 SCIP_RETCODE updateRowActivities(
    SCIP*                 scip,               /**< SCIP data structure */
    SCIP_Real*            activities,         /**< LP row activities */
+   int*                  rowchgiters,        /**< array to store for each LP row the last iteration its activity changed */
+   int                   iteration,          /**< current iteration of the heuristic */
    SCIP_VAR*             var,                /**< variable that has been changed */
    SCIP_Real             shiftval            /**< value that is added to variable */
    )
@@ -197,6 +213,7 @@ SCIP_RETCODE updateRowActivities(
    int i;
 
    assert(activities != NULL);
+   assert(rowchgiters != NULL);
 
    /* get data of column associated to variable */
    col = SCIPvarGetCol(var);
@@ -219,6 +236,7 @@ SCIP_RETCODE updateRowActivities(
       if( rowpos >= 0 && !SCIProwIsLocal(row) )
       {
          activities[rowpos] +=  shiftval * colvals[i];
+         rowchgiters[rowpos] = iteration;
 
          if( SCIPisInfinity(scip, activities[rowpos]) )
             activities[rowpos] = SCIPinfinity(scip);
@@ -453,6 +471,10 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
    SCIP_ROW** lprows;                        /* SCIP LP rows                         */
    SCIP_Real* activities;                    /* row activities for working solution  */
    SCIP_Real* shiftvals;
+   int* blockingrows;                        /* LP position of the row that blocked a variable in its last
+                                              * evaluation, -1 if blocked by its bounds, -2 if not blocked */
+   int* evaliters;                           /* iteration in which each variable was last evaluated */
+   int* rowchgiters;                         /* last iteration in which the activity of each LP row changed */
    SCIP_Bool shifted;
 
    SCIP_RETCODE retcode;
@@ -644,6 +666,14 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
       return SCIP_OKAY;
    }
 
+   /* allocate buffer storage to remember why variables could not be shifted */
+   SCIP_CALL( SCIPallocBufferArray(scip, &blockingrows, nintvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &evaliters, nintvars) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &rowchgiters, nlprows) );
+
+   for( i = 0; i < nintvars; i++ )
+      blockingrows[i] = -2;
+
    /* allocate buffer storage for possible shift candidates */
    shiftcandssize = 8;
    SCIP_CALL( SCIPallocBufferArray(scip, &shiftcands, shiftcandssize) );
@@ -659,9 +689,6 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
       SCIPdebugMsg(scip, "Starting 1-opt heuristic iteration #%d\n", niterations);
 
       /* enumerate all integer variables and find out which of them are shiftable */
-      /* @todo if useloop=TRUE store for each variable which constraint blocked it and only iterate over those variables
-       *       in the following rounds for which the constraint slack was increased by previous shifts
-       */
       for( i = 0; i < nintvars; i++ )
       {
          if( SCIPvarGetStatus(vars[i]) == SCIP_VARSTATUS_COLUMN )
@@ -669,9 +696,16 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
             SCIP_Real shiftval;
             SCIP_Real solval;
 
+            /* a variable that could not be shifted keeps its solution value, so it stays blocked as long as neither its
+             * bounds nor the activity of the blocking row have changed since its last evaluation
+             */
+            if( blockingrows[i] == -1 || (blockingrows[i] >= 0 && rowchgiters[blockingrows[i]] < evaliters[i]) )
+               continue;
+
             /* find out whether the variable can be shifted */
             solval = SCIPgetSolVal(scip, worksol, vars[i]);
-            shiftval = calcShiftVal(scip, vars[i], solval, activities);
+            shiftval = calcShiftVal(scip, vars[i], solval, activities, &blockingrows[i]);
+            evaliters[i] = niterations;
 
             /* insert the variable into the list of shifting candidates */
             if( !SCIPisFeasZero(scip, shiftval) )
@@ -709,7 +743,7 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
             SCIPdebugMsg(scip, " Only one shiftcand found, var <%s>, which is now shifted by<%1.1f> \n",
                SCIPvarGetName(var), shiftval);
             SCIP_CALL( SCIPsetSolVal(scip, worksol, var, solval+shiftval) );
-            SCIP_CALL( updateRowActivities(scip, activities, var, shiftval) );
+            SCIP_CALL( updateRowActivities(scip, activities, rowchgiters, niterations, var, shiftval) );
             ++nsuccessfulshifts;
          }
          else
@@ -741,7 +775,7 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
                var = shiftcands[i];
                assert(var != NULL);
                solval = SCIPgetSolVal(scip, worksol, var);
-               shiftval = calcShiftVal(scip, var, solval, activities);
+               shiftval = calcShiftVal(scip, var, solval, activities, NULL);
                assert(i > 0 || !SCIPisFeasZero(scip, shiftval));
                assert(SCIPisFeasGE(scip, solval+shiftval, SCIPvarGetLbGlobal(var)) && SCIPisFeasLE(scip, solval+shiftval, SCIPvarGetUbGlobal(var)));
 
@@ -750,7 +784,7 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
                {
                   SCIPdebugMsg(scip, " -> Variable <%s> is now shifted by <%1.1f> \n", SCIPvarGetName(vars[i]), shiftval);
                   SCIP_CALL( SCIPsetSolVal(scip, worksol, var, solval+shiftval) );
-                  SCIP_CALL( updateRowActivities(scip, activities, var, shiftval) );
+                  SCIP_CALL( updateRowActivities(scip, activities, rowchgiters, niterations, var, shiftval) );
                   ++nsuccessfulshifts;
                }
             }
@@ -867,6 +901,9 @@ SCIP_DECL_HEUREXEC(heurExecOneopt)
 
    SCIPfreeBufferArray(scip, &shiftvals);
    SCIPfreeBufferArray(scip, &shiftcands);
+   SCIPfreeBufferArray(scip, &rowchgiters);
+   SCIPfreeBufferArray(scip, &evaliters);
+   SCIPfreeBufferArray(scip, &blockingrows);
    SCIPfreeBufferArray(scip, &activities);
 
    SCIP_CALL( SCIPfreeSol(scip, &worksol) );
@@ -1315,7 +1315,13 @@ static SCIP_DECL_HEUREXEC(heurExecPADM)
          solutionsdiffer = FALSE;
          SCIPdebugMsg(scip, "%d\t%d\t%d\t%s\n", piter, aiter, increasedslacks, info);
 
-         /* Loop through the blocks and solve each sub-SCIP, potentially multiple times */
+         /* Loop through the blocks and solve each sub-SCIP, potentially multiple times
+          *
+          * This is a Gauss-Seidel sweep: the coupling constraints of block b use the latest linking values, i.e., those
+          * of the blocks solved before b in the same sweep.  This usually needs fewer sweeps than a Jacobi sweep in
+          * which all blocks use the values of the previous sweep.  The sub-SCIPs are created once and are only reset
+          * by SCIPfreeTransform() between solves.
+          */
          for( b = 0; b < problem->nblocks; b++ )
          {
             for( i = 0; i < blocktolinkvars[b].size; i++ )
@@ -86,6 +86,11 @@ struct SCIP_HeurData
 
 /** perform randomized rounding of the given solution. Domain propagation is optionally applied after every rounding
  *  step
+ *
+ *  @note one rounded point is generated per call.  With propagation, every rounding step changes the probing domains
+ *        of the main SCIP, so several roundings cannot be built at the same time.  In any case, a rounded point has to
+ *        be checked by the constraint handlers in SCIPtrySol(), which works on the main SCIP and therefore cannot run
+ *        on other threads or an accelerator.
  */
 static
 SCIP_RETCODE performRandRounding(
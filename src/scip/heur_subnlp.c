@@ -1015,7 +1015,14 @@ SCIP_RETCODE createSolFromSubScipSol(
    return SCIP_OKAY;
 }
 
-/* solves the subNLP specified in subscip */
+/* solves the subNLP specified in subscip
+ *
+ * The sub-SCIP is created at the first call (see createSubSCIP()) and kept afterwards.  Between calls it is reset with
+ * SCIPfreeTransform(), so the copied problem, the plugins and the parameters are reused and only the fixings of the
+ * integer variables change.  The NLP, and with it the NLPI problem, is built again from the presolved sub-SCIP in every
+ * call.  Presolving the sub-SCIP with the new fixings removes variables and constraints and can change the nonlinear
+ * structure, so a persistent NLP would have to solve the larger problem without these reductions.
+ */
 static
 SCIP_RETCODE solveSubNLP(
    SCIP*                 scip,               /**< original SCIP data structure                                   */
@@ -912,7 +912,15 @@ SCIP_RETCODE createRows(
 }
 
 
-/** get a sub-SCIP copy of the transformed problem */
+/** get a sub-SCIP copy of the transformed problem
+ *
+ *  @note The large neighborhood search heuristics call this method to build a fresh sub-SCIP in every call instead of
+ *        keeping one copy and resetting its bounds.  With compressed copying, the fixed variables are removed from the
+ *        copied constraints, so the sub-SCIP of a neighborhood with many fixings is much smaller than the full problem.
+ *        A fresh copy also picks up the current global bounds and the constraints present at that time, which change
+ *        after restarts and global reductions.  Heuristics whose subproblem differs from call to call only in a few
+ *        modifications, such as heur_proximity.c, keep their sub-SCIP and call SCIPfreeTransform() on it between calls.
+ */
 SCIP_RETCODE SCIPcopyLargeNeighborhoodSearch(
    SCIP*                 sourcescip,         /**< source SCIP data structure */
    SCIP*                 subscip,            /**< sub-SCIP used by the heuristic */
@@ -2883,6 +2883,10 @@ SCIP_Bool checkNEntries(
 #endif
 
 /** removes all empty and single variable cliques from the clique table; removes double entries from the clique table
+ *
+ * Only the dirty cliques, i.e., those kept in front of the clique array with an inactive, fixed, or deleted variable
+ * at or after their startcleanup position, are processed, and a clique's variables are only sorted and merged again if
+ * one of them was replaced by an active representative; all other cliques are neither touched nor re-sorted.
  *
  * @note cliques can be processed several times by this method
  *
@@ -365,6 +365,20 @@ SCIP_Real SCIPintervalNegateReal(
    return negate((double)x);
 }
 
+/** returns the interval of the negated values of an interval; this is exact and independent of the rounding mode */
+static
+SCIP_INTERVAL intervalNegate(
+   SCIP_INTERVAL         operand             /**< operand to negate */
+   )
+{
+   SCIP_INTERVAL resultant;
+
+   resultant.inf = -operand.sup;
+   resultant.sup = -operand.inf;
+
+   return resultant;
+}
+
 /*
  * Interval arithmetic operations
  */
@@ -758,21 +772,20 @@ void SCIPintervalAddVectors(
    )
 {
    SCIP_ROUNDMODE roundmode;
+   SCIP_INTERVAL negsum;
    int i;
 
    roundmode = intervalGetRoundingMode();
 
-   /* compute infimums of resultant array */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-   for( i = 0; i < length; ++i )
-   {
-      SCIPintervalAddInf(infinity, &resultant[i], operand1[i], operand2[i]);
-   }
-   /* compute supremums of result array */
+   /* compute infimums and supremums with one switch of the rounding mode: the infimum of operand1 + operand2 is the
+    * negated supremum of (-operand1) + (-operand2), and negation is exact
+    */
    intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
    for( i = 0; i < length; ++i )
    {
+      SCIPintervalAddSup(infinity, &negsum, intervalNegate(operand1[i]), intervalNegate(operand2[i]));
       SCIPintervalAddSup(infinity, &resultant[i], operand1[i], operand2[i]);
+      resultant[i].inf = -negsum.sup;
    }
 
    intervalSetRoundingMode(roundmode);
@@ -1303,31 +1316,31 @@ void SCIPintervalScalprod(
 {
    SCIP_ROUNDMODE roundmode;
    SCIP_INTERVAL prod;
+   SCIP_INTERVAL negprod;
+   SCIP_INTERVAL negsum;
    int i;
 
    roundmode = intervalGetRoundingMode();
 
    resultant->inf = 0.0;
    resultant->sup = 0.0;
+   negsum.sup = 0.0;
 
-   /* compute infimum of resultant */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-   for( i = 0; i < length && resultant->inf > -infinity; ++i )
-   {
-      SCIPintervalSetEntire(infinity, &prod);
-      SCIPintervalMulInf(infinity, &prod, operand1[i], operand2[i]);
-      SCIPintervalAddInf(infinity, resultant, *resultant, prod); 
-   }
-   assert(resultant->sup == 0.0);
-
-   /* compute supremum of resultant */
+   /* compute infimum and supremum with one switch of the rounding mode: the infimum of the scalar product is the
+    * negated supremum of the scalar product of -operand1 and operand2
+    */
    intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
-   for( i = 0; i < length && resultant->sup < infinity ; ++i )
+   SCIPintervalSetEntire(infinity, &prod);
+   SCIPintervalSetEntire(infinity, &negprod);
+   for( i = 0; i < length && (negsum.sup < infinity || resultant->sup < infinity); ++i )
    {
-      SCIPintervalSetEntire(infinity, &prod);
+      SCIPintervalMulSup(infinity, &negprod, intervalNegate(operand1[i]), operand2[i]);
+      SCIPintervalAddSup(infinity, &negsum, negsum, negprod);
+
       SCIPintervalMulSup(infinity, &prod, operand1[i], operand2[i]);
-      SCIPintervalAddSup(infinity, resultant, *resultant, prod); 
+      SCIPintervalAddSup(infinity, resultant, *resultant, prod);
    }
+   resultant->inf = -negsum.sup;
 
    intervalSetRoundingMode(roundmode);
 }
@@ -1398,20 +1411,34 @@ void SCIPintervalScalprodScalars(
    )
 {
    SCIP_ROUNDMODE roundmode;
+   SCIP_INTERVAL prod;
+   SCIP_INTERVAL negprod;
+   SCIP_INTERVAL negsum;
+   int i;
 
    roundmode = intervalGetRoundingMode();
 
    resultant->inf = 0.0;
    resultant->sup = 0.0;
+   negsum.sup = 0.0;
 
-   /* compute infimum of resultant */
-   intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-   SCIPintervalScalprodScalarsInf(infinity, resultant, length, operand1, operand2);
-   assert(resultant->sup == 0.0);
-
-   /* compute supremum of resultant */
+   /* compute infimum and supremum with one switch of the rounding mode: the infimum of the scalar product is the
+    * negated supremum of the scalar product of operand1 and -operand2
+    */
    intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
-   SCIPintervalScalprodScalarsSup(infinity, resultant, length, operand1, operand2);
+   SCIPintervalSetEntire(infinity, &prod);
+   SCIPintervalSetEntire(infinity, &negprod);
+   for( i = 0; i < length && (negsum.sup < infinity || resultant->sup < infinity); ++i )
+   {
+      SCIPintervalMulScalarSup(infinity, &negprod, operand1[i], -operand2[i]);
+      assert(negprod.inf <= -infinity);
+      SCIPintervalAddSup(infinity, &negsum, negsum, negprod);
+
+      SCIPintervalMulScalarSup(infinity, &prod, operand1[i], operand2[i]);
+      assert(prod.inf <= -infinity);
+      SCIPintervalAddSup(infinity, resultant, *resultant, prod);
+   }
+   resultant->inf = -negsum.sup;
 
    intervalSetRoundingMode(roundmode);
 }
@@ -1430,41 +1457,32 @@ void SCIPintervalSquare(
 
    roundmode = intervalGetRoundingMode();
 
+   /* round upwards only; lower bounds are computed as negation of the upwards rounded negated square */
+   intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
+
    if( operand.sup <= 0.0 )
    {  /* operand is left of 0.0 */
       if( operand.sup <= -infinity )
          resultant->inf =  infinity;
       else
-      {
-         intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-         resultant->inf = operand.sup * operand.sup;
-      }
+         resultant->inf = negate(negate(operand.sup) * operand.sup);
 
       if( operand.inf <= -infinity )
          resultant->sup = infinity;
       else
-      {
-         intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
          resultant->sup = operand.inf * operand.inf;
-      }
    }
    else if( operand.inf >= 0.0 )
    {  /* operand is right of 0.0 */
       if( operand.inf >= infinity )
          resultant->inf = infinity;
       else
-      {
-         intervalSetRoundingMode(SCIP_ROUND_DOWNWARDS);
-         resultant->inf = operand.inf * operand.inf;
-      }
+         resultant->inf = negate(negate(operand.inf) * operand.inf);
 
       if( operand.sup >= infinity )
          resultant->sup = infinity;
       else
-      {
-         intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
          resultant->sup = operand.sup * operand.sup;
-      }
    }
    else
    {  /* [-,+]^2 */
@@ -1476,7 +1494,6 @@ void SCIPintervalSquare(
          SCIP_Real x;
          SCIP_Real y;
 
-         intervalSetRoundingMode(SCIP_ROUND_UPWARDS);
          x = operand.inf * operand.inf;
          y = operand.sup * operand.sup;
          resultant->sup = MAX(x, y);
@@ -55,6 +55,7 @@
 #include "scip/struct_set.h"
 #include "scip/struct_stat.h"
 #include "scip/struct_var.h"
+#include "scip/trace.h"
 #include "scip/var.h"
 #include <string.h>
 
@@ -3166,8 +3167,11 @@ SCIP_RETCODE lpSetTiming(
 
    SCIP_CALL( lpCheckIntpar(lp, SCIP_LPPAR_TIMING, lp->lpitiming) );
 
+   /* the LP solver does not know the time stamp counter clock and measures wall clock time instead */
    if( !enabled )
       lptiming = 0;
+   else if( timing == SCIP_CLOCKTYPE_TSC )
+      lptiming = (int) SCIP_CLOCKTYPE_WALL;
    else
       lptiming = (int) timing;
 
@@ -4584,7 +4588,12 @@ SCIP_RETCODE SCIPcolGetStrongbranches(
 
    SCIPsetDebugMsg(set, "performing strong branching on %d variables with %d iterations\n", ncols, itlim);
 
-   /* call LPI strong branching */
+   /* call LPI strong branching
+    *
+    * All candidates are passed to the LP interface in one call and evaluated on the single LP of this SCIP instance,
+    * which is restored to the current basis after each candidate; the LP interfaces provide no way to copy a loaded
+    * problem with its warm start to evaluate candidates on separate LPs.
+    */
    if ( integral )
       retcode = SCIPlpiStrongbranchesInt(lp->lpi, lpipos, nsubcols, primsols, itlim, sbdown, sbup, sbdownvalid, sbupvalid, &iter);
    else
@@ -8281,6 +8290,10 @@ SCIP_RETCODE lpFlushAddRows(
       /* Because the row becomes a member of the LP solver, its dual variable now can take values
        * different from zero. That means, we have to include the row in the corresponding
        * column vectors.
+       *
+       * The linking cannot be postponed until after the LPI call: it moves the LP columns to the front of the row's
+       * cols array and updates row->nlpcols, which is needed below to fill the (single, contiguous) buffer that is
+       * passed to SCIPlpiAddRows() for all new rows at once.
        */
       SCIP_CALL( rowLink(row, blkmem, set, eventqueue, lp) );
 
@@ -8388,12 +8401,15 @@ SCIP_RETCODE lpFlushChgCols(
    /* get the solver's infinity value */
    lpiinf = SCIPlpiInfinity(lp->lpi);
 
-   /* get temporary memory for changes */
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &objind, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &obj, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &bdind, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &lb, lp->ncols) );
-   SCIP_CALL( SCIPsetAllocBufferArray(set, &ub, lp->ncols) );
+   /* get temporary memory for changes; each changed column yields at most one objective and one bound change, and
+    * buffer memory is reused across flushes, so sizing the arrays by the number of changed columns keeps flushes
+    * with only a few changes (e.g., in probing or strong branching) cheap
+    */
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &objind, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &obj, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &bdind, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &lb, lp->nchgcols) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &ub, lp->nchgcols) );
 
    /* collect all cached bound and objective changes */
    nobjchg = 0;
@@ -8433,7 +8449,7 @@ SCIP_RETCODE lpFlushChgCols(
             newobj = col->obj;
             if( col->flushedobj != newobj ) /*lint !e777*/
             {
-               assert(nobjchg < lp->ncols);
+               assert(nobjchg < lp->nchgcols);
                objind[nobjchg] = col->lpipos;
                obj[nobjchg] = newobj;
                nobjchg++;
@@ -8452,7 +8468,7 @@ SCIP_RETCODE lpFlushChgCols(
 
             if( col->flushedlb != newlb || col->flushedub != newub ) /*lint !e777*/
             {
-               assert(nbdchg < lp->ncols);
+               assert(nbdchg < lp->nchgcols);
                bdind[nbdchg] = col->lpipos;
                lb[nbdchg] = newlb;
                ub[nbdchg] = newub;
@@ -11543,7 +11559,12 @@ SCIP_RETCODE ignoreInstability(
 }
 
 #define FEASTOLTIGHTFAC 0.001
-/** solves the LP with the given LP algorithm, and tries to resolve numerical problems */
+/** solves the LP with the given LP algorithm, and tries to resolve numerical problems
+ *
+ *  The fallback algorithms are tried one after another on the same LPI; racing several algorithms on separate LPI
+ *  instances is not done, since the LP interfaces offer no way to clone a loaded problem into another thread. Choosing
+ *  the root algorithm is left to the parameter lp/initalgorithm.
+ */
 static
 SCIP_RETCODE lpSolveStable(
    SCIP_LP*              lp,                 /**< current LP data */
@@ -12368,7 +12389,8 @@ int lpGetResolveItlim(
 
 
 /** solves the LP with simplex algorithm, and copy the solution into the column's data */
-SCIP_RETCODE SCIPlpSolveAndEval(
+static
+SCIP_RETCODE lpSolveAndEval(
    SCIP_LP*              lp,                 /**< LP data */
    SCIP_SET*             set,                /**< global SCIP settings */
    SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
@@ -13049,6 +13071,43 @@ SCIP_RETCODE SCIPlpSolveAndEval(
    return retcode;
 }
 
+/** solves the LP with simplex algorithm, and copy the solution into the column's data; the solve is recorded in the
+ *  event trace
+ */
+SCIP_RETCODE SCIPlpSolveAndEval(
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   BMS_BLKMEM*           blkmem,             /**< block memory buffers */
+   SCIP_STAT*            stat,               /**< problem statistics */
+   SCIP_EVENTQUEUE*      eventqueue,         /**< event queue */
+   SCIP_EVENTFILTER*     eventfilter,        /**< global event filter */
+   SCIP_PROB*            prob,               /**< problem data */
+   SCIP_Longint          itlim,              /**< maximal number of LP iterations to perform, or -1 for no limit */
+   SCIP_Bool             limitresolveiters,  /**< should LP iterations for resolving calls be limited?
+                                              *   (limit is computed within the method w.r.t. the average LP iterations) */
+   SCIP_Bool             aging,              /**< should aging and removal of obsolete cols/rows be applied? */
+   SCIP_Bool             keepsol,            /**< should the old LP solution be kept if no iterations were performed? */
+   SCIP_Bool*            lperror             /**< pointer to store whether an unresolved LP error occurred */
+   )
+{
+   SCIP_RETCODE retcode;
+   const char* tracename;
+
+   assert(lp != NULL);
+   assert(stat != NULL);
+
+   tracename = lp->diving ? "diving lp" : (lp->probing ? "probing lp" : "lp");
+
+   /* the trace event is closed also if solving fails */
+   SCIPtraceStart(stat->trace, SCIP_TRACECAT_LP, tracename);
+   retcode = lpSolveAndEval(lp, set, messagehdlr, blkmem, stat, eventqueue, eventfilter, prob, itlim, limitresolveiters,
+      aging, keepsol, lperror);
+   SCIPtraceStop(stat->trace, SCIP_TRACECAT_LP, tracename);
+
+   return retcode;
+}
+
 /** gets solution status of current LP */
 SCIP_LPSOLSTAT SCIPlpGetSolstat(
    SCIP_LP*              lp                  /**< current LP data */
@@ -14472,7 +14531,10 @@ SCIP_RETCODE SCIPlpGetSol(
    {
       assert( 0 <= rstat[r] && rstat[r] < 4 );
       lpirows[r]->dualsol = dualsol[r];
-      /* do not rely on LP solvers computation of activity, but recalculate, see also #2594 */
+      /* do not rely on LP solvers computation of activity, but recalculate, see also #2594;
+       * this refreshes the activities of all LP rows in one pass per LP solve, so later efficacy and redundancy checks
+       * on LP rows find them valid; the row norms are maintained incrementally when coefficients change
+       */
       if( lpirows[r]->validactivitylp != stat->lpcount )
          SCIProwRecalcLPActivity(lpirows[r], stat);
       lpirows[r]->basisstatus = (unsigned int) rstat[r]; /*lint !e732*/
@@ -16017,14 +16079,20 @@ SCIP_RETCODE SCIPlpEndDive(
 
    SCIPsetDebugMsg(set, "diving ended (LP flushed: %u, solstat: %d)\n", lp->flushed, SCIPlpGetSolstat(lp));
 
-   /* reset all columns' objective values and bounds to its original values */
+   /* reset all columns' objective values and bounds to its original values; the objective values only have to be
+    * reset if they were changed in diving mode, otherwise they still coincide with the variables' objective values
+    */
    for( v = 0; v < nvars; ++v )
    {
       var = vars[v];
       assert(var != NULL);
       if( SCIPvarGetStatus(var) == SCIP_VARSTATUS_COLUMN )
       {
-         SCIP_CALL( SCIPcolChgObj(SCIPvarGetCol(var), set, lp, SCIPvarGetObj(var)) );
+         if( lp->divingobjchg )
+         {
+            SCIP_CALL( SCIPcolChgObj(SCIPvarGetCol(var), set, lp, SCIPvarGetObj(var)) );
+         }
+         assert(SCIPsetIsEQ(set, SCIPvarGetCol(var)->obj, SCIPvarGetObj(var)) || lp->divingobjchg);
          SCIP_CALL( SCIPcolChgLb(SCIPvarGetCol(var), set, lp, SCIPvarGetLbLocal(var)) );
          SCIP_CALL( SCIPcolChgUb(SCIPvarGetCol(var), set, lp, SCIPvarGetUbLocal(var)) );
       }
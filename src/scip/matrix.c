@@ -441,6 +441,10 @@ SCIP_RETCODE calcActivityBounds(
  *
  *  @note Completeness is checked by testing whether all check constraints are from a list of linear constraint handlers
  *        that can be represented.
+ *
+ *  @note The matrix is a snapshot of the current constraints; it is not updated when a presolver changes the problem.
+ *        Since every matrix-based presolver applies its reductions directly (fixing, aggregating or deleting), the
+ *        next one would see an outdated matrix, which is why each presolver creates its own copy.
  */
 SCIP_RETCODE SCIPmatrixCreate(
    SCIP*                 scip,               /**< current scip instance */
@@ -1170,7 +1174,12 @@ void SCIPmatrixRemoveColumnBounds(
    matrix->ub[col] = SCIPinfinity(scip);
 }
 
-/** detect parallel rows of matrix. rhs/lhs are ignored. */
+/** detect parallel rows of matrix. rhs/lhs are ignored.
+ *
+ *  The rows are partitioned by refinement: starting with one class, each column splits the classes of its rows by
+ *  the scaled coefficient values, so only the nonzeros of each column are sorted (no global sort over all rows) and the
+ *  total work is O(nnz log(maximal column length)). Parallel classes therefore never need pairwise verification.
+ */
 SCIP_RETCODE SCIPmatrixGetParallelRows(
    SCIP*                 scip,               /**< SCIP instance */
    SCIP_MATRIX*          matrix,             /**< matrix containing the constraints */
@@ -29,16 +29,23 @@
  * Local methods
  */
 
-/** prints a message to the given file stream and writes the same messate to the log file */
+/** prints a message to the given file stream and writes the same messate to the log file
+ *
+ *  Screen and log file output is flushed immediately, such that it can be followed while solving. Other files, e.g.,
+ *  problem and solution files written by the readers, are only flushed on request or when they are closed; otherwise,
+ *  each of the many small messages issued while writing such a file would cause a separate system call.
+ */
 static
 void logMessage(
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
    FILE*                 file,               /**< file stream to print message into */
    const char*           msg                 /**< message to print (or NULL to flush) */
    )
 {
    if ( msg != NULL )
       fputs(msg, file);
-   fflush(file);
+   if ( msg == NULL || file == stdout || file == stderr || messagehdlr == NULL || file == messagehdlr->logfile )
+      fflush(file);
 }
 
 /*
@@ -52,21 +59,21 @@ SCIP_DECL_MESSAGEWARNING(messageWarningDefault)
    if ( msg != NULL && msg[0] != '\0' && msg[0] != '\n' )
       fputs("WARNING: ", file);
 
-   logMessage(file, msg);
+   logMessage(messagehdlr, file, msg);
 }
 
 /** dialog message print method of message handler */
 static
 SCIP_DECL_MESSAGEDIALOG(messageDialogDefault)
 {  /*lint --e{715}*/
-   logMessage(file, msg);
+   logMessage(messagehdlr, file, msg);
 }
 
 /** info message print method of message handler */
 static
 SCIP_DECL_MESSAGEINFO(messageInfoDefault)
 {  /*lint --e{715}*/
-   logMessage(file, msg);
+   logMessage(messagehdlr, file, msg);
 }
 
 /** Create default message handler. To free the message handler use SCIPmessagehdlrRelease(). */
@@ -486,6 +486,98 @@ SCIP_Bool nodepqDelPos(
    return parentfelldown;
 }
 
+/** rebuilds both heaps of the node priority queue from scratch in linear time, treating the first len slots as an
+ *  unordered set of nodes
+ */
+static
+void nodepqBuildHeaps(
+   SCIP_NODEPQ*          nodepq,             /**< node priority queue */
+   SCIP_SET*             set                 /**< global SCIP settings */
+   )
+{
+   SCIP_NODESEL* nodesel;
+   SCIP_NODE** slots;
+   int* bfsposs;
+   int* bfsqueue;
+   int start;
+   int pos;
+
+   assert(nodepq != NULL);
+   assert(set != NULL);
+
+   nodesel = nodepq->nodesel;
+   assert(nodesel != NULL);
+   assert(nodesel->nodeselcomp != NULL);
+
+   slots = nodepq->slots;
+   bfsposs = nodepq->bfsposs;
+   bfsqueue = nodepq->bfsqueue;
+
+   /* heapify the slots w.r.t. the node selection comparator by sifting down all inner slots */
+   for( start = PQ_PARENT(nodepq->len-1); start >= 0; --start )
+   {
+      SCIP_NODE* node;
+
+      node = slots[start];
+      pos = start;
+      while( PQ_LEFTCHILD(pos) < nodepq->len )
+      {
+         int childpos;
+
+         childpos = PQ_LEFTCHILD(pos);
+         if( PQ_RIGHTCHILD(pos) < nodepq->len
+            && nodesel->nodeselcomp(set->scip, nodesel, slots[PQ_RIGHTCHILD(pos)], slots[childpos]) < 0 )
+            childpos = PQ_RIGHTCHILD(pos);
+
+         if( nodesel->nodeselcomp(set->scip, nodesel, node, slots[childpos]) <= 0 )
+            break;
+
+         slots[pos] = slots[childpos];
+         pos = childpos;
+      }
+      slots[pos] = node;
+   }
+
+   /* heapify the bfs queue w.r.t. the lower bound of the nodes in the referenced slots */
+   for( pos = 0; pos < nodepq->len; ++pos )
+      bfsqueue[pos] = pos;
+   for( start = PQ_PARENT(nodepq->len-1); start >= 0; --start )
+   {
+      SCIP_Real lowerbound;
+      int idx;
+
+      idx = bfsqueue[start];
+      lowerbound = SCIPnodeGetLowerbound(slots[idx]);
+      pos = start;
+      while( PQ_LEFTCHILD(pos) < nodepq->len )
+      {
+         int childpos;
+
+         childpos = PQ_LEFTCHILD(pos);
+         if( PQ_RIGHTCHILD(pos) < nodepq->len
+            && SCIPnodeGetLowerbound(slots[bfsqueue[PQ_RIGHTCHILD(pos)]]) < SCIPnodeGetLowerbound(slots[bfsqueue[childpos]]) )
+            childpos = PQ_RIGHTCHILD(pos);
+
+         if( lowerbound <= SCIPnodeGetLowerbound(slots[bfsqueue[childpos]]) )
+            break;
+
+         bfsqueue[pos] = bfsqueue[childpos];
+         pos = childpos;
+      }
+      bfsqueue[pos] = idx;
+   }
+   for( pos = 0; pos < nodepq->len; ++pos )
+      bfsposs[bfsqueue[pos]] = pos;
+
+#ifndef NDEBUG
+   for( pos = 1; pos < nodepq->len; ++pos )
+   {
+      assert(nodesel->nodeselcomp(set->scip, nodesel, slots[PQ_PARENT(pos)], slots[pos]) <= 0);
+      assert(SCIPnodeGetLowerbound(slots[bfsqueue[PQ_PARENT(pos)]]) <= SCIPnodeGetLowerbound(slots[bfsqueue[pos]]));
+   }
+#endif
+}
+
 /** returns the position of given node in the priority queue, or -1 if not existing */
 static
 int nodepqFindNode(
@@ -641,12 +733,80 @@ SCIP_RETCODE SCIPnodepqBound(
    )
 {
    SCIP_NODE* node;
+   int ncutoffs;
    int pos;
    SCIP_Bool parentfelldown;
 
    assert(nodepq != NULL);
 
    SCIPsetDebugMsg(set, "bounding node queue of length %d with cutoffbound=%g\n", nodepq->len, cutoffbound);
+
+   /* count the nodes to cut off; if a large part of the queue is pruned, e.g., after a much better incumbent was
+    * found, removing the nodes one by one with O(log n) reheap work each is more expensive than rebuilding the heaps
+    */
+   ncutoffs = 0;
+   for( pos = 0; pos < nodepq->len; ++pos )
+   {
+      if( SCIPsetIsGE(set, SCIPnodeGetLowerbound(nodepq->slots[pos]), cutoffbound) )
+         ++ncutoffs;
+   }
+
+   if( ncutoffs == 0 )
+      return SCIP_OKAY;
+
+   if( 4 * ncutoffs >= nodepq->len )
+   {
+      int nremaining;
+      int oldlen;
+
+      /* move the remaining nodes to the front of the slots array and the cut off nodes behind them */
+      nremaining = 0;
+      nodepq->lowerboundsum = 0.0;
+      for( pos = 0; pos < nodepq->len; ++pos )
+      {
+         node = nodepq->slots[pos];
+         assert(node != NULL);
+         assert(SCIPnodeGetType(node) == SCIP_NODETYPE_LEAF);
+
+         if( SCIPsetIsLT(set, SCIPnodeGetLowerbound(node), cutoffbound) )
+         {
+            nodepq->slots[pos] = nodepq->slots[nremaining];
+            nodepq->slots[nremaining] = node;
+            nodepq->lowerboundsum += SCIPnodeGetLowerbound(node);
+            ++nremaining;
+         }
+      }
+      assert(nremaining == nodepq->len - ncutoffs);
+
+      oldlen = nodepq->len;
+      nodepq->len = nremaining;
+      nodepqBuildHeaps(nodepq, set);
+
+      /* free the cut off nodes; the queue is already consistent at this point */
+      for( pos = nremaining; pos < oldlen; ++pos )
+      {
+         node = nodepq->slots[pos];
+
+         SCIPsetDebugMsg(set, "free node at depth %d with lowerbound=%g\n", SCIPnodeGetDepth(node),
+            SCIPnodeGetLowerbound(node));
+
+         SCIPvisualCutoffNode(stat->visual, set, stat, node, FALSE);
+
+         if( set->reopt_enable )
+         {
+            assert(reopt != NULL);
+            SCIP_CALL( SCIPreoptCheckCutoff(reopt, set, blkmem, node, SCIP_EVENTTYPE_NODEINFEASIBLE, lp,
+                  SCIPlpGetSolstat(lp), SCIPnodeGetDepth(node) == 0, SCIPtreeGetFocusNode(tree) == node,
+                  SCIPnodeGetLowerbound(node), SCIPtreeGetEffectiveRootDepth(tree)));
+         }
+
+         SCIP_CALL( SCIPnodeFree(&node, blkmem, set, stat, eventfilter, eventqueue, tree, lp) );
+      }
+      SCIPsetDebugMsg(set, " -> bounded node queue has length %d\n", nodepq->len);
+
+      return SCIP_OKAY;
+   }
+
    pos = nodepq->len-1;
    while( pos >= 0 )
    {
@@ -107,7 +107,12 @@ SCIP_DECL_NODESELFREE(nodeselFreeEstimate)
 }
 
 
-/** node selection method of node selector */
+/** node selection method of node selector
+ *
+ *  Locality is handled by plunging: as long as the plunging depth and quotient limits allow, a child or sibling of the
+ *  current node is selected, which requires no path switch and reuses the warm-started LP of the parent; only when
+ *  plunging is aborted, the best node w.r.t. the estimate (or the lower bound, every bestnodefreq nodes) is selected.
+ */
 static
 SCIP_DECL_NODESELSELECT(nodeselSelectEstimate)
 {  /*lint --e{715}*/
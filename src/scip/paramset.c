@@ -636,6 +636,36 @@ SCIP_RETCODE paramCopyString(
    return SCIP_OKAY;
 }
 
+/** returns whether the target parameter already has the value of the source parameter of the same type */
+static
+SCIP_Bool paramHasSameValue(
+   SCIP_PARAM*           sourceparam,        /**< source parameter */
+   SCIP_PARAM*           targetparam         /**< target parameter */
+   )
+{
+   assert(sourceparam != NULL);
+   assert(targetparam != NULL);
+   assert(SCIPparamGetType(sourceparam) == SCIPparamGetType(targetparam));
+
+   switch( SCIPparamGetType(sourceparam) )
+   {
+   case SCIP_PARAMTYPE_BOOL:
+      return SCIPparamGetBool(sourceparam) == SCIPparamGetBool(targetparam);
+   case SCIP_PARAMTYPE_INT:
+      return SCIPparamGetInt(sourceparam) == SCIPparamGetInt(targetparam);
+   case SCIP_PARAMTYPE_LONGINT:
+      return SCIPparamGetLongint(sourceparam) == SCIPparamGetLongint(targetparam);
+   case SCIP_PARAMTYPE_REAL:
+      return SCIPparamGetReal(sourceparam) == SCIPparamGetReal(targetparam); /*lint !e777*/
+   case SCIP_PARAMTYPE_CHAR:
+      return SCIPparamGetChar(sourceparam) == SCIPparamGetChar(targetparam);
+   case SCIP_PARAMTYPE_STRING:
+      return strcmp(SCIPparamGetString(sourceparam), SCIPparamGetString(targetparam)) == 0;
+   default:
+      return FALSE;
+   }
+}
+
 /** returns type of parameter */
 SCIP_PARAMTYPE SCIPparamGetType(
    SCIP_PARAM*           param               /**< parameter */
@@ -4331,6 +4361,15 @@ SCIP_RETCODE SCIPparamsetCopyParams(
 
       assert(SCIPparamGetType(sourceparam) == SCIPparamGetType(targetparam));
 
+      /* the value of the target parameter only needs to be set if it differs, which in particular avoids to duplicate
+       * string values and to call their change information methods for parameters that are still at their defaults
+       */
+      if( paramHasSameValue(sourceparam, targetparam) )
+      {
+         SCIPparamSetFixed(targetparam, SCIPparamIsFixed(sourceparam));
+         continue;
+      }
+
       /* set value of target parameter to value of source parameter */
       switch( SCIPparamGetType(sourceparam) )
       {
@@ -335,6 +335,7 @@ SCIP_RETCODE SCIPpresolInitpre(
    presol->lastnupgdconss = 0;
    presol->lastnchgcoefs = 0;
    presol->lastnchgsides = 0;
+   presol->nfailexhaustive = 0;
 
    /* call presolving initialization method of presolver */
    if( presol->presolinitpre != NULL )
@@ -426,6 +427,13 @@ SCIP_RETCODE SCIPpresolExec(
    if( presol->maxrounds >= 0 && presol->ncalls >= presol->maxrounds )
       return SCIP_OKAY;
 
+   /* skip exhaustive calls of presolvers that did not find reductions in their recent exhaustive calls, since these
+    * calls are usually the expensive ones
+    */
+   if( timing == SCIP_PRESOLTIMING_EXHAUSTIVE && set->presol_maxfailexhaustive >= 0
+      && presol->nfailexhaustive >= set->presol_maxfailexhaustive )
+      return SCIP_OKAY;
+
    /* calculate the number of changes since last call */
    nnewfixedvars = *nfixedvars - presol->lastnfixedvars;
    nnewaggrvars = *naggrvars - presol->lastnaggrvars;
@@ -494,6 +502,15 @@ SCIP_RETCODE SCIPpresolExec(
       /* increase the number of calls, if the presolver tried to find reductions */
       if( *result != SCIP_DIDNOTRUN )
          ++(presol->ncalls);
+
+      /* update the number of consecutive unsuccessful exhaustive calls */
+      if( timing == SCIP_PRESOLTIMING_EXHAUSTIVE )
+      {
+         if( *result == SCIP_DIDNOTFIND )
+            ++(presol->nfailexhaustive);
+         else if( *result != SCIP_DIDNOTRUN )
+            presol->nfailexhaustive = 0;
+      }
    }
 
    return SCIP_OKAY;
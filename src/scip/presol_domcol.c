@@ -42,6 +42,7 @@
 #include "scip/presol_domcol.h"
 #include "scip/pub_matrix.h"
 #include "scip/pub_message.h"
+#include "scip/pub_misc.h"
 #include "scip/pub_misc_sort.h"
 #include "scip/pub_presol.h"
 #include "scip/pub_var.h"
@@ -1539,6 +1540,7 @@ SCIP_RETCODE findDominancePairs(
    int*                  searchcols,         /**< indexes of variables for pair comparisons */
    int                   searchsize,         /**< number of variables for pair comparisons */
    SCIP_Bool             onlybinvars,        /**< flag indicating searchcols contains only binary variable indexes */
+   uint64_t*             eqsignatures,       /**< signatures of the equations and ranged rows of each column */
    FIXINGDIRECTION*      varstofix,          /**< array holding information for later upper/lower bound fixing */
    int*                  nfixings,           /**< found number of possible fixings */
    SCIP_Longint*         ndomrelations,      /**< found number of dominance relations */
@@ -1584,6 +1586,7 @@ SCIP_RETCODE findDominancePairs(
    assert(matrix != NULL);
    assert(presoldata != NULL);
    assert(searchcols != NULL);
+   assert(eqsignatures != NULL);
    assert(varstofix != NULL);
    assert(nfixings != NULL);
    assert(ndomrelations != NULL);
@@ -1664,6 +1667,12 @@ SCIP_RETCODE findDominancePairs(
          if( !col1domcol2 && !col2domcol1 )
             continue;
 
+         /* a dominance relation requires both columns to appear in the same equations and ranged rows; if the
+          * signatures differ, the row comparison below would reject the pair anyway, so skip it without merging
+          */
+         if( eqsignatures[col1] != eqsignatures[col2] )
+            continue;
+
          /* get the data for both columns */
          vals1 = SCIPmatrixGetColValPtr(matrix, col1);
          rows1 = SCIPmatrixGetColIdxPtr(matrix, col1);
@@ -2030,6 +2039,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
    int pclassstart;
    int pc;
    SCIP_Bool* varineq;
+   uint64_t* eqsignatures;
 
    assert(result != NULL);
    *result = SCIP_DIDNOTRUN;
@@ -2099,6 +2109,27 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
       varineq[v] = FALSE;
    }
 
+   /* compute for each column a signature of the equations and ranged rows it appears in, which allows to discard
+    * most column pairs without a dominance relation before merging their rows
+    */
+   SCIP_CALL( SCIPallocBufferArray(scip, &eqsignatures, ncols) );
+   for( v = 0; v < ncols; v++ )
+   {
+      int* colrows;
+      int ncolrows;
+      int i;
+
+      colrows = SCIPmatrixGetColIdxPtr(matrix, v);
+      ncolrows = SCIPmatrixGetColNNonzs(matrix, v);
+
+      eqsignatures[v] = 0;
+      for( i = 0; i < ncolrows; i++ )
+      {
+         if( !SCIPmatrixIsRowRhsInfinity(matrix, colrows[i]) )
+            eqsignatures[v] |= SCIPhashSignature64(colrows[i]);
+      }
+   }
+
    /* init pair comparision control */
    presoldata->numcurrentpairs = presoldata->nummaxpairs;
 
@@ -2157,7 +2188,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          if( nconfill > 1 && presoldata->continuousred )
          {
             SCIP_CALL( findDominancePairs(scip, matrix, presoldata, consearchcols, nconfill, FALSE,
-                  varstofix, &nfixings, &ndomrelations, nchgbds) );
+                  eqsignatures, varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nconfill; ++v )
                varsprocessed[consearchcols[v]] = TRUE;
@@ -2174,7 +2205,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          if( nintfill > 1 )
          {
             SCIP_CALL( findDominancePairs(scip, matrix, presoldata, intsearchcols, nintfill, FALSE,
-                  varstofix, &nfixings, &ndomrelations, nchgbds) );
+                  eqsignatures, varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nintfill; ++v )
                varsprocessed[intsearchcols[v]] = TRUE;
@@ -2191,7 +2222,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          if( nbinfill > 1 )
          {
             SCIP_CALL( findDominancePairs(scip, matrix, presoldata, binsearchcols, nbinfill, TRUE,
-                  varstofix, &nfixings, &ndomrelations, nchgbds) );
+                  eqsignatures, varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nbinfill; ++v )
                varsprocessed[binsearchcols[v]] = TRUE;
@@ -2270,7 +2301,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          if( nconfill > 1 && presoldata->continuousred )
          {
             SCIP_CALL( findDominancePairs(scip, matrix, presoldata, consearchcols, nconfill, FALSE,
-                  varstofix, &nfixings, &ndomrelations, nchgbds) );
+                  eqsignatures, varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nconfill; ++v )
                varsprocessed[consearchcols[v]] = TRUE;
@@ -2282,7 +2313,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          if( nintfill > 1 )
          {
             SCIP_CALL( findDominancePairs(scip, matrix, presoldata, intsearchcols, nintfill, FALSE,
-                  varstofix, &nfixings, &ndomrelations, nchgbds) );
+                  eqsignatures, varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nintfill; ++v )
                varsprocessed[intsearchcols[v]] = TRUE;
@@ -2294,7 +2325,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          if( nbinfill > 1 )
          {
             SCIP_CALL( findDominancePairs(scip, matrix, presoldata, binsearchcols, nbinfill, TRUE,
-                  varstofix, &nfixings, &ndomrelations, nchgbds) );
+                  eqsignatures, varstofix, &nfixings, &ndomrelations, nchgbds) );
 
             for( v = 0; v < nbinfill; ++v )
                varsprocessed[binsearchcols[v]] = TRUE;
@@ -2387,6 +2418,7 @@ SCIP_DECL_PRESOLEXEC(presolExecDomcol)
          *result = SCIP_SUCCESS;
    }
 
+   SCIPfreeBufferArray(scip, &eqsignatures);
    SCIPfreeBufferArray(scip, &varineq);
    SCIPfreeBufferArray(scip, &colidx);
    SCIPfreeBufferArray(scip, &pclass);
@@ -1319,8 +1319,6 @@ SCIP_DECL_PRESOLEXEC(presolExecDualsparsify)
    conspairssize = 0;
    nconspairs = 0;
    conspairs = NULL;
-   SCIP_CALL( SCIPhashtableCreate(&pairtable, SCIPblkmem(scip), 1,
-         SCIPhashGetKeyStandard, consPairsEqual, consPairHashval, (void*) scip) );
 
    /* collect implied free variables and their number of nonzeros */
    for( c = 0; c < ncols; c++ )
@@ -1434,6 +1432,10 @@ SCIP_DECL_PRESOLEXEC(presolExecDualsparsify)
       }
    }
 
+   /* create the hash table only now to size it for all collected pairs, which avoids rehashing while inserting them */
+   SCIP_CALL( SCIPhashtableCreate(&pairtable, SCIPblkmem(scip), MAX(nconspairs, 1),
+         SCIPhashGetKeyStandard, consPairsEqual, consPairHashval, (void*) scip) );
+
    /* insert conspairs into hash table */
    for( c = 0; c < nconspairs; ++c )
    {
@@ -187,17 +187,16 @@ static
 SCIP_DECL_HASHKEYVAL(hashdataKeyValCons)
 {  /*lint --e{715}*/
    HASHDATA* hashdata;
-   unsigned int hashval;
 
    hashdata = (HASHDATA*)key;
    assert(hashdata != NULL);
    assert(hashdata->vars != NULL);
    assert(hashdata->nvars == 2);
 
-   /* if we have only two variables we store at each 16 bits of the hash value the index of a variable */
-   hashval = ((unsigned int)SCIPvarGetIndex(hashdata->vars[1]) << 16) + (unsigned int) SCIPvarGetIndex(hashdata->vars[0]); /*lint !e701*/
-
-   return hashval;
+   /* combine both variable indices; packing them into 16 bits each would let many pairs collide as soon as there are
+    * more than 2^16 variables
+    */
+   return SCIPhashTwo(SCIPvarGetIndex(hashdata->vars[0]), SCIPvarGetIndex(hashdata->vars[1]));
 }
 
 
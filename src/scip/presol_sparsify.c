@@ -784,7 +784,6 @@ SCIP_DECL_PRESOLEXEC(presolExecSparsify)
       varpairssize = 0;
       nvarpairs = 0;
       varpairs = NULL;
-      SCIP_CALL( SCIPhashtableCreate(&pairtable, SCIPblkmem(scip), 1, SCIPhashGetKeyStandard, varPairsEqual, varPairHashval, (void*) scip) );
 
       /* collect equalities and their number of non-zeros */
       for( r = 0; r < nrows; r++ )
@@ -867,6 +866,10 @@ SCIP_DECL_PRESOLEXEC(presolExecSparsify)
          }
       }
 
+      /* create the hash table only now to size it for all collected pairs, which avoids rehashing while inserting them */
+      SCIP_CALL( SCIPhashtableCreate(&pairtable, SCIPblkmem(scip), MAX(nvarpairs, 1), SCIPhashGetKeyStandard,
+            varPairsEqual, varPairHashval, (void*) scip) );
+
       /* insert varpairs into hash table */
       for( r = 0; r < nvarpairs; ++r )
       {
@@ -1104,7 +1104,14 @@ SCIP_Bool primalExistsOrigSol(
    return FALSE;
 }
 
-/** check if we are willing to check the solution for feasibility */
+/** check if we are willing to check the solution for feasibility
+ *
+ *  @note this test runs before SCIPsolCheck() in SCIPprimalTrySol() and SCIPprimalTrySolFree().  A solution that equals
+ *        a stored solution is therefore rejected without a feasibility check, and so is a solution whose objective does
+ *        not beat the cutoff bound.  Only the stored solutions with the same objective value are compared value by
+ *        value.  Infeasible candidates are not remembered: rejecting a repeated candidate by hash alone could drop a
+ *        feasible solution on a hash collision, and an exact test would need a copy of every rejected solution.
+ */
 static
 SCIP_Bool solOfInterest(
    SCIP_PRIMAL*          primal,             /**< primal data */
@@ -251,6 +251,10 @@ SCIP_RETCODE SCIPprobCopy(
 /** creates problem data structure
  *  If the problem type requires the use of variable pricers, these pricers should be activated with calls
  *  to SCIPactivatePricer(). These pricers are automatically deactivated, when the problem is freed.
+ *
+ *  @note The name hash tables are only created if misc/usevartable and misc/useconstable are set; models that never
+ *        look up objects by name can switch them off to save memory. Variables and constraints with an empty name
+ *        only store a single byte for their name and are never inserted into these tables.
  */
 SCIP_RETCODE SCIPprobCreate(
    SCIP_PROB**           prob,               /**< pointer to problem data structure */
@@ -35,8 +35,10 @@
 #include "scip/prop.h"
 #include "scip/pub_message.h"
 #include "scip/pub_misc.h"
+#include "scip/trace.h"
 
 #include "scip/struct_prop.h"
+#include "scip/struct_stat.h"
 
 
 /** compares two propagators w. r. to their priority */
@@ -657,6 +659,7 @@ SCIP_RETCODE SCIPpropExec(
    {
       if( !prop->delay || execdelayed )
       {
+         SCIP_RETCODE retcode;
          SCIP_Longint oldndomchgs;
          SCIP_Longint oldnprobdomchgs;
 
@@ -671,8 +674,11 @@ SCIP_RETCODE SCIPpropExec(
          else
             SCIPclockStart(prop->proptime, set);
 
-         /* call external propagation method */
-         SCIP_CALL( prop->propexec(set->scip, prop, proptiming, result) );
+         /* call external propagation method; the trace event is closed also if the call fails */
+         SCIPtraceStart(stat->trace, SCIP_TRACECAT_PROP, prop->name);
+         retcode = prop->propexec(set->scip, prop, proptiming, result);
+         SCIPtraceStop(stat->trace, SCIP_TRACECAT_PROP, prop->name);
+         SCIP_CALL( retcode );
 
          /* stop timing */
          if( instrongbranching )
@@ -1747,7 +1747,13 @@ SCIP_RETCODE sortGenVBounds(
    return SCIP_OKAY;
 }
 
-/** apply propagation of generalized variable bounds */
+/** apply propagation of generalized variable bounds
+ *
+ *  In sorted mode, the bound change events only record for each component the smallest index of a genvbound whose
+ *  right-hand side contains a tightened variable; from there on, all genvbounds of the component are applied in
+ *  topological order, since each tightening may feed the right-hand side of later genvbounds in the same component.
+ *  Components without a caught bound change are not touched at all.
+ */
 static
 SCIP_RETCODE applyGenVBounds(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -460,6 +460,10 @@ SCIP_RETCODE solveNlp(
  *  binary and variables with a small domain will be ignored to reduce the computational cost of the propagator; after
  *  solving each NLP we filter out all variable candidates which are on their lower or upper bound; candidates with a
  *  larger number of occurrences are preferred
+ *
+ *  @note The NLPs are solved one after another on purpose: they share one NLPI problem that only differs in its
+ *        objective, each tightened bound is passed to this problem and strengthens all later NLPs, and the solution of
+ *        each NLP is used to filter the remaining candidates; solving them in parallel would lose both effects.
  */
 static
 SCIP_RETCODE applyNlobbt(
@@ -68,6 +68,7 @@
 #include "scip/scip_prop.h"
 #include "scip/scip_randnumgen.h"
 #include "scip/scip_solvingstats.h"
+#include "scip/scip_timing.h"
 #include "scip/scip_tree.h"
 #include "scip/scip_var.h"
 
@@ -224,6 +225,9 @@ struct SCIP_PropData
    int                   propagatefreq;      /**< trigger a propagation round after that many bound tightenings
                                               *   (0: no propagation) */
    int                   propagatecounter;   /**< number of bound tightenings since the last propagation round */
+   SCIP_CLOCK*           obbtclock;          /**< time spent in applyObbt() (only used with SCIP_STATISTIC) */
+   SCIP_CLOCK*           bilinclock;         /**< time spent in applyObbtBilinear() (only used with SCIP_STATISTIC) */
+   int                   nbilinlps;          /**< number of solved bilinear inequality LPs */
 };
 
 
@@ -1739,7 +1743,13 @@ SCIP_RETCODE applySeparation(
    return SCIP_OKAY;
 }
 
-/** finds new variable bounds until no iterations left or all bounds have been checked */
+/** finds new variable bounds until no iterations left or all bounds have been checked
+ *
+ *  The bounds are processed one after another in the single probing LP of SCIP. Every solve warm starts from the
+ *  basis of the previous one, the next bound is the one closest to the current LP solution (see nextBound()), and
+ *  every LP solution is used right away to filter the remaining bounds. Cloned LPIs would lose both the warm start and
+ *  the immediate filtering, and the probing LP with its cuts cannot be copied into independent LPI instances.
+ */
 static
 SCIP_RETCODE findNewBounds(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -2505,6 +2515,7 @@ SCIP_RETCODE applyObbtBilinear(
 
          /* compute inequality */
          propdata->itusedbilin -= SCIPgetNLPIterations(scip);
+         SCIPstatistic( ++propdata->nbilinlps );
          SCIP_CALL( solveBilinearLP(scip, x, y, xs, ys, xt, yt, &xcoef, &ycoef, &constant, -1L,
             propdata->createlincons ? &nnonzduals : NULL) ); /*lint !e826*/
          propdata->itusedbilin += SCIPgetNLPIterations(scip);
@@ -2931,6 +2942,10 @@ SCIP_DECL_PROPINITSOL(propInitsolObbt)
    /* create random number generator */
    SCIP_CALL( SCIPcreateRandom(scip, &propdata->randnumgen, DEFAULT_RANDSEED, TRUE) );
 
+   SCIPstatistic( SCIP_CALL( SCIPcreateClock(scip, &propdata->obbtclock) ) );
+   SCIPstatistic( SCIP_CALL( SCIPcreateClock(scip, &propdata->bilinclock) ) );
+   SCIPstatistic( propdata->nbilinlps = 0 );
+
    return SCIP_OKAY;
 }
 
@@ -3024,7 +3039,9 @@ SCIP_DECL_PROPEXEC(propExecObbt)
       itlimit = -1;
 
    /* apply obbt */
+   SCIPstatistic( SCIP_CALL( SCIPstartClock(scip, propdata->obbtclock) ) );
    SCIP_CALL( applyObbt(scip, propdata, itlimit, result) );
+   SCIPstatistic( SCIP_CALL( SCIPstopClock(scip, propdata->obbtclock) ) );
    assert(*result != SCIP_DIDNOTRUN);
 
    /* compute globally inequalities for bilinear terms */
@@ -3038,7 +3055,9 @@ SCIP_DECL_PROPEXEC(propExecObbt)
             ? -1L : (SCIP_Longint)(itlimit * propdata->itlimitfactorbilin);
       }
 
+      SCIPstatistic( SCIP_CALL( SCIPstartClock(scip, propdata->bilinclock) ) );
       SCIP_CALL( applyObbtBilinear(scip, propdata, itlimit, result) );
+      SCIPstatistic( SCIP_CALL( SCIPstopClock(scip, propdata->bilinclock) ) );
    }
 
    /* set current node as last node */
@@ -3082,6 +3101,12 @@ SCIP_DECL_PROPEXITSOL(propExitsolObbt)
       "FILTER-LP: %" SCIP_LONGINT_FORMAT " NGENVB(dive): %d NGENVB(aggr.): %d NGENVB(triv.) %d\n",
       propdata->nprobingiterations, propdata->nfiltered, propdata->ntrivialfiltered, propdata->nsolvedbounds,
       propdata->nfilterlpiters, propdata->ngenvboundsprobing, propdata->ngenvboundsaggrfil, propdata->ngenvboundstrivfil);
+   SCIPstatisticMessage("OBBT-TIME: %g BILIN-TIME: %g NBILINLPS: %d BILIN-LP: %" SCIP_LONGINT_FORMAT "\n",
+      SCIPgetClockTime(scip, propdata->obbtclock), SCIPgetClockTime(scip, propdata->bilinclock), propdata->nbilinlps,
+      propdata->itusedbilin);
+
+   SCIPstatistic( SCIP_CALL( SCIPfreeClock(scip, &propdata->bilinclock) ) );
+   SCIPstatistic( SCIP_CALL( SCIPfreeClock(scip, &propdata->obbtclock) ) );
 
    /* free bilinear bounds */
    if( propdata->bilinboundssize > 0 )
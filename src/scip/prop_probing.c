@@ -329,7 +329,13 @@ SCIP_RETCODE sortVariables(
    return SCIP_OKAY;
 }
 
-/** the main probing loop */
+/** the main probing loop
+ *
+ *  The binary variables are probed one after another in SCIP's single probing mode: each probe creates a probing node
+ *  and propagates on the local domains of the one SCIP instance. The fixings, aggregations, and implications found
+ *  for a variable immediately shrink the domains used to probe the next variables, and the constraint handlers'
+ *  propagation callbacks work on the global problem data, so probes cannot run on thread-local domain copies.
+ */
 static
 SCIP_RETCODE applyProbing(
    SCIP*                 scip,               /**< SCIP data structure */
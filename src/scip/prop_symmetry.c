@@ -2616,7 +2616,12 @@ SCIP_RETCODE determineSymmetry(
    /* if a restart occured, either disable orbital fixing... */
    if ( propdata->offoundreduction && propdata->disableofrestart  && SCIPgetNRuns(scip) > propdata->lastrestart )
       propdata->ofenabled = FALSE;
-   /* ... or free symmetries after a restart to recompute them later */
+   /* ... or free symmetries after a restart to recompute them later
+    *
+    * By default, the symmetries of the previous run are kept after a restart, so the graph is neither rebuilt nor
+    * passed to bliss again; after orbital fixing found reductions, the permutations need not be symmetries of the new
+    * presolved problem, and remapping them would require a full verification anyway, so we recompute them instead.
+    */
    else if ( (propdata->offoundreduction || propdata->recomputerestart)
       && propdata->nperms > 0 && SCIPgetNRuns(scip) > propdata->lastrestart )
    {
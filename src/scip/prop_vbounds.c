@@ -191,6 +191,10 @@ struct SCIP_PropData
                                               *   vboundboundedidx */
    int*                  nvbounds;           /**< array storing for each bound index the number of vbounds stored */
    int*                  vboundsize;         /**< array with sizes of vbound arrays for the nodes */
+   int*                  flatboundedidx;     /**< contiguous storage of all vboundboundedidx arrays after initialization */
+   SCIP_Real*            flatcoefs;          /**< contiguous storage of all vboundcoefs arrays after initialization */
+   SCIP_Real*            flatconstants;      /**< contiguous storage of all vboundconstants arrays after initialization */
+   int                   nflatvbounds;       /**< total number of vbounds in the contiguous storage */
    int                   nbounds;            /**< number of bounds of variables regarded (two times number of active variables) */
    int                   lastpresolncliques; /**< number of cliques created until the last call to the presolver */
    SCIP_PQUEUE*          propqueue;          /**< priority queue to handle the bounds of variables that were changed and have to be propagated */
@@ -335,6 +339,10 @@ void resetPropdata(
    propdata->vboundconstants = NULL;
    propdata->nvbounds = NULL;
    propdata->vboundsize = NULL;
+   propdata->flatboundedidx = NULL;
+   propdata->flatcoefs = NULL;
+   propdata->flatconstants = NULL;
+   propdata->nflatvbounds = 0;
    propdata->nbounds = 0;
    propdata->initialized = FALSE;
 }
@@ -1162,6 +1170,83 @@ SCIP_RETCODE topologicalSort(
    return SCIP_OKAY;
 }
 
+/** moves the vbound arrays of a bound to the given position of the contiguous vbound storage */
+static
+void moveVboundsToFlatStorage(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata,           /**< propagator data */
+   int                   idx,                /**< bound index whose vbounds should be moved */
+   int*                  pos                 /**< pointer to first free position in the contiguous storage, is updated */
+   )
+{
+   int nvbounds;
+
+   assert(propdata->vboundsize[idx] > 0);
+
+   nvbounds = propdata->nvbounds[idx];
+   assert(*pos + nvbounds <= propdata->nflatvbounds);
+
+   BMScopyMemoryArray(&propdata->flatboundedidx[*pos], propdata->vboundboundedidx[idx], nvbounds);
+   BMScopyMemoryArray(&propdata->flatcoefs[*pos], propdata->vboundcoefs[idx], nvbounds);
+   BMScopyMemoryArray(&propdata->flatconstants[*pos], propdata->vboundconstants[idx], nvbounds);
+
+   SCIPfreeMemoryArray(scip, &propdata->vboundboundedidx[idx]);
+   SCIPfreeMemoryArray(scip, &propdata->vboundcoefs[idx]);
+   SCIPfreeMemoryArray(scip, &propdata->vboundconstants[idx]);
+
+   propdata->vboundboundedidx[idx] = &propdata->flatboundedidx[*pos];
+   propdata->vboundcoefs[idx] = &propdata->flatcoefs[*pos];
+   propdata->vboundconstants[idx] = &propdata->flatconstants[*pos];
+   propdata->vboundsize[idx] = 0;
+
+   *pos += nvbounds;
+}
+
+/** moves all vbounds into contiguous arrays ordered like the topological order, such that propagation along the
+ *  topological order traverses the vbound data sequentially; afterwards, the vbound arrays of each bound point into
+ *  this storage and no vbounds can be added anymore
+ */
+static
+SCIP_RETCODE compactVbounds(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_PROPDATA*        propdata            /**< propagator data */
+   )
+{
+   int pos;
+   int v;
+
+   assert(propdata->flatboundedidx == NULL);
+
+   propdata->nflatvbounds = 0;
+   for( v = 0; v < propdata->nbounds; ++v )
+      propdata->nflatvbounds += propdata->nvbounds[v];
+
+   if( propdata->nflatvbounds == 0 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->flatboundedidx, propdata->nflatvbounds) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->flatcoefs, propdata->nflatvbounds) );
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &propdata->flatconstants, propdata->nflatvbounds) );
+
+   /* first store the bounds in topological order, then the remaining ones */
+   pos = 0;
+   for( v = 0; v < propdata->nbounds; ++v )
+   {
+      int idx = propdata->topoorder[v];
+
+      if( idx >= 0 && propdata->vboundsize[idx] > 0 )
+         moveVboundsToFlatStorage(scip, propdata, idx, &pos);
+   }
+   for( v = 0; v < propdata->nbounds; ++v )
+   {
+      if( propdata->vboundsize[v] > 0 )
+         moveVboundsToFlatStorage(scip, propdata, v, &pos);
+   }
+   assert(pos == propdata->nflatvbounds);
+
+   return SCIP_OKAY;
+}
+
 /** initializes the internal data for the variable bounds propagator */
 static
 SCIP_RETCODE initData(
@@ -1327,6 +1412,9 @@ SCIP_RETCODE initData(
       SCIP_CALL( topologicalSort(scip, propdata, infeasible) );
    }
 
+   /* store the vbounds contiguously along the topological order */
+   SCIP_CALL( compactVbounds(scip, propdata) );
+
    /* catch variable events */
    SCIP_CALL( catchEvents(scip, propdata) );
 
@@ -2149,6 +2237,12 @@ SCIP_DECL_PROPEXITSOL(propExitsolVbounds)
       /* free priority queue */
       SCIPpqueueFree(&propdata->propqueue);
 
+      /* free contiguous vbound storage */
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->flatconstants, propdata->nflatvbounds);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->flatcoefs, propdata->nflatvbounds);
+      SCIPfreeBlockMemoryArrayNull(scip, &propdata->flatboundedidx, propdata->nflatvbounds);
+      propdata->nflatvbounds = 0;
+
       /* free arrays */
       SCIPfreeBlockMemoryArray(scip, &propdata->vboundsize, propdata->nbounds);
       SCIPfreeBlockMemoryArray(scip, &propdata->nvbounds, propdata->nbounds);
@@ -643,7 +643,12 @@ SCIP_RETCODE getFixedVariable(
    return SCIP_OKAY;
 }
 
-/** read constraint */
+/** read constraint
+ *
+ *  @note The constraint is created by the respective constraint handler's CONSPARSE callback from its textual
+ *        representation, so the reading time is dominated by the handlers' parsers (e.g., the expression parser for
+ *        nonlinear constraints); the CIP format has no handler-independent binary encoding of constraints.
+ */
 static
 SCIP_RETCODE getConstraint(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -772,7 +772,8 @@ SCIP_Bool isValue(
       *value = SCIPinfinity(scip);
       return TRUE;
    }
-   else
+   /* signs are separate tokens, so numbers start with a digit or a dot; this avoids calling strtod() for names */
+   else if( isdigit((unsigned char)lpinput->token[0]) || lpinput->token[0] == '.' )
    {
       double val;
       char* endptr;
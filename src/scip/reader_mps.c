@@ -939,7 +939,13 @@ SCIP_RETCODE readRows(
    return SCIP_OKAY;
 }
 
-/** Process COLUMNS section. */
+/** Process COLUMNS section.
+ *
+ *  @note Each entry costs one hash table lookup of the row name (SCIPfindCons()) and one amortized append to the
+ *        linear constraint plus a lock update; in the problem stage, adding coefficients does not catch events.
+ *        Parsing is inherently sequential because integrality markers and the fixed/free format decision depend on
+ *        preceding lines, and files are read through SCIPfgets() such that compressed files are handled transparently.
+ */
 static
 SCIP_RETCODE readCols(
    MPSINPUT*             mpsi,               /**< mps input structure */
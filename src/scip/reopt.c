@@ -7766,7 +7766,10 @@ SCIP_RETCODE SCIPreoptApplyCuts(
 {
    SCIP_REOPTNODE* reoptnode;
    SCIP_Bool infeasible;
+   SCIP_COL** cols;
+   SCIP_Real* vals;
    unsigned int id;
+   int maxncutvars;
    int ncuts;
    int c;
 
@@ -7790,6 +7793,20 @@ SCIP_RETCODE SCIPreoptApplyCuts(
    reoptnode = reopt->reopttree->reoptnodes[id];
    assert(reoptnode != NULL);
 
+   /* the cuts are stored at the end of the constraint array; get the maximal cut length to allocate the buffer arrays
+    * only once for all cuts of this node
+    */
+   maxncutvars = 0;
+   for( c = reoptnode->nconss-1; c >= 0 && reoptnode->conss[c]->constype == REOPT_CONSTYPE_CUT; c-- )
+      maxncutvars = MAX(maxncutvars, reoptnode->conss[c]->nvars);
+
+   /* nothing to do if there are no cuts */
+   if( c == reoptnode->nconss-1 )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &cols, maxncutvars) );
+   SCIP_CALL( SCIPsetAllocBufferArray(set, &vals, maxncutvars) );
+
    ncuts = 0;
    for( c = reoptnode->nconss-1; c >= 0; c-- )
    {
@@ -7801,14 +7818,11 @@ SCIP_RETCODE SCIPreoptApplyCuts(
       if( cons->constype == REOPT_CONSTYPE_CUT )
       {
          SCIP_ROW* cut;
-         SCIP_COL** cols;
-         SCIP_Real* vals;
          char cutname[SCIP_MAXSTRLEN];
          int ncols;
          int v;
 
-         SCIP_CALL( SCIPsetAllocBufferArray(set, &cols, cons->nvars) );
-         SCIP_CALL( SCIPsetAllocBufferArray(set, &vals, cons->nvars) );
+         assert(cons->nvars <= maxncutvars);
 
          ncols = 0;
          for( v = 0; v < cons->nvars; v++ )
@@ -7859,9 +7873,6 @@ SCIP_RETCODE SCIPreoptApplyCuts(
          else
             ++ncuts;
 
-         SCIPsetFreeBufferArray(set, &vals);
-         SCIPsetFreeBufferArray(set, &cols);
-
          BMSfreeBlockMemoryArrayNull(blkmem, &reoptnode->conss[c]->boundtypes, reoptnode->conss[c]->varssize);
          BMSfreeBlockMemoryArray(blkmem, &reoptnode->conss[c]->vals, reoptnode->conss[c]->varssize);
          BMSfreeBlockMemoryArray(blkmem, &reoptnode->conss[c]->vars, reoptnode->conss[c]->varssize);
@@ -7879,6 +7890,9 @@ SCIP_RETCODE SCIPreoptApplyCuts(
       }
    }
 
+   SCIPsetFreeBufferArray(set, &vals);
+   SCIPsetFreeBufferArray(set, &cols);
+
    return SCIP_OKAY;
 }
 
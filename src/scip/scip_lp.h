@@ -351,6 +351,11 @@ void SCIPresetLPFeastol(
    );
 
 /** gets current LP columns along with the current number of LP columns
+ *
+ *  The LP solution values are stored in the columns and rows themselves (see SCIPcolGetPrimsol(),
+ *  SCIPcolGetRedcost(), SCIProwGetDualsol()); they are copied there once per LP solve, so a linear scan over the
+ *  returned array does not trigger any recomputation. To obtain values for an array of variables in one call, use
+ *  SCIPgetSolVals() with a NULL solution.
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
  *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
@@ -177,6 +177,22 @@ void SCIPprintMemoryDiagnostic(
    assert(scip->mem != NULL);
    assert(scip->set != NULL);
 
+   /* live overview per memory pool; in contrast to the detailed output below, this is also available in optimized builds */
+   SCIPmessagePrintInfo(scip->messagehdlr, "Memory Overview    :       Used  Allocated    MaxUsed\n");
+   SCIPmessagePrintInfo(scip->messagehdlr, "  parameters       : %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT "\n",
+      (SCIP_Longint)BMSgetBlockMemoryUsed(scip->mem->setmem), (SCIP_Longint)BMSgetBlockMemoryAllocated(scip->mem->setmem),
+      (SCIP_Longint)BMSgetBlockMemoryUsedMax(scip->mem->setmem));
+   SCIPmessagePrintInfo(scip->messagehdlr, "  problem/solving  : %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT " %10" SCIP_LONGINT_FORMAT "\n",
+      (SCIP_Longint)BMSgetBlockMemoryUsed(scip->mem->probmem), (SCIP_Longint)BMSgetBlockMemoryAllocated(scip->mem->probmem),
+      (SCIP_Longint)BMSgetBlockMemoryUsedMax(scip->mem->probmem));
+   SCIPmessagePrintInfo(scip->messagehdlr, "  buffer           : %10s %10" SCIP_LONGINT_FORMAT " %10s\n", "-",
+      (SCIP_Longint)BMSgetBufferMemoryUsed(scip->mem->buffer), "-");
+   SCIPmessagePrintInfo(scip->messagehdlr, "  clean buffer     : %10s %10" SCIP_LONGINT_FORMAT " %10s\n", "-",
+      (SCIP_Longint)BMSgetBufferMemoryUsed(scip->mem->cleanbuffer), "-");
+   SCIPmessagePrintInfo(scip->messagehdlr, "  external (estim.): %10" SCIP_LONGINT_FORMAT " %10s %10s\n",
+      scip->stat != NULL ? SCIPstatGetMemExternEstim(scip->stat) : 0LL, "-", "-");
+   SCIPmessagePrintInfo(scip->messagehdlr, "\n");
+
    BMSdisplayMemory();
 
    SCIPmessagePrintInfo(scip->messagehdlr, "\nParameter Block Memory (%p):\n", scip->mem->setmem);
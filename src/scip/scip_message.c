@@ -36,7 +36,9 @@
 #include "nlpi/nlpi.h"
 #include "scip/debug.h"
 #include "scip/pub_message.h"
+#include "scip/pub_misc.h"
 #include "scip/scip_message.h"
+#include "scip/set.h"
 #include "scip/struct_scip.h"
 #include "scip/struct_set.h"
 #include "scip/struct_stat.h"
@@ -212,6 +214,77 @@ void SCIPinfoMessage(
    va_end(ap);
 }
 
+/** prints a string as JSON string, that is, in double quotes and with quotes, backslashes, and control characters
+ *  escaped
+ */
+void SCIPprintJsonString(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< file stream to print into, or NULL for stdout */
+   const char*           str                 /**< string to print */
+   )
+{
+   char buffer[SCIP_MAXSTRLEN];
+   int len;
+
+   assert(scip != NULL);
+   assert(str != NULL);
+
+   /* collect the escaped string in pieces, each escaped character needs at most 6 characters */
+   buffer[0] = '"';
+   len = 1;
+   for( ; *str != '\0'; ++str )
+   {
+      if( len >= SCIP_MAXSTRLEN - 8 )
+      {
+         buffer[len] = '\0';
+         SCIPmessageFPrintInfo(scip->messagehdlr, file, "%s", buffer);
+         len = 0;
+      }
+
+      switch( *str )
+      {
+      case '"':
+      case '\\':
+         buffer[len++] = '\\';
+         buffer[len++] = *str;
+         break;
+      case '\n':
+         buffer[len++] = '\\';
+         buffer[len++] = 'n';
+         break;
+      case '\t':
+         buffer[len++] = '\\';
+         buffer[len++] = 't';
+         break;
+      default:
+         if( (unsigned char)*str < 0x20 )
+            len += SCIPsnprintf(&buffer[len], SCIP_MAXSTRLEN - len, "\\u%04x", (unsigned int)(unsigned char)*str);
+         else
+            buffer[len++] = *str;
+         break;
+      }
+   }
+   buffer[len++] = '"';
+   buffer[len] = '\0';
+
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "%s", buffer);
+}
+
+/** prints a real value as JSON number, or null if it is infinite or not a number, as JSON has no such numbers */
+void SCIPprintJsonReal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< file stream to print into, or NULL for stdout */
+   SCIP_Real             val                 /**< value to print */
+   )
+{
+   assert(scip != NULL);
+
+   if( val != val || SCIPsetIsInfinity(scip->set, REALABS(val)) ) /*lint !e777*/
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "null");
+   else
+      SCIPmessageFPrintInfo(scip->messagehdlr, file, "%.15g", val);
+}
+
 /** prints a message depending on the verbosity level */
 void SCIPverbMessage(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -168,6 +168,24 @@ void SCIPverbMessage(
    ...                                       /**< format arguments line in printf() function */
    );
 
+/** prints a string as JSON string, that is, in double quotes and with quotes, backslashes, and control characters
+ *  escaped
+ */
+SCIP_EXPORT
+void SCIPprintJsonString(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< file stream to print into, or NULL for stdout */
+   const char*           str                 /**< string to print */
+   );
+
+/** prints a real value as JSON number, or null if it is infinite or not a number, as JSON has no such numbers */
+SCIP_EXPORT
+void SCIPprintJsonReal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< file stream to print into, or NULL for stdout */
+   SCIP_Real             val                 /**< value to print */
+   );
+
 /** returns the current message verbosity level
  *
  *  @return message verbosity level of SCIP
@@ -101,6 +101,7 @@
 #include "scip/syncstore.h"
 #include "scip/tree.h"
 #include "scip/var.h"
+#include "scip/trace.h"
 #include "scip/visual.h"
 
 /** checks solution for feasibility in original problem without adding it to the solution store; to improve the
@@ -893,7 +894,12 @@ SCIP_RETCODE presolveRound(
       scip->stat->npresolrounds, scip->stat->npresolroundsfast, scip->stat->npresolroundsmed,
       scip->stat->npresolroundsext, *timing);
 
-   /* call included presolvers with nonnegative priority */
+   /* call included presolvers with nonnegative priority
+    *
+    * presolvers are called strictly one after another: each of them applies its reductions directly to the problem
+    * (there is no transaction layer to collect and validate proposed reductions), so a presolver always has to see
+    * the result of its predecessors
+    */
    while( !(*unbounded) && !(*infeasible) && !aborted && (i < presolend || j < propend) )
    {
       if( i < presolend )
@@ -1243,7 +1249,13 @@ SCIP_RETCODE presolveRound(
 }
 
 
-/** loops through the included presolvers and constraint's presolve methods, until changes are too few */
+/** loops through the included presolvers and constraint's presolve methods, until changes are too few
+ *
+ *  Presolving transforms the transformed problem in place: variables are fixed or aggregated, constraints are deleted
+ *  or upgraded, and the clique and implication tables are updated. Solving cannot start on the same problem before
+ *  presolving is finished; also SCIPsolveConcurrent() presolves once and only copies the presolved problem into the
+ *  concurrent solvers.
+ */
 static
 SCIP_RETCODE presolve(
    SCIP*                 scip,               /**< SCIP data structure */
@@ -1613,6 +1625,9 @@ SCIP_RETCODE initSolve(
    /* possibly create visualization output file */
    SCIP_CALL( SCIPvisualInit(scip->stat->visual, scip->mem->probmem, scip->set, scip->messagehdlr) );
 
+   /* possibly start recording an event trace; concurrent solvers get their own thread id */
+   SCIP_CALL( SCIPtraceInit(scip->stat->trace, scip->set, scip->messagehdlr, SCIPgetConcurrentSolverIdx(scip) + 1) );
+
    /* initialize solution process data structures */
    SCIP_CALL( SCIPpricestoreCreate(&scip->pricestore) );
    SCIP_CALL( SCIPsepastoreCreate(&scip->sepastore, scip->mem->probmem, scip->set) );
@@ -1782,6 +1797,10 @@ SCIP_RETCODE freeSolve(
    /* possibly close visualization output file */
    SCIPvisualExit(scip->stat->visual, scip->set, scip->messagehdlr);
 
+   /* write the event trace, unless it is continued after the restart */
+   if( !restart )
+      SCIPtraceExit(scip->stat->trace, scip->set, scip->messagehdlr);
+
    /* reset statistics for current branch and bound run */
    if( scip->stat->status == SCIP_STATUS_INFEASIBLE || scip->stat->status == SCIP_STATUS_OPTIMAL || scip->stat->status == SCIP_STATUS_UNBOUNDED || scip->stat->status == SCIP_STATUS_INFORUNBD )
       SCIPstatResetCurrentRun(scip->stat, scip->set, scip->transprob, scip->origprob, TRUE);
@@ -1879,6 +1898,9 @@ SCIP_RETCODE freeReoptSolve(
    /* possibly close visualization output file */
    SCIPvisualExit(scip->stat->visual, scip->set, scip->messagehdlr);
 
+   /* write the event trace */
+   SCIPtraceExit(scip->stat->trace, scip->set, scip->messagehdlr);
+
    /* reset statistics for current branch and bound run */
    SCIPstatResetCurrentRun(scip->stat, scip->set, scip->transprob, scip->origprob, FALSE);
 
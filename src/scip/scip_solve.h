@@ -121,6 +121,11 @@ SCIP_RETCODE SCIPpresolve(
  *        - \ref SCIP_STAGE_SOLVED if the solving process was not interrupted
  *
  *  See \ref SCIP_Stage "SCIP_STAGE" for a complete list of all possible solving stages.
+ *
+ *  @note An interrupted solve can only be continued within the same process. The state of the tree search cannot be
+ *        written to disk; to resume a solve in a new process, write the best solution found so far (e.g., with
+ *        SCIPprintBestSol()) and pass it as a start solution to the new run (e.g., with SCIPreadSol()), which
+ *        preserves the primal bound but not the open nodes, cuts, and pseudocosts.
  */
 SCIP_EXPORT
 SCIP_RETCODE SCIPsolve(
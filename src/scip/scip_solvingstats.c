@@ -2934,6 +2934,8 @@ void SCIPprintSeparatorStatistics(
       SCIPcutpoolGetNCalls(scip->cutpool),
       SCIPcutpoolGetNCutsFound(scip->cutpool),
       SCIPcutpoolGetMaxNCuts(scip->cutpool));
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "  cut selection    : %10.2f          -          -          -          -          -          -          -\n",
+      SCIPclockGetTime(scip->stat->cutapplytime));
 
    /* sort separators w.r.t. their name */
    SCIPsetSortSepasName(scip->set);
@@ -3407,6 +3409,9 @@ void SCIPprintTreeStatistics(
    SCIPmessageFPrintInfo(scip->messagehdlr, file, "  delayed cutoffs  : %10" SCIP_LONGINT_FORMAT "\n", scip->stat->ndelayedcutoffs);
    SCIPmessageFPrintInfo(scip->messagehdlr, file, "  repropagations   : %10" SCIP_LONGINT_FORMAT " (%" SCIP_LONGINT_FORMAT " domain reductions, %" SCIP_LONGINT_FORMAT " cutoffs)\n",
       scip->stat->nreprops, scip->stat->nrepropboundchgs, scip->stat->nrepropcutoffs);
+   SCIPmessageFPrintInfo(scip->messagehdlr, file, "  domain props     : %10" SCIP_LONGINT_FORMAT " (%.2f rounds on average, %" SCIP_LONGINT_FORMAT " cutoffs)\n",
+      scip->stat->ndomprops, scip->stat->ndomprops > 0 ? (SCIP_Real)scip->stat->nproprounds / (SCIP_Real)scip->stat->ndomprops : 0.0,
+      scip->stat->npropcutoffs);
    SCIPmessageFPrintInfo(scip->messagehdlr, file, "  avg switch length: %10.2f\n",
       scip->stat->nnodes > 0
       ? (SCIP_Real)(scip->stat->nactivatednodes + scip->stat->ndeactivatednodes) / (SCIP_Real)scip->stat->nnodes : 0.0);
@@ -3908,6 +3913,72 @@ SCIP_RETCODE SCIPprintStatistics(
    return SCIP_OKAY;
 }
 
+/** outputs solving statistics in JSON format
+ *
+ *  The output is one JSON object whose member "tables" maps the name of every active statistics table to the JSON
+ *  output of the table. Tables without JSON output method are given as object with their text output as member "text".
+ *
+ *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
+ *          SCIP_Retcode "SCIP_RETCODE" for a complete list of error codes.
+ *
+ *  @pre This method can be called if SCIP is in one of the following stages:
+ *       - \ref SCIP_STAGE_INIT
+ *       - \ref SCIP_STAGE_PROBLEM
+ *       - \ref SCIP_STAGE_TRANSFORMED
+ *       - \ref SCIP_STAGE_INITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVING
+ *       - \ref SCIP_STAGE_EXITPRESOLVE
+ *       - \ref SCIP_STAGE_PRESOLVED
+ *       - \ref SCIP_STAGE_SOLVING
+ *       - \ref SCIP_STAGE_SOLVED
+ */
+SCIP_RETCODE SCIPprintStatisticsJson(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file                /**< output file (or NULL for standard output) */
+   )
+{
+   SCIP_TABLE** tables;
+   SCIP_Bool first;
+   int ntables;
+   int i;
+
+   assert(scip != NULL);
+   assert(scip->set != NULL);
+
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPprintStatisticsJson", TRUE, TRUE, FALSE, TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, TRUE, TRUE, FALSE, FALSE, FALSE) );
+
+   ntables = SCIPgetNTables(scip);
+   tables = SCIPgetTables(scip);
+
+   /* sort all tables by position unless this has already been done */
+   if( ! scip->set->tablessorted )
+   {
+      SCIPsortPtr((void**)tables, tablePosComp, ntables);
+
+      scip->set->tablessorted = TRUE;
+   }
+
+   SCIPinfoMessage(scip, file, "{\"tables\":{");
+
+   first = TRUE;
+   for( i = 0; i < ntables; ++i )
+   {
+      /* skip tables which are not active or only used in later stages */
+      if( ( ! SCIPtableIsActive(tables[i]) ) || SCIPtableGetEarliestStage(tables[i]) > SCIPgetStage(scip) )
+         continue;
+
+      SCIPinfoMessage(scip, file, "%s\n", first ? "" : ",");
+      SCIPprintJsonString(scip, file, SCIPtableGetName(tables[i]));
+      SCIPinfoMessage(scip, file, ":");
+      SCIP_CALL( SCIPtableOutputJson(tables[i], scip->set, file) );
+      first = FALSE;
+   }
+
+   SCIPinfoMessage(scip, file, "\n}}\n");
+
+   return SCIP_OKAY;
+}
+
 /** outputs reoptimization statistics
  *
  *  @return \ref SCIP_OKAY is returned if everything worked. Otherwise a suitable error code is passed. See \ref
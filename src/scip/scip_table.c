@@ -81,6 +81,24 @@ SCIP_RETCODE SCIPincludeTable(
    return SCIP_OKAY;
 }
 
+/** sets the JSON output method of a statistics table, which is used by SCIPprintStatisticsJson(); tables without
+ *  JSON output method appear there with their text output
+ */
+SCIP_RETCODE SCIPsetTableOutputJson(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_TABLE*           table,              /**< statistics table */
+   SCIP_DECL_TABLEOUTPUTJSON ((*tableoutputjson)) /**< JSON output method, or NULL to use the text output */
+   )
+{
+   SCIP_CALL( SCIPcheckStage(scip, "SCIPsetTableOutputJson", TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE, FALSE) );
+
+   assert(table != NULL);
+
+   SCIPtableSetOutputJson(table, tableoutputjson);
+
+   return SCIP_OKAY;
+}
+
 /** returns the statistics table of the given name, or NULL if not existing */
 SCIP_TABLE* SCIPfindTable(
    SCIP*                 scip,               /**< SCIP data structure */
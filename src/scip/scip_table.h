@@ -66,6 +66,16 @@ SCIP_RETCODE SCIPincludeTable(
    SCIP_STAGE            earlieststage       /**< output of the statistics table is only printed from this stage onwards */
    );
 
+/** sets the JSON output method of a statistics table, which is used by SCIPprintStatisticsJson(); tables without
+ *  JSON output method appear there with their text output
+ */
+SCIP_EXPORT
+SCIP_RETCODE SCIPsetTableOutputJson(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_TABLE*           table,              /**< statistics table */
+   SCIP_DECL_TABLEOUTPUTJSON ((*tableoutputjson)) /**< JSON output method, or NULL to use the text output */
+   );
+
 /** returns the statistics table of the given name, or NULL if not existing */
 SCIP_EXPORT
 SCIP_TABLE* SCIPfindTable(
@@ -45,6 +45,7 @@
 #include "scip/struct_scip.h"
 #include "scip/struct_set.h"
 #include "scip/struct_stat.h"
+#include "scip/trace.h"
 
 /** gets current time of day in seconds (standard time zone)
  *
@@ -178,6 +179,36 @@ SCIP_RETCODE SCIPstopClock(
    return SCIP_OKAY;
 }
 
+/** records the begin of an event in the event trace, if the parameter timing/tracefilename is set
+ *
+ *  Every call should be matched by a call of SCIPstopTraceEvent() with the same category and name. The name is stored
+ *  as a pointer and must live until the end of the solve, e.g., the name of the calling plugin.
+ */
+void SCIPstartTraceEvent(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_TRACECAT         category,           /**< category of the event */
+   const char*           name                /**< name of the event */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->stat != NULL);
+
+   SCIPtraceStart(scip->stat->trace, category, name);
+}
+
+/** records the end of an event in the event trace, if the parameter timing/tracefilename is set */
+void SCIPstopTraceEvent(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_TRACECAT         category,           /**< category of the event */
+   const char*           name                /**< name of the event */
+   )
+{
+   assert(scip != NULL);
+   assert(scip->stat != NULL);
+
+   SCIPtraceStop(scip->stat->trace, category, name);
+}
+
 /** enables or disables all statistic clocks of SCIP concerning plugin statistics,
  *  LP execution time, strong branching time, etc.
  *
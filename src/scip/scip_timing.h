@@ -36,6 +36,7 @@
 #include "scip/type_clock.h"
 #include "scip/type_retcode.h"
 #include "scip/type_scip.h"
+#include "scip/type_trace.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -132,6 +133,26 @@ SCIP_RETCODE SCIPstopClock(
    SCIP_CLOCK*           clck                /**< clock timer */
    );
 
+/** records the begin of an event in the event trace, if the parameter timing/tracefilename is set
+ *
+ *  Every call should be matched by a call of SCIPstopTraceEvent() with the same category and name. The name is stored
+ *  as a pointer and must live until the end of the solve, e.g., the name of the calling plugin.
+ */
+SCIP_EXPORT
+void SCIPstartTraceEvent(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_TRACECAT         category,           /**< category of the event */
+   const char*           name                /**< name of the event */
+   );
+
+/** records the end of an event in the event trace, if the parameter timing/tracefilename is set */
+SCIP_EXPORT
+void SCIPstopTraceEvent(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_TRACECAT         category,           /**< category of the event */
+   const char*           name                /**< name of the event */
+   );
+
 /** enables or disables all statistic clocks of SCIP concerning plugin statistics,
  *  LP execution time, strong branching time, etc.
  *
@@ -35,8 +35,10 @@
 #include "scip/sepa.h"
 #include "scip/pub_message.h"
 #include "scip/pub_misc.h"
+#include "scip/trace.h"
 
 #include "scip/struct_sepa.h"
+#include "scip/struct_stat.h"
 
 
 /** compares two separators w. r. to their priority */
@@ -415,6 +417,7 @@ SCIP_RETCODE SCIPsepaExecLP(
          SCIP_CUTPOOL* delayedcutpool;
          SCIP_Longint oldndomchgs;
          SCIP_Longint oldnprobdomchgs;
+         SCIP_RETCODE retcode;
          int oldncuts;
          int oldnactiveconss;
          int ncutsfound;
@@ -437,11 +440,14 @@ SCIP_RETCODE SCIPsepaExecLP(
 
          /* start timing */
          SCIPclockStart(sepa->sepaclock, set);
+         SCIPtraceStart(stat->trace, SCIP_TRACECAT_SEPA, sepa->name);
 
-         /* call external separation method */
-         SCIP_CALL( sepa->sepaexeclp(set->scip, sepa, result, allowlocal) );
+         /* call external separation method; the trace event is closed also if the call fails */
+         retcode = sepa->sepaexeclp(set->scip, sepa, result, allowlocal);
 
          /* stop timing */
+         SCIPtraceStop(stat->trace, SCIP_TRACECAT_SEPA, sepa->name);
+         SCIP_CALL( retcode );
          SCIPclockStop(sepa->sepaclock, set);
 
          /* update statistics */
@@ -528,6 +534,7 @@ SCIP_RETCODE SCIPsepaExecSol(
       {
          SCIP_Longint oldndomchgs;
          SCIP_Longint oldnprobdomchgs;
+         SCIP_RETCODE retcode;
          int oldncuts;
          int oldnactiveconss;
          int ncutsfound;
@@ -548,11 +555,14 @@ SCIP_RETCODE SCIPsepaExecSol(
 
          /* start timing */
          SCIPclockStart(sepa->sepaclock, set);
+         SCIPtraceStart(stat->trace, SCIP_TRACECAT_SEPA, sepa->name);
 
-         /* call external separation method */
-         SCIP_CALL( sepa->sepaexecsol(set->scip, sepa, sol, result, allowlocal) );
+         /* call external separation method; the trace event is closed also if the call fails */
+         retcode = sepa->sepaexecsol(set->scip, sepa, sol, result, allowlocal);
 
          /* stop timing */
+         SCIPtraceStop(stat->trace, SCIP_TRACECAT_SEPA, sepa->name);
+         SCIP_CALL( retcode );
          SCIPclockStop(sepa->sepaclock, set);
 
          /* update statistics */
@@ -868,6 +868,13 @@ SCIP_RETCODE aggregation(
 
    /* try to generate cut from the current aggregated row; add cut if found, otherwise add another row to aggrrow
     * in order to get rid of a continuous variable
+    *
+    * The aggregation row is extended in place: each step adds a single row to aggrrow and removes the zeros that
+    * cancelled out, so successive aggregations never recompute the rows aggregated before. Since the path is never
+    * backtracked, there is no need to record the steps for undoing them. The bound substitution done by the cut
+    * generators cannot be carried over to the next aggregation, because the choice of the bounds depends on the signs
+    * of the coefficients, which may change when a row is added; the c-MIR heuristic performs the substitution once per
+    * aggregation and reuses it for all tested scaling factors.
     */
    naggrs = 0;
    while( naggrs <= maxaggrs )
@@ -871,7 +871,12 @@ SCIP_RETCODE separateCuts(
 
    *result = SCIP_DIDNOTFIND;
 
-   /* load tclique data structure */
+   /* load tclique data structure
+    *
+    * The graph (including the dense clique table) is built only once per solve and kept in the separator data until
+    * exitsol, so later separation rounds only update the node weights. Cliques found after the first call are not
+    * added; updating the adjacency arrays incrementally would require hooks into the clique table that do not exist.
+    */
    if( !sepadata->tcliquegraphloaded )
    {
       assert(sepadata->tcliquegraph == NULL);
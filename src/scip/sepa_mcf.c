@@ -185,6 +185,12 @@ struct SCIP_SepaData
 {
    SCIP_MCFNETWORK**     mcfnetworks;        /**< array of multi-commodity-flow network structures */
    int                   nmcfnetworks;       /**< number of multi-commodity-flow networks (-1: extraction not yet done) */
+   int                   failednrows;        /**< number of LP rows in a previous run in which no network was found,
+                                              *   or -1 */
+   int                   failedncols;        /**< number of LP columns in a previous run in which no network was found,
+                                              *   or -1 */
+   int                   extractnrows;       /**< number of LP rows at the network extraction in the current run */
+   int                   extractncols;       /**< number of LP columns at the network extraction in the current run */
    int                   nclusters;          /**< number of clusters to generate in the shrunken network -- default separation */
    SCIP_Real             maxweightrange;     /**< maximal valid range max(|weights|)/min(|weights|) of row weights */
    int                   maxtestdelta;       /**< maximal number of different deltas to try (-1: unlimited)  -- default separation */
@@ -6675,11 +6681,28 @@ SCIP_RETCODE separateCuts(
    }
 
    /* ######################## NETWORK DETECTION ##################################### */
+   /* the detection is expensive; if it failed in a previous run and the LP did not grow since then, for example after a
+    * restart, we assume that there is still no network structure to be found
+    */
+   if( sepadata->nmcfnetworks == -1 && sepadata->failednrows >= 0 && nrows <= sepadata->failednrows
+      && ncols <= sepadata->failedncols )
+   {
+      MCFdebugMessage("no network found in a previous run with %d rows and %d columns -> skip extraction\n",
+         sepadata->failednrows, sepadata->failedncols);
+
+      sepadata->nmcfnetworks = 0;
+      sepadata->extractnrows = nrows;
+      sepadata->extractncols = ncols;
+   }
+
    /* get or extract network flow structure */
    if( sepadata->nmcfnetworks == -1 )
    {
       *result = SCIP_DIDNOTFIND;
 
+      sepadata->extractnrows = nrows;
+      sepadata->extractncols = ncols;
+
       SCIP_CALL( mcfnetworkExtract(scip, sepadata, &sepadata->mcfnetworks, &sepadata->nmcfnetworks, &sepadata->effortlevel) );
 
       MCFdebugMessage("extracted %d networks\n", sepadata->nmcfnetworks);
@@ -6813,6 +6836,24 @@ SCIP_DECL_SEPAFREE(sepaFreeMcf)
    return SCIP_OKAY;
 }
 
+/** initialization method of separator (called after problem was transformed) */
+static
+SCIP_DECL_SEPAINIT(sepaInitMcf)
+{
+   /*lint --e{715}*/
+   SCIP_SEPADATA* sepadata;
+
+   /* get separator data */
+   sepadata = SCIPsepaGetData(sepa);
+   assert(sepadata != NULL);
+
+   /* the result of the network extraction is only remembered for the runs of the same problem */
+   sepadata->failednrows = -1;
+   sepadata->failedncols = -1;
+
+   return SCIP_OKAY;
+}
+
 /** solving process initialization method of separator (called when branch and bound process is about to begin) */
 static
 SCIP_DECL_SEPAINITSOL(sepaInitsolMcf)
@@ -6843,6 +6884,18 @@ SCIP_DECL_SEPAEXITSOL(sepaExitsolMcf)
    sepadata = SCIPsepaGetData(sepa);
    assert(sepadata != NULL);
 
+   /* remember the size of the LP if no network was found, to avoid extracting again after a restart */
+   if( sepadata->nmcfnetworks == 0 )
+   {
+      sepadata->failednrows = sepadata->extractnrows;
+      sepadata->failedncols = sepadata->extractncols;
+   }
+   else if( sepadata->nmcfnetworks > 0 )
+   {
+      sepadata->failednrows = -1;
+      sepadata->failedncols = -1;
+   }
+
    /* free MCF networks */
    for( i = 0; i < sepadata->nmcfnetworks; i++ )
    {
@@ -6913,6 +6966,10 @@ SCIP_RETCODE SCIPincludeSepaMcf(
    SCIP_CALL( SCIPallocMemory(scip, &sepadata) );
    sepadata->mcfnetworks = NULL;
    sepadata->nmcfnetworks = -1;
+   sepadata->failednrows = -1;
+   sepadata->failedncols = -1;
+   sepadata->extractnrows = -1;
+   sepadata->extractncols = -1;
 
    sepadata->lastroundsuccess = TRUE;
    sepadata->effortlevel = MCFEFFORTLEVEL_OFF;
@@ -6928,6 +6985,7 @@ SCIP_RETCODE SCIPincludeSepaMcf(
    /* set non-NULL pointers to callback methods */
    SCIP_CALL( SCIPsetSepaCopy(scip, sepa, sepaCopyMcf) );
    SCIP_CALL( SCIPsetSepaFree(scip, sepa, sepaFreeMcf) );
+   SCIP_CALL( SCIPsetSepaInit(scip, sepa, sepaInitMcf) );
    SCIP_CALL( SCIPsetSepaInitsol(scip, sepa, sepaInitsolMcf) );
    SCIP_CALL( SCIPsetSepaExitsol(scip, sepa, sepaExitsolMcf) );
 
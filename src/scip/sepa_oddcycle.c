@@ -3344,7 +3344,11 @@ SCIP_RETCODE separateGLS(
    SCIP_CALL( SCIPallocBufferArray(scip, &pred2, (int) (2 * nbinvars)) );
    SCIP_CALL( SCIPallocBufferArray(scip, &incycle, (int) (2 * nbinvars)) );
 
-   /* separate odd cycle inequalities by GLS method */
+   /* separate odd cycle inequalities by GLS method
+    *
+    * The start nodes are processed one after another: all searches share the dist/pred/entry/order arrays, and the
+    * incut markers of earlier cuts steer later searches.
+    */
    cutoff = (unsigned long long) (0.5 * sepadata->scale);
    for( i = (unsigned int) sepadata->lastroot; i < 2 * nbinvars
            && startcounter < maxstarts
@@ -69,6 +69,12 @@ struct SCIP_SepaData
    int*                  varpriorities;      /**< priorities of the variables in varssorted */
    int                   nbilinvars;         /**< total number of variables occurring in bilinear terms */
    int                   currentnunknown;    /**< number of unknown terms in current row (not printed) */
+   int                   nusedvars;          /**< number of variables in varssorted that are used to compute rlt cuts */
+   SCIP_HASHMAP*         partnermap;         /**< maps a variable to its index in partnerbegins */
+   int*                  partnerbegins;      /**< start of the partner list of each variable in partners */
+   int*                  partners;           /**< indices of used variables in varssorted that form a product with an
+                                              *   auxiliary variable together with the variable of the list */
+   int                   npartnervars;       /**< number of variables that have a partner list */
    SCIP_Bool             iscreated;          /**< indicates whether the sepadata has been initialized yet */
    SCIP_Bool             isinitialround;     /**< indicates that this is the first round and initial rows are used */
 
@@ -107,16 +113,128 @@ SCIP_RETCODE freeSepaData(
       SCIP_CALL( SCIPreleaseVar(scip, &(sepadata->varssorted[i])) );
    }
 
+   /* free partner lists */
+   if( sepadata->partnermap != NULL )
+   {
+      SCIPfreeBlockMemoryArray(scip, &sepadata->partners, sepadata->partnerbegins[sepadata->npartnervars]);
+      SCIPfreeBlockMemoryArray(scip, &sepadata->partnerbegins, sepadata->npartnervars + 1);
+      SCIPhashmapFree(&sepadata->partnermap);
+   }
+   sepadata->npartnervars = 0;
+
    /* free arrays */
    SCIPfreeBlockMemoryArray(scip, &sepadata->varpriorities, sepadata->nbilinvars);
    SCIPfreeBlockMemoryArray(scip, &sepadata->varssorted, sepadata->nbilinvars);
 
    sepadata->nbilinvars = 0;
+   sepadata->nusedvars = 0;
    sepadata->iscreated = FALSE;
 
    return SCIP_OKAY;
 }
 
+/** helper method to build the partner lists of the separation data
+ *
+ * For every variable y that forms a product with an auxiliary variable together with one of the used variables x in
+ * varssorted, the partner list of y stores the indices of all these x. Counting, for each used variable, how many
+ * columns of a row have it as partner then gives the number of known bilinear terms of the row in one sparse pass
+ * over the row, instead of looking up every pair of row column and used variable.
+ */
+static
+SCIP_RETCODE createPartnerLists(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_SEPADATA*        sepadata            /**< separation data */
+   )
+{
+   SCIP_CONSEXPR_BILINTERM* bilinterms;
+   SCIP_HASHMAP* usedvarmap;
+   int* npartners;
+   int nbilinterms;
+   int nlistvars;
+   int pass;
+   int i;
+
+   assert(sepadata->partnermap == NULL);
+
+   bilinterms = SCIPgetConsExprBilinTerms(sepadata->conshdlr);
+   nbilinterms = SCIPgetConsExprNBilinTerms(sepadata->conshdlr);
+
+   /* map used variables to their position in varssorted */
+   SCIP_CALL( SCIPhashmapCreate(&usedvarmap, SCIPblkmem(scip), MAX(sepadata->nusedvars, 1)) );
+   for( i = 0; i < sepadata->nusedvars; ++i )
+   {
+      SCIP_CALL( SCIPhashmapInsertInt(usedvarmap, (void*)sepadata->varssorted[i], i) );
+   }
+
+   SCIP_CALL( SCIPhashmapCreate(&sepadata->partnermap, SCIPblkmem(scip), 2 * nbilinterms) );
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &npartners, 2 * nbilinterms) );
+   nlistvars = 0;
+
+   /* in the first pass, count the partners of every variable; in the second pass, fill the partner lists */
+   for( pass = 0; pass < 2; ++pass )
+   {
+      for( i = 0; i < nbilinterms; ++i )
+      {
+         int j;
+
+         /* only products with an auxiliary variable are known terms */
+         if( bilinterms[i].auxvar == NULL )
+            continue;
+
+         for( j = 0; j < 2; ++j )
+         {
+            SCIP_VAR* var = (j == 0) ? bilinterms[i].x : bilinterms[i].y;
+            SCIP_VAR* othervar = (j == 0) ? bilinterms[i].y : bilinterms[i].x;
+            int listidx;
+
+            /* in a square term, the variable is its own partner only once */
+            if( j == 1 && var == othervar )
+               break;
+
+            if( !SCIPhashmapExists(usedvarmap, (void*)var) )
+               continue;
+
+            if( pass == 0 )
+            {
+               if( !SCIPhashmapExists(sepadata->partnermap, (void*)othervar) )
+               {
+                  SCIP_CALL( SCIPhashmapInsertInt(sepadata->partnermap, (void*)othervar, nlistvars) );
+                  ++nlistvars;
+               }
+               ++npartners[SCIPhashmapGetImageInt(sepadata->partnermap, (void*)othervar)];
+            }
+            else
+            {
+               listidx = SCIPhashmapGetImageInt(sepadata->partnermap, (void*)othervar);
+               sepadata->partners[sepadata->partnerbegins[listidx] + npartners[listidx]] =
+                  SCIPhashmapGetImageInt(usedvarmap, (void*)var);
+               ++npartners[listidx];
+            }
+         }
+      }
+
+      if( pass == 0 )
+      {
+         sepadata->npartnervars = nlistvars;
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &sepadata->partnerbegins, nlistvars + 1) );
+
+         sepadata->partnerbegins[0] = 0;
+         for( i = 0; i < nlistvars; ++i )
+         {
+            sepadata->partnerbegins[i + 1] = sepadata->partnerbegins[i] + npartners[i];
+            npartners[i] = 0;
+         }
+
+         SCIP_CALL( SCIPallocBlockMemoryArray(scip, &sepadata->partners, sepadata->partnerbegins[nlistvars]) );
+      }
+   }
+
+   SCIPfreeBufferArray(scip, &npartners);
+   SCIPhashmapFree(&usedvarmap);
+
+   return SCIP_OKAY;
+}
+
 /* helper method to create separation data */
 static
 SCIP_RETCODE createSepaData(
@@ -210,6 +328,10 @@ SCIP_RETCODE createSepaData(
       SCIP_CALL( SCIPcaptureVar(scip, sepadata->varssorted[i]) );
    }
 
+   /* build the partner lists of the variables that are used to compute rlt cuts */
+   sepadata->nusedvars = sepadata->maxusedvars < 0 ? sepadata->nbilinvars : MIN(sepadata->maxusedvars, sepadata->nbilinvars);
+   SCIP_CALL( createPartnerLists(scip, sepadata) );
+
    /* mark that separation data hash been created */
    sepadata->iscreated = TRUE;
    sepadata->isinitialround = TRUE;
@@ -578,6 +700,9 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpRlt)
 {  /*lint --e{715}*/
    SCIP_ROW** rows;
    SCIP_SEPADATA* sepadata;
+   int* nknown;
+   int* candidates;
+   int ncandidates;
    int ncalls;
    int depth;
    int ncuts;
@@ -663,9 +788,19 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpRlt)
       SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
    }
 
+   /* nknown[j] counts the columns of the current row that form a known bilinear term with the j-th used variable;
+    * candidates holds the used variables for which this count is positive
+    */
+   SCIP_CALL( SCIPallocClearBufferArray(scip, &nknown, sepadata->nusedvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &candidates, sepadata->nusedvars) );
+
    for( i = 0; i < nrows && !SCIPisStopped(scip); ++i )
    {
       SCIP_Bool iseqrow = SCIPisEQ(scip, SCIProwGetLhs(rows[i]), SCIProwGetRhs(rows[i]));
+      SCIP_COL** rowcols;
+      int nrownonz;
+      int nusedcands;
+      SCIP_Bool onlycands;
 
       /* if equality rows are requested, only those can be used */
       if( sepadata->onlyeqrows && !iseqrow )
@@ -705,18 +840,66 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpRlt)
       ncuts = 0;
       *result = SCIP_DIDNOTFIND;
 
-      for( j = 0; j < sepadata->nbilinvars && (sepadata->maxusedvars < 0 || j < sepadata->maxusedvars); ++j )
+      rowcols = SCIProwGetCols(rows[i]);
+      nrownonz = SCIProwGetNNonz(rows[i]);
+
+      /* if a variable without known terms in this row is not acceptable, only variables that form a known term with
+       * one of the columns need to be considered; these are found by joining the columns of the row with the partner
+       * lists, which at the same time counts the known bilinear terms for each such variable
+       */
+      onlycands = sepadata->maxunknownterms >= 0 && nrownonz > sepadata->maxunknownterms;
+      ncandidates = 0;
+      for( j = 0; j < nrownonz && onlycands; ++j )
       {
-         SCIP_VAR *var = sepadata->varssorted[j];
+         SCIP_VAR* colvar = SCIPcolGetVar(rowcols[j]);
+         int listidx;
+
+         if( !SCIPhashmapExists(sepadata->partnermap, (void*)colvar) )
+            continue;
+
+         listidx = SCIPhashmapGetImageInt(sepadata->partnermap, (void*)colvar);
+         for( k = sepadata->partnerbegins[listidx]; k < sepadata->partnerbegins[listidx + 1]; ++k )
+         {
+            if( nknown[sepadata->partners[k]] == 0 )
+               candidates[ncandidates++] = sepadata->partners[k];
+            ++nknown[sepadata->partners[k]];
+         }
+      }
+
+      if( onlycands )
+      {
+         SCIPsortInt(candidates, ncandidates);
+         nusedcands = ncandidates;
+      }
+      else
+         nusedcands = sepadata->nusedvars;
+
+      for( j = 0; j < nusedcands; ++j )
+      {
+         SCIP_VAR *var;
          SCIP_Bool uselb[4] = {TRUE, TRUE, FALSE, FALSE};
          SCIP_Bool uselhs[4] = {TRUE, FALSE, TRUE, FALSE};
          SCIP_Bool buildeqcut;
          SCIP_Bool accepted;
          SCIP_Bool success;
          SCIP_ROW *cut;
+         int varidx;
+         int nunknown;
+
+         varidx = onlycands ? candidates[j] : j;
+         var = sepadata->varssorted[varidx];
 
          /* check whether this row and var fulfill the conditions */
-         SCIP_CALL( isAcceptableRow(scip, sepadata, rows[i], var, &accepted) );
+         if( onlycands )
+         {
+            nunknown = nrownonz - nknown[varidx];
+            accepted = nunknown <= sepadata->maxunknownterms;
+         }
+         else
+         {
+            SCIP_CALL( isAcceptableRow(scip, sepadata, rows[i], var, &accepted) );
+            nunknown = sepadata->currentnunknown;
+         }
 
          if( !accepted )
          {
@@ -730,7 +913,7 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpRlt)
 #endif
 
          /* if all terms are known and it is an equality row, compute equality cuts */
-         buildeqcut = (sepadata->currentnunknown == 0 && iseqrow);
+         buildeqcut = (nunknown == 0 && iseqrow);
 
          /* go over all combinations of sides and bounds and compute the respective cuts */
          for( k = 0; k < 4; ++k )
@@ -791,6 +974,9 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpRlt)
             {
                SCIPdebugMsg(scip, "exit seperator because we found enough cuts or a cutoff -> skip\n");
 
+               SCIPfreeBufferArray(scip, &candidates);
+               SCIPfreeBufferArray(scip, &nknown);
+
                if( sepadata->isinitialround || sepadata->onlyinitial )
                {
                   SCIPfreeBufferArray(scip, &rows);
@@ -800,8 +986,15 @@ SCIP_DECL_SEPAEXECLP(sepaExeclpRlt)
             }
          }
       }
+
+      /* reset the counters of this row */
+      for( j = 0; j < ncandidates; ++j )
+         nknown[candidates[j]] = 0;
    }
 
+   SCIPfreeBufferArray(scip, &candidates);
+   SCIPfreeBufferArray(scip, &nknown);
+
    SCIPdebugMsg(scip, "exit seperator because cut calculation is finished\n");
 
    if( sepadata->isinitialround || sepadata->onlyinitial )
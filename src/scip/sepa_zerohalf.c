@@ -1948,22 +1948,42 @@ TERMINATE:
    return SCIP_OKAY;
 }
 
-/** add a mod2 row to another one */
+/** returns the size of the array that is indexed by the UNIQUE_INDEX of the row indices of the mod 2 rows */
+static
+int mod2matrixGetUniqueIndexSize(
+   SCIP*                 scip,               /**< scip data structure */
+   MOD2_MATRIX*          mod2matrix          /**< mod 2 matrix */
+   )
+{
+   /* the maximum index return by the UNIQUE_INDEX macro is 3 times
+    * the maximum index value in the ROWINDEX struct. The index value could
+    * be the lp position of an original row or the index of a transformed row.
+    * Hence we need to allocate 3 times the maximum of these two possible
+    * index types.
+    */
+   return 3 * MAX(SCIPgetNLPRows(scip), mod2matrix->ntransintrows);
+}
+
+/** add a mod2 row to another one
+ *
+ *  The row indices of the row to add must be marked in the given array, so that a row can be added to many other rows
+ *  without marking its row indices each time; the marks are restored before returning.
+ */
 static
 SCIP_RETCODE mod2rowAddRow(
    SCIP*                 scip,               /**< scip data structure */
    BMS_BLKMEM*           blkmem,             /**< block memory shell */
    MOD2_MATRIX*          mod2matrix,         /**< mod 2 matrix */
    MOD2_ROW*             row,                /**< mod 2 row */
-   MOD2_ROW*             rowtoadd            /**< mod 2 row that is added to the other mod 2 row */
+   MOD2_ROW*             rowtoadd,           /**< mod 2 row that is added to the other mod 2 row */
+   SCIP_Shortbool*       contained           /**< array indexed by UNIQUE_INDEX where exactly the row indices of
+                                              *   rowtoadd are marked */
    )
 {
-   SCIP_Shortbool* contained;
    int i;
    int j;
    int k;
    int nnewentries;
-   int nlprows;
    MOD2_COL** newnonzcols;
    SCIP_Real newslack;
 
@@ -1972,8 +1992,8 @@ SCIP_RETCODE mod2rowAddRow(
 
    assert(row->nnonzcols == 0 || row->nonzcols != NULL);
    assert(rowtoadd->nnonzcols == 0 || rowtoadd->nonzcols != NULL);
+   assert(contained != NULL);
 
-   nlprows = SCIPgetNLPRows(scip);
    row->rhs ^= rowtoadd->rhs;
 
    newslack = row->slack + rowtoadd->slack;
@@ -1984,23 +2004,6 @@ SCIP_RETCODE mod2rowAddRow(
 
    row->slack = newslack;
 
-   {
-      /* the maximum index return by the UNIQUE_INDEX macro is 3 times
-       * the maximum index value in the ROWINDEX struct. The index value could
-       * be the lp position of an original row or the index of a transformed row.
-       * Hence we need to allocate 3 times the maximum of these two possible
-       * index types.
-       */
-      int allocsize = 3 * MAX(nlprows, mod2matrix->ntransintrows);
-      SCIP_CALL( SCIPallocCleanBufferArray(scip, &contained, allocsize) );
-   }
-
-   /* remember entries that are in the row to add */
-   for( i = 0; i < rowtoadd->nrowinds; ++i )
-   {
-      contained[UNIQUE_INDEX(rowtoadd->rowinds[i])] = 1;
-   }
-
    /* remove the entries that are in both rows from the row (1 + 1 = 0 (mod 2)) */
    nnewentries = rowtoadd->nrowinds;
    for( i = 0; i < row->nrowinds; )
@@ -2020,18 +2023,15 @@ SCIP_RETCODE mod2rowAddRow(
 
    SCIP_CALL( SCIPensureBlockMemoryArray(scip, &row->rowinds, &row->rowindssize, row->nrowinds + nnewentries) );
 
-   /* add remaining entries of row to add */
+   /* add remaining entries of row to add and restore the marks of the entries that were in both rows */
    for ( i = 0; i < rowtoadd->nrowinds; ++i )
    {
       if( contained[UNIQUE_INDEX(rowtoadd->rowinds[i])] )
-      {
-         contained[UNIQUE_INDEX(rowtoadd->rowinds[i])] = 0;
          row->rowinds[row->nrowinds++] = rowtoadd->rowinds[i];
-      }
+      else
+         contained[UNIQUE_INDEX(rowtoadd->rowinds[i])] = 1;
    }
 
-   SCIPfreeCleanBufferArray(scip, &contained);
-
    SCIP_CALL( SCIPallocBufferArray(scip, &newnonzcols, row->nnonzcols + rowtoadd->nnonzcols) );
 
    i = 0;
@@ -2273,6 +2273,7 @@ SCIP_RETCODE doSeparation(
             int nslots;
             int nnonzrows;
             MOD2_ROW** rows;
+            SCIP_Shortbool* contained;
 
             ++sepadata->nreductions;
 
@@ -2288,11 +2289,22 @@ SCIP_RETCODE doSeparation(
                   nonzrows[nnonzrows++] = rows[j];
             }
 
+            /* mark the row indices of the pivot row once for all rows it is added to */
+            SCIP_CALL( SCIPallocCleanBufferArray(scip, &contained, mod2matrixGetUniqueIndexSize(scip, &mod2matrix)) );
+
+            for( j = 0; j < row->nrowinds; ++j )
+               contained[UNIQUE_INDEX(row->rowinds[j])] = 1;
+
             for( j = 0; j < nnonzrows; ++j )
             {
-               SCIP_CALL( mod2rowAddRow(scip, SCIPblkmem(scip), &mod2matrix, nonzrows[j], row) );
+               SCIP_CALL( mod2rowAddRow(scip, SCIPblkmem(scip), &mod2matrix, nonzrows[j], row, contained) );
             }
 
+            for( j = 0; j < row->nrowinds; ++j )
+               contained[UNIQUE_INDEX(row->rowinds[j])] = 0;
+
+            SCIPfreeCleanBufferArray(scip, &contained);
+
             /* cppcheck-suppress nullPointer */
             row->slack = col->solval;
             --mod2matrix.nzeroslackrows;
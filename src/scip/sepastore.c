@@ -26,6 +26,7 @@
 #include <assert.h>
 
 #include "scip/def.h"
+#include "scip/clock.h"
 #include "scip/set.h"
 #include "scip/stat.h"
 #include "scip/lp.h"
@@ -39,6 +40,7 @@
 #include "scip/debug.h"
 #include "scip/scip.h"
 #include "scip/cuts.h"
+#include "scip/cutpool.h"
 #include "scip/struct_event.h"
 #include "scip/struct_sepastore.h"
 #include "scip/misc.h"
@@ -96,6 +98,11 @@ SCIP_RETCODE SCIPsepastoreCreate(
 
    SCIP_CALL( SCIPrandomCreate(&(*sepastore)->randnumgen, blkmem, (unsigned int)SCIPsetInitializeRandomSeed(set, 0x5EED)) );
 
+   /* duplicate cuts are detected in the same way as in the cut pools */
+   SCIP_CALL( SCIPhashtableCreate(&(*sepastore)->hashtable, blkmem,
+         (set->misc_usesmalltables ? SCIP_HASHSIZE_CUTPOOLS_SMALL : SCIP_HASHSIZE_CUTPOOLS),
+         SCIPhashGetKeyStandard, SCIPcutpoolHashKeyEqRow, SCIPcutpoolHashKeyValRow, (void*) set) );
+
    return SCIP_OKAY;
 }
 
@@ -109,6 +116,7 @@ SCIP_RETCODE SCIPsepastoreFree(
    assert(*sepastore != NULL);
    assert((*sepastore)->ncuts == 0);
 
+   SCIPhashtableFree(&(*sepastore)->hashtable);
    SCIPrandomFree(&(*sepastore)->randnumgen, blkmem);
    BMSfreeMemoryArrayNull(&(*sepastore)->cuts);
    BMSfreeMemory(sepastore);
@@ -361,6 +369,61 @@ SCIP_Bool sepastoreIsBdchgApplicable(
    return FALSE;
 }
 
+/** checks whether the cut takes part in the detection of duplicate cuts
+ *
+ *  Only one-sided, unmodifiable cuts with at least two nonzeros are hashed, since bound changes are handled separately
+ *  and the comparison of the sides assumes the form ax <= b.
+ */
+static
+SCIP_Bool sepastoreIsCutHashable(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_ROW*             cut                 /**< separated cut */
+   )
+{
+   assert(cut != NULL);
+
+   return !SCIProwIsModifiable(cut) && SCIProwGetNNonz(cut) > 1
+      && (SCIPsetIsInfinity(set, -SCIProwGetLhs(cut)) || SCIPsetIsInfinity(set, SCIProwGetRhs(cut)));
+}
+
+/** returns the right hand side of the cut in the form ax <= b after scaling the largest absolute coefficient to 1.0 */
+static
+SCIP_Real sepastoreGetScaledRhs(
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_ROW*             cut                 /**< separated cut */
+   )
+{
+   SCIP_Real scale;
+
+   scale = 1.0 / SCIProwGetMaxval(cut, set);
+
+   if( SCIPsetIsInfinity(set, cut->rhs) )
+      return scale * (cut->constant - cut->lhs);
+   else
+      return scale * (cut->rhs - cut->constant);
+}
+
+/** removes the cut from the hash table for duplicate detection, if it is stored there */
+static
+SCIP_RETCODE sepastoreUnhashCut(
+   SCIP_SEPASTORE*       sepastore,          /**< separation storage */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_ROW*             cut                 /**< separated cut */
+   )
+{
+   assert(sepastore != NULL);
+   assert(cut != NULL);
+
+   /* the hash table only compares rows up to scaling, so check that the stored row is this cut before removing it */
+   if( SCIPhashtableGetNElements(sepastore->hashtable) > 0 && sepastoreIsCutHashable(set, cut)
+      && SCIPhashtableRetrieve(sepastore->hashtable, (void*) cut) == (void*) cut )
+   {
+      SCIP_CALL( SCIPhashtableRemove(sepastore->hashtable, (void*) cut) );
+   }
+
+   return SCIP_OKAY;
+}
+
 /** removes a non-forced cut from the separation storage */
 static
 SCIP_RETCODE sepastoreDelCut(
@@ -386,6 +449,8 @@ SCIP_RETCODE sepastoreDelCut(
       SCIP_CALL( SCIPeventqueueAdd(eventqueue, blkmem, set, NULL, NULL, NULL, eventfilter, &event) );
    }
 
+   SCIP_CALL( sepastoreUnhashCut(sepastore, set, sepastore->cuts[pos]) );
+
    /* release the row */
    SCIP_CALL( SCIProwRelease(&sepastore->cuts[pos], blkmem, set, lp) );
 
@@ -467,6 +532,7 @@ SCIP_RETCODE SCIPsepastoreAddCut(
          SCIP_CALL( SCIPeventqueueAdd(eventqueue, blkmem, set, NULL, NULL, NULL, eventfilter, &event) );
       }
 
+      SCIP_CALL( sepastoreUnhashCut(sepastore, set, sepastore->cuts[0]) );
       SCIP_CALL( SCIProwRelease(&sepastore->cuts[0], blkmem, set, lp) );
       sepastore->ncuts = 0;
       sepastore->nforcedcuts = 0;
@@ -482,6 +548,41 @@ SCIP_RETCODE SCIPsepastoreAddCut(
    if( !forcecut && SCIPsetGetSepaMaxcuts(set, root) == 0 )
       return SCIP_OKAY;
 
+   /* a non-forced cut that equals a stored non-forced cut up to scaling is only added if its side is tighter; the
+    * weaker stored cut stays in the storage, but is no longer used for duplicate detection
+    */
+   if( !forcecut && sepastoreIsCutHashable(set, cut) )
+   {
+      SCIP_ROW* othercut;
+
+      /* only called to ensure that minidx and maxidx are up-to-date */
+      (void) SCIProwGetMaxidx(cut, set);
+      assert(cut->validminmaxidx);
+
+      othercut = (SCIP_ROW*) SCIPhashtableRetrieve(sepastore->hashtable, (void*) cut);
+      if( othercut != NULL )
+      {
+         SCIP_Real rhs;
+         SCIP_Real otherrhs;
+
+         rhs = sepastoreGetScaledRhs(set, cut);
+         otherrhs = sepastoreGetScaledRhs(set, othercut);
+
+         /* for equal sides, a global cut replaces a local one */
+         if( othercut == cut || SCIPsetIsFeasGT(set, rhs, otherrhs)
+            || (SCIPsetIsFeasEQ(set, rhs, otherrhs) && (SCIProwIsLocal(cut) || !SCIProwIsLocal(othercut))) )
+         {
+            SCIPsetDebugMsg(set, "reject cut <%s>, which is a duplicate of cut <%s>\n", SCIProwGetName(cut),
+               SCIProwGetName(othercut));
+            return SCIP_OKAY;
+         }
+
+         SCIP_CALL( SCIPhashtableRemove(sepastore->hashtable, (void*) othercut) );
+      }
+
+      SCIP_CALL( SCIPhashtableInsert(sepastore->hashtable, (void*) cut) );
+   }
+
    /* get enough memory to store the cut */
    SCIP_CALL( sepastoreEnsureCutsMem(sepastore, set, sepastore->ncuts+1) );
    assert(sepastore->ncuts < sepastore->cutssize);
@@ -901,6 +1002,8 @@ SCIP_RETCODE SCIPsepastoreApplyCuts(
 
    SCIPsetDebugMsg(set, "applying %d cuts\n", sepastore->ncuts);
 
+   SCIPclockStart(stat->cutapplytime, set);
+
    node = SCIPtreeGetCurrentNode(tree);
    assert(node != NULL);
 
@@ -961,6 +1064,8 @@ SCIP_RETCODE SCIPsepastoreApplyCuts(
    /* clear the separation storage and reset statistics for separation round */
    SCIP_CALL( SCIPsepastoreClearCuts(sepastore, blkmem, set, eventqueue, eventfilter, lp) );
 
+   SCIPclockStop(stat->cutapplytime, set);
+
    return SCIP_OKAY;
 }
 
@@ -995,6 +1100,8 @@ SCIP_RETCODE SCIPsepastoreClearCuts(
       SCIP_CALL( SCIProwRelease(&sepastore->cuts[c], blkmem, set, lp) );
    }
 
+   SCIPhashtableRemoveAll(sepastore->hashtable);
+
    /* reset counters */
    sepastore->ncuts = 0;
    sepastore->nforcedcuts = 0;
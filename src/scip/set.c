@@ -262,6 +262,7 @@
 /* Memory */
 
 #define SCIP_DEFAULT_MEM_SAVEFAC            0.8 /**< fraction of maximal mem usage when switching to memory saving mode */
+#define SCIP_DEFAULT_MEM_SHEDDING          TRUE /**< should memory be released when switching to memory saving mode? */
 #define SCIP_DEFAULT_MEM_TREEGROWFAC        2.0 /**< memory growing factor for tree array */
 #define SCIP_DEFAULT_MEM_PATHGROWFAC        2.0 /**< memory growing factor for path array */
 #define SCIP_DEFAULT_MEM_TREEGROWINIT     65536 /**< initial size of tree array */
@@ -321,6 +322,8 @@
                                                  *   in last presolve round */
 #define SCIP_DEFAULT_PRESOL_MAXROUNDS        -1 /**< maximal number of presolving rounds (-1: unlimited, 0: off) */
 #define SCIP_DEFAULT_PRESOL_MAXRESTARTS      -1 /**< maximal number of restarts (-1: unlimited) */
+#define SCIP_DEFAULT_PRESOL_MAXFAILEXHAUSTIVE -1 /**< maximal number of consecutive unsuccessful exhaustive calls of a
+                                                 *   presolver before it is skipped in exhaustive presolving (-1: no limit) */
 #define SCIP_DEFAULT_PRESOL_CLQTABLEFAC     2.0 /**< limit on number of entries in clique table relative to number of problem nonzeros */
 #define SCIP_DEFAULT_PRESOL_RESTARTFAC    0.025 /**< fraction of integer variables that were fixed in the root node
                                                  *   triggering a restart with preprocessing after root node evaluation */
@@ -480,6 +483,8 @@
 #define SCIP_DEFAULT_TIME_READING         FALSE /**< belongs reading time to solving time? */
 #define SCIP_DEFAULT_TIME_RARECLOCKCHECK  FALSE /**< should clock checks of solving time be performed less frequently (might exceed time limit slightly) */
 #define SCIP_DEFAULT_TIME_STATISTICTIMING  TRUE /**< should timing for statistic output be enabled? */
+#define SCIP_DEFAULT_TIME_TRACEFILENAME     "-" /**< name of the event trace file, or "-" if no event trace should be recorded */
+#define SCIP_DEFAULT_TIME_TRACEBUFFERSIZE 1000000 /**< maximal number of events kept in the event trace */
 
 
 /* visualization output */
@@ -667,6 +672,18 @@ SCIP_DECL_PARAMCHGD(paramChgdArraygrowfac)
    return SCIP_OKAY;
 }
 
+/** information method for a parameter change of time_clocktype: calibrates the time stamp counter once per settings
+ *  when its clock is selected, such that clocks never need to calibrate while they measure time
+ */
+static
+SCIP_DECL_PARAMCHGD(paramChgdClocktype)
+{  /*lint --e{715}*/
+   if( SCIPparamGetInt(param) == (int)SCIP_CLOCKTYPE_TSC && scip->set->time_tscfrequency == 0.0 )
+      scip->set->time_tscfrequency = SCIPclockCalibrateTsc();
+
+   return SCIP_OKAY;
+}
+
 /** information method for a parameter change of mem_arraygrowinit */
 static
 SCIP_DECL_PARAMCHGD(paramChgdArraygrowinit)
@@ -1059,6 +1076,10 @@ SCIP_RETCODE SCIPsetCopyParams(
    assert(sourceset != targetset);
    assert(targetset->scip != NULL);
 
+   /* take over the frequency of the time stamp counter, such that it is not calibrated again for the copy */
+   if( targetset->time_tscfrequency == 0.0 )
+      targetset->time_tscfrequency = sourceset->time_tscfrequency;
+
    SCIP_CALL( SCIPparamsetCopyParams(sourceset->paramset, targetset->paramset, targetset, messagehdlr) );
 
    return SCIP_OKAY;
@@ -1079,6 +1100,7 @@ SCIP_RETCODE SCIPsetCreate(
 
    (*set)->stage = SCIP_STAGE_INIT;
    (*set)->scip = scip;
+   (*set)->time_tscfrequency = 0.0;
    (*set)->buffer = SCIPbuffer(scip);
    (*set)->cleanbuffer = SCIPcleanbuffer(scip);
 
@@ -1188,6 +1210,7 @@ SCIP_RETCODE SCIPsetCreate(
    (*set)->extcodedescs = NULL;
    (*set)->nextcodes = 0;
    (*set)->extcodessize = 0;
+   (*set)->time_tracefilename = NULL;
    (*set)->visual_vbcfilename = NULL;
    (*set)->visual_bakfilename = NULL;
    (*set)->nlp_solver = NULL;
@@ -1849,6 +1872,11 @@ SCIP_RETCODE SCIPsetCreate(
          "fraction of maximal memory usage resulting in switch to memory saving mode",
          &(*set)->mem_savefac, FALSE, SCIP_DEFAULT_MEM_SAVEFAC, 0.0, 1.0,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
+         "memory/shedding",
+         "should aged cuts and conflicts be removed and unused block memory be freed when switching to memory saving mode?",
+         &(*set)->mem_shedding, FALSE, SCIP_DEFAULT_MEM_SHEDDING,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
          "memory/arraygrowfac",
          "memory growing factor for dynamically allocated arrays",
@@ -2117,6 +2145,11 @@ SCIP_RETCODE SCIPsetCreate(
          "maximal number of restarts (-1: unlimited)",
          &(*set)->presol_maxrestarts, FALSE, SCIP_DEFAULT_PRESOL_MAXRESTARTS, -1, INT_MAX,
          NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "presolving/maxfailexhaustive",
+         "maximal number of consecutive exhaustive calls of a presolver without reductions before it is skipped in exhaustive presolving (-1: no limit)",
+         &(*set)->presol_maxfailexhaustive, TRUE, SCIP_DEFAULT_PRESOL_MAXFAILEXHAUSTIVE, -1, INT_MAX,
+         NULL, NULL) );
    SCIP_CALL( SCIPsetAddRealParam(*set, messagehdlr, blkmem,
          "presolving/restartfac",
          "fraction of integer variables that were fixed in the root node triggering a restart with preprocessing after root node evaluation",
@@ -2576,9 +2609,9 @@ SCIP_RETCODE SCIPsetCreate(
    assert(sizeof(int) == sizeof(SCIP_CLOCKTYPE)); /*lint !e506*/
    SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
          "timing/clocktype",
-         "default clock type (1: CPU user seconds, 2: wall clock time)",
-         (int*)&(*set)->time_clocktype, FALSE, (int)SCIP_DEFAULT_TIME_CLOCKTYPE, 1, 2,
-         NULL, NULL) );
+         "default clock type (1: CPU user seconds, 2: wall clock time, 3: wall clock time from the CPU time stamp counter, if invariant, otherwise 2)",
+         (int*)&(*set)->time_clocktype, FALSE, (int)SCIP_DEFAULT_TIME_CLOCKTYPE, 1, 3,
+         paramChgdClocktype, NULL) );
    SCIP_CALL( SCIPsetAddBoolParam(*set, messagehdlr, blkmem,
          "timing/enabled",
          "is timing enabled?",
@@ -2599,6 +2632,16 @@ SCIP_RETCODE SCIPsetCreate(
          "should timing for statistic output be performed?",
          &(*set)->time_statistictiming, FALSE, SCIP_DEFAULT_TIME_STATISTICTIMING,
          paramChgdStatistictiming, NULL) );
+   SCIP_CALL( SCIPsetAddStringParam(*set, messagehdlr, blkmem,
+         "timing/tracefilename",
+         "name of the file to which a trace of node processing, LP solves, and plugin calls is written in Chrome trace event format, or - if no trace should be recorded",
+         &(*set)->time_tracefilename, FALSE, SCIP_DEFAULT_TIME_TRACEFILENAME,
+         NULL, NULL) );
+   SCIP_CALL( SCIPsetAddIntParam(*set, messagehdlr, blkmem,
+         "timing/tracebuffersize",
+         "maximal number of events kept in the event trace (older events are overwritten)",
+         &(*set)->time_tracebuffersize, TRUE, SCIP_DEFAULT_TIME_TRACEBUFFERSIZE, 1, INT_MAX,
+         NULL, NULL) );
 
    /* visualization parameters */
    SCIP_CALL( SCIPsetAddStringParam(*set, messagehdlr, blkmem,
@@ -30,6 +30,7 @@
 #include "scip/clock.h"
 #include "scip/concurrent.h"
 #include "scip/conflict.h"
+#include "scip/conflictstore.h"
 #include "scip/cons.h"
 #include "scip/cutpool.h"
 #include "scip/disp.h"
@@ -37,6 +38,7 @@
 #include "scip/heur.h"
 #include "scip/interrupt.h"
 #include "scip/lp.h"
+#include "scip/mem.h"
 #include "scip/nodesel.h"
 #include "scip/pricer.h"
 #include "scip/pricestore.h"
@@ -77,6 +79,7 @@
 #include "scip/struct_tree.h"
 #include "scip/struct_var.h"
 #include "scip/syncstore.h"
+#include "scip/trace.h"
 #include "scip/tree.h"
 #include "scip/var.h"
 #include "scip/visual.h"
@@ -623,8 +626,13 @@ SCIP_RETCODE propagateDomains(
    /* mark the node to be completely propagated in the current repropagation subtree level */
    SCIPnodeMarkPropagated(node, tree);
 
+   /* update the statistics on the number of rounds until the fixpoint (or the round limit) was reached */
+   stat->ndomprops++;
+   stat->nproprounds += propround;
+
    if( *cutoff )
    {
+      stat->npropcutoffs++;
       SCIPsetDebugMsg(set, " --> domain propagation of node %p finished: cutoff!\n", (void*)node);
    }
 
@@ -1638,7 +1646,11 @@ SCIP_RETCODE separationRoundLP(
    /* sort separators by priority */
    SCIPsetSortSepas(set);
 
-   /* call LP separators with nonnegative priority */
+   /* call LP separators with nonnegative priority
+    *
+    * The separators are called one after another: after a separator changed bounds, the LP is resolved before the next
+    * separator is called, and the round ends as soon as enough cuts are in the separation storage.
+    */
    for( i = 0; i < set->nsepas && !(*cutoff) && !(*lperror) && !(*enoughcuts) && lp->flushed && lp->solved
            && (SCIPlpGetSolstat(lp) == SCIP_LPSOLSTAT_OPTIMAL || SCIPlpGetSolstat(lp) == SCIP_LPSOLSTAT_UNBOUNDEDRAY);
         ++i )
@@ -3883,7 +3895,12 @@ SCIP_RETCODE propAndSolve(
       *lperror = FALSE;
       *unbounded = FALSE;
 
-      /* solve the node's LP */
+      /* solve the node's LP
+       *
+       * The LP is solved before the propagators and heuristics that need the LP solution are called, and bound changes
+       * made while the LP is solved would invalidate it. LP-independent propagation therefore runs before the LP (see
+       * above).
+       */
       SCIP_CALL( solveNodeLP(blkmem, set, messagehdlr, stat, mem, origprob, transprob, primal, tree, reopt, lp, relaxation, pricestore,
             sepastore, cutpool, delayedcutpool, branchcand, conflict, conflictstore, eventfilter, eventqueue, cliquetable,
             initiallpsolved, fullseparation, newinitconss, propagateagain, solverelaxagain, cutoff, unbounded, lperror, pricingaborted) );
@@ -4814,6 +4831,48 @@ SCIP_RETCODE addCurrentSolution(
    return SCIP_OKAY;
 }
 
+/** releases memory after switching to memory saving mode: removes cuts from the global cut pools that are neither in
+ *  the LP nor were violated recently, removes the older half of the conflicts from the conflict store, and returns
+ *  unused chunks of block memory
+ */
+static
+SCIP_RETCODE shedMemory(
+   BMS_BLKMEM*           blkmem,             /**< block memory buffers */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   SCIP_STAT*            stat,               /**< dynamic problem statistics */
+   SCIP_MEM*             mem,                /**< block memory pools */
+   SCIP_PROB*            transprob,          /**< transformed problem after presolve */
+   SCIP_REOPT*           reopt,              /**< reoptimization data structure */
+   SCIP_LP*              lp,                 /**< LP data */
+   SCIP_CUTPOOL*         cutpool,            /**< global cut pool */
+   SCIP_CUTPOOL*         delayedcutpool,     /**< global delayed cut pool */
+   SCIP_CONFLICTSTORE*   conflictstore       /**< conflict store */
+   )
+{
+   SCIP_Longint memused;
+   int ndelcuts;
+   int ndeldelayedcuts;
+   int ndelconfs;
+
+   assert(mem != NULL);
+
+   memused = SCIPmemGetTotal(mem);
+
+   SCIP_CALL( SCIPcutpoolShrink(cutpool, blkmem, set, stat, lp, &ndelcuts) );
+   SCIP_CALL( SCIPcutpoolShrink(delayedcutpool, blkmem, set, stat, lp, &ndeldelayedcuts) );
+   SCIP_CALL( SCIPconflictstoreShrink(conflictstore, blkmem, set, stat, transprob, reopt, &ndelconfs) );
+
+   BMSgarbagecollectBlockMemory(mem->probmem);
+
+   SCIPmessagePrintVerbInfo(messagehdlr, set->disp_verblevel, SCIP_VERBLEVEL_HIGH,
+      "(node %" SCIP_LONGINT_FORMAT ") removed %d cuts and %d conflicts (mem: %.1fM -> %.1fM)\n", stat->nnodes,
+      ndelcuts + ndeldelayedcuts, ndelconfs, (SCIP_Real)memused/(1024.0*1024.0),
+      (SCIP_Real)SCIPmemGetTotal(mem)/(1024.0*1024.0));
+
+   return SCIP_OKAY;
+}
+
 /** main solving loop */
 SCIP_RETCODE SCIPsolveCIP(
    BMS_BLKMEM*           blkmem,             /**< block memory buffers */
@@ -4841,6 +4900,7 @@ SCIP_RETCODE SCIPsolveCIP(
    SCIP_Bool*            restart             /**< should solving process be started again with presolving? */
    )
 {
+   SCIP_RETCODE retcode;
    SCIP_NODESEL* nodesel;
    SCIP_NODE* focusnode;
    SCIP_NODE* nextnode;
@@ -4914,9 +4974,19 @@ SCIP_RETCODE SCIPsolveCIP(
 
       do
       {
+         SCIP_Bool memsavemode;
+
          /* update the memory saving flag, switch algorithms respectively */
+         memsavemode = stat->memsavemode;
          SCIPstatUpdateMemsaveMode(stat, set, messagehdlr, mem);
 
+         /* release memory that the solve can do without when switching to memory saving mode */
+         if( !memsavemode && stat->memsavemode && set->mem_shedding )
+         {
+            SCIP_CALL( shedMemory(blkmem, set, messagehdlr, stat, mem, transprob, reopt, lp, cutpool, delayedcutpool,
+                  conflictstore) );
+         }
+
          /* get the current node selector */
          nodesel = SCIPsetGetNodesel(set, stat);
 
@@ -4979,10 +5049,13 @@ SCIP_RETCODE SCIPsolveCIP(
       SCIP_CALL( SCIPeventChgNode(&event, focusnode) );
       SCIP_CALL( SCIPeventProcess(&event, set, NULL, NULL, NULL, eventfilter) );
 
-      /* solve focus node */
-      SCIP_CALL( solveNode(blkmem, set, messagehdlr, stat, mem, origprob, transprob, primal, tree, reopt, lp, relaxation,
+      /* solve focus node; the trace event is closed also if solving fails */
+      SCIPtraceStart(stat->trace, SCIP_TRACECAT_NODE, "node");
+      retcode = solveNode(blkmem, set, messagehdlr, stat, mem, origprob, transprob, primal, tree, reopt, lp, relaxation,
             pricestore, sepastore, branchcand, cutpool, delayedcutpool, conflict, conflictstore, eventfilter, eventqueue,
-            cliquetable, &cutoff, &postpone, &unbounded, &infeasible, restart, &afternodeheur, &stopped) );
+            cliquetable, &cutoff, &postpone, &unbounded, &infeasible, restart, &afternodeheur, &stopped);
+      SCIPtraceStop(stat->trace, SCIP_TRACECAT_NODE, "node");
+      SCIP_CALL( retcode );
       assert(!cutoff || infeasible);
       assert(BMSgetNUsedBufferMemory(mem->buffer) == 0);
       assert(SCIPtreeGetCurrentNode(tree) == focusnode);
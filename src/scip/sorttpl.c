@@ -603,18 +603,31 @@ void SORTTPL_NAME(SCIPsort, SORTTPL_NAMEEXT)
    }
    else
    {
-      SORTTPL_NAME(sorttpl_qSort, SORTTPL_NAMEEXT)
-         (key,
-            SORTTPL_HASFIELD1PAR(field1)
-            SORTTPL_HASFIELD2PAR(field2)
-            SORTTPL_HASFIELD3PAR(field3)
-            SORTTPL_HASFIELD4PAR(field4)
-            SORTTPL_HASFIELD5PAR(field5)
-            SORTTPL_HASFIELD6PAR(field6)
-            SORTTPL_HASPTRCOMPPAR(ptrcomp)
-            SORTTPL_HASINDCOMPPAR(indcomp)
-            SORTTPL_HASINDCOMPPAR(dataptr)
-            0, len-1, TRUE);
+      int i;
+
+      /* long arrays are frequently passed in sorted order already; if the keys are strictly increasing, the sorted
+       * order is unique and we can skip quick sort without changing the result (for ties, quick sort may permute
+       * the additional fields, so we only stop early for strict orders)
+       */
+      i = 0;
+      while( i < len-1 && SORTTPL_ISBETTER(key[i], key[i+1]) )
+         ++i;
+
+      if( i < len-1 )
+      {
+         SORTTPL_NAME(sorttpl_qSort, SORTTPL_NAMEEXT)
+            (key,
+               SORTTPL_HASFIELD1PAR(field1)
+               SORTTPL_HASFIELD2PAR(field2)
+               SORTTPL_HASFIELD3PAR(field3)
+               SORTTPL_HASFIELD4PAR(field4)
+               SORTTPL_HASFIELD5PAR(field5)
+               SORTTPL_HASFIELD6PAR(field6)
+               SORTTPL_HASPTRCOMPPAR(ptrcomp)
+               SORTTPL_HASINDCOMPPAR(indcomp)
+               SORTTPL_HASINDCOMPPAR(dataptr)
+               0, len-1, TRUE);
+      }
    }
 #ifndef NDEBUG
    SORTTPL_NAME(sorttpl_checkSort, SORTTPL_NAMEEXT)
@@ -38,6 +38,7 @@
 #include "scip/struct_set.h"
 #include "scip/struct_stat.h"
 #include "scip/var.h"
+#include "scip/trace.h"
 #include "scip/visual.h"
 
 
@@ -74,6 +75,7 @@ SCIP_RETCODE SCIPstatCreate(
    SCIP_CALL( SCIPclockCreate(&(*stat)->pseudosoltime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->sbsoltime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->nodeactivationtime, SCIP_CLOCKTYPE_DEFAULT) );
+   SCIP_CALL( SCIPclockCreate(&(*stat)->cutapplytime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->nlpsoltime, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->copyclock, SCIP_CLOCKTYPE_DEFAULT) );
    SCIP_CALL( SCIPclockCreate(&(*stat)->strongpropclock, SCIP_CLOCKTYPE_DEFAULT) );
@@ -85,6 +87,7 @@ SCIP_RETCODE SCIPstatCreate(
    SCIP_CALL( SCIPhistoryCreate(&(*stat)->glbhistory, blkmem) );
    SCIP_CALL( SCIPhistoryCreate(&(*stat)->glbhistorycrun, blkmem) );
    SCIP_CALL( SCIPvisualCreate(&(*stat)->visual, messagehdlr) );
+   SCIP_CALL( SCIPtraceCreate(&(*stat)->trace) );
 
    SCIP_CALL( SCIPregressionCreate(&(*stat)->regressioncandsobjval) );
 
@@ -127,6 +130,7 @@ SCIP_RETCODE SCIPstatFree(
    SCIPclockFree(&(*stat)->pseudosoltime);
    SCIPclockFree(&(*stat)->sbsoltime);
    SCIPclockFree(&(*stat)->nodeactivationtime);
+   SCIPclockFree(&(*stat)->cutapplytime);
    SCIPclockFree(&(*stat)->nlpsoltime);
    SCIPclockFree(&(*stat)->copyclock);
    SCIPclockFree(&(*stat)->strongpropclock);
@@ -135,6 +139,7 @@ SCIP_RETCODE SCIPstatFree(
    SCIPhistoryFree(&(*stat)->glbhistory, blkmem);
    SCIPhistoryFree(&(*stat)->glbhistorycrun, blkmem);
    SCIPvisualFree(&(*stat)->visual);
+   SCIPtraceFree(&(*stat)->trace);
 
    SCIPregressionFree(&(*stat)->regressioncandsobjval);
 
@@ -203,6 +208,7 @@ void SCIPstatReset(
    SCIPclockReset(stat->pseudosoltime);
    SCIPclockReset(stat->sbsoltime);
    SCIPclockReset(stat->nodeactivationtime);
+   SCIPclockReset(stat->cutapplytime);
    SCIPclockReset(stat->nlpsoltime);
    SCIPclockReset(stat->copyclock);
    SCIPclockReset(stat->strongpropclock);
@@ -619,6 +625,9 @@ void SCIPstatResetCurrentRun(
    stat->nreprops = 0;
    stat->nrepropboundchgs = 0;
    stat->nrepropcutoffs = 0;
+   stat->ndomprops = 0;
+   stat->nproprounds = 0;
+   stat->npropcutoffs = 0;
    stat->lastdivenode = 0;
    stat->lastconflictnode = 0;
    stat->bestsolnode = 0;
@@ -754,6 +763,7 @@ void SCIPstatEnableOrDisableStatClocks(
    SCIPclockEnableOrDisable(stat->pseudosoltime, enable);
    SCIPclockEnableOrDisable(stat->sbsoltime, enable);
    SCIPclockEnableOrDisable(stat->nodeactivationtime, enable);
+   SCIPclockEnableOrDisable(stat->cutapplytime, enable);
    SCIPclockEnableOrDisable(stat->nlpsoltime, enable);
    SCIPclockEnableOrDisable(stat->copyclock, enable);
    SCIPclockEnableOrDisable(stat->strongpropclock, enable);
@@ -51,6 +51,13 @@ struct SCIP_WallClock
    long                  usec;               /**< microseconds counter */
 };
 
+/** time stamp counter clock; the ticks are only converted into seconds when the time is queried */
+struct SCIP_TscClock
+{
+   SCIP_Longint          ticks;              /**< time stamp counter ticks */
+   SCIP_Real             frequency;          /**< ticks of the time stamp counter per second */
+};
+
 /** clock timer */
 struct SCIP_Clock
 {
@@ -58,6 +65,7 @@ struct SCIP_Clock
    {
       SCIP_CPUCLOCK      cpuclock;           /**< CPU clock counter */
       SCIP_WALLCLOCK     wallclock;          /**< wall clock counter */
+      SCIP_TSCCLOCK      tscclock;           /**< time stamp counter clock */
    } data;
    SCIP_Real             lasttime;           /**< last validated time of clock */
    int                   nruns;              /**< number of SCIPclockStart() calls without SCIPclockStop() calls */
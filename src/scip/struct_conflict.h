@@ -179,6 +179,8 @@ struct SCIP_Conflict
    int                   nproofsets;         /**< number of available proof sets (used slots in proofsets array) */
    int                   tmpbdchginfossize;  /**< size of tmpbdchginfos array */
    int                   ntmpbdchginfos;     /**< number of temporary created bound change information data */
+   int                   nalloctmpbdchginfos;/**< number of allocated objects in tmpbdchginfos array, which are reused
+                                              *   after the temporary data was cleared */
    int                   count;              /**< conflict set counter to label binary conflict variables with */
 };
 
@@ -129,11 +129,14 @@ struct SCIP_ConsExpr_Expr
    /* activity */
    SCIP_INTERVAL           activity;      /**< activity of expression with respect to local variable bounds */
    unsigned int            activitytag;   /**< tag of local variable bounds for which activity is valid */
+   unsigned int            activitychgtag;/**< tag of local variable bounds when activity of expression or of a descendant changed last */
 
    /* propagation */
    SCIP_INTERVAL           propbounds;    /**< bounds to propagate in reverse propagation */
    unsigned int            propboundstag; /**< tag to indicate whether propbounds are valid for the current propagation rounds */
    SCIP_Bool               inpropqueue;   /**< whether expression is queued for propagation */
+   SCIP_Real               propprio;      /**< priority of expression in the reverse propagation queue (larger is processed earlier) */
+   unsigned int            pendingmarks;  /**< for variable expressions: marks for the constraints of the variable that still need to be applied */
 
    /* expression iterators data */
    SCIP_CONSEXPR_EXPR_ITERDATA iterdata[SCIP_CONSEXPRITERATOR_MAXNACTIVE];  /**< data for expression iterators */
@@ -247,6 +250,7 @@ struct SCIP_ConsExpr_Nlhdlr
    SCIP_DECL_CONSEXPR_NLHDLRINITSEPA((*initsepa));          /**< separation initialization callback (can be NULL) */
    SCIP_DECL_CONSEXPR_NLHDLRENFO((*enfo));                  /**< enforcement callback (can be NULL) */
    SCIP_DECL_CONSEXPR_NLHDLRESTIMATE((*estimate));          /**< estimator callback (can be NULL) */
+   SCIP_DECL_CONSEXPR_NLHDLRESTIMATEBATCH((*estimatebatch));/**< batch estimator callback (can be NULL) */
    SCIP_DECL_CONSEXPR_NLHDLREXITSEPA((*exitsepa));          /**< separation deinitialization callback (can be NULL) */
    SCIP_DECL_CONSEXPR_NLHDLRINTEVAL((*inteval));            /**< interval evaluation callback (can be NULL) */
    SCIP_DECL_CONSEXPR_NLHDLRREVERSEPROP((*reverseprop));    /**< reverse propagation callback (can be NULL) */
@@ -265,6 +269,23 @@ struct SCIP_ConsExpr_ExprEnfo
    SCIP_Bool                     sepaaboveusesactivity;/**< whether sepaabove uses activity of some expression */
 };
 
+/** data to warm start the computation of facets of one vertex-polyhedral function
+ *
+ * Stores the function values in the corners of the box of the last facet computation and the final basis of the
+ * separation LP, so that they can be reused if the facet is computed again for the same function.
+ */
+struct SCIP_VertexPolyWarmstart
+{
+   int                         nallvars;     /**< number of variables of the function, half of the length of box */
+   SCIP_Real*                  box;          /**< box of the last facet computation */
+   int                         nvars;        /**< number of nonfixed variables in box */
+   SCIP_Real*                  funvals;      /**< function values in the corners of box w.r.t. nonfixed variables */
+   SCIP_Bool                   hasfunvals;   /**< whether box and funvals are valid */
+   int*                        cstat;        /**< column basis status of the separation LP for nvars variables */
+   int*                        rstat;        /**< row basis status of the separation LP for nvars variables */
+   SCIP_Bool                   hasbasis;     /**< whether cstat and rstat are valid */
+};
+
 /** expression tree iterator */
 struct SCIP_ConsExpr_Iterator
 {
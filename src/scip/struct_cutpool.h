@@ -53,6 +53,12 @@ struct SCIP_Cutpool
    SCIP_CLOCK*           poolclock;          /**< separation time */
    SCIP_HASHTABLE*       hashtable;          /**< hash table to identify already stored cuts */
    SCIP_CUT**            cuts;               /**< stored cuts of the pool */
+   int*                  matbeg;             /**< start of each cut in matcolidx and matvals (row-wise mirror of the cuts) */
+   int*                  matcolidx;          /**< column indices (SCIP_COL::index) of the coefficients of the mirrored cuts */
+   SCIP_Real*            matvals;            /**< coefficients of the mirrored cuts */
+   int                   matbegsize;         /**< size of matbeg array */
+   int                   matsize;            /**< size of matcolidx and matvals arrays */
+   int                   nmatcuts;           /**< number of cuts mirrored: cuts[0..nmatcuts-1] are stored in the matrix */
    SCIP_Longint          processedlp;        /**< last LP that has been processed for separating the LP */
    SCIP_Longint          processedlpsol;     /**< last LP that has been processed for separating other solutions */
    SCIP_Real             processedlpefficacy;/**< minimal efficacy used in last processed LP */
@@ -124,7 +124,13 @@ struct SCIP_HashMapEntry
    SCIP_HASHMAPIMAGE     image;              /**< image of element */
 };
 
-/** hash map data structure to map pointers on pointers */
+/** hash map data structure to map pointers on pointers
+ *
+ *  @note The hash map is already specialized to pointer keys: the hash is computed inline from the key's address and
+ *        keys are compared by pointer equality, so no callbacks are involved. The separate array of 32-bit hashes acts
+ *        as a compact control array that is checked before a slot is touched, and Robin Hood insertion keeps the probe
+ *        sequences short, so lookups of missing keys terminate early. Only the generic SCIP_HASHTABLE uses callbacks.
+ */
 struct SCIP_HashMap
 {
    BMS_BLKMEM*           blkmem;             /**< block memory used to store hash map entries */
@@ -71,6 +71,8 @@ struct SCIP_Presol
    int                   nchgcoefs;          /**< total number of changed coefficients by this presolver */
    int                   nchgsides;          /**< total number of changed left or right hand sides by this presolver */
    int                   ncalls;             /**< number of times the presolver was called and tried to find reductions */
+   int                   nfailexhaustive;    /**< number of consecutive exhaustive calls in the current presolving that
+                                              *   did not find any reductions */
    SCIP_Bool             initialized;        /**< is presolver initialized? */
    SCIP_PRESOLTIMING     timing;             /**< timing of the presolver */
 };
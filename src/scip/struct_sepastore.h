@@ -28,6 +28,7 @@
 
 #include "scip/def.h"
 #include "scip/type_lp.h"
+#include "scip/type_misc.h"
 #include "scip/type_var.h"
 #include "scip/type_sepastore.h"
 
@@ -40,6 +41,7 @@ struct SCIP_SepaStore
 {
    SCIP_ROW**            cuts;               /**< array with separated cuts sorted by score */
    SCIP_RANDNUMGEN*      randnumgen;         /**< random number generator used for tie breaking */
+   SCIP_HASHTABLE*       hashtable;          /**< hash table of non-forced cuts for detecting duplicates on insertion */
    int                   cutssize;           /**< size of cuts and score arrays */
    int                   ncuts;              /**< number of separated cuts (max. is set->sepa_maxcuts) */
    int                   nforcedcuts;        /**< number of forced separated cuts (first positions in cuts array) */
@@ -360,6 +360,7 @@ struct SCIP_Set
    int                   mem_arraygrowinit;  /**< initial size of dynamically allocated arrays */
    int                   mem_treegrowinit;   /**< initial size of tree array */
    int                   mem_pathgrowinit;   /**< initial size of path array */
+   SCIP_Bool             mem_shedding;       /**< should memory be released when switching to memory saving mode? */
 
    /* miscellaneous settings */
    SCIP_Bool             misc_catchctrlc;    /**< should the CTRL-C interrupt be caught by SCIP? */
@@ -424,6 +425,8 @@ struct SCIP_Set
    SCIP_Real             presol_abortfac;    /**< abort presolve, if l.t. this frac of the problem was changed in last round */
    int                   presol_maxrounds;   /**< maximal number of presolving rounds (-1: unlimited) */
    int                   presol_maxrestarts; /**< maximal number of restarts (-1: unlimited) */
+   int                   presol_maxfailexhaustive;/**< maximal number of consecutive unsuccessful exhaustive calls of a
+                                               *   presolver before it is skipped in exhaustive presolving (-1: no limit) */
    SCIP_Real             presol_clqtablefac; /**< limit on number of entries in clique table relative to number of problem nonzeros */
    SCIP_Real             presol_restartfac;  /**< fraction of integer variables that were fixed in the root node
                                               *   triggering a restart with preprocessing after root node evaluation */
@@ -566,10 +569,14 @@ struct SCIP_Set
 
    /* timing settings */
    SCIP_CLOCKTYPE        time_clocktype;     /**< default clock type to use */
+   SCIP_Real             time_tscfrequency;  /**< ticks of the time stamp counter per second; 0.0 if not yet calibrated,
+                                              *   -1.0 if no invariant counter is available */
    SCIP_Bool             time_enabled;       /**< is timing enabled? */
    SCIP_Bool             time_reading;       /**< belongs reading time to solving time? */
    SCIP_Bool             time_rareclockcheck;/**< should clock checks of solving time be performed less frequently (might exceed time limit slightly) */
    SCIP_Bool             time_statistictiming;  /**< should timing for statistic output be enabled? */
+   char*                 time_tracefilename; /**< name of the event trace file, or - if no event trace should be recorded */
+   int                   time_tracebuffersize;/**< maximal number of events kept in the event trace */
 
    /* tree compression parameters (for reoptimization) */
    SCIP_Bool             compr_enable;       /**< should automatic tree compression after presolving be enabled? (only for reoptimization) */
@@ -34,6 +34,7 @@
 #include "scip/def.h"
 #include "scip/type_stat.h"
 #include "scip/type_clock.h"
+#include "scip/type_trace.h"
 #include "scip/type_visual.h"
 #include "scip/type_history.h"
 #include "scip/type_var.h"
@@ -89,6 +90,9 @@ struct SCIP_Stat
    SCIP_Longint          nreprops;           /**< number of times, a solved node is repropagated again */
    SCIP_Longint          nrepropboundchgs;   /**< number of bound changes generated in repropagating nodes */
    SCIP_Longint          nrepropcutoffs;     /**< number of times, a repropagated node was cut off */
+   SCIP_Longint          ndomprops;          /**< number of domain propagation calls in current run */
+   SCIP_Longint          nproprounds;        /**< number of propagation rounds performed in domain propagation calls */
+   SCIP_Longint          npropcutoffs;       /**< number of domain propagation calls that detected a cutoff */
    SCIP_Longint          nlpsolsfound;       /**< number of CIP-feasible LP solutions found so far */
    SCIP_Longint          nrelaxsolsfound;    /**< number of CIP-feasible relaxation solutions found so far */
    SCIP_Longint          npssolsfound;       /**< number of CIP-feasible pseudo solutions found so far */
@@ -162,6 +166,7 @@ struct SCIP_Stat
    SCIP_CLOCK*           pseudosoltime;      /**< time needed for storing feasible pseudo solutions */
    SCIP_CLOCK*           sbsoltime;          /**< time needed for searching and storing feasible strong branching solutions */
    SCIP_CLOCK*           nodeactivationtime; /**< time needed for path switching and activating nodes */
+   SCIP_CLOCK*           cutapplytime;       /**< time needed for selecting cuts and applying them to the LP */
    SCIP_CLOCK*           nlpsoltime;         /**< time needed for solving NLPs */
    SCIP_CLOCK*           copyclock;          /**< time needed for copying problems */
    SCIP_CLOCK*           strongpropclock;    /**< time needed for propagation during strong branching */
@@ -170,6 +175,7 @@ struct SCIP_Stat
    SCIP_HISTORY*         glbhistorycrun;     /**< global history information over all variables for current run */
    SCIP_VAR*             lastbranchvar;      /**< last variable, that was branched on */
    SCIP_VISUAL*          visual;             /**< visualization information */
+   SCIP_TRACE*           trace;              /**< event trace of the solving process */
    SCIP_HEUR*            firstprimalheur;    /**< heuristic which found the first primal solution */
    SCIP_STATUS           status;             /**< SCIP solving status */
    SCIP_BRANCHDIR        lastbranchdir;      /**< direction of the last branching */
@@ -44,6 +44,7 @@ struct SCIP_Table
    SCIP_DECL_TABLEINITSOL ((*tableinitsol)); /**< solving process initialization method of statistics table */
    SCIP_DECL_TABLEEXITSOL ((*tableexitsol)); /**< solving process deinitialization method of statistics table */
    SCIP_DECL_TABLEOUTPUT ((*tableoutput));   /**< output method */
+   SCIP_DECL_TABLEOUTPUTJSON ((*tableoutputjson)); /**< JSON output method, or NULL if the text output is used */
    SCIP_TABLEDATA*       tabledata;          /**< statistics table data */
    int                   position;           /**< relative position of statistics table */
    SCIP_STAGE            earlieststage;      /**< output of the statistics table is only printed from this stage onwards */
@@ -0,0 +1,60 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   struct_trace.h
+ * @ingroup INTERNALAPI
+ * @brief  data structures for event tracing of the solving process
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_STRUCT_TRACE_H__
+#define __SCIP_STRUCT_TRACE_H__
+
+#include "scip/def.h"
+#include "scip/type_trace.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** single begin or end event in a trace */
+struct SCIP_TraceEvent
+{
+   const char*           name;               /**< name of the traced plugin or action */
+   SCIP_Real             time;               /**< time of the monotonic clock in seconds at which the event happened */
+   SCIP_TRACECAT         category;           /**< category of the event */
+   SCIP_Bool             begin;              /**< is this the begin of an event (or its end)? */
+};
+
+/** event trace data structure
+ *
+ *  The events are stored in a ring buffer: if it is full, the oldest events are overwritten, such that the trace
+ *  always shows the most recent part of the solving process.
+ */
+struct SCIP_Trace
+{
+   SCIP_TRACEEVENT*      events;             /**< ring buffer of events, or NULL if tracing is disabled */
+   char*                 filename;           /**< name of the file the trace is written to */
+   SCIP_Longint          nevents;            /**< total number of events recorded since the trace was initialized */
+   int                   size;               /**< size of the ring buffer */
+   int                   tid;                /**< thread id shown in the trace viewer (index of concurrent solver + 1) */
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -72,7 +72,13 @@ struct SCIP_Child
    int                   arraypos;           /**< position of node in the children array */
 };
 
-/** leaf information (should not exceed the size of a pointer) */
+/** leaf information (should not exceed the size of a pointer)
+ *
+ *  A leaf only stores its own domain changes (in SCIP_NODE::domchg, relative to its parent) and refers to the LP state
+ *  of its fork, so its memory footprint is already proportional to the branching decisions that created it. When the
+ *  memory limit is approached, SCIP switches to the node selectors' memory saving priority instead of storing leaves
+ *  elsewhere (see parameter memory/savefac).
+ */
 struct SCIP_Leaf
 {
    SCIP_NODE*            lpstatefork;        /**< fork/subroot node defining the LP state of the leaf */
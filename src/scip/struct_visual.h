@@ -41,6 +41,10 @@ struct SCIP_Visual
 {
    FILE*                 vbcfile;            /**< file to store VBC information */
    FILE*                 bakfile;            /**< file to store BAK information */
+   char*                 vbcbuffer;          /**< buffer collecting VBC output before it is written to the file */
+   char*                 bakbuffer;          /**< buffer collecting BAK output before it is written to the file */
+   int                   vbcbufferlen;       /**< number of characters currently stored in the VBC buffer */
+   int                   bakbufferlen;       /**< number of characters currently stored in the BAK buffer */
    SCIP_MESSAGEHDLR*     messagehdlr;        /**< message handler to use */
    SCIP_HASHMAP*         nodenum;            /**< hash map for mapping nodes to node numbers */
    SCIP_Longint          timestep;           /**< time step counter for non real time output */
@@ -421,6 +421,12 @@ SCIP_RETCODE SCIPsyncstoreEnsureAllSynced(
 /** Start synchronization for the given concurrent solver.
  *  Needs to be followed by a call to SCIPsyncstoreFinishSync if
  *  the syncdata that is returned is not NULL
+ *
+ *  @note the synchronization data form a ring of nsyncdata slots, each with its own lock, so writers of the current
+ *        synchronization do not block readers of earlier ones.  A solver holds the lock only while it copies its
+ *        solutions and bound changes.  The delay until others receive them is set by the synchronization
+ *        frequency (concurrent/sync/freqinit, freqmax, freqfactor) and by the read delay (concurrent/sync/minsyncdelay,
+ *        maxnsyncdelay), not by the locking.
  */
 SCIP_RETCODE SCIPsyncstoreStartSync(
    SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
@@ -754,7 +760,14 @@ void SCIPsyncdataGetSolutionBuffer(
    }
 }
 
-/** adds bound changes to the synchronization data */
+/** adds bound changes to the synchronization data
+ *
+ *  @note solutions and global bound changes are the only data exchanged between concurrent solvers, because they can be
+ *        stored in the solver-independent encoding given by SCIPgetConcurrentVaridx().  Conflict constraints and cuts
+ *        belong to the constraint handlers and cut pool of one solver and are defined on its transformed variables,
+ *        which differ between solvers after presolving.  Exchanging them would require a common representation, such
+ *        as a linear row over concurrent variable indices, that is rebuilt in every receiving solver.
+ */
 SCIP_RETCODE SCIPsyncdataAddBoundChanges(
    SCIP_SYNCSTORE*       syncstore,          /**< the synchronization store */
    SCIP_SYNCDATA*        syncdata,           /**< the synchronization data */
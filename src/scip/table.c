@@ -102,6 +102,7 @@ SCIP_RETCODE doTableCreate(
    (*table)->tableinitsol = tableinitsol;
    (*table)->tableexitsol = tableexitsol;
    (*table)->tableoutput = tableoutput;
+   (*table)->tableoutputjson = NULL;
    (*table)->tabledata = tabledata;
    (*table)->position = position;
    (*table)->earlieststage = earlieststage;
@@ -275,6 +276,63 @@ SCIP_RETCODE SCIPtableOutput(
    return SCIP_OKAY;
 }
 
+/** output statistics table as JSON value; if the table has no JSON output method, its text output is printed as JSON
+ *  string
+ */
+SCIP_RETCODE SCIPtableOutputJson(
+   SCIP_TABLE*           table,              /**< statistics table */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   FILE*                 file                /**< output file (or NULL for standard output) */
+   )
+{
+   FILE* textfile;
+   char* text;
+   long size;
+
+   assert(table != NULL);
+   assert(table->tableoutput != NULL);
+   assert(set != NULL);
+
+   if( table->tableoutputjson != NULL )
+   {
+      SCIP_CALL( table->tableoutputjson(set->scip, table, file) );
+      return SCIP_OKAY;
+   }
+
+   /* store the text output in a temporary file and print it as JSON string */
+   textfile = tmpfile();
+   if( textfile == NULL )
+   {
+      SCIPerrorMessage("error creating temporary file for output of statistics table <%s>\n", table->name);
+      return SCIP_FILECREATEERROR;
+   }
+
+   SCIP_CALL_FINALLY( table->tableoutput(set->scip, table, textfile), fclose(textfile) );
+
+   size = ftell(textfile);
+   if( size < 0 )
+      size = 0;
+   rewind(textfile);
+
+   if( BMSallocMemoryArray(&text, size + 1) == NULL )
+   {
+      SCIPerrorMessage("No memory in function call\n");
+      fclose(textfile);
+      return SCIP_NOMEMORY;
+   }
+   size = (long) fread(text, 1, (size_t) size, textfile);
+   text[size] = '\0';
+   fclose(textfile);
+
+   SCIPinfoMessage(set->scip, file, "{\"text\":");
+   SCIPprintJsonString(set->scip, file, text);
+   SCIPinfoMessage(set->scip, file, "}");
+
+   BMSfreeMemoryArray(&text);
+
+   return SCIP_OKAY;
+}
+
 /** gets user data of statistics table */
 SCIP_TABLEDATA* SCIPtableGetData(
    SCIP_TABLE*           table               /**< statistics table */
@@ -285,6 +343,17 @@ SCIP_TABLEDATA* SCIPtableGetData(
    return table->tabledata;
 }
 
+/** sets JSON output method of statistics table */
+void SCIPtableSetOutputJson(
+   SCIP_TABLE*           table,              /**< statistics table */
+   SCIP_DECL_TABLEOUTPUTJSON ((*tableoutputjson)) /**< JSON output method, or NULL to use the text output */
+   )
+{
+   assert(table != NULL);
+
+   table->tableoutputjson = tableoutputjson;
+}
+
 /** sets user data of statistics table; user has to free old data in advance! */
 void SCIPtableSetData(
    SCIP_TABLE*           table,              /**< statistics table */
@@ -103,6 +103,21 @@ SCIP_RETCODE SCIPtableOutput(
    FILE*                 file                /**< output file (or NULL for standard output) */
    );
 
+/** output statistics table as JSON value; if the table has no JSON output method, its text output is printed as JSON
+ *  string
+ */
+SCIP_RETCODE SCIPtableOutputJson(
+   SCIP_TABLE*           table,              /**< statistics table */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   FILE*                 file                /**< output file (or NULL for standard output) */
+   );
+
+/** sets JSON output method of statistics table */
+void SCIPtableSetOutputJson(
+   SCIP_TABLE*           table,              /**< statistics table */
+   SCIP_DECL_TABLEOUTPUTJSON ((*tableoutputjson)) /**< JSON output method, or NULL to use the text output */
+   );
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,10 +21,31 @@
 
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
+#include "scip/pub_branch.h"
+#include "scip/pub_cons.h"
+#include "scip/pub_cutpool.h"
+#include "scip/pub_heur.h"
 #include "scip/pub_message.h"
+#include "scip/pub_presol.h"
+#include "scip/pub_pricer.h"
+#include "scip/pub_prop.h"
+#include "scip/pub_sepa.h"
 #include "scip/pub_table.h"
+#include "scip/scip_branch.h"
+#include "scip/scip_cons.h"
+#include "scip/scip_cut.h"
+#include "scip/scip_general.h"
+#include "scip/scip_heur.h"
+#include "scip/scip_message.h"
+#include "scip/scip_presol.h"
+#include "scip/scip_pricer.h"
+#include "scip/scip_prob.h"
+#include "scip/scip_prop.h"
+#include "scip/scip_sepa.h"
 #include "scip/scip_solvingstats.h"
 #include "scip/scip_table.h"
+#include "scip/scip_timing.h"
+#include "scip/scip_tree.h"
 #include "scip/table_default.h"
 
 
@@ -422,6 +443,732 @@ SCIP_DECL_TABLEOUTPUT(tableOutputBenders)
    return SCIP_OKAY;
 }
 
+/*
+ * JSON output methods of statistics tables
+ */
+
+/** prints the name of a member of a JSON object, preceded by a comma unless it is the first member */
+static
+void printJsonName(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   const char*           name,               /**< name of member */
+   SCIP_Bool*            first               /**< pointer to store whether the next member is the first one */
+   )
+{
+   assert(first != NULL);
+
+   if( !*first )
+      SCIPinfoMessage(scip, file, ",");
+   SCIPprintJsonString(scip, file, name);
+   SCIPinfoMessage(scip, file, ":");
+   *first = FALSE;
+}
+
+/** prints a member of a JSON object with a real value */
+static
+void printJsonReal(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   const char*           name,               /**< name of member */
+   SCIP_Real             val,                /**< value of member */
+   SCIP_Bool*            first               /**< pointer to store whether the next member is the first one */
+   )
+{
+   printJsonName(scip, file, name, first);
+   SCIPprintJsonReal(scip, file, val);
+}
+
+/** prints a member of a JSON object with an integer value */
+static
+void printJsonLongint(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   const char*           name,               /**< name of member */
+   SCIP_Longint          val,                /**< value of member */
+   SCIP_Bool*            first               /**< pointer to store whether the next member is the first one */
+   )
+{
+   printJsonName(scip, file, name, first);
+   SCIPinfoMessage(scip, file, "%" SCIP_LONGINT_FORMAT, val);
+}
+
+/** prints the statistics of a presolving method as member of a JSON object */
+static
+void printJsonPresolving(
+   SCIP*                 scip,               /**< SCIP data structure */
+   FILE*                 file,               /**< output file */
+   const char*           name,               /**< name of presolving method */
+   SCIP_Real             time,               /**< execution time */
+   SCIP_Real             setuptime,          /**< setup time */
+   int                   ncalls,             /**< number of calls */
+   int                   nfixedvars,         /**< number of fixed variables */
+   int                   naggrvars,          /**< number of aggregated variables */
+   int                   nchgvartypes,       /**< number of changed variable types */
+   int                   nchgbds,            /**< number of changed bounds */
+   int                   naddholes,          /**< number of added holes */
+   int                   ndelconss,          /**< number of deleted constraints */
+   int                   naddconss,          /**< number of added constraints */
+   int                   nchgsides,          /**< number of changed sides */
+   int                   nchgcoefs,          /**< number of changed coefficients */
+   SCIP_Bool*            first               /**< pointer to store whether the next member is the first one */
+   )
+{
+   SCIP_Bool firstentry = TRUE;
+
+   printJsonName(scip, file, name, first);
+   SCIPinfoMessage(scip, file, "{");
+   printJsonReal(scip, file, "exectime", time, &firstentry);
+   printJsonReal(scip, file, "setuptime", setuptime, &firstentry);
+   printJsonLongint(scip, file, "calls", (SCIP_Longint)ncalls, &firstentry);
+   printJsonLongint(scip, file, "fixedvars", (SCIP_Longint)nfixedvars, &firstentry);
+   printJsonLongint(scip, file, "aggrvars", (SCIP_Longint)naggrvars, &firstentry);
+   printJsonLongint(scip, file, "chgtypes", (SCIP_Longint)nchgvartypes, &firstentry);
+   printJsonLongint(scip, file, "chgbounds", (SCIP_Longint)nchgbds, &firstentry);
+   printJsonLongint(scip, file, "addholes", (SCIP_Longint)naddholes, &firstentry);
+   printJsonLongint(scip, file, "delconss", (SCIP_Longint)ndelconss, &firstentry);
+   printJsonLongint(scip, file, "addconss", (SCIP_Longint)naddconss, &firstentry);
+   printJsonLongint(scip, file, "chgsides", (SCIP_Longint)nchgsides, &firstentry);
+   printJsonLongint(scip, file, "chgcoefs", (SCIP_Longint)nchgcoefs, &firstentry);
+   SCIPinfoMessage(scip, file, "}");
+}
+
+/** returns whether the statistics of a constraint handler are printed */
+static
+SCIP_Bool conshdlrHasStatistics(
+   SCIP_CONSHDLR*        conshdlr            /**< constraint handler */
+   )
+{
+   return SCIPconshdlrGetMaxNActiveConss(conshdlr) > 0 || !SCIPconshdlrNeedsCons(conshdlr);
+}
+
+/** returns the name of a solving stage */
+static
+const char* getStageName(
+   SCIP_STAGE            stage               /**< solving stage */
+   )
+{
+   switch( stage )
+   {
+   case SCIP_STAGE_INIT:
+      return "init";
+   case SCIP_STAGE_PROBLEM:
+      return "problem";
+   case SCIP_STAGE_TRANSFORMING:
+      return "transforming";
+   case SCIP_STAGE_TRANSFORMED:
+      return "transformed";
+   case SCIP_STAGE_INITPRESOLVE:
+      return "initpresolve";
+   case SCIP_STAGE_PRESOLVING:
+      return "presolving";
+   case SCIP_STAGE_EXITPRESOLVE:
+      return "exitpresolve";
+   case SCIP_STAGE_PRESOLVED:
+      return "presolved";
+   case SCIP_STAGE_INITSOLVE:
+      return "initsolve";
+   case SCIP_STAGE_SOLVING:
+      return "solving";
+   case SCIP_STAGE_SOLVED:
+      return "solved";
+   case SCIP_STAGE_EXITSOLVE:
+      return "exitsolve";
+   case SCIP_STAGE_FREETRANS:
+      return "freetrans";
+   case SCIP_STAGE_FREE:
+      return "free";
+   default:
+      return "unknown";
+   }
+}
+
+/** returns the name of a solution status */
+static
+const char* getStatusName(
+   SCIP_STATUS           status              /**< solution status */
+   )
+{
+   switch( status )
+   {
+   case SCIP_STATUS_USERINTERRUPT:
+      return "userinterrupt";
+   case SCIP_STATUS_NODELIMIT:
+      return "nodelimit";
+   case SCIP_STATUS_TOTALNODELIMIT:
+      return "totalnodelimit";
+   case SCIP_STATUS_STALLNODELIMIT:
+      return "stallnodelimit";
+   case SCIP_STATUS_TIMELIMIT:
+      return "timelimit";
+   case SCIP_STATUS_MEMLIMIT:
+      return "memlimit";
+   case SCIP_STATUS_GAPLIMIT:
+      return "gaplimit";
+   case SCIP_STATUS_SOLLIMIT:
+      return "sollimit";
+   case SCIP_STATUS_BESTSOLLIMIT:
+      return "bestsollimit";
+   case SCIP_STATUS_RESTARTLIMIT:
+      return "restartlimit";
+   case SCIP_STATUS_OPTIMAL:
+      return "optimal";
+   case SCIP_STATUS_INFEASIBLE:
+      return "infeasible";
+   case SCIP_STATUS_UNBOUNDED:
+      return "unbounded";
+   case SCIP_STATUS_INFORUNBD:
+      return "inforunbd";
+   case SCIP_STATUS_TERMINATE:
+      return "terminate";
+   case SCIP_STATUS_UNKNOWN:
+   default:
+      return "unknown";
+   }
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonStatus)
+{  /*lint --e{715}*/
+   SCIP_Bool first = TRUE;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   SCIPinfoMessage(scip, file, "{");
+   printJsonName(scip, file, "stage", &first);
+   SCIPprintJsonString(scip, file, getStageName(SCIPgetStage(scip)));
+   printJsonName(scip, file, "status", &first);
+   SCIPprintJsonString(scip, file, getStatusName(SCIPgetStatus(scip)));
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonTiming)
+{  /*lint --e{715}*/
+   SCIP_Bool first = TRUE;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   SCIPinfoMessage(scip, file, "{");
+   printJsonReal(scip, file, "total", SCIPgetTotalTime(scip), &first);
+   printJsonReal(scip, file, "reading", SCIPgetReadingTime(scip), &first);
+   if( SCIPgetStage(scip) > SCIP_STAGE_PROBLEM )
+      printJsonReal(scip, file, "solving", SCIPgetSolvingTime(scip), &first);
+   if( SCIPgetStage(scip) >= SCIP_STAGE_INITPRESOLVE )
+      printJsonReal(scip, file, "presolving", SCIPgetPresolvingTime(scip), &first);
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonOrigProb)
+{  /*lint --e{715}*/
+   SCIP_Bool first = TRUE;
+   int nvars;
+   int nbinvars;
+   int nintvars;
+   int nimplvars;
+   int ncontvars;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   SCIP_CALL( SCIPgetOrigVarsData(scip, NULL, &nvars, &nbinvars, &nintvars, &nimplvars, &ncontvars) );
+
+   SCIPinfoMessage(scip, file, "{");
+   printJsonName(scip, file, "name", &first);
+   SCIPprintJsonString(scip, file, SCIPgetProbName(scip));
+   printJsonLongint(scip, file, "vars", (SCIP_Longint)nvars, &first);
+   printJsonLongint(scip, file, "binvars", (SCIP_Longint)nbinvars, &first);
+   printJsonLongint(scip, file, "intvars", (SCIP_Longint)nintvars, &first);
+   printJsonLongint(scip, file, "implvars", (SCIP_Longint)nimplvars, &first);
+   printJsonLongint(scip, file, "contvars", (SCIP_Longint)ncontvars, &first);
+   printJsonLongint(scip, file, "conss", (SCIP_Longint)SCIPgetNOrigConss(scip), &first);
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonTransProb)
+{  /*lint --e{715}*/
+   SCIP_Bool first = TRUE;
+   int nvars;
+   int nbinvars;
+   int nintvars;
+   int nimplvars;
+   int ncontvars;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   SCIP_CALL( SCIPgetVarsData(scip, NULL, &nvars, &nbinvars, &nintvars, &nimplvars, &ncontvars) );
+
+   SCIPinfoMessage(scip, file, "{");
+   printJsonLongint(scip, file, "vars", (SCIP_Longint)nvars, &first);
+   printJsonLongint(scip, file, "binvars", (SCIP_Longint)nbinvars, &first);
+   printJsonLongint(scip, file, "intvars", (SCIP_Longint)nintvars, &first);
+   printJsonLongint(scip, file, "implvars", (SCIP_Longint)nimplvars, &first);
+   printJsonLongint(scip, file, "contvars", (SCIP_Longint)ncontvars, &first);
+   printJsonLongint(scip, file, "conss", (SCIP_Longint)SCIPgetNConss(scip), &first);
+   printJsonLongint(scip, file, "nonzeros", SCIPgetNNZs(scip), &first);
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonPresol)
+{  /*lint --e{715}*/
+   SCIP_PRESOL** presols;
+   SCIP_PROP** props;
+   SCIP_CONSHDLR** conshdlrs;
+   SCIP_Bool first;
+   int i;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   SCIPinfoMessage(scip, file, "{\"presolvers\":{");
+   presols = SCIPgetPresols(scip);
+   first = TRUE;
+   for( i = 0; i < SCIPgetNPresols(scip); ++i )
+   {
+      printJsonPresolving(scip, file, SCIPpresolGetName(presols[i]), SCIPpresolGetTime(presols[i]),
+         SCIPpresolGetSetupTime(presols[i]), SCIPpresolGetNCalls(presols[i]), SCIPpresolGetNFixedVars(presols[i]),
+         SCIPpresolGetNAggrVars(presols[i]), SCIPpresolGetNChgVarTypes(presols[i]), SCIPpresolGetNChgBds(presols[i]),
+         SCIPpresolGetNAddHoles(presols[i]), SCIPpresolGetNDelConss(presols[i]), SCIPpresolGetNAddConss(presols[i]),
+         SCIPpresolGetNChgSides(presols[i]), SCIPpresolGetNChgCoefs(presols[i]), &first);
+   }
+
+   SCIPinfoMessage(scip, file, "},\"propagators\":{");
+   props = SCIPgetProps(scip);
+   first = TRUE;
+   for( i = 0; i < SCIPgetNProps(scip); ++i )
+   {
+      if( !SCIPpropDoesPresolve(props[i]) )
+         continue;
+
+      printJsonPresolving(scip, file, SCIPpropGetName(props[i]), SCIPpropGetPresolTime(props[i]),
+         SCIPpropGetSetupTime(props[i]), SCIPpropGetNPresolCalls(props[i]), SCIPpropGetNFixedVars(props[i]),
+         SCIPpropGetNAggrVars(props[i]), SCIPpropGetNChgVarTypes(props[i]), SCIPpropGetNChgBds(props[i]),
+         SCIPpropGetNAddHoles(props[i]), SCIPpropGetNDelConss(props[i]), SCIPpropGetNAddConss(props[i]),
+         SCIPpropGetNChgSides(props[i]), SCIPpropGetNChgCoefs(props[i]), &first);
+   }
+
+   SCIPinfoMessage(scip, file, "},\"constraints\":{");
+   conshdlrs = SCIPgetConshdlrs(scip);
+   first = TRUE;
+   for( i = 0; i < SCIPgetNConshdlrs(scip); ++i )
+   {
+      if( !SCIPconshdlrDoesPresolve(conshdlrs[i]) || !conshdlrHasStatistics(conshdlrs[i]) )
+         continue;
+
+      printJsonPresolving(scip, file, SCIPconshdlrGetName(conshdlrs[i]), SCIPconshdlrGetPresolTime(conshdlrs[i]),
+         SCIPconshdlrGetSetupTime(conshdlrs[i]), SCIPconshdlrGetNPresolCalls(conshdlrs[i]),
+         SCIPconshdlrGetNFixedVars(conshdlrs[i]), SCIPconshdlrGetNAggrVars(conshdlrs[i]),
+         SCIPconshdlrGetNChgVarTypes(conshdlrs[i]), SCIPconshdlrGetNChgBds(conshdlrs[i]),
+         SCIPconshdlrGetNAddHoles(conshdlrs[i]), SCIPconshdlrGetNDelConss(conshdlrs[i]),
+         SCIPconshdlrGetNAddConss(conshdlrs[i]), SCIPconshdlrGetNChgSides(conshdlrs[i]),
+         SCIPconshdlrGetNChgCoefs(conshdlrs[i]), &first);
+   }
+   SCIPinfoMessage(scip, file, "}}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonCons)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLR** conshdlrs;
+   SCIP_Bool first = TRUE;
+   int i;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   conshdlrs = SCIPgetConshdlrs(scip);
+
+   SCIPinfoMessage(scip, file, "{");
+   for( i = 0; i < SCIPgetNConshdlrs(scip); ++i )
+   {
+      SCIP_CONSHDLR* conshdlr = conshdlrs[i];
+      SCIP_Bool firstentry = TRUE;
+
+      if( !conshdlrHasStatistics(conshdlr) )
+         continue;
+
+      printJsonName(scip, file, SCIPconshdlrGetName(conshdlr), &first);
+      SCIPinfoMessage(scip, file, "{");
+      printJsonLongint(scip, file, "number", (SCIP_Longint)SCIPconshdlrGetStartNActiveConss(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "maxnumber", (SCIP_Longint)SCIPconshdlrGetMaxNActiveConss(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "separate", SCIPconshdlrGetNSepaCalls(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "propagate", SCIPconshdlrGetNPropCalls(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "enfolp", SCIPconshdlrGetNEnfoLPCalls(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "enforelax", SCIPconshdlrGetNEnfoRelaxCalls(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "enfops", SCIPconshdlrGetNEnfoPSCalls(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "check", SCIPconshdlrGetNCheckCalls(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "resprop", SCIPconshdlrGetNRespropCalls(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "cutoffs", SCIPconshdlrGetNCutoffs(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "domreds", SCIPconshdlrGetNDomredsFound(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "cuts", SCIPconshdlrGetNCutsFound(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "applied", SCIPconshdlrGetNCutsApplied(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "conss", SCIPconshdlrGetNConssFound(conshdlr), &firstentry);
+      printJsonLongint(scip, file, "children", SCIPconshdlrGetNChildren(conshdlr), &firstentry);
+      SCIPinfoMessage(scip, file, "}");
+   }
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonConstiming)
+{  /*lint --e{715}*/
+   SCIP_CONSHDLR** conshdlrs;
+   SCIP_Bool first = TRUE;
+   int i;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   conshdlrs = SCIPgetConshdlrs(scip);
+
+   SCIPinfoMessage(scip, file, "{");
+   for( i = 0; i < SCIPgetNConshdlrs(scip); ++i )
+   {
+      SCIP_CONSHDLR* conshdlr = conshdlrs[i];
+      SCIP_Bool firstentry = TRUE;
+      SCIP_Real totaltime;
+
+      if( !conshdlrHasStatistics(conshdlr) )
+         continue;
+
+      totaltime = SCIPconshdlrGetSepaTime(conshdlr) + SCIPconshdlrGetPropTime(conshdlr)
+         + SCIPconshdlrGetStrongBranchPropTime(conshdlr) + SCIPconshdlrGetEnfoLPTime(conshdlr)
+         + SCIPconshdlrGetEnfoPSTime(conshdlr) + SCIPconshdlrGetEnfoRelaxTime(conshdlr)
+         + SCIPconshdlrGetCheckTime(conshdlr) + SCIPconshdlrGetRespropTime(conshdlr)
+         + SCIPconshdlrGetSetupTime(conshdlr);
+
+      printJsonName(scip, file, SCIPconshdlrGetName(conshdlr), &first);
+      SCIPinfoMessage(scip, file, "{");
+      printJsonReal(scip, file, "totaltime", totaltime, &firstentry);
+      printJsonReal(scip, file, "setuptime", SCIPconshdlrGetSetupTime(conshdlr), &firstentry);
+      printJsonReal(scip, file, "separate", SCIPconshdlrGetSepaTime(conshdlr), &firstentry);
+      printJsonReal(scip, file, "propagate", SCIPconshdlrGetPropTime(conshdlr), &firstentry);
+      printJsonReal(scip, file, "enfolp", SCIPconshdlrGetEnfoLPTime(conshdlr), &firstentry);
+      printJsonReal(scip, file, "enfops", SCIPconshdlrGetEnfoPSTime(conshdlr), &firstentry);
+      printJsonReal(scip, file, "enforelax", SCIPconshdlrGetEnfoRelaxTime(conshdlr), &firstentry);
+      printJsonReal(scip, file, "check", SCIPconshdlrGetCheckTime(conshdlr), &firstentry);
+      printJsonReal(scip, file, "resprop", SCIPconshdlrGetRespropTime(conshdlr), &firstentry);
+      printJsonReal(scip, file, "sbprop", SCIPconshdlrGetStrongBranchPropTime(conshdlr), &firstentry);
+      SCIPinfoMessage(scip, file, "}");
+   }
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonProp)
+{  /*lint --e{715}*/
+   SCIP_PROP** props;
+   SCIP_Bool first = TRUE;
+   int i;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   props = SCIPgetProps(scip);
+
+   SCIPinfoMessage(scip, file, "{");
+   for( i = 0; i < SCIPgetNProps(scip); ++i )
+   {
+      SCIP_PROP* prop = props[i];
+      SCIP_Bool firstentry = TRUE;
+      SCIP_Real totaltime;
+
+      totaltime = SCIPpropGetPresolTime(prop) + SCIPpropGetTime(prop) + SCIPpropGetRespropTime(prop)
+         + SCIPpropGetStrongBranchPropTime(prop) + SCIPpropGetSetupTime(prop);
+
+      printJsonName(scip, file, SCIPpropGetName(prop), &first);
+      SCIPinfoMessage(scip, file, "{");
+      printJsonLongint(scip, file, "propagate", SCIPpropGetNCalls(prop), &firstentry);
+      printJsonLongint(scip, file, "resprop", SCIPpropGetNRespropCalls(prop), &firstentry);
+      printJsonLongint(scip, file, "cutoffs", SCIPpropGetNCutoffs(prop), &firstentry);
+      printJsonLongint(scip, file, "domreds", SCIPpropGetNDomredsFound(prop), &firstentry);
+      printJsonReal(scip, file, "totaltime", totaltime, &firstentry);
+      printJsonReal(scip, file, "setuptime", SCIPpropGetSetupTime(prop), &firstentry);
+      printJsonReal(scip, file, "presoltime", SCIPpropGetPresolTime(prop), &firstentry);
+      printJsonReal(scip, file, "proptime", SCIPpropGetTime(prop), &firstentry);
+      printJsonReal(scip, file, "resproptime", SCIPpropGetRespropTime(prop), &firstentry);
+      printJsonReal(scip, file, "sbproptime", SCIPpropGetStrongBranchPropTime(prop), &firstentry);
+      SCIPinfoMessage(scip, file, "}");
+   }
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonSepa)
+{  /*lint --e{715}*/
+   SCIP_CUTPOOL* cutpool;
+   SCIP_SEPA** sepas;
+   SCIP_Bool first = TRUE;
+   SCIP_Bool firstentry = TRUE;
+   int i;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   cutpool = SCIPgetGlobalCutpool(scip);
+
+   SCIPinfoMessage(scip, file, "{");
+   printJsonName(scip, file, "cut pool", &first);
+   SCIPinfoMessage(scip, file, "{");
+   printJsonReal(scip, file, "exectime", SCIPcutpoolGetTime(cutpool), &firstentry);
+   printJsonLongint(scip, file, "calls", SCIPcutpoolGetNCalls(cutpool), &firstentry);
+   printJsonLongint(scip, file, "cuts", SCIPcutpoolGetNCutsFound(cutpool), &firstentry);
+   printJsonLongint(scip, file, "maxpoolsize", (SCIP_Longint)SCIPcutpoolGetMaxNCuts(cutpool), &firstentry);
+   SCIPinfoMessage(scip, file, "}");
+
+   sepas = SCIPgetSepas(scip);
+   for( i = 0; i < SCIPgetNSepas(scip); ++i )
+   {
+      SCIP_SEPA* sepa = sepas[i];
+
+      firstentry = TRUE;
+      printJsonName(scip, file, SCIPsepaGetName(sepa), &first);
+      SCIPinfoMessage(scip, file, "{");
+      printJsonReal(scip, file, "exectime", SCIPsepaGetTime(sepa), &firstentry);
+      printJsonReal(scip, file, "setuptime", SCIPsepaGetSetupTime(sepa), &firstentry);
+      printJsonLongint(scip, file, "calls", SCIPsepaGetNCalls(sepa), &firstentry);
+      printJsonLongint(scip, file, "cutoffs", SCIPsepaGetNCutoffs(sepa), &firstentry);
+      printJsonLongint(scip, file, "domreds", SCIPsepaGetNDomredsFound(sepa), &firstentry);
+      printJsonLongint(scip, file, "cuts", SCIPsepaGetNCutsFound(sepa), &firstentry);
+      printJsonLongint(scip, file, "applied", SCIPsepaGetNCutsApplied(sepa), &firstentry);
+      printJsonLongint(scip, file, "conss", SCIPsepaGetNConssFound(sepa), &firstentry);
+      SCIPinfoMessage(scip, file, "}");
+   }
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonPricer)
+{  /*lint --e{715}*/
+   SCIP_PRICER** pricers;
+   SCIP_Bool first = TRUE;
+   int i;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   /* the active pricers come first in the pricer array */
+   pricers = SCIPgetPricers(scip);
+
+   SCIPinfoMessage(scip, file, "{");
+   for( i = 0; i < SCIPgetNActivePricers(scip); ++i )
+   {
+      SCIP_PRICER* pricer = pricers[i];
+      SCIP_Bool firstentry = TRUE;
+
+      printJsonName(scip, file, SCIPpricerGetName(pricer), &first);
+      SCIPinfoMessage(scip, file, "{");
+      printJsonReal(scip, file, "exectime", SCIPpricerGetTime(pricer), &firstentry);
+      printJsonReal(scip, file, "setuptime", SCIPpricerGetSetupTime(pricer), &firstentry);
+      printJsonLongint(scip, file, "calls", (SCIP_Longint)SCIPpricerGetNCalls(pricer), &firstentry);
+      printJsonLongint(scip, file, "vars", (SCIP_Longint)SCIPpricerGetNVarsFound(pricer), &firstentry);
+      SCIPinfoMessage(scip, file, "}");
+   }
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonBranch)
+{  /*lint --e{715}*/
+   SCIP_BRANCHRULE** branchrules;
+   SCIP_Bool first = TRUE;
+   int i;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   branchrules = SCIPgetBranchrules(scip);
+
+   SCIPinfoMessage(scip, file, "{");
+   for( i = 0; i < SCIPgetNBranchrules(scip); ++i )
+   {
+      SCIP_BRANCHRULE* branchrule = branchrules[i];
+      SCIP_Bool firstentry = TRUE;
+
+      printJsonName(scip, file, SCIPbranchruleGetName(branchrule), &first);
+      SCIPinfoMessage(scip, file, "{");
+      printJsonReal(scip, file, "exectime", SCIPbranchruleGetTime(branchrule), &firstentry);
+      printJsonReal(scip, file, "setuptime", SCIPbranchruleGetSetupTime(branchrule), &firstentry);
+      printJsonLongint(scip, file, "branchlp", SCIPbranchruleGetNLPCalls(branchrule), &firstentry);
+      printJsonLongint(scip, file, "branchext", SCIPbranchruleGetNExternCalls(branchrule), &firstentry);
+      printJsonLongint(scip, file, "branchps", SCIPbranchruleGetNPseudoCalls(branchrule), &firstentry);
+      printJsonLongint(scip, file, "cutoffs", SCIPbranchruleGetNCutoffs(branchrule), &firstentry);
+      printJsonLongint(scip, file, "domreds", SCIPbranchruleGetNDomredsFound(branchrule), &firstentry);
+      printJsonLongint(scip, file, "cuts", SCIPbranchruleGetNCutsFound(branchrule), &firstentry);
+      printJsonLongint(scip, file, "conss", SCIPbranchruleGetNConssFound(branchrule), &firstentry);
+      printJsonLongint(scip, file, "children", SCIPbranchruleGetNChildren(branchrule), &firstentry);
+      SCIPinfoMessage(scip, file, "}");
+   }
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonHeur)
+{  /*lint --e{715}*/
+   SCIP_HEUR** heurs;
+   SCIP_Bool first = TRUE;
+   int i;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   heurs = SCIPgetHeurs(scip);
+
+   SCIPinfoMessage(scip, file, "{");
+   for( i = 0; i < SCIPgetNHeurs(scip); ++i )
+   {
+      SCIP_HEUR* heur = heurs[i];
+      SCIP_Bool firstentry = TRUE;
+
+      printJsonName(scip, file, SCIPheurGetName(heur), &first);
+      SCIPinfoMessage(scip, file, "{");
+      printJsonReal(scip, file, "exectime", SCIPheurGetTime(heur), &firstentry);
+      printJsonReal(scip, file, "setuptime", SCIPheurGetSetupTime(heur), &firstentry);
+      printJsonLongint(scip, file, "calls", SCIPheurGetNCalls(heur), &firstentry);
+      printJsonLongint(scip, file, "found", SCIPheurGetNSolsFound(heur), &firstentry);
+      printJsonLongint(scip, file, "best", SCIPheurGetNBestSolsFound(heur), &firstentry);
+      SCIPinfoMessage(scip, file, "}");
+   }
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonLP)
+{  /*lint --e{715}*/
+   SCIP_Bool first = TRUE;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   SCIPinfoMessage(scip, file, "{");
+   printJsonLongint(scip, file, "lps", SCIPgetNLPs(scip), &first);
+   printJsonLongint(scip, file, "iterations", SCIPgetNLPIterations(scip), &first);
+   printJsonLongint(scip, file, "primallps", SCIPgetNPrimalLPs(scip), &first);
+   printJsonLongint(scip, file, "primallpiterations", SCIPgetNPrimalLPIterations(scip), &first);
+   printJsonLongint(scip, file, "duallps", SCIPgetNDualLPs(scip), &first);
+   printJsonLongint(scip, file, "duallpiterations", SCIPgetNDualLPIterations(scip), &first);
+   printJsonLongint(scip, file, "barrierlps", SCIPgetNBarrierLPs(scip), &first);
+   printJsonLongint(scip, file, "barrierlpiterations", SCIPgetNBarrierLPIterations(scip), &first);
+   printJsonLongint(scip, file, "divinglps", SCIPgetNDivingLPs(scip), &first);
+   printJsonLongint(scip, file, "divinglpiterations", SCIPgetNDivingLPIterations(scip), &first);
+   printJsonLongint(scip, file, "strongbranchs", SCIPgetNStrongbranchs(scip), &first);
+   printJsonLongint(scip, file, "strongbranchlpiterations", SCIPgetNStrongbranchLPIterations(scip), &first);
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonTree)
+{  /*lint --e{715}*/
+   SCIP_Bool first = TRUE;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   SCIPinfoMessage(scip, file, "{");
+   printJsonLongint(scip, file, "runs", (SCIP_Longint)SCIPgetNRuns(scip), &first);
+   printJsonLongint(scip, file, "nodes", SCIPgetNNodes(scip), &first);
+   printJsonLongint(scip, file, "totalnodes", SCIPgetNTotalNodes(scip), &first);
+   printJsonLongint(scip, file, "nodesleft", (SCIP_Longint)SCIPgetNNodesLeft(scip), &first);
+   printJsonLongint(scip, file, "feasleaves", SCIPgetNFeasibleLeaves(scip), &first);
+   printJsonLongint(scip, file, "infeasleaves", SCIPgetNInfeasibleLeaves(scip), &first);
+   printJsonLongint(scip, file, "objleaves", SCIPgetNObjlimLeaves(scip), &first);
+   printJsonLongint(scip, file, "maxdepth", (SCIP_Longint)SCIPgetMaxDepth(scip), &first);
+   printJsonLongint(scip, file, "maxtotaldepth", (SCIP_Longint)SCIPgetMaxTotalDepth(scip), &first);
+   printJsonLongint(scip, file, "backtracks", SCIPgetNBacktracks(scip), &first);
+   printJsonLongint(scip, file, "delayedcutoffs", SCIPgetNDelayedCutoffs(scip), &first);
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonRoot)
+{  /*lint --e{715}*/
+   SCIP_Bool first = TRUE;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   SCIPinfoMessage(scip, file, "{");
+   printJsonReal(scip, file, "firstlpvalue", SCIPgetFirstLPDualboundRoot(scip), &first);
+   printJsonLongint(scip, file, "firstlpiterations", SCIPgetNRootFirstLPIterations(scip), &first);
+   printJsonReal(scip, file, "firstlptime", SCIPgetFirstLPTime(scip), &first);
+   printJsonReal(scip, file, "finaldualbound", SCIPgetDualboundRoot(scip), &first);
+   printJsonLongint(scip, file, "finalrootiterations", SCIPgetNRootLPIterations(scip), &first);
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
+/** JSON output method of statistics table to output file stream 'file' */
+static
+SCIP_DECL_TABLEOUTPUTJSON(tableOutputJsonSol)
+{  /*lint --e{715}*/
+   SCIP_Bool first = TRUE;
+
+   assert(scip != NULL);
+   assert(table != NULL);
+
+   SCIPinfoMessage(scip, file, "{");
+   printJsonLongint(scip, file, "solutions", SCIPgetNSolsFound(scip), &first);
+   printJsonLongint(scip, file, "limsolutions", SCIPgetNLimSolsFound(scip), &first);
+   printJsonLongint(scip, file, "improvements", SCIPgetNBestSolsFound(scip), &first);
+   printJsonReal(scip, file, "firstprimalbound", SCIPgetFirstPrimalBound(scip), &first);
+   printJsonReal(scip, file, "primalbound", SCIPgetPrimalbound(scip), &first);
+   printJsonReal(scip, file, "dualbound", SCIPgetDualbound(scip), &first);
+   printJsonReal(scip, file, "gap", SCIPgetGap(scip), &first);
+   SCIPinfoMessage(scip, file, "}");
+
+   return SCIP_OKAY;
+}
+
 
 /*
  * statistics table specific interface methods
@@ -468,41 +1215,49 @@ SCIP_RETCODE SCIPincludeTableDefault(
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_STATUS, TABLE_DESC_STATUS, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputStatus,
          NULL, TABLE_POSITION_STATUS, TABLE_EARLIEST_STAGE_STATUS) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_STATUS), tableOutputJsonStatus) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_TIMING) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_TIMING, TABLE_DESC_TIMING, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputTiming,
          NULL, TABLE_POSITION_TIMING, TABLE_EARLIEST_STAGE_TIMING) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_TIMING), tableOutputJsonTiming) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_ORIGPROB) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_ORIGPROB, TABLE_DESC_ORIGPROB, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputOrigProb,
          NULL, TABLE_POSITION_ORIGPROB, TABLE_EARLIEST_STAGE_ORIGPROB) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_ORIGPROB), tableOutputJsonOrigProb) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_TRANSPROB) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_TRANSPROB, TABLE_DESC_TRANSPROB, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputTransProb,
          NULL, TABLE_POSITION_TRANSPROB, TABLE_EARLIEST_STAGE_TRANSPROB) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_TRANSPROB), tableOutputJsonTransProb) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_PRESOL) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_PRESOL, TABLE_DESC_PRESOL, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputPresol,
          NULL, TABLE_POSITION_PRESOL, TABLE_EARLIEST_STAGE_PRESOL) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_PRESOL), tableOutputJsonPresol) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_CONS) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_CONS, TABLE_DESC_CONS, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputCons,
          NULL, TABLE_POSITION_CONS, TABLE_EARLIEST_STAGE_CONS) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_CONS), tableOutputJsonCons) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_CONSTIMING) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_CONSTIMING, TABLE_DESC_CONSTIMING, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputConstiming,
          NULL, TABLE_POSITION_CONSTIMING, TABLE_EARLIEST_STAGE_CONSTIMING) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_CONSTIMING), tableOutputJsonConstiming) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_PROP) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_PROP, TABLE_DESC_PROP, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputProp,
          NULL, TABLE_POSITION_PROP, TABLE_EARLIEST_STAGE_PROP) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_PROP), tableOutputJsonProp) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_CONFLICT) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_CONFLICT, TABLE_DESC_CONFLICT, TRUE,
@@ -513,21 +1268,25 @@ SCIP_RETCODE SCIPincludeTableDefault(
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_SEPA, TABLE_DESC_SEPA, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputSepa,
          NULL, TABLE_POSITION_SEPA, TABLE_EARLIEST_STAGE_SEPA) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_SEPA), tableOutputJsonSepa) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_PRICER) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_PRICER, TABLE_DESC_PRICER, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputPricer,
          NULL, TABLE_POSITION_PRICER, TABLE_EARLIEST_STAGE_PRICER) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_PRICER), tableOutputJsonPricer) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_BRANCH) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_BRANCH, TABLE_DESC_BRANCH, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputBranch,
          NULL, TABLE_POSITION_BRANCH, TABLE_EARLIEST_STAGE_BRANCH) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_BRANCH), tableOutputJsonBranch) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_HEUR) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_HEUR, TABLE_DESC_HEUR, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputHeur,
          NULL, TABLE_POSITION_HEUR, TABLE_EARLIEST_STAGE_HEUR) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_HEUR), tableOutputJsonHeur) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_COMPRESSION) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_COMPRESSION, TABLE_DESC_COMPRESSION, TRUE,
@@ -543,6 +1302,7 @@ SCIP_RETCODE SCIPincludeTableDefault(
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_LP, TABLE_DESC_LP, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputLP,
          NULL, TABLE_POSITION_LP, TABLE_EARLIEST_STAGE_LP) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_LP), tableOutputJsonLP) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_NLP) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_NLP, TABLE_DESC_NLP, TRUE,
@@ -558,16 +1318,19 @@ SCIP_RETCODE SCIPincludeTableDefault(
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_TREE, TABLE_DESC_TREE, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputTree,
          NULL, TABLE_POSITION_TREE, TABLE_EARLIEST_STAGE_TREE) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_TREE), tableOutputJsonTree) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_ROOT) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_ROOT, TABLE_DESC_ROOT, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputRoot,
          NULL, TABLE_POSITION_ROOT, TABLE_EARLIEST_STAGE_ROOT) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_ROOT), tableOutputJsonRoot) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_SOL) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_SOL, TABLE_DESC_SOL, TRUE,
          tableCopyDefault, NULL, NULL, NULL, NULL, NULL, tableOutputSol,
          NULL, TABLE_POSITION_SOL, TABLE_EARLIEST_STAGE_SOL) );
+   SCIP_CALL( SCIPsetTableOutputJson(scip, SCIPfindTable(scip, TABLE_NAME_SOL), tableOutputJsonSol) );
 
    assert(SCIPfindTable(scip, TABLE_NAME_CONC) == NULL);
    SCIP_CALL( SCIPincludeTable(scip, TABLE_NAME_CONC, TABLE_DESC_CONC, TRUE,
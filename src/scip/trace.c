@@ -0,0 +1,294 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   trace.c
+ * @ingroup OTHER_CFILES
+ * @brief  methods for tracing the solving process and writing the trace in Chrome trace event format
+ *
+ * If the parameter timing/tracefilename is set, begin and end events of node processing, LP solves, separator,
+ * propagator, and heuristic calls, nonlinear handler enforcement, and the synchronization of concurrent solvers are
+ * recorded in a ring buffer of timing/tracebuffersize events. When solving ends, the buffer is written in the JSON
+ * trace event format of Chrome, which can be opened with chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Every concurrent solver is a SCIP instance of its own and writes its own file with the suffix .<tid>. The time stamps
+ * are microseconds of the monotonic clock of the system, such that the files of all solvers share one time line and can
+ * be merged by concatenating their traceEvents arrays. Reading this clock does not enter the kernel on common systems.
+ *
+ * If the ring buffer overflowed, the end events whose begin event was overwritten are not written, such that every
+ * written end event closes a written begin event.
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "blockmemshell/memory.h"
+#include "scip/pub_message.h"
+#include "scip/pub_misc.h"
+#include "scip/scip_message.h"
+#include "scip/set.h"
+#include "scip/struct_set.h"
+#include "scip/trace.h"
+#include "scip/struct_trace.h"
+
+/** names of the event categories */
+static const char* tracecatnames[] = { "node", "lp", "sepa", "prop", "heur", "nlhdlr", "sync", "user" };
+
+/** returns the time of the monotonic clock of the system in seconds */
+static
+SCIP_Real traceGetTime(
+   void
+   )
+{
+#if defined(_WIN32) || defined(_WIN64)
+   LARGE_INTEGER counter;
+   LARGE_INTEGER frequency;
+
+   (void) QueryPerformanceCounter(&counter);
+   (void) QueryPerformanceFrequency(&frequency);
+
+   return (SCIP_Real)counter.QuadPart / (SCIP_Real)frequency.QuadPart;
+#else
+   struct timespec now;
+
+   (void) clock_gettime(CLOCK_MONOTONIC, &now);
+
+   return (SCIP_Real)now.tv_sec + 1e-9 * (SCIP_Real)now.tv_nsec;
+#endif
+}
+
+/** creates event trace data structure */
+SCIP_RETCODE SCIPtraceCreate(
+   SCIP_TRACE**          trace               /**< pointer to store the event trace */
+   )
+{
+   assert(trace != NULL);
+
+   SCIP_ALLOC( BMSallocMemory(trace) );
+
+   (*trace)->events = NULL;
+   (*trace)->filename = NULL;
+   (*trace)->nevents = 0;
+   (*trace)->size = 0;
+   (*trace)->tid = 0;
+
+   return SCIP_OKAY;
+}
+
+/** frees event trace data structure */
+void SCIPtraceFree(
+   SCIP_TRACE**          trace               /**< pointer to the event trace */
+   )
+{
+   assert(trace != NULL);
+   assert(*trace != NULL);
+   assert((*trace)->events == NULL);
+   assert((*trace)->filename == NULL);
+
+   BMSfreeMemory(trace);
+}
+
+/** allocates the ring buffer if a trace file is given and the trace is not yet active; an active trace is kept, such
+ *  that the events before a restart are not lost
+ */
+SCIP_RETCODE SCIPtraceInit(
+   SCIP_TRACE*           trace,              /**< event trace */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   int                   tid                 /**< thread id of the trace: 0 for the main SCIP, index + 1 for a concurrent
+                                              *   solver, whose trace file gets the suffix .tid */
+   )
+{
+   char filename[SCIP_MAXSTRLEN];
+
+   assert(trace != NULL);
+   assert(set != NULL);
+   assert(set->time_tracefilename != NULL);
+   assert(tid >= 0);
+
+   if( trace->events != NULL )
+      return SCIP_OKAY;
+
+   if( set->time_tracefilename[0] == '-' && set->time_tracefilename[1] == '\0' )
+      return SCIP_OKAY;
+
+   if( tid == 0 )
+      (void) SCIPsnprintf(filename, SCIP_MAXSTRLEN, "%s", set->time_tracefilename);
+   else
+      (void) SCIPsnprintf(filename, SCIP_MAXSTRLEN, "%s.%d", set->time_tracefilename, tid);
+
+   SCIPmessagePrintVerbInfo(messagehdlr, set->disp_verblevel, SCIP_VERBLEVEL_NORMAL,
+      "storing event trace in file <%s>\n", filename);
+
+   SCIP_ALLOC( BMSduplicateMemoryArray(&trace->filename, filename, strlen(filename) + 1) );
+   SCIP_ALLOC( BMSallocMemoryArray(&trace->events, set->time_tracebuffersize) );
+   trace->size = set->time_tracebuffersize;
+   trace->nevents = 0;
+   trace->tid = tid;
+
+   return SCIP_OKAY;
+}
+
+/** writes the recorded events to the trace file and frees the ring buffer */
+void SCIPtraceExit(
+   SCIP_TRACE*           trace,              /**< event trace */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr         /**< message handler */
+   )
+{
+   FILE* file;
+   SCIP_Longint first;
+   SCIP_Longint i;
+   int depth;
+
+   assert(trace != NULL);
+   assert(set != NULL);
+
+   if( trace->events == NULL )
+      return;
+
+   file = fopen(trace->filename, "w");
+   if( file == NULL )
+   {
+      SCIPerrorMessage("error creating file <%s>\n", trace->filename);
+      SCIPprintSysError(trace->filename);
+   }
+   else
+   {
+      /* if the buffer overflowed, the oldest events have been overwritten */
+      first = MAX(trace->nevents - trace->size, 0);
+      if( first > 0 )
+      {
+         SCIPmessagePrintVerbInfo(messagehdlr, set->disp_verblevel, SCIP_VERBLEVEL_NORMAL,
+            "event trace buffer overflowed: only the last %d of %" SCIP_LONGINT_FORMAT " events are written to <%s>\n",
+            trace->size, trace->nevents, trace->filename);
+      }
+
+      fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+      fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", trace->tid);
+      if( trace->tid == 0 )
+         fprintf(file, "\"SCIP\"");
+      else
+         fprintf(file, "\"concurrent solver %d\"", trace->tid - 1);
+      fprintf(file, "}}");
+
+      /* events are nested, so an end event at depth 0 closes a begin event that was overwritten */
+      depth = 0;
+      for( i = first; i < trace->nevents; ++i )
+      {
+         SCIP_TRACEEVENT* event = &trace->events[i % trace->size];
+
+         if( event->begin )
+            ++depth;
+         else if( depth == 0 )
+            continue;
+         else
+            --depth;
+
+         fprintf(file, ",\n{\"name\":");
+         SCIPprintJsonString(set->scip, file, event->name);
+         fprintf(file, ",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}",
+            tracecatnames[event->category], event->begin ? 'B' : 'E', 1e+6 * event->time, trace->tid);
+      }
+      fprintf(file, "\n]}\n");
+
+      fclose(file);
+   }
+
+   BMSfreeMemoryArray(&trace->events);
+   BMSfreeMemoryArray(&trace->filename);
+   trace->nevents = 0;
+   trace->size = 0;
+}
+
+/** records an event in the ring buffer of an enabled trace; use SCIPtraceStart() and SCIPtraceStop() instead */
+void SCIPtraceAddEvent(
+   SCIP_TRACE*           trace,              /**< event trace */
+   SCIP_TRACECAT         category,           /**< category of the event */
+   const char*           name,               /**< name of the event */
+   SCIP_Bool             begin               /**< is this the begin of the event (or its end)? */
+   )
+{
+   SCIP_TRACEEVENT* event;
+
+   assert(trace != NULL);
+   assert(trace->events != NULL);
+   assert(trace->size > 0);
+   assert(name != NULL);
+
+   event = &trace->events[trace->nevents % trace->size];
+   event->name = name;
+   event->time = traceGetTime();
+   event->category = category;
+   event->begin = begin;
+   ++trace->nevents;
+}
+
+/*
+ * simple functions implemented as defines
+ */
+
+/* In debug mode, the following methods are implemented as function calls to ensure
+ * type validity.
+ * In optimized mode, the methods are implemented as defines to improve performance.
+ * However, we want to have them in the library anyways, so we have to undef the defines.
+ */
+
+#undef SCIPtraceStart
+#undef SCIPtraceStop
+#undef SCIPtraceIsEnabled
+
+/** records the begin of an event */
+void SCIPtraceStart(
+   SCIP_TRACE*           trace,              /**< event trace */
+   SCIP_TRACECAT         category,           /**< category of the event */
+   const char*           name                /**< name of the event; must live until the trace is written */
+   )
+{
+   assert(trace != NULL);
+
+   if( trace->events != NULL )
+      SCIPtraceAddEvent(trace, category, name, TRUE);
+}
+
+/** records the end of an event */
+void SCIPtraceStop(
+   SCIP_TRACE*           trace,              /**< event trace */
+   SCIP_TRACECAT         category,           /**< category of the event */
+   const char*           name                /**< name of the event; must live until the trace is written */
+   )
+{
+   assert(trace != NULL);
+
+   if( trace->events != NULL )
+      SCIPtraceAddEvent(trace, category, name, FALSE);
+}
+
+/** returns whether events are recorded */
+SCIP_Bool SCIPtraceIsEnabled(
+   SCIP_TRACE*           trace               /**< event trace */
+   )
+{
+   assert(trace != NULL);
+
+   return trace->events != NULL;
+}
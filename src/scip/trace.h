@@ -0,0 +1,114 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   trace.h
+ * @ingroup INTERNALAPI
+ * @brief  methods for tracing the solving process and writing the trace in Chrome trace event format
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_TRACE_H__
+#define __SCIP_TRACE_H__
+
+
+#include "scip/def.h"
+#include "scip/type_message.h"
+#include "scip/type_retcode.h"
+#include "scip/type_set.h"
+#include "scip/type_trace.h"
+
+#ifdef NDEBUG
+#include "scip/struct_trace.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** creates event trace data structure */
+SCIP_RETCODE SCIPtraceCreate(
+   SCIP_TRACE**          trace               /**< pointer to store the event trace */
+   );
+
+/** frees event trace data structure */
+void SCIPtraceFree(
+   SCIP_TRACE**          trace               /**< pointer to the event trace */
+   );
+
+/** allocates the ring buffer if a trace file is given and the trace is not yet active; an active trace is kept, such
+ *  that the events before a restart are not lost
+ */
+SCIP_RETCODE SCIPtraceInit(
+   SCIP_TRACE*           trace,              /**< event trace */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr,        /**< message handler */
+   int                   tid                 /**< thread id of the trace: 0 for the main SCIP, index + 1 for a concurrent
+                                              *   solver, whose trace file gets the suffix .tid */
+   );
+
+/** writes the recorded events to the trace file and frees the ring buffer */
+void SCIPtraceExit(
+   SCIP_TRACE*           trace,              /**< event trace */
+   SCIP_SET*             set,                /**< global SCIP settings */
+   SCIP_MESSAGEHDLR*     messagehdlr         /**< message handler */
+   );
+
+/** records the begin of an event */
+void SCIPtraceStart(
+   SCIP_TRACE*           trace,              /**< event trace */
+   SCIP_TRACECAT         category,           /**< category of the event */
+   const char*           name                /**< name of the event; must live until the trace is written */
+   );
+
+/** records the end of an event */
+void SCIPtraceStop(
+   SCIP_TRACE*           trace,              /**< event trace */
+   SCIP_TRACECAT         category,           /**< category of the event */
+   const char*           name                /**< name of the event; must live until the trace is written */
+   );
+
+/** returns whether events are recorded */
+SCIP_Bool SCIPtraceIsEnabled(
+   SCIP_TRACE*           trace               /**< event trace */
+   );
+
+#ifdef NDEBUG
+
+/* In optimized mode, the function calls are overwritten by defines to reduce the number of function calls and
+ * speed up the algorithms; a disabled trace then only costs a pointer check.
+ */
+
+#define SCIPtraceStart(trace, category, name) \
+   do { if( (trace)->events != NULL ) SCIPtraceAddEvent(trace, category, name, TRUE); } while( FALSE )
+#define SCIPtraceStop(trace, category, name) \
+   do { if( (trace)->events != NULL ) SCIPtraceAddEvent(trace, category, name, FALSE); } while( FALSE )
+#define SCIPtraceIsEnabled(trace)    ((trace)->events != NULL)
+
+#endif
+
+/** records an event in the ring buffer of an enabled trace; use SCIPtraceStart() and SCIPtraceStop() instead */
+void SCIPtraceAddEvent(
+   SCIP_TRACE*           trace,              /**< event trace */
+   SCIP_TRACECAT         category,           /**< category of the event */
+   const char*           name,               /**< name of the event */
+   SCIP_Bool             begin               /**< is this the begin of the event (or its end)? */
+   );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
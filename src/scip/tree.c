@@ -537,6 +537,10 @@ SCIP_RETCODE forkCreate(
 
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, fork) );
 
+   /* the LPI state is opaque to SCIP; the LP interfaces already store it packed with two bits per column and row.
+    * It is only kept for forks and subroots and freed as soon as the last child referring to it has been processed
+    * (see forkReleaseLPIState()), so leaves do not hold a basis of their own.
+    */
    SCIP_CALL( SCIPlpGetState(lp, blkmem, &((*fork)->lpistate)) );
    (*fork)->lpwasprimfeas = lp->primalfeasible;
    (*fork)->lpwasprimchecked = lp->primalchecked;
@@ -3055,7 +3059,13 @@ void treeFindSwitchForks(
    tree->repropdepth = INT_MAX;
 }
 
-/** switches the active path to the new focus node, applies domain and constraint set changes */
+/** switches the active path to the new focus node, applies domain and constraint set changes
+ *
+ *  Only the nodes below the common fork (determined once by treeFindSwitchForks()) are deactivated and activated.
+ *  The bound changes are undone and replayed node by node, since nodes may be repropagated or cut off on the way and
+ *  constraint set changes have to be applied in order; the resulting bound change events are delayed, so that
+ *  changes cancelling each other out are merged before any event handler sees them.
+ */
 static
 SCIP_RETCODE treeSwitchPath(
    SCIP_TREE*            tree,               /**< branch and bound tree */
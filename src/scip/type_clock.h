@@ -33,13 +33,15 @@ enum SCIP_ClockType
 {
    SCIP_CLOCKTYPE_DEFAULT = 0,          /**< use default clock type */
    SCIP_CLOCKTYPE_CPU     = 1,          /**< use CPU clock */
-   SCIP_CLOCKTYPE_WALL    = 2           /**< use wall clock */
+   SCIP_CLOCKTYPE_WALL    = 2,          /**< use wall clock */
+   SCIP_CLOCKTYPE_TSC     = 3           /**< use wall clock based on the time stamp counter of the CPU, if available */
 };
 typedef enum SCIP_ClockType SCIP_CLOCKTYPE;       /**< clock type to use */
 
 typedef struct SCIP_Clock SCIP_CLOCK;             /**< clock timer */
 typedef struct SCIP_CPUClock SCIP_CPUCLOCK;       /**< CPU clock counter */
 typedef struct SCIP_WallClock SCIP_WALLCLOCK;     /**< wall clock counter */
+typedef struct SCIP_TscClock SCIP_TSCCLOCK;       /**< time stamp counter clock */
 
 #ifdef __cplusplus
 }
@@ -931,6 +931,40 @@ typedef struct SCIP_ConsExpr_ExprEnfo SCIP_CONSEXPR_EXPRENFO;        /**< expres
    SCIP_Bool addbranchscores, \
    SCIP_Bool* addedbranchscores)
 
+/** nonlinear handler batch under/overestimation callback
+ *
+ * The method computes linear under- or overestimators at several given points at once.
+ * It is an optional addition to the estimator callback that allows a nonlinear handler to do work that does
+ * not depend on the point, e.g., collecting variables and coefficients, only once for all points.
+ * In difference to the estimator callback, the value of the expression w.r.t. auxiliary variables is not passed,
+ * that is, the callback needs to evaluate in each point itself, and no branching scores are added.
+ * For each point, at most one estimator is computed. If successful for point k, it shall be stored in rowpreps[k]
+ * and rowprep->local be set accordingly. Otherwise, rowpreps[k] shall be set to NULL.
+ *
+ * input:
+ *  - scip : SCIP main data structure
+ *  - conshdlr : constraint handler
+ *  - nlhdlr : nonlinear handler
+ *  - expr : expression
+ *  - nlhdlrexprdata : expression data of nonlinear handler
+ *  - sols : points at which to estimate (entries can be NULL for the LP solution)
+ *  - nsols : number of points
+ *  - overestimate : whether the expression needs to be over- or underestimated
+ *  - targetvalues : values the estimators shall exceed, or NULL if any estimator will be accepted
+ *  - rowpreps : array of length nsols to store the estimators
+ */
+#define SCIP_DECL_CONSEXPR_NLHDLRESTIMATEBATCH(x) SCIP_RETCODE x (\
+   SCIP* scip, \
+   SCIP_CONSHDLR* conshdlr, \
+   SCIP_CONSEXPR_NLHDLR* nlhdlr, \
+   SCIP_CONSEXPR_EXPR* expr, \
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata, \
+   SCIP_SOL** sols, \
+   int nsols, \
+   SCIP_Bool overestimate, \
+   SCIP_Real* targetvalues, \
+   SCIP_ROWPREP** rowpreps)
+
 typedef struct SCIP_ConsExpr_Nlhdlr         SCIP_CONSEXPR_NLHDLR;          /**< nonlinear handler */
 typedef struct SCIP_ConsExpr_NlhdlrData     SCIP_CONSEXPR_NLHDLRDATA;      /**< nonlinear handler data */
 typedef struct SCIP_ConsExpr_NlhdlrExprData SCIP_CONSEXPR_NLHDLREXPRDATA;  /**< nonlinear handler data for a specific expression */
@@ -949,6 +983,8 @@ typedef struct SCIP_ConsExpr_NlhdlrExprData SCIP_CONSEXPR_NLHDLREXPRDATA;  /**<
  */
 #define SCIP_DECL_VERTEXPOLYFUN(f) SCIP_Real f (SCIP_Real* args, int nargs, void* funcdata)
 
+typedef struct SCIP_VertexPolyWarmstart SCIP_VERTEXPOLYWARMSTART; /**< data to warm start the facet computation for one vertex-polyhedral function */
+
 /** maximum dimension of vertex-polyhedral function for which we can try to compute a facet of its convex or concave envelope */
 #define SCIP_MAXVERTEXPOLYDIM 14
 
@@ -980,6 +1016,8 @@ struct SCIP_RowPrep
 };
 typedef struct SCIP_RowPrep SCIP_ROWPREP;
 
+typedef struct SCIP_RowPrepPool SCIP_ROWPREPPOOL; /**< pool of rowpreps that can be reused */
+
 #ifdef __cplusplus
 }
 #endif
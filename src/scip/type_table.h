@@ -112,6 +112,18 @@ typedef struct SCIP_TableData SCIP_TABLEDATA; /**< statistics table specific dat
  */
 #define SCIP_DECL_TABLEOUTPUT(x) SCIP_RETCODE x (SCIP* scip, SCIP_TABLE* table, FILE* file)
 
+/** JSON output method of statistics table to output file stream 'file'
+ *
+ *  The method has to print exactly one JSON value, usually an object with the entries of the table. Tables without
+ *  this method appear in the JSON statistics with their text output.
+ *
+ *  input:
+ *  - scip            : SCIP main data structure
+ *  - table           : the statistics table itself
+ *  - file            : file stream for output
+ */
+#define SCIP_DECL_TABLEOUTPUTJSON(x) SCIP_RETCODE x (SCIP* scip, SCIP_TABLE* table, FILE* file)
+
 #ifdef __cplusplus
 }
 #endif
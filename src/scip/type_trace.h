@@ -0,0 +1,50 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scipopt.org.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   type_trace.h
+ * @brief  type definitions for event tracing of the solving process
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#ifndef __SCIP_TYPE_TRACE_H__
+#define __SCIP_TYPE_TRACE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** categories of traced events; they are shown as the "cat" field in the trace viewer */
+enum SCIP_TraceCat
+{
+   SCIP_TRACECAT_NODE   = 0,            /**< processing of a branch-and-bound node */
+   SCIP_TRACECAT_LP     = 1,            /**< solving of an LP */
+   SCIP_TRACECAT_SEPA   = 2,            /**< call of a separator */
+   SCIP_TRACECAT_PROP   = 3,            /**< call of a propagator */
+   SCIP_TRACECAT_HEUR   = 4,            /**< call of a primal heuristic */
+   SCIP_TRACECAT_NLHDLR = 5,            /**< enforcement by a nonlinear handler */
+   SCIP_TRACECAT_SYNC   = 6,            /**< synchronization of concurrent solvers */
+   SCIP_TRACECAT_USER   = 7             /**< event traced by a user plugin */
+};
+typedef enum SCIP_TraceCat SCIP_TRACECAT;
+
+typedef struct SCIP_TraceEvent SCIP_TRACEEVENT; /**< single begin or end event in a trace */
+typedef struct SCIP_Trace SCIP_TRACE;        /**< event trace data structure */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -16145,23 +16145,39 @@ SCIP_RETCODE SCIPbdchginfoCreate(
    assert(bdchginfo != NULL);
 
    SCIP_ALLOC( BMSallocBlockMemory(blkmem, bdchginfo) );
-   (*bdchginfo)->oldbound = oldbound;
-   (*bdchginfo)->newbound = newbound;
-   (*bdchginfo)->var = var;
-   (*bdchginfo)->inferencedata.var = var;
-   (*bdchginfo)->inferencedata.reason.prop = NULL;
-   (*bdchginfo)->inferencedata.info = 0;
-   (*bdchginfo)->bdchgidx.depth = INT_MAX;
-   (*bdchginfo)->bdchgidx.pos = -1;
-   (*bdchginfo)->pos = 0;
-   (*bdchginfo)->boundchgtype = SCIP_BOUNDCHGTYPE_BRANCHING; /*lint !e641*/
-   (*bdchginfo)->boundtype = boundtype; /*lint !e641*/
-   (*bdchginfo)->inferboundtype = boundtype; /*lint !e641*/
-   (*bdchginfo)->redundant = FALSE;
+   SCIPbdchginfoInit(*bdchginfo, var, boundtype, oldbound, newbound);
 
    return SCIP_OKAY;
 }
 
+/** initializes an already allocated bound change information object as artificial object with depth = INT_MAX and
+ *  pos = -1
+ */
+void SCIPbdchginfoInit(
+   SCIP_BDCHGINFO*       bdchginfo,          /**< bound change information */
+   SCIP_VAR*             var,                /**< active variable that changed the bounds */
+   SCIP_BOUNDTYPE        boundtype,          /**< type of bound for var: lower or upper bound */
+   SCIP_Real             oldbound,           /**< old value for bound */
+   SCIP_Real             newbound            /**< new value for bound */
+   )
+{
+   assert(bdchginfo != NULL);
+
+   bdchginfo->oldbound = oldbound;
+   bdchginfo->newbound = newbound;
+   bdchginfo->var = var;
+   bdchginfo->inferencedata.var = var;
+   bdchginfo->inferencedata.reason.prop = NULL;
+   bdchginfo->inferencedata.info = 0;
+   bdchginfo->bdchgidx.depth = INT_MAX;
+   bdchginfo->bdchgidx.pos = -1;
+   bdchginfo->pos = 0;
+   bdchginfo->boundchgtype = SCIP_BOUNDCHGTYPE_BRANCHING; /*lint !e641*/
+   bdchginfo->boundtype = boundtype; /*lint !e641*/
+   bdchginfo->inferboundtype = boundtype; /*lint !e641*/
+   bdchginfo->redundant = FALSE;
+}
+
 /** frees a bound change information object */
 void SCIPbdchginfoFree(
    SCIP_BDCHGINFO**      bdchginfo,          /**< pointer to store bound change information */
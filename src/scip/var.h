@@ -181,6 +181,17 @@ SCIP_RETCODE SCIPbdchginfoCreate(
    SCIP_Real             newbound            /**< new value for bound */
    );
 
+/** initializes an already allocated bound change information object as artificial object with depth = INT_MAX and
+ *  pos = -1
+ */
+void SCIPbdchginfoInit(
+   SCIP_BDCHGINFO*       bdchginfo,          /**< bound change information */
+   SCIP_VAR*             var,                /**< active variable that changed the bounds */
+   SCIP_BOUNDTYPE        boundtype,          /**< type of bound for var: lower or upper bound */
+   SCIP_Real             oldbound,           /**< old value for bound */
+   SCIP_Real             newbound            /**< new value for bound */
+   );
+
 /** frees a bound change information object */
 void SCIPbdchginfoFree(
    SCIP_BDCHGINFO**      bdchginfo,          /**< pointer to store bound change information */
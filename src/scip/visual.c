@@ -31,6 +31,7 @@
 /*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
 
 #include <stdio.h>
+#include <stdarg.h>
 #include <assert.h>
 
 #include "blockmemshell/memory.h"
@@ -43,6 +44,11 @@
 #include "scip/visual.h"
 #include "scip/struct_visual.h"
 
+/** size of the buffers in which the visualization output is collected before it is written to the files; the output
+ *  of the default message handler is flushed after every message, which otherwise costs one system call per event
+ */
+#define VISUAL_BUFFERSIZE  65536
+
 
 /** returns the branching variable of the node, or NULL */
 static
@@ -72,6 +78,85 @@ void getBranchInfo(
    (*boundtype) = (SCIP_BOUNDTYPE) domchgbound->boundchgs[0].boundtype;
 }
 
+/** writes the collected output of the given visualization file and empties its buffer */
+static
+void visualFlush(
+   SCIP_VISUAL*          visual,             /**< visualization information */
+   FILE*                 file                /**< visualization file (VBC or BAK) */
+   )
+{
+   char* buffer;
+   int* bufferlen;
+
+   assert( visual != NULL );
+   assert( file != NULL );
+   assert( file == visual->vbcfile || file == visual->bakfile );
+
+   buffer = (file == visual->vbcfile) ? visual->vbcbuffer : visual->bakbuffer;
+   bufferlen = (file == visual->vbcfile) ? &visual->vbcbufferlen : &visual->bakbufferlen;
+
+   if ( *bufferlen > 0 )
+   {
+      SCIPmessageFPrintInfo(visual->messagehdlr, file, "%s", buffer);
+      *bufferlen = 0;
+      buffer[0] = '\0';
+   }
+}
+
+/** appends formatted output to the buffer of the given visualization file, which is written when it is full */
+static
+void visualPrintf(
+   SCIP_VISUAL*          visual,             /**< visualization information */
+   FILE*                 file,               /**< visualization file (VBC or BAK) */
+   const char*           formatstr,          /**< format string like in printf() function */
+   ...                                       /**< format arguments like in printf() function */
+   )
+{
+   va_list ap;
+   char* buffer;
+   int* bufferlen;
+   int n;
+
+   assert( visual != NULL );
+   assert( file != NULL );
+   assert( file == visual->vbcfile || file == visual->bakfile );
+
+   buffer = (file == visual->vbcfile) ? visual->vbcbuffer : visual->bakbuffer;
+   bufferlen = (file == visual->vbcfile) ? &visual->vbcbufferlen : &visual->bakbufferlen;
+   assert( buffer != NULL );
+   assert( 0 <= *bufferlen && *bufferlen < VISUAL_BUFFERSIZE );
+
+   va_start(ap, formatstr); /*lint !e838*/
+   n = vsnprintf(buffer + *bufferlen, (size_t) (VISUAL_BUFFERSIZE - *bufferlen), formatstr, ap);
+   va_end(ap);
+
+   if ( n < 0 )
+   {
+      buffer[*bufferlen] = '\0';
+      return;
+   }
+
+   if ( n < VISUAL_BUFFERSIZE - *bufferlen )
+   {
+      *bufferlen += n;
+      return;
+   }
+
+   /* the output did not fit: drop the truncated part, write the buffer and retry in the empty buffer */
+   buffer[*bufferlen] = '\0';
+   visualFlush(visual, file);
+
+   va_start(ap, formatstr); /*lint !e838*/
+   if ( n < VISUAL_BUFFERSIZE )
+   {
+      (void) vsnprintf(buffer, (size_t) VISUAL_BUFFERSIZE, formatstr, ap);
+      *bufferlen = n;
+   }
+   else
+      SCIPmessageVFPrintInfo(visual->messagehdlr, file, formatstr, ap);
+   va_end(ap);
+}
+
 /** creates visualization data structure */
 SCIP_RETCODE SCIPvisualCreate(
    SCIP_VISUAL**         visual,             /**< pointer to store visualization information */
@@ -82,6 +167,10 @@ SCIP_RETCODE SCIPvisualCreate(
 
    (*visual)->vbcfile = NULL;
    (*visual)->bakfile = NULL;
+   (*visual)->vbcbuffer = NULL;
+   (*visual)->bakbuffer = NULL;
+   (*visual)->vbcbufferlen = 0;
+   (*visual)->bakbufferlen = 0;
    (*visual)->messagehdlr = messagehdlr;
    (*visual)->nodenum = NULL;
    (*visual)->timestep = 0;
@@ -102,6 +191,8 @@ void SCIPvisualFree(
    assert( *visual != NULL );
    assert( (*visual)->vbcfile == NULL );
    assert( (*visual)->bakfile == NULL );
+   assert( (*visual)->vbcbuffer == NULL );
+   assert( (*visual)->bakbuffer == NULL );
    assert( (*visual)->nodenum == NULL );
 
    BMSfreeMemory(visual);
@@ -141,11 +232,15 @@ SCIP_RETCODE SCIPvisualInit(
          return SCIP_FILECREATEERROR;
       }
 
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "#TYPE: COMPLETE TREE\n");
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "#TIME: SET\n");
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "#BOUNDS: SET\n");
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "#INFORMATION: STANDARD\n");
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "#NODE_NUMBER: NONE\n");
+      SCIP_ALLOC( BMSallocMemoryArray(&visual->vbcbuffer, VISUAL_BUFFERSIZE) );
+      visual->vbcbuffer[0] = '\0';
+      visual->vbcbufferlen = 0;
+
+      visualPrintf(visual, visual->vbcfile, "#TYPE: COMPLETE TREE\n");
+      visualPrintf(visual, visual->vbcfile, "#TIME: SET\n");
+      visualPrintf(visual, visual->vbcfile, "#BOUNDS: SET\n");
+      visualPrintf(visual, visual->vbcfile, "#INFORMATION: STANDARD\n");
+      visualPrintf(visual, visual->vbcfile, "#NODE_NUMBER: NONE\n");
    }
 
    /* check whether we should initialize BAK output */
@@ -165,6 +260,10 @@ SCIP_RETCODE SCIPvisualInit(
          SCIPprintSysError(set->visual_bakfilename);
          return SCIP_FILECREATEERROR;
       }
+
+      SCIP_ALLOC( BMSallocMemoryArray(&visual->bakbuffer, VISUAL_BUFFERSIZE) );
+      visual->bakbuffer[0] = '\0';
+      visual->bakbufferlen = 0;
    }
 
    /* possibly init hashmap for nodes */
@@ -190,6 +289,8 @@ void SCIPvisualExit(
    {
       SCIPmessagePrintVerbInfo(messagehdlr, set->disp_verblevel, SCIP_VERBLEVEL_FULL, "closing VBC information file\n");
 
+      visualFlush(visual, visual->vbcfile);
+      BMSfreeMemoryArray(&visual->vbcbuffer);
       fclose(visual->vbcfile);
       visual->vbcfile = NULL;
    }
@@ -198,6 +299,8 @@ void SCIPvisualExit(
    {
       SCIPmessagePrintVerbInfo(messagehdlr, set->disp_verblevel, SCIP_VERBLEVEL_FULL, "closing BAK information file\n");
 
+      visualFlush(visual, visual->bakfile);
+      BMSfreeMemoryArray(&visual->bakbuffer);
       fclose(visual->bakfile);
       visual->bakfile = NULL;
    }
@@ -245,11 +348,11 @@ void printTime(
       step %= 100;
       hunds = (int)step;
 
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "%02d:%02d:%02d.%02d ", hours, mins, secs, hunds);
+      visualPrintf(visual, visual->vbcfile, "%02d:%02d:%02d.%02d ", hours, mins, secs, hunds);
    }
    else
    {
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->bakfile, "%f ", (SCIP_Real) step/100.0);
+      visualPrintf(visual, visual->bakfile, "%f ", (SCIP_Real) step/100.0);
    }
 }
 
@@ -307,18 +410,18 @@ SCIP_RETCODE SCIPvisualNewChild(
    if ( visual->vbcfile != NULL )
    {
       printTime(visual, stat, TRUE);
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "N %d %d %d\n", parentnodenum, nodenum, SCIP_VBCCOLOR_UNSOLVED);
+      visualPrintf(visual, visual->vbcfile, "N %d %d %d\n", parentnodenum, nodenum, SCIP_VBCCOLOR_UNSOLVED);
       printTime(visual, stat, TRUE);
       if( branchvar != NULL )
       {
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t%s [%g,%g] %s %f\\nbound:\\t%f\n",
+         visualPrintf(visual, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t%s [%g,%g] %s %f\\nbound:\\t%f\n",
             (int)nodenum, (int)nodenum, node, SCIPnodeGetDepth(node),
             SCIPvarGetName(branchvar), SCIPvarGetLbLocal(branchvar), SCIPvarGetUbLocal(branchvar),
             branchtype == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=",  branchbound, lowerbound);
       }
       else
       {
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t-\\nbound:\\t%f\n",
+         visualPrintf(visual, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t-\\nbound:\\t%f\n",
             (int)nodenum, (int)nodenum, node, SCIPnodeGetDepth(node), lowerbound);
       }
    }
@@ -372,14 +475,14 @@ SCIP_RETCODE SCIPvisualUpdateChild(
       printTime(visual, stat, TRUE);
       if( branchvar != NULL )
       {
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t%s [%g,%g] %s %f\\nbound:\\t%f\n",
+         visualPrintf(visual, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t%s [%g,%g] %s %f\\nbound:\\t%f\n",
             (int)nodenum, (int)nodenum, node, SCIPnodeGetDepth(node),
             SCIPvarGetName(branchvar), SCIPvarGetLbLocal(branchvar), SCIPvarGetUbLocal(branchvar),
             branchtype == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=",  branchbound, lowerbound);
       }
       else
       {
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t-\\nbound:\\t%f\n",
+         visualPrintf(visual, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t-\\nbound:\\t%f\n",
             (int)nodenum, (int)nodenum, node, SCIPnodeGetDepth(node), lowerbound);
       }
    }
@@ -428,7 +531,7 @@ SCIP_RETCODE SCIPvisualUpdateChild(
       } /*lint !e788*/
       /* append new status line with updated node information to the bakfile */
       printTime(visual, stat, FALSE);
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->bakfile, "%s %d %d %c %f %f %d\n", nodeinfo, (int)nodenum, (int)parentnodenum, t,
+      visualPrintf(visual, visual->bakfile, "%s %d %d %c %f %f %d\n", nodeinfo, (int)nodenum, (int)parentnodenum, t,
             lowerbound, sum, nlpcands);
    }
 
@@ -454,7 +557,7 @@ void vbcSetColor(
       nodenum = SCIPhashmapGetImageInt(visual->nodenum, node);
       assert(nodenum > 0);
       printTime(visual, stat, TRUE);
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "P %d %d\n", (int)nodenum, color);
+      visualPrintf(visual, visual->vbcfile, "P %d %d\n", (int)nodenum, color);
       visual->lastnode = node;
       visual->lastcolor = color;
    }
@@ -504,14 +607,14 @@ void SCIPvisualSolvedNode(
       printTime(visual, stat, TRUE);
       if( branchvar != NULL )
       {
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t%s [%g,%g] %s %f\\nbound:\\t%f\\nnr:\\t%" SCIP_LONGINT_FORMAT "\n",
+         visualPrintf(visual, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t%s [%g,%g] %s %f\\nbound:\\t%f\\nnr:\\t%" SCIP_LONGINT_FORMAT "\n",
             (int)nodenum, (int)nodenum, node, SCIPnodeGetDepth(node),
             SCIPvarGetName(branchvar),  SCIPvarGetLbLocal(branchvar), SCIPvarGetUbLocal(branchvar),
             branchtype == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=",  branchbound, lowerbound, stat->nnodes);
       }
       else
       {
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t-\\nbound:\\t%f\\nnr:\\t%" SCIP_LONGINT_FORMAT "\n",
+         visualPrintf(visual, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t-\\nbound:\\t%f\\nnr:\\t%" SCIP_LONGINT_FORMAT "\n",
             (int)nodenum, (int)nodenum, node, SCIPnodeGetDepth(node), lowerbound, stat->nnodes);
       }
       vbcSetColor(visual, stat, node, SCIP_VBCCOLOR_SOLVED);
@@ -565,14 +668,14 @@ void SCIPvisualCutoffNode(
       printTime(visual, stat, TRUE);
       if( branchvar != NULL )
       {
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t%s [%g,%g] %s %f\\nbound:\\t%f\\nnr:\\t%" SCIP_LONGINT_FORMAT "\n",
+         visualPrintf(visual, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t%s [%g,%g] %s %f\\nbound:\\t%f\\nnr:\\t%" SCIP_LONGINT_FORMAT "\n",
             (int)nodenum, (int)nodenum, node, SCIPnodeGetDepth(node),
             SCIPvarGetName(branchvar),  SCIPvarGetLbLocal(branchvar), SCIPvarGetUbLocal(branchvar),
             branchtype == SCIP_BOUNDTYPE_LOWER ? ">=" : "<=",  branchbound, lowerbound, stat->nnodes);
       }
       else
       {
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t-\\nbound:\\t%f\\nnr:\\t%" SCIP_LONGINT_FORMAT "\n",
+         visualPrintf(visual, visual->vbcfile, "I %d \\inode:\\t%d (%p)\\idepth:\\t%d\\nvar:\\t-\\nbound:\\t%f\\nnr:\\t%" SCIP_LONGINT_FORMAT "\n",
             (int)nodenum, (int)nodenum, node, SCIPnodeGetDepth(node), lowerbound, stat->nnodes);
       }
       vbcSetColor(visual, stat, node, SCIP_VBCCOLOR_CUTOFF);
@@ -593,9 +696,9 @@ void SCIPvisualCutoffNode(
 
       printTime(visual, stat, FALSE);
       if ( infeasible )
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->bakfile, "infeasible %d %d %c\n", nodenum, parentnodenum, t);
+         visualPrintf(visual, visual->bakfile, "infeasible %d %d %c\n", nodenum, parentnodenum, t);
       else
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->bakfile, "fathomed %d %d %c\n", nodenum, parentnodenum, t);
+         visualPrintf(visual, visual->bakfile, "fathomed %d %d %c\n", nodenum, parentnodenum, t);
    }
 }
 
@@ -693,10 +796,10 @@ void SCIPvisualFoundSolution(
       if( bettersol )
       {
          /* note that this output is in addition to the one by SCIPvisualUpperbound() */
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "A %d \\nfound better solution: %f\n", (int)nodenum, obj);
+         visualPrintf(visual, visual->vbcfile, "A %d \\nfound better solution: %f\n", (int)nodenum, obj);
       }
       else
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "A %d \\nfound solution: %f\n", (int)nodenum, obj);
+         visualPrintf(visual, visual->vbcfile, "A %d \\nfound solution: %f\n", (int)nodenum, obj);
 
       vbcSetColor(visual, stat, node, SCIP_VBCCOLOR_SOLUTION);
    }
@@ -744,13 +847,13 @@ void SCIPvisualFoundSolution(
                t = (branchtype == SCIP_BOUNDTYPE_LOWER ? 'R' : 'L');
 
             printTime(visual, stat, FALSE);
-            SCIPmessageFPrintInfo(visual->messagehdlr, visual->bakfile, "integer %d %d %c %f\n", nodenum, parentnodenum, t, obj);
+            visualPrintf(visual, visual->bakfile, "integer %d %d %c %f\n", nodenum, parentnodenum, t, obj);
          }
       }  /*lint !e438*/
       else
       {
          printTime(visual, stat, FALSE);
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->bakfile, "heuristic %f\n", obj);
+         visualPrintf(visual, visual->bakfile, "heuristic %f\n", obj);
       }
    }
 }
@@ -784,9 +887,9 @@ void SCIPvisualLowerbound(
 
       printTime(visual, stat, TRUE);
       if( SCIPgetObjsense(set->scip) == SCIP_OBJSENSE_MINIMIZE )
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "L %f\n", lowerbound);
+         visualPrintf(visual, visual->vbcfile, "L %f\n", lowerbound);
       else
-         SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "U %f\n", lowerbound);
+         visualPrintf(visual, visual->vbcfile, "U %f\n", lowerbound);
    }
 
    /* do nothing for BAK */
@@ -812,9 +915,9 @@ void SCIPvisualUpperbound(
 
    printTime(visual, stat, TRUE);
    if( SCIPgetObjsense(set->scip) == SCIP_OBJSENSE_MINIMIZE )
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "U %f\n", upperbound);
+      visualPrintf(visual, visual->vbcfile, "U %f\n", upperbound);
    else
-      SCIPmessageFPrintInfo(visual->messagehdlr, visual->vbcfile, "L %f\n", upperbound);
+      visualPrintf(visual, visual->vbcfile, "L %f\n", upperbound);
 
    /* do nothing for BAK */
 }
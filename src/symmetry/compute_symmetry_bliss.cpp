@@ -964,7 +964,13 @@ const char* SYMsymmetryGetDesc(void)
    return "Computing Graph Automorphism Groups by T. Junttila and P. Kaski (http://www.tcs.hut.fi/Software/bliss/)";
 }
 
-/** compute generators of symmetry group */
+/** compute generators of symmetry group
+ *
+ *  @note The graph is built through bliss' own vertex and edge interface, since bliss keeps its adjacency lists in its
+ *        internal vertex structures; assembling a separate compressed representation first would only add a copy.
+ *        Other automorphism backends can be added as further implementations of compute_symmetry.h, selected at
+ *        build time like compute_symmetry_none.cpp.
+ */
 SCIP_RETCODE SYMcomputeSymmetryGenerators(
    SCIP*                 scip,               /**< SCIP pointer */
    int                   maxgenerators,      /**< maximal number of generators constructed (= 0 if unlimited) */
@@ -48,7 +48,13 @@ struct SCIP_JobQueue
 };
 typedef struct SCIP_JobQueue SCIP_JOBQUEUE;
 
-/** The thread pool */
+/** The thread pool
+ *
+ *  All jobs share a single FIFO queue that is protected by the pool lock.  The only client in SCIP is the concurrent
+ *  solver (see concurrent.c), which submits one job per concurrent solver and waits for all of them.  So the queue
+ *  holds at most as many jobs as there are threads, and each job runs for the whole solve, which makes contention on
+ *  the lock negligible.  Per-thread queues with work stealing would only pay off for many short jobs.
+ */
 struct SCIP_ThreadPool
 {
    /* Pool Characteristics */
@@ -977,7 +977,8 @@ void procPcdata(
    {
       if ( len + 1 >= size ) /* leave space for terminating '\0' */
       {
-         size += DATA_EXT_SIZE;
+         /* grow geometrically, such that long data sections are not copied over and over again */
+         size = (size == 0) ? DATA_EXT_SIZE : 2 * size;
 
          if ( data == NULL )
          {
@@ -1025,13 +1026,16 @@ void procPcdata(
          }
          else
          {
-            BMSduplicateMemoryArray(&node->data, data, strlen(data)+1);
+            /* hand the data over to the node instead of copying it; shrink it to its actual length first */
+            ALLOC_ABORT( BMSreallocMemoryArray(&data, len + 1) );
+            node->data = data;
+            data = NULL;
             xmlAppendChild(topPstack(ppos), node);
             ppos->state = XML_STATE_BEFORE;
          }
       }
 
-      BMSfreeMemoryArray(&data);
+      BMSfreeMemoryArrayNull(&data);
    }
 }
 
@@ -0,0 +1,658 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scip.zib.de.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   microbench.c
+ * @brief  micro-benchmarks for core kernels of SCIP
+ *
+ * Times single kernels on problems created by fixed-seed random generators, so that the results are comparable across
+ * commits:
+ * - SCIPsortIntReal() and hash map insertion, lookup, and removal,
+ * - SCIPevalConsExprExpr(), forward propagation by SCIPevalConsExprExprActivity(), and forward and reverse
+ *   propagation of an expression constraint by SCIPpropCons() on a random sum of nonlinear terms (in presolving),
+ * - SCIPcalcMIR(), SCIPselectCuts(), and cut pool separation on the LP of a random MIP (in a separator at the root
+ *   node).
+ *
+ * Only the public API is used, such that the program can be linked against any build of the library.
+ *
+ * The cut kernels need a solved root LP and are therefore out of scope for builds without an LP solver (LPS=none):
+ * they are reported as not run, and the name of the LP solver is written to the results. The results are written in
+ * JSON format to the standard output or to the file given with -o.
+ *
+ * Usage: microbench [-n size] [-r repetitions] [-s seed] [-o jsonfile]
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "scip/scip.h"
+#include "scip/scipdefplugins.h"
+#include "scip/cons_expr.h"
+#include "lpi/lpi.h"
+
+#define DEFAULT_SIZE             10000   /**< default problem size (number of sorted elements, hash map entries, ...) */
+#define DEFAULT_REPETITIONS         20   /**< default number of repetitions of each kernel */
+#define DEFAULT_SEED                 0   /**< default seed of the problem generators */
+
+#define SEPA_NAME          "microbench"
+#define SEPA_DESC          "separator that times cut kernels on the root LP"
+
+/** kernels that are timed */
+enum Kernel
+{
+   KERNEL_SORTINTREAL   = 0,
+   KERNEL_HASHMAP       = 1,
+   KERNEL_EXPREVAL      = 2,
+   KERNEL_ACTIVITY      = 3,
+   KERNEL_PROPCONS      = 4,
+   KERNEL_CALCMIR       = 5,
+   KERNEL_SELECTCUTS    = 6,
+   KERNEL_CUTPOOL       = 7
+};
+typedef enum Kernel KERNEL;
+
+#define NKERNELS 8
+
+/** names of the kernels in the JSON output */
+static const char* kernelnames[NKERNELS] = { "SCIPsortIntReal", "hashmap", "SCIPevalConsExprExpr",
+   "SCIPevalConsExprExprActivity", "SCIPpropCons", "SCIPcalcMIR", "SCIPselectCuts", "SCIPseparateCutpool" };
+
+/** benchmark data */
+struct BenchData
+{
+   SCIP_Real             times[NKERNELS];    /**< total time spent in each kernel */
+   SCIP_Longint          ncalls[NKERNELS];   /**< number of calls of each kernel */
+   SCIP_Bool             run[NKERNELS];      /**< whether each kernel has been run */
+   int                   size;               /**< problem size */
+   int                   nrepetitions;       /**< number of repetitions of each kernel */
+   unsigned int          seed;               /**< seed of the problem generators */
+};
+typedef struct BenchData BENCHDATA;
+
+/** starts a new measurement */
+static
+SCIP_RETCODE startMeasurement(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CLOCK*           clock               /**< clock to use */
+   )
+{
+   SCIP_CALL( SCIPresetClock(scip, clock) );
+   SCIP_CALL( SCIPstartClock(scip, clock) );
+
+   return SCIP_OKAY;
+}
+
+/** stops a measurement and adds it to the given kernel */
+static
+SCIP_RETCODE stopMeasurement(
+   SCIP*                 scip,               /**< SCIP data structure */
+   SCIP_CLOCK*           clock,              /**< clock to use */
+   BENCHDATA*            benchdata,          /**< benchmark data */
+   KERNEL                kernel,             /**< kernel that has been measured */
+   SCIP_Longint          ncalls              /**< number of calls of the kernel in the measurement */
+   )
+{
+   SCIP_CALL( SCIPstopClock(scip, clock) );
+
+   benchdata->times[kernel] += SCIPgetClockTime(scip, clock);
+   benchdata->ncalls[kernel] += ncalls;
+   benchdata->run[kernel] = TRUE;
+
+   return SCIP_OKAY;
+}
+
+/** times sorting and hash map operations on random integers */
+static
+SCIP_RETCODE benchSortAndHash(
+   SCIP*                 scip,               /**< SCIP data structure */
+   BENCHDATA*            benchdata           /**< benchmark data */
+   )
+{
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_HASHMAP* hashmap;
+   SCIP_CLOCK* clock;
+   SCIP_Real* reals;
+   int* ints;
+   int n;
+   int r;
+   int i;
+
+   n = benchdata->size;
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, benchdata->seed, TRUE) );
+   SCIP_CALL( SCIPcreateClock(scip, &clock) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &ints, n) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &reals, n) );
+
+   for( r = 0; r < benchdata->nrepetitions; ++r )
+   {
+      for( i = 0; i < n; ++i )
+      {
+         ints[i] = SCIPrandomGetInt(randnumgen, 0, INT_MAX - 1);
+         reals[i] = SCIPrandomGetReal(randnumgen, -1.0, 1.0);
+      }
+
+      SCIP_CALL( startMeasurement(scip, clock) );
+      SCIPsortIntReal(ints, reals, n);
+      SCIP_CALL( stopMeasurement(scip, clock, benchdata, KERNEL_SORTINTREAL, 1LL) );
+
+      /* use the random integers as keys in random order; 0 is not a valid key */
+      SCIPrandomPermuteIntArray(randnumgen, ints, 0, n);
+
+      SCIP_CALL( startMeasurement(scip, clock) );
+      SCIP_CALL( SCIPhashmapCreate(&hashmap, SCIPblkmem(scip), n) );
+      for( i = 0; i < n; ++i )
+      {
+         SCIP_CALL( SCIPhashmapSetImageInt(hashmap, (void*)(size_t)(ints[i] + 1), i) );
+      }
+      for( i = 0; i < n; ++i )
+      {
+         if( SCIPhashmapGetImageInt(hashmap, (void*)(size_t)(ints[n - 1 - i] + 1)) == INT_MAX )
+            return SCIP_ERROR;
+      }
+      for( i = 0; i < n; ++i )
+      {
+         SCIP_CALL( SCIPhashmapRemove(hashmap, (void*)(size_t)(ints[i] + 1)) );
+      }
+      SCIPhashmapFree(&hashmap);
+      SCIP_CALL( stopMeasurement(scip, clock, benchdata, KERNEL_HASHMAP, 3LL * n) );
+   }
+
+   SCIPfreeBufferArray(scip, &reals);
+   SCIPfreeBufferArray(scip, &ints);
+   SCIP_CALL( SCIPfreeClock(scip, &clock) );
+   SCIPfreeRandom(scip, &randnumgen);
+
+   return SCIP_OKAY;
+}
+
+/** presolving method that interrupts the solve, such that the expression kernels run in the presolving stage */
+static
+SCIP_DECL_PRESOLEXEC(presolExecInterrupt)
+{  /*lint --e{715}*/
+   SCIP_CALL( SCIPinterruptSolve(scip) );
+   *result = SCIP_DIDNOTRUN;
+
+   return SCIP_OKAY;
+}
+
+/** times evaluation and propagation of a random sum of nonlinear terms */
+static
+SCIP_RETCODE benchExpressions(
+   BENCHDATA*            benchdata           /**< benchmark data */
+   )
+{
+   SCIP* scip;
+   SCIP_CONSHDLR* conshdlr;
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_CLOCK* clock;
+   SCIP_CONS* cons;
+   SCIP_VAR** vars;
+   SCIP_SOL* sol;
+   SCIP_INTERVAL activity;
+   SCIP_RESULT result;
+   char* exprstr;
+   int exprstrsize;
+   int exprstrlen;
+   int nterms;
+   int nvars;
+   int r;
+   int i;
+
+   nterms = MAX(benchdata->size / 10, 1);
+   nvars = MAX(nterms / 10, 2);
+
+   /* include only what is needed to presolve, such that no other plugin fixes the variables */
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeConshdlrExpr(scip) );
+   SCIP_CALL( SCIPincludeNodeselDfs(scip) );
+   SCIP_CALL( SCIPincludePresolBasic(scip, NULL, "interrupt", "interrupts presolving", 1, -1,
+         SCIP_PRESOLTIMING_ALWAYS, presolExecInterrupt, NULL) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "timing/clocktype", (int) SCIP_CLOCKTYPE_WALL) );
+
+   conshdlr = SCIPfindConshdlr(scip, "expr");
+   assert(conshdlr != NULL);
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, benchdata->seed, TRUE) );
+   SCIP_CALL( SCIPcreateClock(scip, &clock) );
+
+   /* create variables in [1,10], such that all terms are defined */
+   SCIP_CALL( SCIPcreateProbBasic(scip, "microbench_expr") );
+   for( i = 0; i < nvars; ++i )
+   {
+      SCIP_VAR* var;
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "x%d", i);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &var, name, 1.0, 10.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+      SCIP_CALL( SCIPaddVar(scip, var) );
+      SCIP_CALL( SCIPreleaseVar(scip, &var) );
+   }
+
+   SCIP_CALL( SCIPpresolve(scip) );
+   assert(SCIPgetStage(scip) == SCIP_STAGE_PRESOLVING);
+
+   /* generate the expression in terms of the transformed variables */
+   exprstrsize = 64 * nterms + 1;
+   exprstrlen = 0;
+   SCIP_CALL( SCIPallocBufferArray(scip, &exprstr, exprstrsize) );
+   exprstr[0] = '\0';
+   for( i = 0; i < nterms; ++i )
+   {
+      int v1 = SCIPrandomGetInt(randnumgen, 0, nvars - 1);
+      int v2 = SCIPrandomGetInt(randnumgen, 0, nvars - 1);
+      SCIP_Real coef = SCIPrandomGetReal(randnumgen, 0.5, 2.0);
+
+      switch( SCIPrandomGetInt(randnumgen, 0, 3) )
+      {
+      case 0:
+         exprstrlen += SCIPsnprintf(exprstr + exprstrlen, exprstrsize - exprstrlen, "%s%.3f*<t_x%d>*<t_x%d>",
+            i == 0 ? "" : " + ", coef, v1, v2);
+         break;
+      case 1:
+         exprstrlen += SCIPsnprintf(exprstr + exprstrlen, exprstrsize - exprstrlen, "%s%.3f*<t_x%d>^1.5",
+            i == 0 ? "" : " + ", coef, v1);
+         break;
+      case 2:
+         exprstrlen += SCIPsnprintf(exprstr + exprstrlen, exprstrsize - exprstrlen, "%s%.3f*exp(0.1*<t_x%d>)",
+            i == 0 ? "" : " + ", coef, v1);
+         break;
+      default:
+         exprstrlen += SCIPsnprintf(exprstr + exprstrlen, exprstrsize - exprstrlen, "%s%.3f*log(<t_x%d>)",
+            i == 0 ? "" : " + ", coef, v1);
+         break;
+      }
+      assert(exprstrlen < exprstrsize);
+   }
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, exprstr, NULL, &expr) );
+   SCIPfreeBufferArray(scip, &exprstr);
+
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+
+   for( r = 0; r < benchdata->nrepetitions; ++r )
+   {
+      /* evaluate in a new random point; a new solution tag ensures that no value of a previous evaluation is used */
+      for( i = 0; i < nvars; ++i )
+      {
+         SCIP_CALL( SCIPsetSolVal(scip, sol, vars[i], SCIPrandomGetReal(randnumgen, 1.0, 10.0)) );
+      }
+
+      SCIP_CALL( startMeasurement(scip, clock) );
+      SCIP_CALL( SCIPevalConsExprExpr(scip, conshdlr, expr, sol, (unsigned int) r + 1) );
+      SCIP_CALL( stopMeasurement(scip, clock, benchdata, KERNEL_EXPREVAL, 1LL) );
+
+      /* invalidate all activities, such that the forward propagation recomputes every subexpression */
+      SCIPincrementConsExprCurBoundsTag(conshdlr, TRUE);
+
+      SCIP_CALL( startMeasurement(scip, clock) );
+      SCIP_CALL( SCIPevalConsExprExprActivity(scip, conshdlr, expr, &activity, FALSE) );
+      SCIP_CALL( stopMeasurement(scip, clock, benchdata, KERNEL_ACTIVITY, 1LL) );
+
+      /* bounds cannot be relaxed in presolving, so every repetition propagates a new constraint that limits the sum to
+       * half of the average range of its terms above its minimum, which tightens the upper bounds of the variables
+       * a bit further
+       */
+      SCIP_CALL( SCIPcreateConsExprBasic(scip, &cons, "microbench", expr, -SCIPinfinity(scip),
+            activity.inf + 0.5 * (activity.sup - activity.inf) / nterms) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+
+      SCIP_CALL( startMeasurement(scip, clock) );
+      SCIP_CALL( SCIPpropCons(scip, cons, SCIP_PROPTIMING_BEFORELP, &result) );
+      SCIP_CALL( stopMeasurement(scip, clock, benchdata, KERNEL_PROPCONS, 1LL) );
+
+      SCIP_CALL( SCIPdelCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+
+      if( result == SCIP_CUTOFF )
+         break;
+   }
+
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+   SCIP_CALL( SCIPfreeClock(scip, &clock) );
+   SCIPfreeRandom(scip, &randnumgen);
+   SCIP_CALL( SCIPfree(&scip) );
+
+   return SCIP_OKAY;
+}
+
+/** LP separation method that times the cut kernels once on the root LP and adds no cuts itself */
+static
+SCIP_DECL_SEPAEXECLP(sepaExeclpMicrobench)
+{  /*lint --e{715}*/
+   BENCHDATA* benchdata;
+   SCIP_AGGRROW* aggrrow;
+   SCIP_CUTPOOL* cutpool;
+   SCIP_RESULT cutpoolresult;
+   SCIP_CLOCK* clock;
+   SCIP_ROW** rows;
+   SCIP_ROW** cuts;
+   SCIP_ROW** selcuts;
+   SCIP_VAR** vars;
+   SCIP_Real* cutcoefs;
+   int* cutinds;
+   int nrows;
+   int nvars;
+   int ncuts;
+   int r;
+   int i;
+
+   *result = SCIP_DIDNOTRUN;
+
+   benchdata = (BENCHDATA*) SCIPsepaGetData(sepa);
+   assert(benchdata != NULL);
+
+   /* run only once */
+   if( benchdata->run[KERNEL_CALCMIR] )
+      return SCIP_OKAY;
+
+   SCIP_CALL( SCIPgetLPRowsData(scip, &rows, &nrows) );
+   vars = SCIPgetVars(scip);
+   nvars = SCIPgetNVars(scip);
+
+   SCIP_CALL( SCIPcreateClock(scip, &clock) );
+   SCIP_CALL( SCIPaggrRowCreate(scip, &aggrrow) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cutcoefs, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cutinds, nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &cuts, nrows) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &selcuts, nrows) );
+
+   /* compute an MIR cut from every LP row; keep the cuts of the first repetition for the selection and the cut pool */
+   ncuts = 0;
+   for( r = 0; r < benchdata->nrepetitions; ++r )
+   {
+      for( i = 0; i < nrows; ++i )
+      {
+         SCIP_Real cutrhs;
+         SCIP_Real cutefficacy;
+         SCIP_Bool cutislocal;
+         SCIP_Bool success;
+         int cutnnz;
+         int cutrank;
+
+         SCIPaggrRowClear(aggrrow);
+         SCIP_CALL( SCIPaggrRowAddRow(scip, aggrrow, rows[i], 1.0, 0) );
+
+         SCIP_CALL( startMeasurement(scip, clock) );
+         SCIP_CALL( SCIPcalcMIR(scip, NULL, TRUE, 0.9999, TRUE, FALSE, FALSE, NULL, NULL, 0.001, 0.999, 1.0, aggrrow,
+               cutcoefs, &cutrhs, cutinds, &cutnnz, &cutefficacy, &cutrank, &cutislocal, &success) );
+         SCIP_CALL( stopMeasurement(scip, clock, benchdata, KERNEL_CALCMIR, 1LL) );
+
+         if( r == 0 && success && cutnnz > 0 )
+         {
+            SCIP_ROW* cut;
+            char name[SCIP_MAXSTRLEN];
+            int j;
+
+            (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "microbench_mir%d", i);
+            SCIP_CALL( SCIPcreateEmptyRowSepa(scip, &cut, sepa, name, -SCIPinfinity(scip), cutrhs, cutislocal, FALSE,
+                  TRUE) );
+            SCIP_CALL( SCIPcacheRowExtensions(scip, cut) );
+            for( j = 0; j < cutnnz; ++j )
+            {
+               SCIP_CALL( SCIPaddVarToRow(scip, cut, vars[cutinds[j]], cutcoefs[j]) );
+            }
+            SCIP_CALL( SCIPflushRowExtensions(scip, cut) );
+            cuts[ncuts++] = cut;
+         }
+      }
+   }
+
+   if( ncuts > 0 )
+   {
+      for( r = 0; r < benchdata->nrepetitions; ++r )
+      {
+         int nselectedcuts;
+
+         /* the selection reorders the array, so start from the same order in every repetition */
+         BMScopyMemoryArray(selcuts, cuts, ncuts);
+
+         SCIP_CALL( startMeasurement(scip, clock) );
+         SCIP_CALL( SCIPselectCuts(scip, selcuts, NULL, 0.9, 0.0, 0.1, 0.1, 0.0, 1.0, 0.1, 0.1, ncuts, 0, ncuts,
+               &nselectedcuts) );
+         SCIP_CALL( stopMeasurement(scip, clock, benchdata, KERNEL_SELECTCUTS, 1LL) );
+
+         /* a cut pool separates each cut only once per LP, so every repetition uses a new pool */
+         SCIP_CALL( startMeasurement(scip, clock) );
+         SCIP_CALL( SCIPcreateCutpool(scip, &cutpool, INT_MAX) );
+         for( i = 0; i < ncuts; ++i )
+         {
+            SCIP_CALL( SCIPaddRowCutpool(scip, cutpool, cuts[i]) );
+         }
+         SCIP_CALL( SCIPseparateCutpool(scip, cutpool, &cutpoolresult) );
+         SCIP_CALL( SCIPfreeCutpool(scip, &cutpool) );
+         SCIP_CALL( stopMeasurement(scip, clock, benchdata, KERNEL_CUTPOOL, 1LL) );
+      }
+   }
+
+   for( i = ncuts - 1; i >= 0; --i )
+   {
+      SCIP_CALL( SCIPreleaseRow(scip, &cuts[i]) );
+   }
+
+   SCIPfreeBufferArray(scip, &selcuts);
+   SCIPfreeBufferArray(scip, &cuts);
+   SCIPfreeBufferArray(scip, &cutinds);
+   SCIPfreeBufferArray(scip, &cutcoefs);
+   SCIPaggrRowFree(scip, &aggrrow);
+   SCIP_CALL( SCIPfreeClock(scip, &clock) );
+
+   return SCIP_OKAY;
+}
+
+/** times the cut kernels on the root LP of a random MIP with knapsack rows */
+static
+SCIP_RETCODE benchCuts(
+   BENCHDATA*            benchdata           /**< benchmark data */
+   )
+{
+   SCIP* scip;
+   SCIP_SEPA* sepa;
+   SCIP_RANDNUMGEN* randnumgen;
+   SCIP_VAR** vars;
+   SCIP_RETCODE retcode;
+   int nvars;
+   int nrows;
+   int i;
+   int j;
+
+   nvars = MAX(benchdata->size / 20, 2);
+   nrows = MAX(nvars / 2, 1);
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeDefaultPlugins(scip) );
+   SCIP_CALL( SCIPincludeSepaBasic(scip, &sepa, SEPA_NAME, SEPA_DESC, 1000000, 0, 1.0, FALSE, FALSE,
+         sepaExeclpMicrobench, NULL, (SCIP_SEPADATA*) benchdata) );
+   SCIP_CALL( SCIPsetIntParam(scip, "display/verblevel", 0) );
+   SCIP_CALL( SCIPsetIntParam(scip, "timing/clocktype", (int) SCIP_CLOCKTYPE_WALL) );
+   SCIP_CALL( SCIPsetLongintParam(scip, "limits/nodes", 1LL) );
+   SCIP_CALL( SCIPsetPresolving(scip, SCIP_PARAMSETTING_OFF, TRUE) );
+
+   SCIP_CALL( SCIPcreateRandom(scip, &randnumgen, benchdata->seed, TRUE) );
+
+   /* maximize a random objective over random knapsack rows with general integer variables */
+   SCIP_CALL( SCIPcreateProbBasic(scip, "microbench_cuts") );
+   SCIP_CALL( SCIPsetObjsense(scip, SCIP_OBJSENSE_MAXIMIZE) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &vars, nvars) );
+   for( j = 0; j < nvars; ++j )
+   {
+      char name[SCIP_MAXSTRLEN];
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "y%d", j);
+      SCIP_CALL( SCIPcreateVarBasic(scip, &vars[j], name, 0.0, 10.0, (SCIP_Real) SCIPrandomGetInt(randnumgen, 1, 100),
+            SCIP_VARTYPE_INTEGER) );
+      SCIP_CALL( SCIPaddVar(scip, vars[j]) );
+   }
+   for( i = 0; i < nrows; ++i )
+   {
+      SCIP_CONS* cons;
+      char name[SCIP_MAXSTRLEN];
+      SCIP_Real rhs = 0.0;
+
+      (void) SCIPsnprintf(name, SCIP_MAXSTRLEN, "row%d", i);
+      SCIP_CALL( SCIPcreateConsBasicLinear(scip, &cons, name, 0, NULL, NULL, -SCIPinfinity(scip), 0.0) );
+      for( j = 0; j < nvars; ++j )
+      {
+         if( SCIPrandomGetReal(randnumgen, 0.0, 1.0) < 0.1 )
+         {
+            SCIP_Real coef = (SCIP_Real) SCIPrandomGetInt(randnumgen, 1, 1000);
+
+            SCIP_CALL( SCIPaddCoefLinear(scip, cons, vars[j], coef) );
+            rhs += coef;
+         }
+      }
+      SCIP_CALL( SCIPchgRhsLinear(scip, cons, floor(0.5 * rhs) + 0.5) );
+      SCIP_CALL( SCIPaddCons(scip, cons) );
+      SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   }
+   for( j = nvars - 1; j >= 0; --j )
+   {
+      SCIP_CALL( SCIPreleaseVar(scip, &vars[j]) );
+   }
+   SCIPfreeBufferArray(scip, &vars);
+   SCIPfreeRandom(scip, &randnumgen);
+
+   /* without a working LP solver, the separator is never called and the cut kernels are reported as not run */
+   retcode = SCIPsolve(scip);
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPerrorMessage("solving the MIP for the cut kernels failed\n");
+      SCIPprintError(retcode);
+   }
+
+   SCIP_CALL( SCIPfree(&scip) );
+
+   return SCIP_OKAY;
+}
+
+/** writes the results in JSON format */
+static
+void writeResults(
+   FILE*                 file,               /**< output file */
+   BENCHDATA*            benchdata           /**< benchmark data */
+   )
+{
+   int k;
+
+   fprintf(file, "{\n");
+   fprintf(file, "  \"scipversion\": \"%d.%d.%d\",\n", SCIPmajorVersion(), SCIPminorVersion(), SCIPtechVersion());
+   fprintf(file, "  \"size\": %d,\n", benchdata->size);
+   fprintf(file, "  \"repetitions\": %d,\n", benchdata->nrepetitions);
+   fprintf(file, "  \"seed\": %u,\n", benchdata->seed);
+   fprintf(file, "  \"lpsolver\": \"%s\",\n", SCIPlpiGetSolverName());
+   fprintf(file, "  \"kernels\": [\n");
+   for( k = 0; k < NKERNELS; ++k )
+   {
+      fprintf(file, "    { \"name\": \"%s\", \"run\": %s, \"calls\": %" SCIP_LONGINT_FORMAT ", \"time\": %.6f, "
+         "\"timepercall\": %.9f }%s\n", kernelnames[k], benchdata->run[k] ? "true" : "false", benchdata->ncalls[k],
+         benchdata->times[k], benchdata->ncalls[k] > 0 ? benchdata->times[k] / benchdata->ncalls[k] : 0.0,
+         k < NKERNELS - 1 ? "," : "");
+   }
+   fprintf(file, "  ]\n");
+   fprintf(file, "}\n");
+}
+
+/** runs all benchmarks */
+static
+SCIP_RETCODE runBenchmarks(
+   BENCHDATA*            benchdata,          /**< benchmark data */
+   const char*           filename            /**< name of JSON output file, or NULL for standard output */
+   )
+{
+   SCIP* scip;
+   FILE* file;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPsetIntParam(scip, "timing/clocktype", (int) SCIP_CLOCKTYPE_WALL) );
+   SCIP_CALL( benchSortAndHash(scip, benchdata) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   SCIP_CALL( benchExpressions(benchdata) );
+   SCIP_CALL( benchCuts(benchdata) );
+
+   if( filename != NULL )
+   {
+      file = fopen(filename, "w");
+      if( file == NULL )
+      {
+         SCIPerrorMessage("cannot open file <%s> for writing\n", filename);
+         return SCIP_FILECREATEERROR;
+      }
+   }
+   else
+      file = stdout;
+
+   writeResults(file, benchdata);
+
+   if( filename != NULL )
+      (void) fclose(file);
+
+   return SCIP_OKAY;
+}
+
+/** main method */
+int main(
+   int                   argc,               /**< number of arguments from the shell */
+   char**                argv                /**< array of shell arguments */
+   )
+{
+   BENCHDATA benchdata;
+   SCIP_RETCODE retcode;
+   const char* filename = NULL;
+   int i;
+
+   BMSclearMemory(&benchdata);
+   benchdata.size = DEFAULT_SIZE;
+   benchdata.nrepetitions = DEFAULT_REPETITIONS;
+   benchdata.seed = DEFAULT_SEED;
+
+   for( i = 1; i < argc; ++i )
+   {
+      if( i + 1 < argc && strcmp(argv[i], "-n") == 0 )
+      {
+         benchdata.size = atoi(argv[++i]);
+         benchdata.size = MAX(benchdata.size, 1);
+      }
+      else if( i + 1 < argc && strcmp(argv[i], "-r") == 0 )
+      {
+         benchdata.nrepetitions = atoi(argv[++i]);
+         benchdata.nrepetitions = MAX(benchdata.nrepetitions, 1);
+      }
+      else if( i + 1 < argc && strcmp(argv[i], "-s") == 0 )
+         benchdata.seed = (unsigned int) atoi(argv[++i]);
+      else if( i + 1 < argc && strcmp(argv[i], "-o") == 0 )
+         filename = argv[++i];
+      else
+      {
+         printf("usage: %s [-n size] [-r repetitions] [-s seed] [-o jsonfile]\n", argv[0]);
+         return 1;
+      }
+   }
+
+   retcode = runBenchmarks(&benchdata, filename);
+   if( retcode != SCIP_OKAY )
+   {
+      SCIPprintError(retcode);
+      return -1;
+   }
+
+   return 0;
+}
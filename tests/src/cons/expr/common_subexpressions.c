@@ -130,3 +130,35 @@ Test(commonSubexpr, multipleConstraints)
    SCIP_CALL( SCIPreleaseCons(scip, &conss[1]) );
    SCIP_CALL( SCIPreleaseCons(scip, &conss[0]) );
 }
+
+/* larger expressions first: subexpressions of later constraints are represented by subexpressions of earlier ones */
+Test(commonSubexpr, largestFirst)
+{
+   SCIP_CONS* conss[3];
+   SCIP_CONSEXPR_EXPR* expr;
+
+   SCIP_CALL( (SCIPparseConsExprExpr(scip, conshdlr, "log(abs(exp(<x> * <y>))) + <x> * <y>", NULL, &expr)) );
+   SCIP_CALL( SCIPcreateConsExprBasic(scip, &conss[0], "cons", expr, -1.0, 1.0) );
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   SCIP_CALL( (SCIPparseConsExprExpr(scip, conshdlr, "exp(<x> * <y>)", NULL, &expr)) );
+   SCIP_CALL( SCIPcreateConsExprBasic(scip, &conss[1], "cons", expr, -1.0, 1.0) );
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   SCIP_CALL( (SCIPparseConsExprExpr(scip, conshdlr, "log(abs(exp(<x> * <y>))) + <x> * <y>", NULL, &expr)) );
+   SCIP_CALL( SCIPcreateConsExprBasic(scip, &conss[2], "cons", expr, -1.0, 1.0) );
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   SCIP_CALL( replaceCommonSubexpressions(scip, conss, 3) );
+
+   /* both x*y in the first constraint are the same */
+   expr = SCIPgetExprConsExpr(scip, conss[0]);
+   cr_assert(expr->children[1] == expr->children[0]->children[0]->children[0]->children[0]);
+
+   cr_assert(SCIPgetExprConsExpr(scip, conss[1]) == expr->children[0]->children[0]->children[0]);
+   cr_assert(SCIPgetExprConsExpr(scip, conss[2]) == expr);
+
+   SCIP_CALL( SCIPreleaseCons(scip, &conss[2]) );
+   SCIP_CALL( SCIPreleaseCons(scip, &conss[1]) );
+   SCIP_CALL( SCIPreleaseCons(scip, &conss[0]) );
+}
@@ -425,3 +425,65 @@ Test(conshdlr, consrelviol_g2, .init = setup, .fini = teardown,
    /* release constraints */
    SCIP_CALL( SCIPreleaseCons(scip, &consexpr) );
 }
+
+Test(conshdlr, absviolations, .init = setup, .fini = teardown,
+   .description = "test violation of the cons_expr constraint handler for a batch of solutions."
+   )
+{
+   SCIP_CONS* conss[2];
+   SCIP_SOL* sols[3];
+   SCIP_Real maxviols[3];
+   SCIP_Real viol;
+   SCIP_Real maxviol;
+   SCIP_Bool success;
+   int c;
+   int s;
+
+   /* parse constraints */
+   SCIP_CALL( SCIPparseCons(scip, &conss[0], "[expr] <test>: 1.1*<x>*<y>/<z> + 3.2*<x>^2*<y>^(-5)*<z> + 0.5*<z>^3 <= 2;",
+         TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE, &success) );
+   cr_assert(success);
+   SCIP_CALL( SCIPparseCons(scip, &conss[1], "[expr] <test2>: 1 <= exp(<x>) - <y>*<z> <= 4;",
+         TRUE, TRUE, TRUE, TRUE, TRUE, FALSE, FALSE, FALSE, FALSE, FALSE, &success) );
+   cr_assert(success);
+
+   /* infeasible, feasible, and undefined solution */
+   SCIP_CALL( SCIPcreateSol(scip, &sols[0], NULL) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[0], x, 1) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[0], y, 2) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[0], z, 3) );
+   SCIP_CALL( SCIPcreateSol(scip, &sols[1], NULL) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[1], x, 0.5) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[1], y, 1) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[1], z, 0.5) );
+   SCIP_CALL( SCIPcreateSol(scip, &sols[2], NULL) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[2], x, 1) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[2], y, 1) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[2], z, 0) );
+
+   SCIP_CALL( SCIPgetAbsViolationsConsExpr(scip, conss, 2, sols, 3, maxviols) );
+
+   /* compare with the violations for each solution separately */
+   for( s = 0; s < 3; ++s )
+   {
+      maxviol = 0.0;
+      for( c = 0; c < 2; ++c )
+      {
+         SCIP_CALL( SCIPgetAbsViolationConsExpr(scip, conss[c], sols[s], &viol) );
+         maxviol = MAX(maxviol, viol);
+      }
+      cr_expect(SCIPisEQ(scip, maxviols[s], maxviol), "solution %d: expected %g, got %g", s, maxviol, maxviols[s]);
+   }
+   cr_expect(SCIPisPositive(scip, maxviols[0]));
+   cr_expect(SCIPisZero(scip, maxviols[1]));
+   cr_expect(SCIPisInfinity(scip, maxviols[2]));
+
+   for( s = 0; s < 3; ++s )
+   {
+      SCIP_CALL( SCIPfreeSol(scip, &sols[s]) );
+   }
+   for( c = 0; c < 2; ++c )
+   {
+      SCIP_CALL( SCIPreleaseCons(scip, &conss[c]) );
+   }
+}
@@ -0,0 +1,193 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scip.zib.de.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   evaltape.c
+ * @brief  tests evaluation and differentiation of expressions by evaluation tapes
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/cons_expr.c"
+
+#include "include/scip_test.h"
+
+
+static SCIP* scip;
+static SCIP_CONSHDLR* conshdlr;
+static SCIP_SOL* sol;
+static SCIP_VAR* x;
+static SCIP_VAR* y;
+static SCIP_RANDNUMGEN* rndgen;
+
+static
+void setup(void)
+{
+   SCIP_CALL( SCIPcreate(&scip) );
+
+   /* include cons_expr: this adds the operator handlers */
+   SCIP_CALL( SCIPincludeConshdlrExpr(scip) );
+
+   /* get expr conshdlr */
+   conshdlr = SCIPfindConshdlr(scip, "expr");
+   cr_assert(conshdlr != NULL);
+
+   /* create problem */
+   SCIP_CALL( SCIPcreateProbBasic(scip, "test_problem") );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &x, "x", -SCIPinfinity(scip), SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &y, "y", -SCIPinfinity(scip), SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, x) );
+   SCIP_CALL( SCIPaddVar(scip, y) );
+
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+
+   /* create random number generator */
+   SCIP_CALL( SCIPcreateRandom(scip, &rndgen, 1, TRUE) );
+}
+
+static
+void teardown(void)
+{
+   SCIPfreeRandom(scip, &rndgen);
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+   SCIP_CALL( SCIPreleaseVar(scip, &x) );
+   SCIP_CALL( SCIPreleaseVar(scip, &y) );
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory leak!!");
+}
+
+TestSuite(evaltape, .init = setup, .fini = teardown);
+
+/* compares tape evaluation and differentiation with the iterator based ones; variable expressions have several parents */
+Test(evaltape, commonsubexpressions)
+{
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_CONSEXPR_EXPR* simplified;
+   SCIP_Bool changed;
+   SCIP_Bool infeasible;
+   EXPRTAPE* tape;
+   const char* input = "<x>^2*<y> + exp(<x>*<y>) + 3*<x>*<y> + log(<x>^2 + 1)";
+   int i;
+
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)input, NULL, &expr) );
+   SCIP_CALL( SCIPsimplifyConsExprExpr(scip, conshdlr, expr, &simplified, &changed, &infeasible) );
+   cr_assert(!infeasible);
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   SCIP_CALL( createExprTape(scip, conshdlr, simplified, &tape) );
+   cr_assert(tape->exprs[tape->nexprs-1] == simplified);
+
+   for( i = 0; i < 20; ++i )
+   {
+      SCIP_Real val;
+      SCIP_Real dx;
+      SCIP_Real dy;
+
+      SCIP_CALL( SCIPsetSolVal(scip, sol, x, SCIPrandomGetReal(rndgen, -2.0, 2.0)) );
+      SCIP_CALL( SCIPsetSolVal(scip, sol, y, SCIPrandomGetReal(rndgen, -2.0, 2.0)) );
+
+      SCIP_CALL( SCIPcomputeConsExprExprGradient(scip, conshdlr, simplified, sol, 0) );
+      val = SCIPgetConsExprExprValue(simplified);
+      dx = SCIPgetConsExprExprPartialDiff(scip, conshdlr, simplified, x);
+      dy = SCIPgetConsExprExprPartialDiff(scip, conshdlr, simplified, y);
+      cr_assert(val != SCIP_INVALID);
+
+      SCIP_CALL( computeExprTapeGradient(scip, conshdlr, tape, sol, 0) );
+      cr_expect(SCIPisEQ(scip, SCIPgetConsExprExprValue(simplified), val), "value %g, expected %g",
+         SCIPgetConsExprExprValue(simplified), val);
+      cr_expect(SCIPisEQ(scip, SCIPgetConsExprExprPartialDiff(scip, conshdlr, simplified, x), dx),
+         "x-derivative %g, expected %g", SCIPgetConsExprExprPartialDiff(scip, conshdlr, simplified, x), dx);
+      cr_expect(SCIPisEQ(scip, SCIPgetConsExprExprPartialDiff(scip, conshdlr, simplified, y), dy),
+         "y-derivative %g, expected %g", SCIPgetConsExprExprPartialDiff(scip, conshdlr, simplified, y), dy);
+   }
+
+   freeExprTape(scip, &tape);
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &simplified) );
+}
+
+/* checks that evaluation errors are reported by an invalid value */
+Test(evaltape, domainerror)
+{
+   SCIP_CONSEXPR_EXPR* expr;
+   EXPRTAPE* tape;
+   const char* input = "log(<x>) + <y>";
+
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)input, NULL, &expr) );
+   SCIP_CALL( createExprTape(scip, conshdlr, expr, &tape) );
+
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, -1.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sol, y, 1.0) );
+
+   SCIP_CALL( evalExprTape(scip, tape, sol, 0, FALSE) );
+   cr_expect_eq(SCIPgetConsExprExprValue(expr), SCIP_INVALID);
+
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 1.0) );
+   SCIP_CALL( computeExprTapeGradient(scip, conshdlr, tape, sol, 0) );
+   cr_expect(SCIPisEQ(scip, SCIPgetConsExprExprValue(expr), 1.0));
+   cr_expect(SCIPisEQ(scip, SCIPgetConsExprExprPartialDiff(scip, conshdlr, expr, x), 1.0));
+   cr_expect(SCIPisEQ(scip, SCIPgetConsExprExprPartialDiff(scip, conshdlr, expr, y), 1.0));
+
+   freeExprTape(scip, &tape);
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+}
+
+/* checks that incremental evaluation only re-evaluates subexpressions that depend on changed variables */
+Test(evaltape, incremental)
+{
+   SCIP_CONSEXPR_EXPR* expr;
+   EXPRTAPE* tape;
+   const char* input = "exp(<x>) + <y>^2";
+   int expidx;
+   int k;
+
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)input, NULL, &expr) );
+   SCIP_CALL( createExprTape(scip, conshdlr, expr, &tape) );
+
+   expidx = -1;
+   for( k = 0; k < tape->nexprs; ++k )
+      if( strcmp(SCIPgetConsExprExprHdlrName(SCIPgetConsExprExprHdlr(tape->exprs[k])), "exp") == 0 )
+         expidx = k;
+   cr_assert(expidx >= 0);
+
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 1.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sol, y, 1.0) );
+   SCIP_CALL( evalExprTape(scip, tape, sol, 1, TRUE) );
+   cr_expect(SCIPisEQ(scip, SCIPgetConsExprExprValue(expr), exp(1.0) + 1.0));
+   cr_expect(tape->changed[expidx]);
+
+   /* only y changes: exp(x) keeps its value */
+   SCIP_CALL( SCIPsetSolVal(scip, sol, y, 2.0) );
+   SCIP_CALL( evalExprTape(scip, tape, sol, 2, TRUE) );
+   cr_expect(SCIPisEQ(scip, SCIPgetConsExprExprValue(expr), exp(1.0) + 4.0));
+   cr_expect(!tape->changed[expidx]);
+   cr_expect_eq(tape->exprs[expidx]->evaltag, 2);
+
+   /* x changes: exp(x) is evaluated again */
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 0.0) );
+   SCIP_CALL( evalExprTape(scip, tape, sol, 3, TRUE) );
+   cr_expect(SCIPisEQ(scip, SCIPgetConsExprExprValue(expr), 1.0 + 4.0));
+   cr_expect(tape->changed[expidx]);
+
+   /* evaluation by someone else is noticed */
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 1.0) );
+   SCIP_CALL( SCIPevalConsExprExpr(scip, conshdlr, tape->exprs[expidx], sol, 4) );
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x, 0.0) );
+   SCIP_CALL( evalExprTape(scip, tape, sol, 5, TRUE) );
+   cr_expect(SCIPisEQ(scip, SCIPgetConsExprExprValue(expr), 1.0 + 4.0));
+
+   freeExprTape(scip, &tape);
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+}
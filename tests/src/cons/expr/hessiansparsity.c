@@ -0,0 +1,115 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                           */
+/*                  This file is part of the program and library             */
+/*         SCIP --- Solving Constraint Integer Programs                      */
+/*                                                                           */
+/*    Copyright (C) 2002-2020 Konrad-Zuse-Zentrum                            */
+/*                            fuer Informationstechnik Berlin                */
+/*                                                                           */
+/*  SCIP is distributed under the terms of the ZIB Academic License.         */
+/*                                                                           */
+/*  You should have received a copy of the ZIB Academic License              */
+/*  along with SCIP; see the file COPYING. If not visit scip.zib.de.         */
+/*                                                                           */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/**@file   hessiansparsity.c
+ * @brief  tests the Hessian sparsity pattern of expression constraints
+ */
+
+/*---+----1----+----2----+----3----+----4----+----5----+----6----+----7----+----8----+----9----+----0----+----1----+----2*/
+
+#include "scip/scip.h"
+#include "scip/cons_expr.h"
+
+#include "include/scip_test.h"
+
+static SCIP* scip;
+static SCIP_CONSHDLR* conshdlr;
+
+static
+void setup(void)
+{
+   SCIP_VAR* x;
+   SCIP_VAR* y;
+   SCIP_VAR* z;
+   SCIP_VAR* w;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+
+   /* include cons_expr: this adds the operator handlers */
+   SCIP_CALL( SCIPincludeConshdlrExpr(scip) );
+
+   /* get expr conshdlr */
+   conshdlr = SCIPfindConshdlr(scip, "expr");
+   cr_assert_not_null(conshdlr);
+
+   /* create problem */
+   SCIP_CALL( SCIPcreateProbBasic(scip, "test_problem") );
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &x, "x", -1.0, 1.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &y, "y", -1.0, 1.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &z, "z", -1.0, 1.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPcreateVarBasic(scip, &w, "w", -1.0, 1.0, 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   SCIP_CALL( SCIPaddVar(scip, x) );
+   SCIP_CALL( SCIPaddVar(scip, y) );
+   SCIP_CALL( SCIPaddVar(scip, z) );
+   SCIP_CALL( SCIPaddVar(scip, w) );
+   SCIP_CALL( SCIPreleaseVar(scip, &x) );
+   SCIP_CALL( SCIPreleaseVar(scip, &y) );
+   SCIP_CALL( SCIPreleaseVar(scip, &z) );
+   SCIP_CALL( SCIPreleaseVar(scip, &w) );
+
+   /* go to presolving, so that constraints store their variable expressions when they are added */
+   SCIP_CALL( TESTscipSetStage(scip, SCIP_STAGE_PRESOLVING, FALSE) );
+}
+
+static
+void teardown(void)
+{
+   /* free scip and check for memory leaks */
+   SCIP_CALL( SCIPfree(&scip) );
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "There are memory leaks!");
+}
+
+TestSuite(hessiansparsity, .init = setup, .fini = teardown);
+
+Test(hessiansparsity, pattern)
+{
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_CONS* cons;
+   int* rowbegins;
+   int* colidxs;
+   int nvars;
+   int nnz;
+
+   /* the variables are numbered by their first appearance: x = 0, y = 1, z = 2, w = 3 */
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"<t_x> * <t_y> + exp(<t_z>) + <t_x>^2 + 3 * <t_w>", NULL, &expr) );
+   SCIP_CALL( SCIPcreateConsExprBasic(scip, &cons, "cons", expr, -1.0, 1.0) );
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+
+   SCIP_CALL( SCIPgetConsExprHessianSparsity(scip, conshdlr, cons, &nvars, &rowbegins, &colidxs, &nnz) );
+
+   cr_assert_eq(nvars, 4);
+   cr_assert_eq(nnz, 3);
+
+   /* row x: (x,x) from x^2 */
+   cr_expect_eq(rowbegins[0], 0);
+   cr_expect_eq(rowbegins[1], 1);
+   cr_expect_eq(colidxs[0], 0);
+
+   /* row y: (y,x) from x*y, but no (y,y) */
+   cr_expect_eq(rowbegins[2], 2);
+   cr_expect_eq(colidxs[1], 0);
+
+   /* row z: (z,z) from exp(z) */
+   cr_expect_eq(rowbegins[3], 3);
+   cr_expect_eq(colidxs[2], 2);
+
+   /* row w: w appears linearly */
+   cr_expect_eq(rowbegins[4], 3);
+
+   SCIP_CALL( SCIPdelCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+}
@@ -162,16 +162,14 @@ void checkCut(SCIP_ROW* cut, SCIP_VAR** vars, SCIP_Real* vals, int nvars, SCIP_R
 /* tests the detection of semicontinuous variables */
 Test(nlhdlrperspective, varissc, .init = setup, .fini = teardown)
 {
-   SCIP_HASHMAP* scvars;
-   SCIP_HASHMAPENTRY* entry;
-   SCVARDATA* scvdata;
+   SCVARDATA* scvars;
    SCIP_Bool result;
    SCIP_Bool infeas;
    int nbndchgs;
-   int c;
+   int start;
 
    /* allocate memory */
-   SCIP_CALL( SCIPhashmapCreate(&scvars, SCIPblkmem(scip), 1) );
+   SCIP_CALL( createSCVarData(scip, &scvars, NULL) );
 
    /* add bound information to the vars */
    /* z1 <= x1 <= 3*z1 */
@@ -187,32 +185,21 @@ Test(nlhdlrperspective, varissc, .init = setup, .fini = teardown)
    SCIP_CALL( varIsSemicontinuous(scip, x_1, scvars, &result) );
 
    /* check result */
-   cr_expect_eq(SCIPhashmapGetNElements(scvars), 1, "Expected 1 semicontinuous variable, got %d", SCIPhashmapGetNElements(scvars));
-   scvdata = (SCVARDATA*) SCIPhashmapGetImage(scvars, (void*)x_1);
-   cr_expect_eq(scvdata->nbnds, 3, "Expected 3 on/off bounds for variable x1, got %d", scvdata->nbnds);
-
-   cr_expect_eq(scvdata->bvars[0], (void*)z_1, "bvars[0] expected to be z1, got %s", SCIPvarGetName(scvdata->bvars[0]));
-   cr_expect_eq(scvdata->vals0[0], 0.0, "vals0[0] expected to be 0.0, got %f", scvdata->vals0[0]);
-   cr_expect_eq(scvdata->bvars[1], (void*)z_2, "bvars[1] expected to be z2, got %s", SCIPvarGetName(scvdata->bvars[1]));
-   cr_expect_eq(scvdata->vals0[1], 0.0, "vals0[1] expected to be 0.0, got %f", scvdata->vals0[1]);
-   cr_expect_eq(scvdata->bvars[2], (void*)z_3, "bvars[2] expected to be z3, got %s", SCIPvarGetName(scvdata->bvars[2]));
-   cr_expect_eq(scvdata->vals0[2], 1.0, "vals0[2] expected to be 1.0, got %f", scvdata->vals0[2]);
+   cr_expect(result, "Expected x1 to be semicontinuous");
+   cr_expect_eq(scvars->nscvars, 1, "Expected 1 semicontinuous variable, got %d", scvars->nscvars);
+   cr_expect_eq(getSCVarNBnds(scvars, x_1), 3, "Expected 3 on/off bounds for variable x1, got %d", getSCVarNBnds(scvars, x_1));
+   cr_expect_eq(getSCVarNBnds(scvars, y_1), 0, "Expected 0 on/off bounds for variable y1, got %d", getSCVarNBnds(scvars, y_1));
+
+   start = getSCVarStart(scvars, x_1);
+   cr_expect_eq(scvars->bvars[start], (void*)z_1, "bvars[0] expected to be z1, got %s", SCIPvarGetName(scvars->bvars[start]));
+   cr_expect_eq(scvars->vals0[start], 0.0, "vals0[0] expected to be 0.0, got %f", scvars->vals0[start]);
+   cr_expect_eq(scvars->bvars[start+1], (void*)z_2, "bvars[1] expected to be z2, got %s", SCIPvarGetName(scvars->bvars[start+1]));
+   cr_expect_eq(scvars->vals0[start+1], 0.0, "vals0[1] expected to be 0.0, got %f", scvars->vals0[start+1]);
+   cr_expect_eq(scvars->bvars[start+2], (void*)z_3, "bvars[2] expected to be z3, got %s", SCIPvarGetName(scvars->bvars[start+2]));
+   cr_expect_eq(scvars->vals0[start+2], 1.0, "vals0[2] expected to be 1.0, got %f", scvars->vals0[start+2]);
 
    /* free memory */
-   for( c = 0; c < SCIPhashmapGetNEntries(scvars); ++c )
-   {
-      entry = SCIPhashmapGetEntry(scvars, c);
-      if( entry != NULL )
-      {
-         scvdata = (SCVARDATA*) SCIPhashmapEntryGetImage(entry);
-         SCIPfreeBlockMemoryArray(scip, &scvdata->ubs1, scvdata->bndssize);
-         SCIPfreeBlockMemoryArray(scip, &scvdata->lbs1, scvdata->bndssize);
-         SCIPfreeBlockMemoryArray(scip, &scvdata->vals0, scvdata->bndssize);
-         SCIPfreeBlockMemoryArray(scip, &scvdata->bvars, scvdata->bndssize);
-         SCIPfreeBlockMemory(scip, &scvdata);
-      }
-   }
-   SCIPhashmapFree(&scvars);
+   SCIP_CALL( freeSCVarData(scip, &scvars) );
 }
 
 /* detects x1^2 + x1y1 + x2^2 as an on/off expression with 2 indicator variables */
@@ -539,3 +526,300 @@ Test(nlhdlrperspective, sepa1, .init = setup, .fini = teardown)
    SCIP_CALL( SCIPreleaseCons(scip, &cons) );
    SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
 }
+
+/* checks that batched probing computes the same cuts as probing for a single expression, with the enforcement of the
+ * convex handler at a different position than the one of the perspective handler
+ */
+Test(nlhdlrperspective, batchprobing, .init = setup, .fini = teardown)
+{
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata = NULL;
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata_conv = NULL;
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_CONSEXPR_EXPRENFO_METHOD enforcing;
+   SCIP_CONSEXPR_EXPRENFO_METHOD participating;
+   SCIP_Bool infeas;
+   SCIP_Bool doprobing;
+   SCIP_Bool cutoff;
+   SCIP_Bool indfixed;
+   SCIP_CONS* cons;
+   int nbndchgs;
+   SCIP_SOL* sol;
+   SCIP_SOL* solcopy;
+   SCIP_VAR* auxvar;
+   SCIP_VAR** probingvars;
+   SCIP_INTERVAL* probingdoms;
+   SCIP_PTRARRAY* rowpreps2;
+   SCIP_PTRARRAY* rowpreps;
+   SCIP_PTRARRAY* batchrowpreps;
+   SCIP_BOOLARRAY* brscores;
+   SCIP_BOOLARRAY* batchbrscores;
+   SCIP_RESULT result;
+   int enfoposs[1];
+   int nenfos;
+   int nprobingvars;
+   int nrowpreps;
+   int nbatchrowpreps;
+   int r;
+   int v;
+   int w;
+
+   /* skip when no ipopt */
+   if( ! SCIPisIpoptAvailableIpopt() )
+      return;
+
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   nlhdlrdata->adjrefpoint = TRUE;
+
+   /* create expression and constraint */
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"<x1>^2 + <x1>*<x2> + <x2>^2", NULL, &expr) );
+   SCIP_CALL( SCIPcreateConsExprBasic(scip, &cons, (char*)"nlin", expr, -SCIPinfinity(scip), 0)  );
+   SCIP_CALL( SCIPaddConsLocks(scip, cons, 1, 0) );
+   SCIP_CALL( SCIPcomputeConsExprExprCurvature(scip, expr) );
+   SCIP_CALL( SCIPregisterConsExprExprUsage(scip, conshdlr, expr, TRUE, FALSE, FALSE, FALSE) );
+
+   /* add implied variable bounds as in sepa1 */
+   SCIP_CALL( SCIPaddVarVlb(scip, x_1, z_1, -3.0, 3.0, &infeas, &nbndchgs) );
+   SCIP_CALL( SCIPaddVarVub(scip, x_1, z_1, 3.0, 3.0, &infeas, &nbndchgs) );
+   SCIP_CALL( SCIPaddVarVlb(scip, x_2, z_1, -1.0, 0.0, &infeas, &nbndchgs) );
+   SCIP_CALL( SCIPaddVarVub(scip, x_2, z_1, 5.0, 0.0, &infeas, &nbndchgs) );
+   SCIP_CALL( SCIPaddVarVlb(scip, x_1, z_2, 1.0, 0.0, &infeas, &nbndchgs) );
+   SCIP_CALL( SCIPaddVarVub(scip, x_1, z_2, 3.0, 0.0, &infeas, &nbndchgs) );
+   SCIP_CALL( SCIPaddVarVlb(scip, x_2, z_2, -1.0, 0.0, &infeas, &nbndchgs) );
+   SCIP_CALL( SCIPaddVarVub(scip, x_2, z_2, 5.0, 0.0, &infeas, &nbndchgs) );
+
+   /* detect by convex handler */
+   enforcing = SCIP_CONSEXPR_EXPRENFO_NONE;
+   participating = SCIP_CONSEXPR_EXPRENFO_NONE;
+   SCIP_CALL( nlhdlr_conv->detect(scip, conshdlr, nlhdlr_conv, expr, cons, &enforcing, &participating, &nlhdlrexprdata_conv) );
+   cr_assert_eq(enforcing, SCIP_CONSEXPR_EXPRENFO_SEPABELOW);
+   cr_assert_not_null(nlhdlrexprdata_conv);
+
+   /* the perspective handler comes first, so that the position of the convex handler is not 0 */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &expr->enfos, 2) );
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, &expr->enfos[0]) );
+   SCIP_CALL( SCIPallocClearBlockMemory(scip, &expr->enfos[1]) );
+   expr->nenfos = 2;
+   expr->enfos[0]->nlhdlr = nlhdlr;
+   expr->enfos[1]->nlhdlr = nlhdlr_conv;
+   expr->enfos[1]->nlhdlrexprdata = nlhdlrexprdata_conv;
+   expr->enfos[1]->nlhdlrparticipation = participating;
+
+   /* detect by perspective handler */
+   participating = SCIP_CONSEXPR_EXPRENFO_NONE;
+   SCIP_CALL( nlhdlrDetectPerspective(scip, conshdlr, nlhdlr, expr, cons, &enforcing, &participating, &nlhdlrexprdata) );
+   cr_assert_not_null(nlhdlrexprdata);
+   cr_assert_eq(nlhdlrexprdata->nindicators, 2);
+   expr->enfos[0]->nlhdlrexprdata = nlhdlrexprdata;
+   expr->enfos[0]->nlhdlrparticipation = participating;
+
+   SCIP_CALL( nlhdlrInitSepaPerspective(scip, conshdlr, cons, nlhdlr, expr, nlhdlrexprdata, TRUE, TRUE, &infeas) );
+   cr_assert_eq(nlhdlrexprdata->indicators[0], z_1);
+
+   SCIP_CALL( SCIPcreateVarBasic(scip, &expr->auxvar, "auxvar", -SCIPinfinity(scip), SCIPinfinity(scip), 0.0, SCIP_VARTYPE_CONTINUOUS) );
+   auxvar = expr->auxvar;
+
+   SCIP_CALL( nlhdlr_conv->initsepa(scip, conshdlr, cons, nlhdlr_conv, expr, nlhdlrexprdata_conv, FALSE, TRUE, &infeas) );
+   SCIP_CALL( SCIPclearCuts(scip) );
+
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x_1, 0.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sol, x_2, 4.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sol, z_1, 0.5) );
+   SCIP_CALL( SCIPsetSolVal(scip, sol, z_2, 0.5) );
+   SCIP_CALL( SCIPsetSolVal(scip, sol, auxvar, 10) );
+
+   SCIP_CALL( SCIPevalauxConsExprNlhdlr(scip, nlhdlr, expr, nlhdlrexprdata, &(expr->enfos[0]->auxvalue), sol) );
+   cr_expect_eq(expr->enfos[0]->auxvalue, 16.0);
+
+   SCIP_CALL( collectEnfoNlhdlrs(scip, conshdlr, nlhdlr, expr, sol, FALSE, FALSE, TRUE, enfoposs, &nenfos, &doprobing) );
+   cr_assert_eq(nenfos, 1);
+   cr_assert_eq(enfoposs[0], 1);
+
+   SCIP_CALL( SCIPcreatePtrarray(scip, &rowpreps2) );
+   SCIP_CALL( SCIPcreatePtrarray(scip, &rowpreps) );
+   SCIP_CALL( SCIPcreatePtrarray(scip, &batchrowpreps) );
+   SCIP_CALL( SCIPcreateBoolarray(scip, &brscores) );
+   SCIP_CALL( SCIPcreateBoolarray(scip, &batchbrscores) );
+
+   /* probe z_1 for expr alone */
+   probingvars = NULL;
+   probingdoms = NULL;
+   nprobingvars = 0;
+   doprobing = TRUE;
+   result = SCIP_DIDNOTFIND;
+   SCIP_CALL( analyseOnoffBounds(scip, nlhdlrdata, nlhdlrexprdata, z_1, &probingvars, &probingdoms, &nprobingvars,
+         &doprobing, &result) );
+
+   solcopy = sol;
+   SCIP_CALL( startProbing(scip, nlhdlrdata, nlhdlrexprdata, z_1, probingvars, probingdoms, nprobingvars,
+         nlhdlrexprdata->vars, nlhdlrexprdata->nvars, sol, &solcopy, &cutoff) );
+   cr_assert_not(cutoff);
+   nrowpreps = 0;
+   SCIP_CALL( estimatePerspective(scip, conshdlr, nlhdlr, expr, nlhdlrexprdata, 0, solcopy, enfoposs, nenfos, FALSE,
+         FALSE, rowpreps2, rowpreps, brscores, &nrowpreps) );
+   SCIP_CALL( SCIPendProbing(scip) );
+   cr_assert_gt(nrowpreps, 0);
+
+   /* the auxiliary value at the adjusted reference point belongs to the convex handler, not to the perspective handler */
+   cr_expect_eq(expr->enfos[0]->auxvalue, 16.0);
+
+   /* probe z_1 in batched mode */
+   SCIP_CALL( updateBatchData(scip, nlhdlrexprdata, FALSE) );
+   nbatchrowpreps = 0;
+   SCIP_CALL( probeIndicatorBatch(scip, conshdlr, nlhdlr, expr, nlhdlrexprdata, 0, sol, enfoposs, nenfos, FALSE, FALSE,
+         FALSE, probingvars, probingdoms, nprobingvars, rowpreps2, batchrowpreps, batchbrscores, &nbatchrowpreps,
+         &indfixed, &result) );
+   cr_assert_not(indfixed);
+   cr_expect_eq(expr->enfos[0]->auxvalue, 16.0);
+
+   /* compare the cuts */
+   cr_assert_eq(nbatchrowpreps, nrowpreps, "Expected %d cuts in batched probing, got %d", nrowpreps, nbatchrowpreps);
+   for( r = 0; r < nrowpreps; ++r )
+   {
+      SCIP_ROWPREP* rowprep;
+      SCIP_ROWPREP* batchrowprep;
+
+      rowprep = (SCIP_ROWPREP*) SCIPgetPtrarrayVal(scip, rowpreps, r);
+      batchrowprep = (SCIP_ROWPREP*) SCIPgetPtrarrayVal(scip, batchrowpreps, r);
+
+      cr_assert_eq(batchrowprep->nvars, rowprep->nvars);
+      cr_expect_eq(batchrowprep->sidetype, rowprep->sidetype);
+      cr_expect(SCIPisEQ(scip, batchrowprep->side, rowprep->side));
+
+      for( v = 0; v < rowprep->nvars; ++v )
+      {
+         for( w = 0; w < batchrowprep->nvars && batchrowprep->vars[w] != rowprep->vars[v]; ++w )
+            ;
+         cr_assert_lt(w, batchrowprep->nvars, "variable %s must be in the batched cut", SCIPvarGetName(rowprep->vars[v]));
+         cr_expect(SCIPisEQ(scip, batchrowprep->coefs[w], rowprep->coefs[v]));
+      }
+
+      SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &rowprep) );
+      SCIP_CALL( SCIPreleaseRowprepToPool(scip, SCIPgetConsExprRowprepPool(conshdlr), &batchrowprep) );
+   }
+
+   /* free memory */
+   SCIPfreeBufferArrayNull(scip, &probingdoms);
+   SCIPfreeBufferArrayNull(scip, &probingvars);
+   SCIP_CALL( SCIPfreeBoolarray(scip, &batchbrscores) );
+   SCIP_CALL( SCIPfreeBoolarray(scip, &brscores) );
+   SCIP_CALL( SCIPfreePtrarray(scip, &batchrowpreps) );
+   SCIP_CALL( SCIPfreePtrarray(scip, &rowpreps) );
+   SCIP_CALL( SCIPfreePtrarray(scip, &rowpreps2) );
+   if( solcopy != sol )
+   {
+      SCIP_CALL( SCIPfreeSol(scip, &solcopy) );
+   }
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+
+   SCIP_CALL( freeNlhdlrExprData(scip, nlhdlrexprdata) );
+   SCIPfreeBlockMemory(scip, &nlhdlrexprdata);
+   expr->enfos[0]->nlhdlrexprdata = NULL;
+   SCIP_CALL( SCIPreleaseVar(scip, &expr->auxvar) );
+
+   SCIP_CALL( SCIPaddConsLocks(scip, cons, -1, 0) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+}
+
+/* tests that two expressions sharing an indicator do not reuse the probing cache entry of each other */
+Test(nlhdlrperspective, probingcacheshared, .init = setup, .fini = teardown)
+{
+   SCIP_CONSEXPR_NLHDLRDATA* nlhdlrdata;
+   SCIP_VAR* varsa[2];
+   SCIP_VAR* varsb[2];
+   SCIP_SOL* sol;
+   SCIP_SOL* solcopy;
+   SCIP_Bool cutoff;
+
+   nlhdlrdata = SCIPgetConsExprNlhdlrData(nlhdlr);
+   nlhdlrdata->probingcache = TRUE;
+   nlhdlrdata->nprobingcachehits = 0;
+
+   /* the variables of two expressions that both have indicator z_1 */
+   varsa[0] = x_1;
+   varsa[1] = x_2;
+   varsb[0] = x_1;
+   varsb[1] = x_3;
+
+   /* pass a solution copy that already exists, such that no expression data is needed to create it */
+   SCIP_CALL( SCIPcreateSol(scip, &sol, NULL) );
+   SCIP_CALL( SCIPcreateSol(scip, &solcopy, NULL) );
+   cr_assert_eq(SCIPgetDepth(scip), 0);
+
+   /* first probing for expression a: nothing is cached yet */
+   SCIP_CALL( startProbing(scip, nlhdlrdata, NULL, z_1, NULL, NULL, 0, varsa, 2, sol, &solcopy, &cutoff) );
+   SCIP_CALL( SCIPendProbing(scip) );
+   cr_assert_not(cutoff);
+   cr_expect_eq(nlhdlrdata->nprobingcachehits, 0);
+   cr_expect_not_null(findProbingCache(scip, nlhdlrdata, z_1, computeDomainSignature(varsa, 2), varsa, 2));
+
+   /* expression b must not use the entry of expression a, although the indicator and the domains are the same */
+   cr_expect_null(findProbingCache(scip, nlhdlrdata, z_1, computeDomainSignature(varsb, 2), varsb, 2));
+   SCIP_CALL( startProbing(scip, nlhdlrdata, NULL, z_1, NULL, NULL, 0, varsb, 2, sol, &solcopy, &cutoff) );
+   SCIP_CALL( SCIPendProbing(scip) );
+   cr_assert_not(cutoff);
+   cr_expect_eq(nlhdlrdata->nprobingcachehits, 0);
+
+   /* b replaced the entry of a, so probing for b again is a hit and probing for a again is not */
+   SCIP_CALL( startProbing(scip, nlhdlrdata, NULL, z_1, NULL, NULL, 0, varsb, 2, sol, &solcopy, &cutoff) );
+   SCIP_CALL( SCIPendProbing(scip) );
+   cr_expect_eq(nlhdlrdata->nprobingcachehits, 1);
+   cr_expect_null(findProbingCache(scip, nlhdlrdata, z_1, computeDomainSignature(varsa, 2), varsa, 2));
+
+   SCIP_CALL( startProbing(scip, nlhdlrdata, NULL, z_1, NULL, NULL, 0, varsa, 2, sol, &solcopy, &cutoff) );
+   SCIP_CALL( SCIPendProbing(scip) );
+   cr_expect_eq(nlhdlrdata->nprobingcachehits, 1);
+
+   /* a changed local domain of a variable of a invalidates its entry */
+   SCIP_CALL( SCIPchgVarUb(scip, x_2, 4.0) );
+   cr_expect_null(findProbingCache(scip, nlhdlrdata, z_1, computeDomainSignature(varsa, 2), varsa, 2));
+
+   freeProbingCaches(scip, nlhdlrdata);
+   SCIP_CALL( SCIPfreeSol(scip, &solcopy) );
+   SCIP_CALL( SCIPfreeSol(scip, &sol) );
+}
+
+/* checks which expressions are recognized for computing perspective tangents in closed form */
+Test(nlhdlrperspective, closedform, .init = setup, .fini = teardown)
+{
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_VAR* var;
+
+   /* x1^2 is convex */
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"<x1>^2", NULL, &expr) );
+   cr_expect(hasClosedFormTangent(conshdlr, expr, FALSE, &var));
+   cr_expect_eq(var, x_1);
+   cr_expect_not(hasClosedFormTangent(conshdlr, expr, TRUE, &var));
+   cr_expect_null(var);
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   /* exp(x2) is convex */
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"exp(<x2>)", NULL, &expr) );
+   cr_expect(hasClosedFormTangent(conshdlr, expr, FALSE, &var));
+   cr_expect_eq(var, x_2);
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   /* x1^0.5 is concave since x1 >= 0 */
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"<x1>^0.5", NULL, &expr) );
+   cr_expect(hasClosedFormTangent(conshdlr, expr, TRUE, &var));
+   cr_expect_not(hasClosedFormTangent(conshdlr, expr, FALSE, &var));
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   /* x2^1.5 is not defined for all values of x2 */
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"<x2>^1.5", NULL, &expr) );
+   cr_expect_not(hasClosedFormTangent(conshdlr, expr, FALSE, &var));
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   /* -x1*log(x1) is concave */
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"entropy(<x1>)", NULL, &expr) );
+   cr_expect(hasClosedFormTangent(conshdlr, expr, TRUE, &var));
+   cr_expect_eq(var, x_1);
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   /* products are not univariate */
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"<x1>*<x2>", NULL, &expr) );
+   cr_expect_not(hasClosedFormTangent(conshdlr, expr, FALSE, &var));
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+}
@@ -262,6 +262,96 @@ Test(nlhdlrquadratic, detectandfree2, .init = setup, .fini = teardown)
    SCIP_CALL( SCIPreleaseCons(scip, &cons) );
 }
 
+/* batch estimation of x^2 + 2 x y + 3 y^2 + w gives the same estimators as estimating at each point separately */
+Test(nlhdlrquadratic, estimatebatch, .init = setup, .fini = teardown)
+{
+   SCIP_CONSEXPR_NLHDLREXPRDATA* nlhdlrexprdata = NULL;
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_CONSEXPR_EXPR* simplified;
+   SCIP_CONSEXPR_EXPRENFO_METHOD enforcing;
+   SCIP_CONSEXPR_EXPRENFO_METHOD participating;
+   SCIP_ROWPREP* batchrowpreps[2];
+   SCIP_PTRARRAY* rowpreps;
+   SCIP_SOL* sols[2];
+   SCIP_Bool changed = FALSE;
+   SCIP_Bool infeasible;
+   SCIP_Bool success;
+   SCIP_Bool addedbranchscores;
+   int k;
+   int i;
+   int j;
+
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"<x>^2 + 2*<x>*<y> + 3*<y>^2 + <w>", NULL, &expr) );
+   SCIP_CALL( SCIPsimplifyConsExprExpr(scip, conshdlr, expr, &simplified, &changed, &infeasible) );
+   cr_expect_not(infeasible);
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+   expr = simplified;
+
+   enforcing = SCIP_CONSEXPR_EXPRENFO_NONE;
+   participating = SCIP_CONSEXPR_EXPRENFO_NONE;
+   SCIP_CALL( nlhdlrDetectQuadratic(scip, conshdlr, nlhdlr, expr, NULL, &enforcing, &participating, &nlhdlrexprdata) );
+   cr_assert_not_null(nlhdlrexprdata);
+
+   /* the quadratic is convex; curvature detection needs Ipopt, so set it here if it could not be detected */
+   nlhdlrexprdata->curvature = SCIP_EXPRCURV_CONVEX;
+
+   SCIP_CALL( SCIPcreateSol(scip, &sols[0], NULL) );
+   SCIP_CALL( SCIPcreateSol(scip, &sols[1], NULL) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[0], x, 1.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[0], y, -2.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[1], x, 0.5) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[1], y, 3.0) );
+   SCIP_CALL( SCIPsetSolVal(scip, sols[1], w, 7.0) );
+
+   SCIP_CALL( nlhdlrEstimateBatchQuadratic(scip, conshdlr, nlhdlr, expr, nlhdlrexprdata, sols, 2, FALSE, NULL,
+         batchrowpreps) );
+
+   SCIP_CALL( SCIPcreatePtrarray(scip, &rowpreps) );
+   for( k = 0; k < 2; ++k )
+   {
+      SCIP_ROWPREP* rowprep;
+
+      SCIP_CALL( nlhdlrEstimateQuadratic(scip, conshdlr, nlhdlr, expr, nlhdlrexprdata, sols[k], 0.0, FALSE,
+            SCIPinfinity(scip), rowpreps, &success, FALSE, &addedbranchscores) );
+      cr_assert(success);
+
+      rowprep = (SCIP_ROWPREP*) SCIPgetPtrarrayVal(scip, rowpreps, 0);
+      cr_assert_not_null(rowprep);
+      cr_assert_not_null(batchrowpreps[k]);
+
+      /* compare estimators */
+      cr_expect_eq(batchrowpreps[k]->nvars, rowprep->nvars);
+      EXPECTFEQ(batchrowpreps[k]->side, rowprep->side);
+      cr_expect_eq(batchrowpreps[k]->local, rowprep->local);
+      for( i = 0; i < rowprep->nvars; ++i )
+      {
+         for( j = 0; j < batchrowpreps[k]->nvars; ++j )
+            if( batchrowpreps[k]->vars[j] == rowprep->vars[i] )
+               break;
+         cr_assert(j < batchrowpreps[k]->nvars, "variable %s missing in batch estimator", SCIPvarGetName(rowprep->vars[i]));
+         EXPECTFEQ(batchrowpreps[k]->coefs[j], rowprep->coefs[i]);
+      }
+
+      SCIPfreeRowprep(scip, &rowprep);
+      SCIPfreeRowprep(scip, &batchrowpreps[k]);
+      SCIP_CALL( SCIPclearPtrarray(scip, rowpreps) );
+   }
+   SCIP_CALL( SCIPfreePtrarray(scip, &rowpreps) );
+
+   SCIP_CALL( SCIPfreeSol(scip, &sols[1]) );
+   SCIP_CALL( SCIPfreeSol(scip, &sols[0]) );
+
+   /* register enforcer info in expr and free */
+   SCIP_CALL( SCIPallocBlockMemoryArray(scip, &(expr->enfos), 1) );
+   SCIP_CALL( SCIPallocBlockMemory(scip, &(expr->enfos[0])) );
+   expr->enfos[0]->nlhdlr = nlhdlr;
+   expr->enfos[0]->nlhdlrexprdata = nlhdlrexprdata;
+   expr->nenfos = 1;
+   expr->enfos[0]->issepainit = FALSE;
+
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+}
+
 /* properly detect quadratic expression in exp(abs(log(x^2 + 2 * x*y + y^2))) <= 1 */
 Test(nlhdlrquadratic, detectandfree3, .init = setup, .fini = teardown)
 {
@@ -356,13 +356,18 @@ Test(nlhdlrquotient, inteval, .description = "tests interval evaluation of simpl
 {
    SCIP_INTERVAL varbnds;
    SCIP_INTERVAL result;
+   SCIP_INTERVAL asymptote;
+
+   /* asymptote a / c of (4x + 1) / (-3x + 3) */
+   SCIPintervalSet(&asymptote, 4.0);
+   SCIPintervalDivScalar(SCIP_INTERVAL_INFINITY, &asymptote, asymptote, -3.0);
 
    /* test interval including 0 in denominator*/
 
    varbnds.inf = 0.0;
    varbnds.sup = 2.0;
 
-   result = intEvalQuotient(scip, varbnds, 4.0, 1.0, -3.0, 3.0, -2.0);
+   result = intEvalQuotientUnivariate(scip, varbnds, 4.0, 1.0, -3.0, 3.0, -2.0, FALSE, asymptote);
 
    cr_expect(SCIPintervalIsEntire(SCIP_INTERVAL_INFINITY, result));
 
@@ -371,7 +376,7 @@ Test(nlhdlrquotient, inteval, .description = "tests interval evaluation of simpl
    varbnds.inf = 2.0;
    varbnds.sup = 9.0;
 
-   result = intEvalQuotient(scip, varbnds, 4.0, 1.0, -3.0, 3.0, -2.0);
+   result = intEvalQuotientUnivariate(scip, varbnds, 4.0, 1.0, -3.0, 3.0, -2.0, FALSE, asymptote);
 
    cr_expect(SCIPisEQ(scip, result.inf, -5.0));
    cr_expect(SCIPisEQ(scip, result.sup, -37.0 / 24.0 - 2.0), "expected %f, but got %f\n",
@@ -382,18 +387,22 @@ Test(nlhdlrquotient, inteval, .description = "tests interval evaluation of simpl
    varbnds.inf = -1.0;
    varbnds.sup = 0.0;
 
-   result = intEvalQuotient(scip, varbnds, 4.0, 1.0, -3.0, 3.0, -2.0);
+   result = intEvalQuotientUnivariate(scip, varbnds, 4.0, 1.0, -3.0, 3.0, -2.0, FALSE, asymptote);
 
    cr_expect(SCIPisEQ(scip, result.inf, -2.5));
    cr_expect(SCIPisEQ(scip, result.sup, 1.0 / 3.0 - 2.0));
 
 
+   /* asymptote a / c of (-4x + 1) / (-3x + 3) */
+   SCIPintervalSet(&asymptote, -4.0);
+   SCIPintervalDivScalar(SCIP_INTERVAL_INFINITY, &asymptote, asymptote, -3.0);
+
    /* test positive denominator part for monotone decreasing expression */
 
    varbnds.inf = 2.0;
    varbnds.sup = 9.0;
 
-   result = intEvalQuotient(scip, varbnds, -4.0, 1.0, -3.0, 3.0, -2.0);
+   result = intEvalQuotientUnivariate(scip, varbnds, -4.0, 1.0, -3.0, 3.0, -2.0, FALSE, asymptote);
 
    cr_expect(SCIPisEQ(scip, result.inf, 35.0 / 24.0 - 2.0));
    cr_expect(SCIPisEQ(scip, result.sup, 7.0 / 3.0 - 2.0));
@@ -403,7 +412,7 @@ Test(nlhdlrquotient, inteval, .description = "tests interval evaluation of simpl
    varbnds.inf = -1.0;
    varbnds.sup = 0.0;
 
-   result = intEvalQuotient(scip, varbnds, -4.0, 1.0, -3.0, 3.0, -2.0);
+   result = intEvalQuotientUnivariate(scip, varbnds, -4.0, 1.0, -3.0, 3.0, -2.0, FALSE, asymptote);
 
    cr_expect(SCIPisEQ(scip, result.inf, 1.0 / 3.0 - 2.0));
    cr_expect(SCIPisEQ(scip, result.sup, 5.0 / 6.0 - 2.0));
@@ -414,27 +423,35 @@ Test(nlhdlrquotient, reverseprop, .description = "tests reverse propagation simp
 {
    SCIP_INTERVAL bnds;
    SCIP_INTERVAL result;
+   SCIP_INTERVAL asymptote;
+
+   /* asymptote a / c of x / (x + 1) */
+   SCIPintervalSet(&asymptote, 1.0);
 
    /* x / (x + 1) in [-3,-1] => x in [-0.75,0.5]*/
    SCIPintervalSetBounds(&bnds, -3.0, -1.0);
-   result = reversepropQuotient(bnds, 1.0, 0.0, 1.0, 1.0, 0.0);
+   result = reversepropQuotientUnivariate(bnds, 1.0, 0.0, 1.0, 1.0, 0.0, FALSE, asymptote);
    cr_expect(SCIPisEQ(scip, result.inf, -0.75));
    cr_expect(SCIPisEQ(scip, result.sup, -0.5));
 
    /* x / (x + 1) in [-2,0.9] => x in [-2/3,9]*/
    SCIPintervalSetBounds(&bnds, -2.0, 0.9);
-   result = reversepropQuotient(bnds, 1.0, 0.0, 1.0, 1.0, 0.0);
+   result = reversepropQuotientUnivariate(bnds, 1.0, 0.0, 1.0, 1.0, 0.0, FALSE, asymptote);
    cr_expect(SCIPisEQ(scip, result.inf, -2.0 / 3.0));
    cr_expect(SCIPisEQ(scip, result.sup, 9.0));
 
+   /* asymptote a / c of (-5x + 2) / (3*x + 3) */
+   SCIPintervalSet(&asymptote, -5.0);
+   SCIPintervalDivScalar(SCIP_INTERVAL_INFINITY, &asymptote, asymptote, 3.0);
+
    /* (-5x + 2) / (3*x + 3) + 6 in [3,5] => x in [-inf,+inf]*/
    SCIPintervalSetBounds(&bnds, 3.0, 5.0);
-   result = reversepropQuotient(bnds, -5.0, 2.0, 3.0, 3.0, 6.0);
+   result = reversepropQuotientUnivariate(bnds, -5.0, 2.0, 3.0, 3.0, 6.0, FALSE, asymptote);
    cr_expect(SCIPintervalIsEntire(SCIP_INTERVAL_INFINITY, result));
 
    /* (-5x + 2) / (3*x + 3) + 6 in [-2,-1] => x in [-23/16,-26/19]*/
    SCIPintervalSetBounds(&bnds, -2.0, -1.0);
-   result = reversepropQuotient(bnds, -5.0, 2.0, 3.0, 3.0, 6.0);
+   result = reversepropQuotientUnivariate(bnds, -5.0, 2.0, 3.0, 3.0, 6.0, FALSE, asymptote);
    cr_expect(SCIPisEQ(scip, result.inf, -23.0/16.0));
    cr_expect(SCIPisEQ(scip, result.sup, -26.0/19.0));
 }
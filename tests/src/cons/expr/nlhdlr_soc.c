@@ -937,6 +937,44 @@ Test(nlhdlrsoc, detectandfree14, .description = "detects complex quadratic const
 
 
 /* disaggregates SQRT( 8 + 2*(x + 1)^2 + 3*(y + sin(x) + 2)^2 ) <= -2*(w - 1) */
+Test(nlhdlrsoc, eigencache, .description = "decomposition of equal matrices is taken from the cache")
+{
+   SCIP_Real matrix[4];
+   SCIP_Real eigvals[2];
+   SCIP_Real eigvecs[4];
+   SCIP_Bool success;
+
+   if( !SCIPisIpoptAvailableIpopt() )
+      return;
+
+   /* x^2 + 4xy + y^2 has eigenvalues -1 and 3 */
+   matrix[0] = 1.0; matrix[1] = 2.0; matrix[2] = 2.0; matrix[3] = 1.0;
+   SCIP_CALL( SCIPcomputeConsExprEigenDecomposition(scip, conshdlr, TRUE, 2, matrix, eigvals, &success) );
+   cr_assert(success);
+   cr_expect(SCIPisEQ(scip, eigvals[0], -1.0));
+   cr_expect(SCIPisEQ(scip, eigvals[1], 3.0));
+   BMScopyMemoryArray(eigvecs, matrix, 4);
+   cr_expect_eq(SCIPhashtableGetNElements(SCIPconshdlrGetData(conshdlr)->eigencache), 1);
+
+   /* the same matrix again: result comes from the cache */
+   matrix[0] = 1.0; matrix[1] = 2.0; matrix[2] = 2.0; matrix[3] = 1.0;
+   eigvals[0] = eigvals[1] = 0.0;
+   SCIP_CALL( SCIPcomputeConsExprEigenDecomposition(scip, conshdlr, TRUE, 2, matrix, eigvals, &success) );
+   cr_assert(success);
+   cr_expect(SCIPisEQ(scip, eigvals[0], -1.0));
+   cr_expect(SCIPisEQ(scip, eigvals[1], 3.0));
+   cr_expect(memcmp(eigvecs, matrix, 4 * sizeof(SCIP_Real)) == 0);
+   cr_expect_eq(SCIPhashtableGetNElements(SCIPconshdlrGetData(conshdlr)->eigencache), 1);
+
+   /* a different matrix gets another entry */
+   matrix[0] = 2.0; matrix[1] = 0.0; matrix[2] = 0.0; matrix[3] = 1.0;
+   SCIP_CALL( SCIPcomputeConsExprEigenDecomposition(scip, conshdlr, FALSE, 2, matrix, eigvals, &success) );
+   cr_assert(success);
+   cr_expect(SCIPisEQ(scip, eigvals[0], 1.0));
+   cr_expect(SCIPisEQ(scip, eigvals[1], 2.0));
+   cr_expect_eq(SCIPhashtableGetNElements(SCIPconshdlrGetData(conshdlr)->eigencache), 2);
+}
+
 Test(nlhdlrsoc, disaggregation, .description = "disaggregate soc and check the resulting datastructure")
 {
    SCIP_CONS* cons;
@@ -1025,6 +1063,8 @@ Test(nlhdlrsoc, separation1, .description = "test separation for simple norm exp
    SCIP_VAR* cutvars[3];
    SCIP_VAR* auxvar;
    SCIP_Real cutvals[3];
+   SCIP_Real* auxvals;
+   SCIP_Real* termvals;
    SCIP_Bool infeasible;
    SCIP_Real rhs;
    int i;
@@ -1066,8 +1106,14 @@ Test(nlhdlrsoc, separation1, .description = "test separation for simple norm exp
    SCIPsetSolVal(scip, sol, nlhdlrexprdata->disvars[2], 1.0);
    SCIPsetSolVal(scip, sol, auxvar, 2.0);
 
+   /* evaluate the terms once for all disaggregations */
+   SCIP_CALL( SCIPallocBufferArray(scip, &auxvals, nlhdlrexprdata->nvars) );
+   SCIP_CALL( SCIPallocBufferArray(scip, &termvals, nlhdlrexprdata->nterms) );
+   SCIP_CALL( evalAllTerms(scip, nlhdlrexprdata, sol, auxvals, termvals) );
+
    /* check cut w.r.t. x */
-   SCIP_CALL( generateCutSolDisagg(scip, expr, cons, sol, nlhdlrexprdata, 0, 0.0, 2.0, &cut) );
+   SCIP_CALL( generateCutSolDisaggVals(scip, expr, cons, sol, nlhdlrexprdata, 0, 0.0, auxvals, termvals[0], 2.0,
+         SCIPgetSolVal(scip, sol, nlhdlrexprdata->disvars[0]), &cut) );
 
    cutvars[0] = nlhdlrexprdata->disvars[0];
    cutvars[1] = x;
@@ -1081,7 +1127,8 @@ Test(nlhdlrsoc, separation1, .description = "test separation for simple norm exp
    SCIPreleaseRow(scip, &cut);
 
    /* check cut w.r.t. y */
-   SCIP_CALL( generateCutSolDisagg(scip, expr, cons, sol, nlhdlrexprdata, 1, 0.0, 2.0, &cut) );
+   SCIP_CALL( generateCutSolDisaggVals(scip, expr, cons, sol, nlhdlrexprdata, 1, 0.0, auxvals, termvals[1], 2.0,
+         SCIPgetSolVal(scip, sol, nlhdlrexprdata->disvars[1]), &cut) );
 
    cutvars[0] = auxvar;
    cutvars[1] = y;
@@ -1095,7 +1142,8 @@ Test(nlhdlrsoc, separation1, .description = "test separation for simple norm exp
    SCIPreleaseRow(scip, &cut);
 
    /* check cut w.r.t. z */
-   SCIP_CALL( generateCutSolDisagg(scip, expr, cons, sol, nlhdlrexprdata, 2, 0.0, 2.0, &cut) );
+   SCIP_CALL( generateCutSolDisaggVals(scip, expr, cons, sol, nlhdlrexprdata, 2, 0.0, auxvals, termvals[2], 2.0,
+         SCIPgetSolVal(scip, sol, nlhdlrexprdata->disvars[2]), &cut) );
 
    cutvars[0] = auxvar;
    cutvars[1] = z;
@@ -1108,6 +1156,9 @@ Test(nlhdlrsoc, separation1, .description = "test separation for simple norm exp
    checkCut(cut, cutvars, cutvals, rhs, 3);
    SCIPreleaseRow(scip, &cut);
 
+   SCIPfreeBufferArray(scip, &termvals);
+   SCIPfreeBufferArray(scip, &auxvals);
+
    /* free expr and cons */
    SCIPfreeSol(scip, &sol);
 
@@ -117,7 +117,7 @@ SCIP_RETCODE propCons(
       SCIP_CALL( SCIPtightenConsExprExprInterval(scip, conshdlr, expr, conssides, infeasible, &ntightenings) );
    }
 
-   SCIP_CALL( reversePropQueue(scip, conshdlr, infeasible, &ntightenings) );
+   SCIP_CALL( reversePropQueue(scip, conshdlr, FALSE, infeasible, &ntightenings) );
 
    return SCIP_OKAY;
 }
@@ -559,7 +559,7 @@ Test(propagate, complicated_expression)
    cr_expect(SCIPisFeasEQ(scip, rootexpr->propbounds.sup, log(3)));
 
    /* apply reverse propagation */
-   SCIP_CALL( reversePropQueue(scip, conshdlr, &infeasible, &ntightenings) );
+   SCIP_CALL( reversePropQueue(scip, conshdlr, FALSE, &infeasible, &ntightenings) );
    cr_assert_not(infeasible);
 
    SCIP_CALL( SCIPreleaseCons(scip, &cons) );
@@ -805,7 +805,7 @@ Test(propagate, infeas_after_backwardprop)
    cr_assert(SCIPisFeasEQ(scip, expr2->propbounds.sup, 4.0));
 
    /* reverse propagation of cons2 should lead to new bounds on x and y */
-   SCIP_CALL( reversePropQueue(scip, conshdlr, &infeasible, &ntightenings) );
+   SCIP_CALL( reversePropQueue(scip, conshdlr, FALSE, &infeasible, &ntightenings) );
    cr_assert_not(infeasible);
    cr_assert(SCIPisFeasEQ(scip, SCIPvarGetLbLocal(x), 1.5));
    cr_assert(SCIPisFeasEQ(scip, SCIPvarGetUbLocal(x), 2.0));
@@ -961,3 +961,147 @@ ParameterizedTest(const struct expr_results* data, propagate, propConss)
    SCIP_CALL( SCIPreleaseCons(scip, &cons1) );
    SCIP_CALL( SCIPreleaseCons(scip, &cons2) );
 }
+
+/* check that constraints are split into variable-disjoint components and that propagation by components finds the
+ * tightenings in all components
+ */
+Test(propagate, components)
+{
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_CONS* conss[3];
+   SCIP_CONS* sortedconss[3];
+   int compstarts[4];
+   int ncomponents;
+   int nchgbds = 0;
+   SCIP_RESULT result;
+   int i;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/expr/propcomponents", TRUE) );
+
+   SCIP_CALL( SCIPchgVarLb(scip, x, -10.0) ); SCIP_CALL( SCIPchgVarUb(scip, x, 10.0) );
+   SCIP_CALL( SCIPchgVarLb(scip, y, -10.0) ); SCIP_CALL( SCIPchgVarUb(scip, y, 10.0) );
+   SCIP_CALL( SCIPchgVarLb(scip, z, -10.0) ); SCIP_CALL( SCIPchgVarUb(scip, z, 10.0) );
+
+   /* x^2 <= 4 and exp(y) + x <= 1 share x; z^2 <= 9 is independent */
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"<t_z>^2", NULL, &expr) );
+   SCIP_CALL( SCIPcreateConsExprBasic(scip, &conss[0], "c0", expr, -SCIPinfinity(scip), 9.0) );
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"<t_x>^2", NULL, &expr) );
+   SCIP_CALL( SCIPcreateConsExprBasic(scip, &conss[1], "c1", expr, -SCIPinfinity(scip), 4.0) );
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"exp(<t_y>) + <t_x>", NULL, &expr) );
+   SCIP_CALL( SCIPcreateConsExprBasic(scip, &conss[2], "c2", expr, -SCIPinfinity(scip), 1.0) );
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+
+   for( i = 0; i < 3; ++i )
+   {
+      SCIP_CALL( SCIPaddCons(scip, conss[i]) );
+   }
+
+   SCIP_CALL( sortConssByComponent(scip, conss, 3, sortedconss, compstarts, &ncomponents) );
+   cr_assert_eq(ncomponents, 2);
+   cr_expect_eq(compstarts[0], 0);
+   cr_expect_eq(compstarts[2], 3);
+   cr_expect(compstarts[1] == 1 || compstarts[1] == 2);
+
+   /* the component of a single constraint must be c0 */
+   if( compstarts[1] == 1 )
+      cr_expect_eq(sortedconss[0], conss[0]);
+   else
+      cr_expect_eq(sortedconss[2], conss[0]);
+
+   SCIP_CALL( propConss(scip, conshdlr, conss, 3, TRUE, &result, &nchgbds) );
+   cr_expect_eq(result, SCIP_REDUCEDDOM);
+   cr_expect(SCIPisFeasEQ(scip, SCIPvarGetLbLocal(z), -3.0));
+   cr_expect(SCIPisFeasEQ(scip, SCIPvarGetUbLocal(z), 3.0));
+   cr_expect(SCIPisFeasEQ(scip, SCIPvarGetLbLocal(x), -2.0));
+   cr_expect(SCIPisFeasLE(scip, SCIPvarGetUbLocal(x), 1.0));
+   cr_expect(SCIPisFeasLE(scip, SCIPvarGetUbLocal(y), log(3.0)));
+
+   for( i = 0; i < 3; ++i )
+   {
+      SCIP_CALL( SCIPdelCons(scip, conss[i]) );
+      SCIP_CALL( SCIPreleaseCons(scip, &conss[i]) );
+   }
+}
+
+/* check that reverse propagation ordered by priority and limited to one expression per round finds the same bounds,
+ * since the remaining queue is carried over to the next round
+ */
+Test(propagate, revproplimits)
+{
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_CONS* cons;
+   int nchgbds = 0;
+   SCIP_RESULT result;
+
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/expr/revpropprio", TRUE) );
+   SCIP_CALL( SCIPsetIntParam(scip, "constraints/expr/maxrevpropexprs", 1) );
+
+   SCIP_CALL( SCIPchgVarLb(scip, x, -10.0) ); SCIP_CALL( SCIPchgVarUb(scip, x, 10.0) );
+   SCIP_CALL( SCIPchgVarLb(scip, y, -10.0) ); SCIP_CALL( SCIPchgVarUb(scip, y, 10.0) );
+   SCIP_CALL( SCIPchgVarLb(scip, z, -10.0) ); SCIP_CALL( SCIPchgVarUb(scip, z, 10.0) );
+
+   /* reverse propagation has to go through the sum and then through each of the powers */
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"exp(<t_x>^2) + (<t_y> + <t_z>)^2", NULL, &expr) );
+   SCIP_CALL( SCIPcreateConsExprBasic(scip, &cons, "c", expr, -SCIPinfinity(scip), exp(4.0)) );
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+
+   SCIP_CALL( propConss(scip, conshdlr, &cons, 1, TRUE, &result, &nchgbds) );
+   cr_expect_eq(result, SCIP_REDUCEDDOM);
+   cr_expect(SCIPisFeasEQ(scip, SCIPvarGetLbLocal(x), -2.0), "got lb %g", SCIPvarGetLbLocal(x));
+   cr_expect(SCIPisFeasEQ(scip, SCIPvarGetUbLocal(x), 2.0), "got ub %g", SCIPvarGetUbLocal(x));
+   cr_expect_eq(SCIPpqueueNElems(SCIPconshdlrGetData(conshdlr)->reversepropqueue), 0);
+
+   SCIP_CALL( SCIPdelCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+}
+
+/* the activity of an expression is only recomputed if the activity of a descendant has changed */
+Test(propagate, memoactivity)
+{
+   SCIP_CONSEXPR_EXPRHDLR* exphdlr;
+   SCIP_CONSEXPR_EXPR* expr;
+   SCIP_CONS* cons;
+   SCIP_Longint nintevalcalls;
+   SCIP_Bool infeasible;
+   int ntightenings;
+
+   exphdlr = SCIPgetConsExprExprHdlrExponential(conshdlr);
+   cr_assert_not_null(exphdlr);
+
+   SCIP_CALL( SCIPchgVarLb(scip, x, 0.0) ); SCIP_CALL( SCIPchgVarUb(scip, x, 2.0) );
+   SCIP_CALL( SCIPchgVarLb(scip, y, 0.0) ); SCIP_CALL( SCIPchgVarUb(scip, y, 2.0) );
+
+   SCIP_CALL( SCIPparseConsExprExpr(scip, conshdlr, (char*)"exp(<t_x>) + exp(<t_y>)", NULL, &expr) );
+   SCIP_CALL( SCIPcreateConsExprBasic(scip, &cons, "c", expr, -SCIPinfinity(scip), SCIPinfinity(scip)) );
+   SCIP_CALL( SCIPaddCons(scip, cons) );
+
+   SCIP_CALL( forwardPropExpr(scip, conshdlr, expr, FALSE, &infeasible, &ntightenings, NULL) );
+   cr_expect_not(infeasible);
+   cr_expect(CHECK_EXPRINTERVAL(scip, expr, 2.0, 2.0 * exp(2.0)));
+
+   /* only exp(x) needs to be reevaluated after changing the bounds of x */
+   nintevalcalls = exphdlr->nintevalcalls;
+   SCIP_CALL( SCIPchgVarUb(scip, x, 1.0) );
+   SCIP_CALL( forwardPropExpr(scip, conshdlr, expr, FALSE, &infeasible, &ntightenings, NULL) );
+   cr_expect_not(infeasible);
+   cr_expect_eq(exphdlr->nintevalcalls, nintevalcalls + 1);
+   cr_expect(CHECK_EXPRINTERVAL(scip, expr, 2.0, exp(1.0) + exp(2.0)));
+
+   /* without memoization, both exponentials are reevaluated */
+   SCIP_CALL( SCIPsetBoolParam(scip, "constraints/expr/memoactivity", FALSE) );
+   nintevalcalls = exphdlr->nintevalcalls;
+   SCIP_CALL( SCIPchgVarUb(scip, y, 1.0) );
+   SCIP_CALL( forwardPropExpr(scip, conshdlr, expr, FALSE, &infeasible, &ntightenings, NULL) );
+   cr_expect_not(infeasible);
+   cr_expect_eq(exphdlr->nintevalcalls, nintevalcalls + 2);
+   cr_expect(CHECK_EXPRINTERVAL(scip, expr, 2.0, 2.0 * exp(1.0)));
+
+   SCIP_CALL( SCIPreleaseConsExprExpr(scip, &expr) );
+   SCIP_CALL( SCIPdelCons(scip, cons) );
+   SCIP_CALL( SCIPreleaseCons(scip, &cons) );
+}
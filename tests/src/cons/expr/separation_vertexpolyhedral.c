@@ -250,6 +250,70 @@ Test(separation, multilinearseparation)
    cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory is leaking!!");
 }
 
+/* this test needs to create its own data, it doesn't use the fixtures! */
+Test(separation, multilinearwarmstart)
+{
+   SCIP_VERTEXPOLYWARMSTART* warmstart = NULL;
+   SCIP_Real prodcoef = -0.7;
+   SCIP_Real box[] = {-0.2, 0.7, -10.0, 8.0, 1.0, 1.3, 0.09, 2.1};
+   SCIP_Real solval[] = { 0.2, -4.0, 1.1, 0.18};
+   SCIP_Real solval2[] = { 0.5, 6.0, 1.2, 2.0};
+   SCIP_Real facetcoefs[4];
+   SCIP_Real facetcoefsws[4];
+   SCIP_Real facetconstant;
+   SCIP_Real facetconstantws;
+   SCIP_Bool success;
+   int i;
+
+   SCIP_CALL( SCIPcreate(&scip) );
+   SCIP_CALL( SCIPincludeConshdlrExpr(scip) );
+   conshdlr = SCIPfindConshdlr(scip, "expr");
+   assert(conshdlr != NULL);
+
+   /* first call creates the warm start data and has to give the same facet as in multilinearseparation */
+   SCIP_CALL( SCIPcomputeFacetVertexPolyhedralWarmstart(scip, conshdlr, TRUE, prodfunction, &prodcoef, solval, box, 4, SCIPinfinity(scip), &warmstart, &success, facetcoefsws, &facetconstantws) );
+
+   cr_assert(success);
+   cr_assert(warmstart != NULL);
+   cr_expect(warmstart->hasfunvals);
+   cr_expect(warmstart->hasbasis);
+
+   SCIP_Real exact_facet[] = {63.0/100, 63.0/5000, 441.0/1000, 637.0/100, -8883.0/10000};
+   for( i = 0; i < 4; ++i )
+   {
+      cr_expect_float_eq(facetcoefsws[i], exact_facet[i], SCIPfeastol(scip), "coef %d: received %g instead of %g\n", i, facetcoefsws[i], exact_facet[i]);
+   }
+   cr_expect_float_eq(facetconstantws, exact_facet[4], SCIPfeastol(scip), "constant: received %g instead of %g\n", facetconstantws, exact_facet[4]);
+
+   /* second call for another point reuses function values and basis; facet must give the same value in the point as a cold start */
+   SCIP_CALL( SCIPcomputeFacetVertexPolyhedralWarmstart(scip, conshdlr, TRUE, prodfunction, &prodcoef, solval2, box, 4, SCIPinfinity(scip), &warmstart, &success, facetcoefsws, &facetconstantws) );
+   cr_assert(success);
+
+   SCIP_CALL( SCIPcomputeFacetVertexPolyhedral(scip, conshdlr, TRUE, prodfunction, &prodcoef, solval2, box, 4, SCIPinfinity(scip), &success, facetcoefs, &facetconstant) );
+   cr_assert(success);
+
+   for( i = 0; i < 4; ++i )
+   {
+      facetconstant += facetcoefs[i] * solval2[i];
+      facetconstantws += facetcoefsws[i] * solval2[i];
+   }
+   cr_expect_float_eq(facetconstantws, facetconstant, SCIPfeastol(scip), "facet value %g with warm start, %g without\n", facetconstantws, facetconstant);
+
+   /* fixing a variable changes the dimension, which invalidates function values and basis */
+   box[6] = box[7];
+   SCIP_CALL( SCIPcomputeFacetVertexPolyhedralWarmstart(scip, conshdlr, TRUE, prodfunction, &prodcoef, solval, box, 4, SCIPinfinity(scip), &warmstart, &success, facetcoefsws, &facetconstantws) );
+   cr_assert(success);
+   cr_expect_eq(warmstart->nvars, 3);
+
+   SCIPfreeFacetVertexPolyhedralWarmstart(scip, &warmstart);
+   cr_expect(warmstart == NULL);
+
+   SCIP_CALL( consExitExpr(scip, conshdlr, NULL, 0) );  /* to free vp_ data in conshdlr, not called otherwise */
+   SCIP_CALL( SCIPfree(&scip) );
+
+   cr_assert_eq(BMSgetMemoryUsed(), 0, "Memory is leaking!!");
+}
+
 Test(separation, errorfacet)
 {
    /* char const* names[] = {"x", "y", "w"}; */